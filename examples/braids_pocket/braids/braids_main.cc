@@ -35,6 +35,7 @@
 // #include "plugin_interface.h"
 
 #include "pico/multicore.h"
+#include "hardware/sync.h"
 #include "braids_main.h"
 
 // #define PROFILE_RENDER 1
@@ -268,9 +269,14 @@ uint32_t get_from_fifo(void) {
     return data;
 }
 
+volatile bool braids_ready = false;
+
 void braids_main(void) {
     multicore_fifo_drain();
     Init();
+
+    braids_ready = true;
+    __sev();
     while (1) {
 
         const uint32_t data = get_from_fifo();
@@ -1,13 +1,18 @@
 #pragma once
 
+#include <stdbool.h>
+
 #ifdef __cplusplus
 #define EXTERNC extern "C"
 #else
-#define EXTERNC
+#define EXTERNC extern
 #endif
 
 EXTERNC void braids_main(void);
 
+// Set by braids_main() once core1 is initialized and ready for messages
+EXTERNC volatile bool braids_ready;
+
 #define BITS_PER_SAMPLE        12
 #define SAMPLE_BITS_TO_DISCARD (16- BITS_PER_SAMPLE)
 #define MAX_MIDI_VAL (15)
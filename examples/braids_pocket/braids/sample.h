@@ -3,7 +3,7 @@
  */
 #define WAV_DATA_LENGTH 38151 
 
-uint8_t WAV_DATA[] = {
+const uint8_t WAV_DATA[] __attribute__((aligned(4))) = {
     151,151,150,144,152,164,162,146,141,155,157,137,113,118,150,182,
     193,184,164,149,148,153,159,159,152,142,133,128,129,135,141,138,
     128,114,103,100,106,119,138,163,189,211,225,230,224,208,187,162,
@@ -2,9 +2,11 @@
 #include <stdlib.h>
 #include "pico/multicore.h"
 #include "pico/stdlib.h"
+#include "hardware/sync.h"
 
 #include "noise_nugget.h"
 #include "pgb1.h"
+#include "scheduler.h"
 #include "braids/braids_main.h"
 
 /*
@@ -99,13 +101,22 @@ void midi_in_cb(uint32_t msg) {
     send_MIDI(msg);
 }
 
+/* Decode the MIDI input received by DMA, calls midi_in_cb() */
+static void midi_task(void *arg) {
+    (void)arg;
+    midi_poll(NULL, 0);
+}
+
 synth_param selected_param = Timbre;
 uint8_t param_value[PARAM_COUNT] = {6, 0, 6, 0, 0, 0, 6, 10};
 
+bool screen_changed = true;
+
 void incr_param(synth_param id) {
     if (param_value[id] < MAX_MIDI_VAL) {
         param_value[id] += 1;
         send_CC(0, id, param_value[id]);
+        screen_changed = true;
     }
 }
 
@@ -113,27 +124,219 @@ void decr_param(synth_param id) {
     if (param_value[id] > 0) {
         param_value[id] -= 1;
         send_CC(0, id, param_value[id]);
+        screen_changed = true;
     }
 }
 
 #define DEFAULT_BASE_NOTE 48 // C3
 int base_note = DEFAULT_BASE_NOTE;
 
+/* Task periods and budgets in microseconds */
+#define KEYBOARD_TASK_PERIOD 1000   // 1 kHz
+#define KEYBOARD_TASK_BUDGET 200
+#define REPEAT_TASK_PERIOD   100000 // 10 Hz
+#define REPEAT_TASK_BUDGET   200
+#define MIDI_TASK_PERIOD     1000   // 1 kHz
+#define MIDI_TASK_BUDGET     200
+#define SCREEN_TASK_PERIOD   33333  // 30 Hz
+#define SCREEN_TASK_BUDGET   2000
+
+#define LEDS_FPS 60
+#define OCTAVE_RESET_LED 8
+
+static void keyboard_task(void *arg) {
+    (void)arg;
+    const synth_param prev_param = selected_param;
+    const int prev_base_note = base_note;
+
+    keyboard_scan();
+
+    // D-PAD to select current param
+    if (falling (K_LEFT)) {
+        if (selected_param > 0) {
+            selected_param -= 1;
+        }
+    } else if (raising (K_RIGHT)) {
+        if (selected_param < PARAM_COUNT - 1) {
+            selected_param += 1;
+        }
+    } else if (falling (K_UP)) {
+        if (selected_param > 3) {
+            selected_param -= 4;
+        }
+    } else if (raising (K_DOWN)) {
+        if (selected_param <= 3) {
+            selected_param += 4;
+        }
+    }
+
+    // A and B to change selected param value
+    if (falling(K_A)) {
+        incr_param(selected_param);
+    } else if (falling(K_B)) {
+        decr_param(selected_param);
+    }
+
+    // Shortcuts for Shape
+    if (falling(K_SONG)) {
+        incr_param(Shape);
+    } else if (falling(K_MENU)) {
+        decr_param(Shape);
+    }
+
+    // Octave Up/Down
+    if (falling(K_1)) {
+        if (base_note > 12) {
+            base_note -= 12;
+        }
+    } else if (falling(K_8)) {
+        if (base_note < 108) {
+            base_note += 12;
+        }
+    } else if (falling(K_4)) {
+        base_note = DEFAULT_BASE_NOTE;
+    }
+
+    // Keyboard
+    if (falling(K_9)) {
+        send_note_on (0, base_note + 0, 127);
+    }
+    if (falling(K_2)) {
+        send_note_on (0, base_note + 1, 127);
+    }
+    if (falling(K_10)) {
+        send_note_on (0, base_note + 2, 127);
+    }
+    if (falling(K_3)) {
+        send_note_on (0, base_note + 3, 127);
+    }
+    if (falling(K_11)) {
+        send_note_on (0, base_note + 4, 127);
+    }
+    if (falling(K_12)) {
+        send_note_on (0, base_note + 5, 127);
+    }
+    if (falling(K_5)) {
+        send_note_on (0, base_note + 6, 127);
+    }
+    if (falling(K_13)) {
+        send_note_on (0, base_note + 7, 127);
+    }
+    if (falling(K_6)) {
+        send_note_on (0, base_note + 8, 127);
+    }
+    if (falling(K_14)) {
+        send_note_on (0, base_note + 9, 127);
+    }
+    if (falling(K_7)) {
+        send_note_on (0, base_note + 10, 127);
+    }
+    if (falling(K_15)) {
+        send_note_on (0, base_note + 11, 127);
+    }
+    if (falling(K_16)) {
+        send_note_on (0, base_note + 12, 127);
+    }
+
+    if (base_note != prev_base_note) {
+        // Blink the octave reset key when not on the default octave
+        if (base_note != DEFAULT_BASE_NOTE) {
+            leds_set_blink(OCTAVE_RESET_LED, 250, 250);
+        } else {
+            leds_set_blink(OCTAVE_RESET_LED, 0, 0);
+        }
+    }
+
+    if (selected_param != prev_param || base_note != prev_base_note) {
+        screen_changed = true;
+    }
+}
+
+/* Held shortcut keys change their parameter at a fixed rate */
+static void repeat_task(void *arg) {
+    (void)arg;
+    // Shortcuts for Timbre
+    if (pressed(K_TRACK)) {
+        incr_param(Timbre);
+    } else if (pressed(K_STEP)) {
+        decr_param(Timbre);
+    }
+
+    // Shortcuts for Color
+    if (pressed(K_PLAY)) {
+        incr_param(Color);
+    } else if (pressed(K_REC)) {
+        decr_param(Color);
+    }
+}
+
+static void screen_task(void *arg) {
+    (void)arg;
+    if (!screen_changed) {
+        return;
+    }
+    screen_changed = false;
+
+    screen_clear();
+    screen_print(0, 57, value_name[base_note / 12]);
+
+    switch (selected_param) {
+    case Shape:
+        screen_print(0, 0, shape_name[param_value[selected_param]]);
+        break;
+    default:
+        screen_print(0, 0, param_name[selected_param]);
+        screen_print(70, 0, value_name[param_value[selected_param]]);
+        break;
+    }
+
+    for (int i = 0; i < PARAM_COUNT; i++) {
+        const int x0 = 19 + (i % 4) * 27;
+        const int y0 = -2 + (i < 4 ? 1 : 2) * 27;
+        const int y1 = y0 - param_value[i];
+
+        screen_fill_rect(x0, y1, 8, y0 - y1 + 1, true);
+
+        screen_print(x0 - 1, y0 + 4, param_name_short[i]);
+
+        if (selected_param == i) {
+            const int left  = x0 - 2;
+            const int right = x0 + 9;
+            const int bot   = y0 + 1;
+            const int top   = y0 - 16;
+            screen_draw_hline (left, bot, right - left + 1, true);
+            screen_draw_hline (left, top, right - left + 1, true);
+            screen_draw_vline (left, top, bot - top + 1, true);
+            screen_draw_vline (right, top, bot - top + 1, true);
+        }
+    }
+
+    screen_update();
+}
+
 int main(void) {
     stdio_init_all();
 
     multicore_fifo_drain();
-    sleep_ms(200);
     multicore_reset_core1();
-    sleep_ms(200);
     multicore_launch_core1(braids_main);
+    nn_boot_mark("core1 launched");
 
-    keyboard_init();
-    leds_init();
-    screen_init();
+    /* Audio first: it may retune the system clock that the LEDs PIO and
+     * screen SPI are configured from. */
     if (!nn_audio_init(44100, audio_out_cb, NULL)) {
         printf("PGB-1 audio init failed");
+    } else {
+        const nn_clock_plan *plan = nn_audio_clock_plan();
+        printf("PGB-1 sys clock: %lu Hz, PIO div: %u + %u/256, rate: %lu Hz (%ld ppm), %lu cycles/frame\n",
+               (unsigned long)plan->sys_hz,
+               plan->pio_div_int, plan->pio_div_frac,
+               (unsigned long)plan->actual_rate, (long)plan->error_ppm,
+               (unsigned long)plan->cycles_per_frame);
     }
+    keyboard_init();
+    leds_init();
+    screen_init();
     if (!nn_set_hp_volume(1.0, 1.0)) {
         printf("PGB-1 HP volume failed");
     }
@@ -144,6 +347,12 @@ int main(void) {
     //     printf("PGB-1 line out volume failed");
     // }
 
+    /* Braids Init() runs on core1 in parallel with the setup above */
+    while (!braids_ready) {
+        __wfe();
+    }
+    nn_boot_mark("core1 ready");
+
     /* Set synth parameters */
     for (int i = 0; i < PARAM_COUNT; i++) {
         send_CC(0, i, param_value[i]);
@@ -187,154 +396,22 @@ int main(void) {
     leds_set_color(22, White);
 
     leds_update();
-    for (uint32_t frame = 0; ; frame++) {
-        keyboard_scan();
-
-        // D-PAD to select current param
-        if (falling (K_LEFT)) {
-            if (selected_param > 0) {
-                selected_param -= 1;
-            }
-        } else if (raising (K_RIGHT)) {
-            if (selected_param < PARAM_COUNT - 1) {
-                selected_param += 1;
-            }
-        } else if (falling (K_UP)) {
-            if (selected_param > 3) {
-                selected_param -= 4;
-            }
-        } else if (raising (K_DOWN)) {
-            if (selected_param <= 3) {
-                selected_param += 4;
-            }
-        }
-
-        // A and B to change selected param value
-        if (falling(K_A)) {
-            incr_param(selected_param);
-        } else if (falling(K_B)) {
-            decr_param(selected_param);
-        }
-
-        // Shortcuts for Shape
-        if (falling(K_SONG)) {
-            incr_param(Shape);
-        } else if (falling(K_MENU)) {
-            decr_param(Shape);
-        }
-
-        if (frame % 100 == 0) {
-            // Shortcuts for Timbre
-            if (pressed(K_TRACK)) {
-                incr_param(Timbre);
-            } else if (pressed(K_STEP)) {
-                decr_param(Timbre);
-            }
-
-            // Shortcuts for Color
-            if (pressed(K_PLAY)) {
-                incr_param(Color);
-             } else if (pressed(K_REC)) {
-                 decr_param(Color);
-             }
-        }
-
-
-        // Octave Up/Down
-        if (falling(K_1)) {
-            if (base_note > 12) {
-                base_note -= 12;
-            }
-        } else if (falling(K_8)) {
-            if (base_note < 108) {
-                base_note += 12;
-            }
-        } else if (falling(K_4)) {
-            base_note = DEFAULT_BASE_NOTE;
-        }
-
-        // Keyboard
-        if (falling(K_9)) {
-            send_note_on (0, base_note + 0, 127);
-        }
-        if (falling(K_2)) {
-            send_note_on (0, base_note + 1, 127);
-        }
-        if (falling(K_10)) {
-            send_note_on (0, base_note + 2, 127);
-        }
-        if (falling(K_3)) {
-            send_note_on (0, base_note + 3, 127);
-        }
-        if (falling(K_11)) {
-            send_note_on (0, base_note + 4, 127);
-        }
-        if (falling(K_12)) {
-            send_note_on (0, base_note + 5, 127);
-        }
-        if (falling(K_5)) {
-            send_note_on (0, base_note + 6, 127);
-        }
-        if (falling(K_13)) {
-            send_note_on (0, base_note + 7, 127);
-        }
-        if (falling(K_6)) {
-            send_note_on (0, base_note + 8, 127);
-        }
-        if (falling(K_14)) {
-            send_note_on (0, base_note + 9, 127);
-        }
-        if (falling(K_7)) {
-            send_note_on (0, base_note + 10, 127);
-        }
-        if (falling(K_15)) {
-            send_note_on (0, base_note + 11, 127);
-        }
-        if (falling(K_16)) {
-            send_note_on (0, base_note + 12, 127);
-        }
-
-        /* Update the screen every 300 frames */
-        if (frame % 300 == 0) {
-            screen_clear();
-            screen_print(0, 57, value_name[base_note / 12]);
-
-            switch (selected_param) {
-            case Shape:
-                screen_print(0, 0, shape_name[param_value[selected_param]]);
-                break;
-            default:
-                screen_print(0, 0, param_name[selected_param]);
-                screen_print(70, 0, value_name[param_value[selected_param]]);
-                break;
-            }
-
-            for (int i = 0; i < PARAM_COUNT; i++) {
-                const int x0 = 19 + (i % 4) * 27;
-                const int y0 = -2 + (i < 4 ? 1 : 2) * 27;
-                const int y1 = y0 - param_value[i];
-
-                for (int w = 0; w < 8; w++) {
-                    screen_draw_line (x0 + w, y0, x0 + w, y1, true);
-                }
-
-                screen_print(x0 - 1, y0 + 4, param_name_short[i]);
-
-                if (selected_param == i) {
-                    const int left  = x0 - 2;
-                    const int right = x0 + 9;
-                    const int bot   = y0 + 1;
-                    const int top   = y0 - 16;
-                    screen_draw_line (left, bot, right, bot, true);
-                    screen_draw_line (left, top, right, top, true);
-                    screen_draw_line (left, bot, left, top, true);
-                    screen_draw_line (right, bot, right, top, true);
-                }
-            }
-
-            screen_update();
-        }
-
-        sleep_ms(1);
+    /* From now on the LEDs (blinking) are refreshed by a timer interrupt */
+    if (!leds_animation_start(LEDS_FPS)) {
+        printf("PGB-1 LED animation failed");
     }
+    nn_boot_mark("first frame");
+    nn_boot_print_timeline();
+
+    nn_sched_add_task("keyboard", keyboard_task, NULL,
+                      KEYBOARD_TASK_PERIOD, KEYBOARD_TASK_BUDGET);
+    nn_sched_add_task("midi", midi_task, NULL,
+                      MIDI_TASK_PERIOD, MIDI_TASK_BUDGET);
+    nn_sched_add_task("repeat", repeat_task, NULL,
+                      REPEAT_TASK_PERIOD, REPEAT_TASK_BUDGET);
+    nn_sched_add_task("screen", screen_task, NULL,
+                      SCREEN_TASK_PERIOD, SCREEN_TASK_BUDGET);
+
+    /* Audio is rendered on core1, core0 only runs the UI tasks */
+    nn_sched_run();
 }
@@ -4,9 +4,11 @@
 
 #include "pico/stdlib.h"
 #include "hardware/gpio.h"
-#include "hardware/adc.h"
 #include "noise_nugget.h"
+#include "scheduler.h"
+#include "pots.h"
 #include "midi_utils.h"
+#include "midi_rx.h"
 #include "nugget_midi_synth.h"
 
 #include <iostream>
@@ -177,8 +179,6 @@ VoiceParams v_params = {.amount = MAX_PARAM / 2,
                         .attack = MAX_PARAM / 20,
                         .release = MAX_PARAM / 3};
 
-uint8_t params[4] = {0, 0, 0, 0};
-
 void render_audio(uint32_t *buffer, int len) {
 
     fixdsp::MonoBuffer mono_buffer[POLY_COUNT];
@@ -283,23 +283,12 @@ void control_change(uint8_t chan, uint8_t controller, uint8_t value) {
 
 extern "C" {
 
-uint8_t read_adc(uint id) {
-    adc_select_input(id);
-    const float conversion_factor = 3.3f / (1 << 12);
-    const uint16_t result = adc_read();
-    const uint16_t cc = result >> 5;
-    //printf("Raw value: 0x%03x, voltage: %f V\n", result, result * conversion_factor);
-    //printf("%d, ", cc);
-    return cc;
-}
-
 #define MIDI_UART uart0
-#define MIDI_IRQ UART0_IRQ
 #define MIDI_OUT_PIN 12
 #define MIDI_IN_PIN 13
 #define MIDI_GPIO_FUNC GPIO_FUNC_UART
 
-static midi_decoder demo_midi_decoder;
+static midi_rx demo_midi_rx;
 
 enum Buttons {
     BTN_VOL_UP, BTN_VOL_DOWN,
@@ -317,18 +306,6 @@ float speaker_volume = 0.0;
 #define POLY_SWITCH_PIN 4
 #define ENV_HOLD_SWITCH_PIN 5
 
-void demo_on_uart_rx() {
-    while (uart_is_readable(MIDI_UART)) {
-        uint8_t ch = uart_getc(MIDI_UART);
-        printf("MIDI CHAR: 0x%x\n", ch);
-        uint32_t msg = midi_decoder_push(&demo_midi_decoder, ch);
-        if (msg != 0) {
-            printf("MIDI MSG: 0x%x\n", msg);
-            nn_ms_send_MIDI(msg);
-        }
-    }
-}
-
 void demo_midi_init(void) {
 
     uart_init(MIDI_UART, 31250);
@@ -337,11 +314,86 @@ void demo_midi_init(void) {
     uart_set_format(MIDI_UART, 8, 1, UART_PARITY_NONE);
     uart_set_fifo_enabled(MIDI_UART, true);
 
-    irq_set_exclusive_handler(MIDI_IRQ, demo_on_uart_rx);
-    irq_set_enabled(MIDI_IRQ, true);
-    uart_set_irq_enables(MIDI_UART, true, false);
+    // Received by DMA, decoded in midi_task()
+    if (!midi_rx_init(&demo_midi_rx, MIDI_UART)) {
+        printf("MIDI init failed\n");
+    }
+}
+
+static void midi_task(void *arg) {
+    (void)arg;
+    midi_event events[16];
+    uint32_t count;
 
-    midi_decoder_init(&demo_midi_decoder);
+    do {
+        count = midi_rx_poll(&demo_midi_rx, events, 16);
+        for (uint32_t i = 0; i < count; i++) {
+            printf("MIDI MSG: 0x%x\n", events[i].msg);
+            nn_ms_send_MIDI(events[i].msg);
+        }
+    } while (count == 16);
+}
+
+static void adc_task(void *arg) {
+    (void)arg;
+    nn_pot_event ev;
+
+    nn_pots_poll();
+
+    // Only filtered changes beyond the hysteresis are sent to core1
+    while (nn_pots_get_event(&ev)) {
+        nn_ms_send_CC(0, ev.channel + 1, ev.value);
+    }
+}
+
+static void buttons_task(void *arg) {
+    (void)arg;
+    poly_on = gpio_get(POLY_SWITCH_PIN);
+    env_hold = gpio_get(ENV_HOLD_SWITCH_PIN);
+
+    for (uint i = 0; i < BTN_COUNT; i++) {
+        const bool new_state = gpio_get(btn_pin[i]);
+
+        if (!new_state && btn_last_state[i]) {
+            printf("%d pressed\n", i);
+            switch (i)
+            {
+            case BTN_VOL_UP:
+                if (speaker_volume <= 0.9) {
+                    speaker_volume += 0.1;
+                }
+                printf("Speaker volume: %f\n", speaker_volume);
+                nn_set_line_out_volume(speaker_volume, 0.0, 0.0, speaker_volume);
+                break;
+
+            case BTN_VOL_DOWN:
+                if (speaker_volume > 0.1) {
+                    speaker_volume -= 0.1;
+                }
+                printf("Speaker volume: %f\n", speaker_volume);
+                nn_set_line_out_volume(speaker_volume, 0.0, 0.0, speaker_volume);
+                break;
+
+            case BTN_ENG_UP:
+                if (engine < LAST_VOICE_ENGINE - 1) {
+                    engine = (enum VoiceEngine)((int)engine + 1);
+                }
+                printf("Next engine: %d\n", engine);
+                break;
+
+            case BTN_ENG_DOWN:
+                if (engine > 0) {
+                    engine = (enum VoiceEngine)((int)engine - 1);
+                }
+                printf("Prev engine: %d\n", engine);
+                break;
+
+            default:
+                break;
+            }
+        }
+        btn_last_state[i] = new_state;
+    }
 }
 
 int main(void)
@@ -349,15 +401,10 @@ int main(void)
     stdio_init_all();
     printf("Noise Nugget 2040 FixDSP example\n");
 
-    adc_init();
-
-    // Make sure GPIO is high-impedance, no pullups etc
-    adc_gpio_init(26);
-    adc_gpio_init(27);
-    adc_gpio_init(28);
-    adc_gpio_init(29);
-
-    demo_midi_init();
+    // Free running ADC on the 4 inputs (GPIO 26 to 29)
+    if (!nn_pots_init(0xF)) {
+        printf("Pots init failed");
+    }
 
     for (uint i = 0; i < BTN_COUNT; i++) {
         gpio_init(btn_pin[i]);
@@ -376,6 +423,9 @@ int main(void)
     nn_ms_start(FIXDSP_SAMPLE_RATE,
                render_audio, note_on, note_off, control_change);
 
+    // After nn_ms_start() as the UART baud rate depends on the clock plan
+    demo_midi_init();
+
     if (!nn_set_hp_volume(0.7, 0.7)) {
         printf("HP volume failed");
     }
@@ -383,66 +433,12 @@ int main(void)
     nn_enable_speakers(true, true, 0);
     nn_set_line_out_volume(0.0, 0.0, 0.0, 0.0);
 
-    //send_note_on(0, 44, 127);
-    while (1) {
-        for (uint i = 0; i < 4; i++) {
-            const uint8_t new_value = read_adc(i);
-            if (new_value != params[i]) {
-                params[i] = new_value;
-                nn_ms_send_CC(0, i + 1, new_value);
-            }
-        }
-
-        poly_on = gpio_get(POLY_SWITCH_PIN);
-        env_hold = gpio_get(ENV_HOLD_SWITCH_PIN);
-
-        for (uint i = 0; i < BTN_COUNT; i++) {
-            const bool new_state = gpio_get(btn_pin[i]);
-
-            if (!new_state && btn_last_state[i]) {
-                printf("%d pressed\n", i);
-                switch (i)
-                {
-                case BTN_VOL_UP:
-                    if (speaker_volume <= 0.9) {
-                        speaker_volume += 0.1;
-                    }
-                    printf("Speaker volume: %f\n", speaker_volume);
-                    nn_set_line_out_volume(speaker_volume, 0.0, 0.0, speaker_volume);
-                    break;
-
-                case BTN_VOL_DOWN:
-                    if (speaker_volume > 0.1) {
-                        speaker_volume -= 0.1;
-                    }
-                    printf("Speaker volume: %f\n", speaker_volume);
-                    nn_set_line_out_volume(speaker_volume, 0.0, 0.0, speaker_volume);
-                    break;
-
-                case BTN_ENG_UP:
-                    if (engine < LAST_VOICE_ENGINE - 1) {
-                        engine = (enum VoiceEngine)((int)engine + 1);
-                    }
-                    printf("Next engine: %d\n", engine);
-                    break;
-
-                case BTN_ENG_DOWN:
-                    if (engine > 0) {
-                        engine = (enum VoiceEngine)((int)engine - 1);
-                    }
-                    printf("Prev engine: %d\n", engine);
-                    break;
-
-                default:
-                    break;
-                }
-            }
-            btn_last_state[i] = new_state;
-        }
-
-        sleep_ms(10);
-    }
+    nn_sched_add_task("midi", midi_task, NULL, 1000, 200);       // 1 kHz
+    nn_sched_add_task("adc", adc_task, NULL, 5000, 500);        // 200 Hz
+    nn_sched_add_task("buttons", buttons_task, NULL, 10000, 200); // 100 Hz
 
+    // Audio is rendered on core1, core0 only runs the control tasks
+    nn_sched_run();
 }
 
 }
\ No newline at end of file
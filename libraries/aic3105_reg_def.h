@@ -145,3 +145,14 @@
 #define PASSIVE_BYPASS 108
 //  DAC Quiescent Current Adjustment Register
 #define DAC_ICC_ADJ 109
+
+//  Page 1 registers
+
+//  Left DAC digital effects filter coefficients (N0 MSB to D5 LSB)
+#define AIC3X_P1_LEFT_EFFECTS_N0_MSB 1
+//  Left DAC de-emphasis filter coefficients (N0 MSB to D1 LSB)
+#define AIC3X_P1_LEFT_DEEMPH_N0_MSB 21
+//  Right DAC digital effects filter coefficients (N0 MSB to D5 LSB)
+#define AIC3X_P1_RIGHT_EFFECTS_N0_MSB 27
+//  Right DAC de-emphasis filter coefficients (N0 MSB to D1 LSB)
+#define AIC3X_P1_RIGHT_DEEMPH_N0_MSB 47
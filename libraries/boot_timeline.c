@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Boot timeline of noise_nugget.h, shared by the device and host builds
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "noise_nugget.h"
+
+#define BOOT_MARK_MAX 16
+
+typedef struct boot_mark {
+    const char *phase;
+    uint32_t time_us;
+} boot_mark;
+
+static boot_mark g_boot_marks[BOOT_MARK_MAX];
+static int g_boot_mark_count = 0;
+
+void nn_boot_mark(const char *phase) {
+    if (g_boot_mark_count < BOOT_MARK_MAX) {
+        g_boot_marks[g_boot_mark_count].phase = phase;
+        g_boot_marks[g_boot_mark_count].time_us = time_us_32();
+        g_boot_mark_count++;
+    }
+}
+
+void nn_boot_print_timeline(void) {
+    uint32_t prev = 0;
+
+    printf("Boot timeline:\n");
+    for (int i = 0; i < g_boot_mark_count; i++) {
+        const uint32_t t = g_boot_marks[i].time_us;
+        printf("%8lu us (+%7lu us) %s\n",
+               (unsigned long)t, (unsigned long)(t - prev),
+               g_boot_marks[i].phase);
+        prev = t;
+    }
+}
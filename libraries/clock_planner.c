@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "clock_planner.h"
+
+#define PLL_VCO_MIN_HZ 750000000u
+#define PLL_VCO_MAX_HZ 1600000000u
+#define PLL_FBDIV_MIN 16
+#define PLL_FBDIV_MAX 320
+#define PLL_POSTDIV_MAX 7
+
+#define PIO_DIV_INT_MAX 65535
+
+void nn_clock_constraints_init(nn_clock_constraints *c, uint32_t max_sys_hz) {
+    c->xosc_hz = 12000000;
+    c->min_sys_hz = 125000000;
+    c->max_sys_hz = max_sys_hz;
+    c->max_error_ppm = 100;
+}
+
+/* Fill the PIO divider and rate fields of the plan from plan->sys_hz.
+ * Returns false if the divider is out of the PIO range. */
+static bool compute_divider(uint32_t sample_rate, nn_clock_plan *plan) {
+    const uint64_t pio_hz = (uint64_t)sample_rate * NN_I2S_PIO_CYCLES_PER_FRAME;
+
+    if (pio_hz == 0) {
+        return false;
+    }
+
+    /* Divider in 16.8 fixed point, rounded to nearest */
+    const uint64_t div = ((uint64_t)plan->sys_hz * 256 + pio_hz / 2) / pio_hz;
+
+    if (div < 256 || (div >> 8) > PIO_DIV_INT_MAX) {
+        return false;
+    }
+
+    plan->pio_div_int = (uint16_t)(div >> 8);
+    plan->pio_div_frac = (uint8_t)(div & 0xFF);
+
+    /* Actual rate = sys_hz * 256 / (div * cycles_per_frame) */
+    const uint64_t num = (uint64_t)plan->sys_hz * 256;
+    const uint64_t den = div * NN_I2S_PIO_CYCLES_PER_FRAME;
+    plan->actual_rate = (uint32_t)((num + den / 2) / den);
+
+    const int64_t err = (int64_t)(num * 1000000 / den) - (int64_t)sample_rate * 1000000;
+    plan->error_ppm = (int32_t)(err / (int64_t)sample_rate);
+
+    plan->cycles_per_frame = plan->sys_hz / sample_rate;
+    return true;
+}
+
+static uint32_t abs_ppm(int32_t ppm) {
+    return ppm < 0 ? (uint32_t)(-ppm) : (uint32_t)ppm;
+}
+
+/* Return true if candidate a is a better plan than b */
+static bool better_plan(const nn_clock_plan *a, const nn_clock_plan *b) {
+    const bool a_int = a->pio_div_frac == 0;
+    const bool b_int = b->pio_div_frac == 0;
+
+    if (a_int != b_int) {
+        return a_int;
+    }
+    if (a->sys_hz != b->sys_hz) {
+        return a->sys_hz > b->sys_hz;
+    }
+    if (abs_ppm(a->error_ppm) != abs_ppm(b->error_ppm)) {
+        return abs_ppm(a->error_ppm) < abs_ppm(b->error_ppm);
+    }
+    return a->vco_hz > b->vco_hz;
+}
+
+bool nn_clock_plan_for_rate(uint32_t sample_rate,
+                            const nn_clock_constraints *c,
+                            nn_clock_plan *plan) {
+    bool found = false;
+
+    for (uint32_t fbdiv = PLL_FBDIV_MIN; fbdiv <= PLL_FBDIV_MAX; fbdiv++) {
+        const uint64_t vco = (uint64_t)c->xosc_hz * fbdiv;
+
+        if (vco < PLL_VCO_MIN_HZ || vco > PLL_VCO_MAX_HZ) {
+            continue;
+        }
+
+        for (uint32_t pd1 = PLL_POSTDIV_MAX; pd1 >= 1; pd1--) {
+            for (uint32_t pd2 = pd1; pd2 >= 1; pd2--) {
+                const uint32_t post = pd1 * pd2;
+
+                /* Only exact system clocks, so that clock_get_hz() is right */
+                if (vco % post != 0) {
+                    continue;
+                }
+
+                nn_clock_plan candidate;
+                candidate.vco_hz = (uint32_t)vco;
+                candidate.fbdiv = (uint16_t)fbdiv;
+                candidate.post_div1 = (uint8_t)pd1;
+                candidate.post_div2 = (uint8_t)pd2;
+                candidate.sys_hz = (uint32_t)(vco / post);
+
+                if (candidate.sys_hz < c->min_sys_hz ||
+                    candidate.sys_hz > c->max_sys_hz)
+                {
+                    continue;
+                }
+
+                if (!compute_divider(sample_rate, &candidate)) {
+                    continue;
+                }
+
+                if (abs_ppm(candidate.error_ppm) > c->max_error_ppm) {
+                    continue;
+                }
+
+                if (!found || better_plan(&candidate, plan)) {
+                    *plan = candidate;
+                    found = true;
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+bool nn_clock_plan_fixed(uint32_t sample_rate, uint32_t sys_hz,
+                         nn_clock_plan *plan) {
+    plan->vco_hz = 0;
+    plan->fbdiv = 0;
+    plan->post_div1 = 0;
+    plan->post_div2 = 0;
+    plan->sys_hz = sys_hz;
+
+    return compute_divider(sample_rate, plan);
+}
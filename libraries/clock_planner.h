@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file clock_planner.h
+ * @brief System clock planner for the I2S PIO state machine.
+ *
+ * The I2S PIO program runs at (sample_rate * 16 * 2 * 4) Hz. When clk_sys is
+ * not an integer multiple of that frequency, the PIO fractional divider
+ * introduces jitter on BCLK/LRCLK. This planner searches every RP2040 system
+ * PLL configuration for one that gives an integer (or at least accurate) PIO
+ * divider, preferring the highest system clock allowed.
+ *
+ * The planner is pure arithmetic and does not depend on the Pico SDK.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct nn_clock_constraints
+ * @brief Limits used when searching for a system clock configuration.
+ */
+typedef struct nn_clock_constraints {
+    uint32_t xosc_hz;        ///< Crystal oscillator frequency (12 MHz on RP2040 boards).
+    uint32_t min_sys_hz;     ///< Lowest acceptable system clock.
+    uint32_t max_sys_hz;     ///< Highest acceptable system clock (overclock limit).
+    uint32_t max_error_ppm;  ///< Maximum sample rate error in parts per million.
+} nn_clock_constraints;
+
+/**
+ * @struct nn_clock_plan
+ * @brief Result of the clock planner.
+ */
+typedef struct nn_clock_plan {
+    uint32_t vco_hz;         ///< System PLL VCO frequency.
+    uint16_t fbdiv;          ///< System PLL feedback divider.
+    uint8_t  post_div1;      ///< System PLL first post divider.
+    uint8_t  post_div2;      ///< System PLL second post divider.
+    uint32_t sys_hz;         ///< Resulting system clock.
+    uint16_t pio_div_int;    ///< Integer part of the I2S PIO clock divider.
+    uint8_t  pio_div_frac;   ///< Fractional part (1/256) of the PIO divider.
+    uint32_t actual_rate;    ///< Sample rate actually produced (rounded).
+    int32_t  error_ppm;      ///< Sample rate error in parts per million.
+    uint32_t cycles_per_frame; ///< CPU cycles available per stereo frame, per core.
+} nn_clock_plan;
+
+/**
+ * @brief Number of PIO clock cycles per stereo frame of the I2S program.
+ */
+#define NN_I2S_PIO_CYCLES_PER_FRAME (16 * 2 * 4)
+
+/**
+ * @brief Initializes constraints with the default RP2040 values.
+ *
+ * @param c Constraints to initialize
+ * @param max_sys_hz Highest acceptable system clock
+ */
+void nn_clock_constraints_init(nn_clock_constraints *c, uint32_t max_sys_hz);
+
+/**
+ * @brief Finds the best system clock for a given sample rate.
+ *
+ * @details Candidates are all the system PLL configurations within the
+ * RP2040 limits (VCO 750-1600 MHz, FBDIV 16-320, post dividers 1-7) whose
+ * output is within the constraints. An integer PIO divider always wins over a
+ * fractional one, then the highest system clock, then the smallest sample
+ * rate error, then the highest VCO frequency (lowest PLL jitter).
+ *
+ * @param sample_rate The audio sample rate
+ * @param c Search constraints
+ * @param plan Output plan, only valid when true is returned
+ *
+ * @return Returns true if a configuration was found, false otherwise.
+ */
+bool nn_clock_plan_for_rate(uint32_t sample_rate,
+                            const nn_clock_constraints *c,
+                            nn_clock_plan *plan);
+
+/**
+ * @brief Computes the PIO divider for a fixed system clock.
+ *
+ * @details This is the fallback used when the system clock cannot be changed.
+ * The PLL fields of the plan are set to zero.
+ *
+ * @param sample_rate The audio sample rate
+ * @param sys_hz The current system clock
+ * @param plan Output plan
+ *
+ * @return Returns true if the divider is within the PIO range, false otherwise.
+ */
+bool nn_clock_plan_fixed(uint32_t sample_rate, uint32_t sys_hz,
+                         nn_clock_plan *plan);
+
+#ifdef __cplusplus
+}
+#endif
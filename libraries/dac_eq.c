@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <math.h>
+#include "dac_eq.h"
+
+#define PI_F 3.14159265358979f
+
+// Largest coefficient magnitude in Q15 (1.0 is not representable)
+#define Q15_MAX (32767.0f / 32768.0f)
+
+// Frequency points per biquad when searching the peak gain
+#define PEAK_GRID_POINTS 256
+
+typedef struct biquad {
+    float b0, b1, b2, a1, a2; // Normalized (a0 == 1)
+    float w0;                 // Band frequency (radians per sample)
+} biquad;
+
+static bool design_band(const nn_eq_band *band, uint32_t sample_rate,
+                        biquad *bq) {
+    if (band->type == NN_EQ_FLAT || band->gain_db == 0.0f) {
+        *bq = (biquad){1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+        return true;
+    }
+
+    if (band->freq_hz <= 0.0f || band->freq_hz >= sample_rate / 2.0f ||
+        band->q <= 0.0f)
+    {
+        return false;
+    }
+
+    const float A = powf(10.0f, band->gain_db / 40.0f);
+    const float w0 = 2.0f * PI_F * band->freq_hz / (float)sample_rate;
+    const float cosw = cosf(w0);
+    const float alpha = sinf(w0) / (2.0f * band->q);
+    const float sqA = 2.0f * sqrtf(A) * alpha;
+
+    float b0, b1, b2, a0, a1, a2;
+
+    switch (band->type) {
+    case NN_EQ_LOW_SHELF:
+        b0 = A * ((A + 1) - (A - 1) * cosw + sqA);
+        b1 = 2 * A * ((A - 1) - (A + 1) * cosw);
+        b2 = A * ((A + 1) - (A - 1) * cosw - sqA);
+        a0 = (A + 1) + (A - 1) * cosw + sqA;
+        a1 = -2 * ((A - 1) + (A + 1) * cosw);
+        a2 = (A + 1) + (A - 1) * cosw - sqA;
+        break;
+
+    case NN_EQ_HIGH_SHELF:
+        b0 = A * ((A + 1) + (A - 1) * cosw + sqA);
+        b1 = -2 * A * ((A - 1) + (A + 1) * cosw);
+        b2 = A * ((A + 1) + (A - 1) * cosw - sqA);
+        a0 = (A + 1) - (A - 1) * cosw + sqA;
+        a1 = 2 * ((A - 1) - (A + 1) * cosw);
+        a2 = (A + 1) - (A - 1) * cosw - sqA;
+        break;
+
+    case NN_EQ_PEAK:
+        b0 = 1 + alpha * A;
+        b1 = -2 * cosw;
+        b2 = 1 - alpha * A;
+        a0 = 1 + alpha / A;
+        a1 = -2 * cosw;
+        a2 = 1 - alpha / A;
+        break;
+
+    default:
+        return false;
+    }
+
+    bq->b0 = b0 / a0;
+    bq->b1 = b1 / a0;
+    bq->b2 = b2 / a0;
+    bq->a1 = a1 / a0;
+    bq->a2 = a2 / a0;
+    bq->w0 = w0;
+    return true;
+}
+
+static int16_t to_q15(float v) {
+    const float scaled = roundf(v * 32768.0f);
+
+    if (scaled > 32767.0f) {
+        return 32767;
+    } else if (scaled < -32768.0f) {
+        return -32768;
+    } else {
+        return (int16_t)scaled;
+    }
+}
+
+// Magnitude response of a biquad at w (radians per sample). Written in
+// terms of phi = 4*sin^2(w/2) (RBJ cookbook) so that it does not lose its
+// precision at low frequencies.
+static float magnitude(const biquad *bq, float w) {
+    const float s = sinf(w / 2.0f);
+    const float phi = 4.0f * s * s;
+    const float b = bq->b0 + bq->b1 + bq->b2;
+    const float a = 1.0f + bq->a1 + bq->a2;
+
+    const float num = b * b
+        - (bq->b0 * bq->b1 + 4.0f * bq->b0 * bq->b2 + bq->b1 * bq->b2) * phi
+        + bq->b0 * bq->b2 * phi * phi;
+    const float den = a * a
+        - (bq->a1 + 4.0f * bq->a2 + bq->a1 * bq->a2) * phi
+        + bq->a2 * phi * phi;
+
+    return sqrtf(num / den);
+}
+
+// Peak of the magnitude response, on a log frequency grid from 10Hz to
+// Nyquist plus DC, Nyquist and the band frequency
+static float peak_magnitude(const biquad *bq, uint32_t sample_rate) {
+    const float w_min = 2.0f * PI_F * 10.0f / (float)sample_rate;
+    const float ratio = powf(PI_F / w_min, 1.0f / PEAK_GRID_POINTS);
+
+    float peak = magnitude(bq, 0.0f);
+    float w = w_min;
+
+    for (int i = 0; i <= PEAK_GRID_POINTS; i++) {
+        const float m = magnitude(bq, w < PI_F ? w : PI_F);
+        if (m > peak) peak = m;
+        w *= ratio;
+    }
+
+    const float m = magnitude(bq, bq->w0);
+    return m > peak ? m : peak;
+}
+
+static void quantize_scaled(const biquad *bq, float scale,
+                            int16_t *n0, int16_t *n1, int16_t *n2,
+                            int16_t *d1, int16_t *d2) {
+    // N1 and D1 are multiplied by 2 in the filter
+    *n0 = to_q15(bq->b0 * scale);
+    *n1 = to_q15(bq->b1 * scale / 2.0f);
+    *n2 = to_q15(bq->b2 * scale);
+
+    // Denominator is 32768 - 2*D1*z^-1 - D2*z^-2
+    *d1 = to_q15(-bq->a1 / 2.0f);
+    *d2 = to_q15(-bq->a2);
+}
+
+// Quantize one biquad, returns the numerator scale factor applied
+static float quantize(const biquad *bq, uint32_t sample_rate,
+                      int16_t *n0, int16_t *n1, int16_t *n2,
+                      int16_t *d1, int16_t *d2) {
+    float peak = fabsf(bq->b0);
+    if (fabsf(bq->b1) / 2.0f > peak) peak = fabsf(bq->b1) / 2.0f;
+    if (fabsf(bq->b2) > peak) peak = fabsf(bq->b2);
+
+    float scale = peak > Q15_MAX ? Q15_MAX / peak : 1.0f;
+
+    // Keep the gain of the band at or below 0dB, so that the output of each
+    // biquad fits in the codec datapath
+    const float gain = peak_magnitude(bq, sample_rate);
+    if (gain * scale > 1.0f) {
+        scale = 1.0f / gain;
+    }
+
+    quantize_scaled(bq, scale, n0, n1, n2, d1, d2);
+
+    // The rounding of the coefficients changes the gain of low frequency
+    // bands by a few percent, check the quantized filter
+    for (int i = 0; i < 4; i++) {
+        const biquad q = {*n0 / 32768.0f, *n1 / 16384.0f, *n2 / 32768.0f,
+                          -*d1 / 16384.0f, -*d2 / 32768.0f, bq->w0};
+        const float q_gain = peak_magnitude(&q, sample_rate);
+
+        if (q_gain <= 1.0f) {
+            break;
+        }
+        scale *= 0.999f / q_gain;
+        quantize_scaled(bq, scale, n0, n1, n2, d1, d2);
+    }
+
+    return scale;
+}
+
+bool nn_dac_eq_compute(const nn_eq_band bands[NN_DAC_EQ_BANDS],
+                       uint32_t sample_rate,
+                       nn_dac_eq_coefs *coefs) {
+    biquad first, second;
+
+    if (sample_rate == 0 ||
+        !design_band(&bands[0], sample_rate, &first) ||
+        !design_band(&bands[1], sample_rate, &second))
+    {
+        return false;
+    }
+
+    const float scale_a = quantize(&first, sample_rate,
+                                   &coefs->n0, &coefs->n1, &coefs->n2,
+                                   &coefs->d1, &coefs->d2);
+    const float scale_b = quantize(&second, sample_rate,
+                                   &coefs->n3, &coefs->n4, &coefs->n5,
+                                   &coefs->d4, &coefs->d5);
+
+    coefs->headroom_db = 20.0f * log10f(scale_a * scale_b);
+    return true;
+}
+
+static void put16(uint8_t *regs, int16_t value) {
+    regs[0] = (uint8_t)(((uint16_t)value) >> 8);
+    regs[1] = (uint8_t)(((uint16_t)value) & 0xFF);
+}
+
+void nn_dac_eq_to_regs(const nn_dac_eq_coefs *coefs, uint8_t regs[20]) {
+    put16(&regs[0], coefs->n0);
+    put16(&regs[2], coefs->n1);
+    put16(&regs[4], coefs->n2);
+    put16(&regs[6], coefs->n3);
+    put16(&regs[8], coefs->n4);
+    put16(&regs[10], coefs->n5);
+    put16(&regs[12], coefs->d1);
+    put16(&regs[14], coefs->d2);
+    put16(&regs[16], coefs->d4);
+    put16(&regs[18], coefs->d5);
+}
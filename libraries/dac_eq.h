@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file dac_eq.h
+ * @brief Coefficients conversion for the AIC3105 DAC digital effects filter.
+ *
+ * Each DAC channel of the AIC3105 has a digital effects filter made of two
+ * cascaded biquads:
+ *
+ *          N0 + 2*N1*z^-1 + N2*z^-2     N3 + 2*N4*z^-1 + N5*z^-2
+ *  H(z) = -------------------------- x --------------------------
+ *         32768 - 2*D1*z^-1 - D2*z^-2   32768 - 2*D4*z^-1 - D5*z^-2
+ *
+ * where all the coefficients are 16-bit two's complement values. This file
+ * converts EQ bands (shelves and peaks, in Hz/dB/Q) into these coefficients.
+ *
+ * The conversion is pure arithmetic and does not depend on the Pico SDK.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of EQ bands available per DAC channel (one per biquad).
+ */
+#define NN_DAC_EQ_BANDS 2
+
+/**
+ * @enum nn_eq_type
+ * @brief EQ band filter types.
+ */
+typedef enum nn_eq_type {
+    NN_EQ_FLAT,       ///< Band disabled (unity gain).
+    NN_EQ_LOW_SHELF,  ///< Low shelf, gain applied below freq_hz.
+    NN_EQ_HIGH_SHELF, ///< High shelf, gain applied above freq_hz.
+    NN_EQ_PEAK,       ///< Peak/notch centered on freq_hz.
+} nn_eq_type;
+
+/**
+ * @struct nn_eq_band
+ * @brief Settings of one EQ band.
+ */
+typedef struct nn_eq_band {
+    nn_eq_type type; ///< Filter type.
+    float freq_hz;   ///< Center (peak) or corner (shelves) frequency in Hz.
+    float gain_db;   ///< Gain in dB, positive to boost, negative to cut.
+    float q;         ///< Quality factor (peak bandwidth or shelf slope).
+} nn_eq_band;
+
+/**
+ * @struct nn_dac_eq_coefs
+ * @brief Effects filter coefficients of one DAC channel, in the order of the
+ * page 1 codec registers.
+ */
+typedef struct nn_dac_eq_coefs {
+    int16_t n0, n1, n2, n3, n4, n5; ///< Numerator coefficients.
+    int16_t d1, d2, d4, d5;         ///< Denominator coefficients.
+    float headroom_db;              ///< Attenuation applied to keep the gain at or below 0 dB (<= 0 dB).
+} nn_dac_eq_coefs;
+
+/**
+ * @brief Convert EQ bands into effects filter coefficients.
+ *
+ * @details Uses the RBJ "Audio EQ Cookbook" biquad designs. The numerators of
+ * each band are scaled down so that its peak magnitude response (searched on
+ * a log frequency grid) is at most 0 dB, which also keeps the coefficients
+ * within the Q15 range. A boost therefore never clips: a +6 dB shelf becomes
+ * a -6 dB cut of the rest of the spectrum. The attenuation is reported in
+ * headroom_db.
+ *
+ * @param bands Array of NN_DAC_EQ_BANDS bands
+ * @param sample_rate Sample rate of the DAC
+ * @param coefs Output coefficients
+ *
+ * @return Returns false if a band has invalid settings (frequency not between
+ *         0 and Nyquist, or Q <= 0), true otherwise.
+ */
+bool nn_dac_eq_compute(const nn_eq_band bands[NN_DAC_EQ_BANDS],
+                       uint32_t sample_rate,
+                       nn_dac_eq_coefs *coefs);
+
+/**
+ * @brief Serialize coefficients in codec register order (MSB first).
+ *
+ * @param coefs Coefficients to serialize
+ * @param regs Output buffer for the 20 registers values (N0 MSB/LSB ... D5
+ *             MSB/LSB)
+ */
+void nn_dac_eq_to_regs(const nn_dac_eq_coefs *coefs, uint8_t regs[20]);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,383 @@
+#include "drum-voices.h"
+#include "resources.h"
+
+namespace fixdsp {
+    namespace drum {
+
+        // 205.3, 304.4, 369.6, 522.7, 540 and 800 Hz, relative to the first
+        // one (Q16)
+        static const uint32_t metallic_ratios[6] = {
+            65536, 97172, 117985, 166862, 172379, 255375
+        };
+
+        void MetallicBank::setPitch(int16_t pitch) {
+            const uint64_t base = phase::ComputePhaseIncrement(pitch);
+
+            for (int i = 0; i < 6; i++) {
+                increment_[i] = (base * metallic_ratios[i]) >> 16;
+            }
+        }
+
+        void MetallicBank::render(MonoBuffer &buffer) {
+            auto out = buffer.getWritePointer(0);
+
+            // A block at a time, the phases stay in registers
+            uint32_t p0 = phase_[0], p1 = phase_[1], p2 = phase_[2];
+            uint32_t p3 = phase_[3], p4 = phase_[4], p5 = phase_[5];
+
+            for (size_t i = 0; i < buffer.getBufferLength(); i++) {
+                p0 += increment_[0];
+                p1 += increment_[1];
+                p2 += increment_[2];
+                p3 += increment_[3];
+                p4 += increment_[4];
+                p5 += increment_[5];
+
+                // low is minus the number of squares in their low half
+                const int32_t low =
+                    (static_cast<int32_t>(p0) >> 31) + (static_cast<int32_t>(p1) >> 31) +
+                    (static_cast<int32_t>(p2) >> 31) + (static_cast<int32_t>(p3) >> 31) +
+                    (static_cast<int32_t>(p4) >> 31) + (static_cast<int32_t>(p5) >> 31);
+                out[i] = (6 + 2 * low) * 5461;
+            }
+
+            phase_[0] = p0; phase_[1] = p1; phase_[2] = p2;
+            phase_[3] = p3; phase_[4] = p4; phase_[5] = p5;
+        }
+
+        Snare::Snare() {
+            body_.setPunch(MAX_PARAM / 16);
+            body_.setPunchDecay(4000);
+
+            body_env_.setTimeRange(envelope::S_QUARTER_SECOND);
+            body_env_.setDecay(12000);
+
+            noise_env_.setTimeRange(envelope::S_HALF_SECOND);
+            setDecay(MAX_PARAM / 2);
+
+            noise_filter_.setMode(filter::SVF_MODE_HP);
+            noise_filter_.setCutoff(keyToPitch(84));
+            noise_filter_.setResonance(4000);
+        }
+
+        void Snare::setDecay(int16_t decay) {
+            noise_env_.setDecay(decay);
+        }
+
+        void Snare::setTone(int16_t tone) {
+            if (tone < 0) tone = 0;
+            tone_ = tone;
+        }
+
+        void Snare::setDrive(int16_t drive) {
+            drive_ = drive;
+        }
+
+        void Snare::on(int16_t velocity) {
+            body_.on(key_);
+            body_env_.on(velocity);
+            noise_env_.on(velocity);
+        }
+
+        bool Snare::active() const {
+            return body_env_.active() || noise_env_.active();
+        }
+
+        void Snare::render(MonoBuffer &buffer, const MonoBuffer &noise) {
+            auto out = buffer.getWritePointer(0);
+            auto noise_p = noise.getReadPointer(0);
+            const int32_t noise_level = tone_;
+            const int32_t body_level = MAX_PARAM - tone_;
+
+            noise_filter_.prepare();
+            if (body_env_.active()) {
+                for (size_t i = 0; i < buffer.getBufferLength(); i++) {
+                    const int32_t body =
+                        (Interpolate824(wav_sine.data(), body_.phaseRender()) * body_env_.render()) >> 15;
+                    const int32_t snap =
+                        (noise_filter_.process(noise_p[i] >> 1) * noise_env_.render()) >> 15;
+                    out[i] = (body * body_level + snap * noise_level) >> 15;
+                }
+            } else {
+                // The body is shorter than the noise, only its phase runs
+                // once it is over
+                for (size_t i = 0; i < buffer.getBufferLength(); i++) {
+                    body_.phaseRender();
+                    const int32_t snap =
+                        (noise_filter_.process(noise_p[i] >> 1) * noise_env_.render()) >> 15;
+                    out[i] = (snap * noise_level) >> 15;
+                }
+            }
+            drive(buffer, drive_);
+        }
+
+        HiHat::HiHat() {
+            closed_env_.setTimeRange(envelope::S_QUARTER_SECOND);
+            open_env_.setTimeRange(envelope::S_1_SECONDS);
+            setClosedDecay(16000);
+            setOpenDecay(16000);
+
+            // Clamped to the highest cutoff of the SVF
+            filter_.setMode(filter::SVF_MODE_HP);
+            filter_.setCutoff(keyToPitch(110));
+            filter_.setResonance(8000);
+        }
+
+        void HiHat::setClosedDecay(int16_t decay) {
+            closed_env_.setDecay(decay);
+        }
+
+        void HiHat::setOpenDecay(int16_t decay) {
+            if (decay < 0) decay = 0;
+            open_decay_ = decay;
+            open_env_.setDecay(open_decay_);
+        }
+
+        void HiHat::setTone(int16_t tone) {
+            if (tone < 0) tone = 0;
+            tone_ = tone;
+        }
+
+        void HiHat::setDrive(int16_t drive) {
+            drive_ = drive;
+        }
+
+        void HiHat::closed(int16_t velocity) {
+            // Fast decay of the open hat, restored by the next open()
+            open_env_.setDecay(0);
+            closed_env_.on(velocity);
+        }
+
+        void HiHat::open(int16_t velocity) {
+            open_env_.setDecay(open_decay_);
+            open_env_.on(velocity);
+        }
+
+        bool HiHat::active() const {
+            return closed_env_.active() || open_env_.active();
+        }
+
+        void HiHat::render(MonoBuffer &buffer, const MonoBuffer &noise) {
+            auto out = buffer.getWritePointer(0);
+            auto noise_p = noise.getReadPointer(0);
+            const int32_t noise_level = tone_;
+            const int32_t metal_level = MAX_PARAM - tone_;
+
+            // The bank renders into the output, mixed in place. Half scale
+            // into the filter, for the resonance.
+            metal_.render(buffer);
+            filter_.prepare();
+            for (size_t i = 0; i < buffer.getBufferLength(); i++) {
+                const int32_t mix =
+                    (out[i] * metal_level + noise_p[i] * noise_level) >> 16;
+                const int32_t env = closed_env_.render() + open_env_.render();
+                out[i] = clip((filter_.process(mix) * env) >> 15);
+            }
+            drive(buffer, drive_);
+        }
+
+        Clap::Clap() {
+            burst_env_.setTimeRange(envelope::S_QUARTER_SECOND);
+            burst_env_.setDecay(6000);
+
+            tail_env_.setTimeRange(envelope::S_1_SECONDS);
+            setDecay(MAX_PARAM / 4);
+
+            filter_.setMode(filter::SVF_MODE_BP);
+            filter_.setCutoff(keyToPitch(86));
+            filter_.setResonance(12000);
+        }
+
+        void Clap::setDecay(int16_t decay) {
+            tail_env_.setDecay(decay);
+        }
+
+        void Clap::setDrive(int16_t drive) {
+            drive_ = drive;
+        }
+
+        void Clap::on(int16_t velocity) {
+            velocity_ = velocity;
+            burst_ = 0;
+            burst_pos_ = 0;
+            burst_env_.on(velocity);
+        }
+
+        bool Clap::active() const {
+            return burst_ < kBursts || tail_env_.active();
+        }
+
+        void Clap::render(MonoBuffer &buffer, const MonoBuffer &noise) {
+            auto out = buffer.getWritePointer(0);
+            auto noise_p = noise.getReadPointer(0);
+
+            filter_.prepare();
+
+            // Tail only: no burst bookkeeping
+            if (burst_ >= kBursts) {
+                for (size_t i = 0; i < buffer.getBufferLength(); i++) {
+                    out[i] = (filter_.process(noise_p[i] >> 1) * tail_env_.render()) >> 15;
+                }
+                drive(buffer, drive_);
+                return;
+            }
+
+            for (size_t i = 0; i < buffer.getBufferLength(); i++) {
+                int32_t env;
+
+                // A few short bursts, then the tail
+                if (burst_ < kBursts) {
+                    env = burst_env_.render();
+                    if (++burst_pos_ >= kBurstSpacing) {
+                        burst_pos_ = 0;
+                        if (++burst_ < kBursts) {
+                            burst_env_.on(velocity_);
+                        } else {
+                            tail_env_.on(velocity_);
+                        }
+                    }
+                } else {
+                    env = tail_env_.render();
+                }
+                out[i] = (filter_.process(noise_p[i] >> 1) * env) >> 15;
+            }
+            drive(buffer, drive_);
+        }
+
+        Tom::Tom() {
+            body_.setPunch(MAX_PARAM / 12);
+            body_.setPunchDecay(12000);
+
+            env_.setTimeRange(envelope::S_1_SECONDS);
+            setDecay(MAX_PARAM / 2);
+
+            click_env_.setTimeRange(envelope::S_QUARTER_SECOND);
+            click_env_.setDecay(2000);
+        }
+
+        void Tom::setDecay(int16_t decay) {
+            env_.setDecay(decay);
+        }
+
+        void Tom::setDrive(int16_t drive) {
+            drive_ = drive;
+        }
+
+        void Tom::on(int16_t velocity) {
+            body_.on(key_);
+            env_.on(velocity);
+            click_env_.on(velocity / 8);
+        }
+
+        bool Tom::active() const {
+            return env_.active();
+        }
+
+        void Tom::render(MonoBuffer &buffer, const MonoBuffer &noise) {
+            auto out = buffer.getWritePointer(0);
+            auto noise_p = noise.getReadPointer(0);
+
+            if (click_env_.active()) {
+                for (size_t i = 0; i < buffer.getBufferLength(); i++) {
+                    const int32_t body =
+                        (Interpolate824(wav_sine.data(), body_.phaseRender()) * env_.render()) >> 15;
+                    const int32_t click = (noise_p[i] * click_env_.render()) >> 15;
+                    out[i] = clip(body + click);
+                }
+            } else {
+                for (size_t i = 0; i < buffer.getBufferLength(); i++) {
+                    out[i] =
+                        (Interpolate824(wav_sine.data(), body_.phaseRender()) * env_.render()) >> 15;
+                }
+            }
+            drive(buffer, drive_);
+        }
+
+        // AudioBuffer::clear() does nothing
+        static inline void silence(MonoBuffer &buffer) {
+            buffer.getBufferContainer()[0].fill(0);
+        }
+
+        Kit::Kit() {
+            random_.Seed(0x21);
+
+            toms_[0].setKey(43);
+            toms_[1].setKey(48);
+            toms_[2].setKey(53);
+        }
+
+        void Kit::on(KitVoice voice, int16_t velocity) {
+            switch (voice) {
+            case KIT_KICK:
+                kick_.on(kick_key_, velocity);
+                break;
+            case KIT_SNARE:
+                snare_.on(velocity);
+                break;
+            case KIT_CLOSED_HAT:
+                hi_hat_.closed(velocity);
+                break;
+            case KIT_OPEN_HAT:
+                hi_hat_.open(velocity);
+                break;
+            case KIT_CLAP:
+                clap_.on(velocity);
+                break;
+            case KIT_LOW_TOM:
+            case KIT_MID_TOM:
+            case KIT_HIGH_TOM:
+                toms_[voice - KIT_LOW_TOM].on(velocity);
+                break;
+            default:
+                break;
+            }
+        }
+
+        bool Kit::active() const {
+            return kick_.active() || snare_.active() || hi_hat_.active() ||
+                clap_.active() || toms_[0].active() || toms_[1].active() ||
+                toms_[2].active();
+        }
+
+        void Kit::render(MonoBuffer &buffer) {
+            const bool toms =
+                toms_[0].active() || toms_[1].active() || toms_[2].active();
+
+            if (toms || snare_.active() || hi_hat_.active() || clap_.active()) {
+                random_.render(noise_);
+            }
+
+            // Idle voices are silent, all of them are mixed in one pass
+            if (kick_.active()) {
+                kick_.render(kick_out_);
+            } else {
+                silence(kick_out_);
+            }
+            if (snare_.active()) {
+                snare_.render(snare_out_, noise_);
+            } else {
+                silence(snare_out_);
+            }
+            if (hi_hat_.active()) {
+                hi_hat_.render(hi_hat_out_, noise_);
+            } else {
+                silence(hi_hat_out_);
+            }
+            if (clap_.active()) {
+                clap_.render(clap_out_, noise_);
+            } else {
+                silence(clap_out_);
+            }
+            for (int i = 0; i < 3; i++) {
+                if (toms_[i].active()) {
+                    toms_[i].render(toms_out_[i], noise_);
+                } else {
+                    silence(toms_out_[i]);
+                }
+            }
+
+            addSat(buffer, kick_out_, snare_out_, hi_hat_out_, clap_out_,
+                   toms_out_[0], toms_out_[1], toms_out_[2]);
+        }
+    }
+}
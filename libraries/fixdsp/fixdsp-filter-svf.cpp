@@ -26,13 +26,18 @@ namespace fixdsp {
           mode_ = mode;
         }
 
-        void SVF::process(MonoBuffer &buffer) {
-
+        void SVF::prepare() {
             if (dirty_) {
               f_ = Interpolate824(lut_svf_cutoff, frequency_ << 17);
               damp_ = Interpolate824(lut_svf_damp, resonance_ << 17);
+              feedback_ = (f_ * damp_ >> 15) + (f_ * f_ >> 15);
               dirty_ = false;
             }
+        }
+
+        void SVF::process(MonoBuffer &buffer) {
+
+            prepare();
             int32_t f = f_;
             int32_t damp = damp_;
 
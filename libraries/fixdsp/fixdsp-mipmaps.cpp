@@ -0,0 +1,3976 @@
+// This file is generated by mipmaps_compiler.py, do not edit
+#include "mipmaps.h"
+
+namespace fixdsp {
+    namespace mipmap {
+
+        const MipmapData saw[kLevels] = {
+            // 1 harmonic
+            {{
+                     0,   -109,   -217,   -326,   -435,   -544,   -652,   -761,
+                  -870,   -978,  -1087,  -1195,  -1304,  -1412,  -1521,  -1629,
+                 -1737,  -1845,  -1953,  -2061,  -2169,  -2277,  -2385,  -2493,
+                 -2600,  -2708,  -2815,  -2923,  -3030,  -3137,  -3244,  -3351,
+                 -3457,  -3564,  -3670,  -3777,  -3883,  -3989,  -4095,  -4201,
+                 -4306,  -4412,  -4517,  -4622,  -4727,  -4831,  -4936,  -5040,
+                 -5144,  -5248,  -5352,  -5456,  -5559,  -5662,  -5765,  -5868,
+                 -5970,  -6073,  -6175,  -6277,  -6378,  -6479,  -6581,  -6681,
+                 -6782,  -6882,  -6982,  -7082,  -7182,  -7281,  -7380,  -7479,
+                 -7577,  -7675,  -7773,  -7871,  -7968,  -8065,  -8162,  -8258,
+                 -8354,  -8450,  -8545,  -8640,  -8735,  -8830,  -8924,  -9018,
+                 -9111,  -9204,  -9297,  -9389,  -9481,  -9573,  -9664,  -9755,
+                 -9846,  -9936, -10026, -10115, -10205, -10293, -10382, -10470,
+                -10557, -10644, -10731, -10817, -10903, -10989, -11074, -11159,
+                -11243, -11327, -11410, -11493, -11576, -11658, -11739, -11821,
+                -11901, -11982, -12062, -12141, -12220, -12299, -12377, -12454,
+                -12531, -12608, -12684, -12760, -12835, -12910, -12984, -13058,
+                -13131, -13204, -13276, -13348, -13419, -13490, -13560, -13630,
+                -13699, -13768, -13836, -13904, -13971, -14038, -14104, -14170,
+                -14235, -14299, -14363, -14427, -14489, -14552, -14614, -14675,
+                -14735, -14796, -14855, -14914, -14973, -15031, -15088, -15145,
+                -15201, -15256, -15311, -15366, -15420, -15473, -15526, -15578,
+                -15630, -15681, -15731, -15781, -15830, -15878, -15926, -15974,
+                -16021, -16067, -16112, -16157, -16202, -16246, -16289, -16331,
+                -16373, -16414, -16455, -16495, -16535, -16574, -16612, -16649,
+                -16686, -16723, -16758, -16793, -16828, -16862, -16895, -16927,
+                -16959, -16990, -17021, -17051, -17080, -17109, -17137, -17164,
+                -17191, -17217, -17243, -17267, -17292, -17315, -17338, -17360,
+                -17382, -17403, -17423, -17442, -17461, -17480, -17497, -17514,
+                -17530, -17546, -17561, -17575, -17589, -17602, -17614, -17626,
+                -17637, -17647, -17657, -17666, -17674, -17682, -17689, -17695,
+                -17701, -17706, -17710, -17714, -17717, -17719, -17721, -17722,
+                -17722, -17722, -17721, -17719, -17717, -17714, -17710, -17706,
+                -17701, -17695, -17689, -17682, -17674, -17666, -17657, -17647,
+                -17637, -17626, -17614, -17602, -17589, -17575, -17561, -17546,
+                -17530, -17514, -17497, -17480, -17461, -17442, -17423, -17403,
+                -17382, -17360, -17338, -17315, -17292, -17267, -17243, -17217,
+                -17191, -17164, -17137, -17109, -17080, -17051, -17021, -16990,
+                -16959, -16927, -16895, -16862, -16828, -16793, -16758, -16723,
+                -16686, -16649, -16612, -16574, -16535, -16495, -16455, -16414,
+                -16373, -16331, -16289, -16246, -16202, -16157, -16112, -16067,
+                -16021, -15974, -15926, -15878, -15830, -15781, -15731, -15681,
+                -15630, -15578, -15526, -15473, -15420, -15366, -15311, -15256,
+                -15201, -15145, -15088, -15031, -14973, -14914, -14855, -14796,
+                -14735, -14675, -14614, -14552, -14489, -14427, -14363, -14299,
+                -14235, -14170, -14104, -14038, -13971, -13904, -13836, -13768,
+                -13699, -13630, -13560, -13490, -13419, -13348, -13276, -13204,
+                -13131, -13058, -12984, -12910, -12835, -12760, -12684, -12608,
+                -12531, -12454, -12377, -12299, -12220, -12141, -12062, -11982,
+                -11901, -11821, -11739, -11658, -11576, -11493, -11410, -11327,
+                -11243, -11159, -11074, -10989, -10903, -10817, -10731, -10644,
+                -10557, -10470, -10382, -10293, -10205, -10115, -10026,  -9936,
+                 -9846,  -9755,  -9664,  -9573,  -9481,  -9389,  -9297,  -9204,
+                 -9111,  -9018,  -8924,  -8830,  -8735,  -8640,  -8545,  -8450,
+                 -8354,  -8258,  -8162,  -8065,  -7968,  -7871,  -7773,  -7675,
+                 -7577,  -7479,  -7380,  -7281,  -7182,  -7082,  -6982,  -6882,
+                 -6782,  -6681,  -6581,  -6479,  -6378,  -6277,  -6175,  -6073,
+                 -5970,  -5868,  -5765,  -5662,  -5559,  -5456,  -5352,  -5248,
+                 -5144,  -5040,  -4936,  -4831,  -4727,  -4622,  -4517,  -4412,
+                 -4306,  -4201,  -4095,  -3989,  -3883,  -3777,  -3670,  -3564,
+                 -3457,  -3351,  -3244,  -3137,  -3030,  -2923,  -2815,  -2708,
+                 -2600,  -2493,  -2385,  -2277,  -2169,  -2061,  -1953,  -1845,
+                 -1737,  -1629,  -1521,  -1412,  -1304,  -1195,  -1087,   -978,
+                  -870,   -761,   -652,   -544,   -435,   -326,   -217,   -109,
+                     0,    109,    217,    326,    435,    544,    652,    761,
+                   870,    978,   1087,   1195,   1304,   1412,   1521,   1629,
+                  1737,   1845,   1953,   2061,   2169,   2277,   2385,   2493,
+                  2600,   2708,   2815,   2923,   3030,   3137,   3244,   3351,
+                  3457,   3564,   3670,   3777,   3883,   3989,   4095,   4201,
+                  4306,   4412,   4517,   4622,   4727,   4831,   4936,   5040,
+                  5144,   5248,   5352,   5456,   5559,   5662,   5765,   5868,
+                  5970,   6073,   6175,   6277,   6378,   6479,   6581,   6681,
+                  6782,   6882,   6982,   7082,   7182,   7281,   7380,   7479,
+                  7577,   7675,   7773,   7871,   7968,   8065,   8162,   8258,
+                  8354,   8450,   8545,   8640,   8735,   8830,   8924,   9018,
+                  9111,   9204,   9297,   9389,   9481,   9573,   9664,   9755,
+                  9846,   9936,  10026,  10115,  10205,  10293,  10382,  10470,
+                 10557,  10644,  10731,  10817,  10903,  10989,  11074,  11159,
+                 11243,  11327,  11410,  11493,  11576,  11658,  11739,  11821,
+                 11901,  11982,  12062,  12141,  12220,  12299,  12377,  12454,
+                 12531,  12608,  12684,  12760,  12835,  12910,  12984,  13058,
+                 13131,  13204,  13276,  13348,  13419,  13490,  13560,  13630,
+                 13699,  13768,  13836,  13904,  13971,  14038,  14104,  14170,
+                 14235,  14299,  14363,  14427,  14489,  14552,  14614,  14675,
+                 14735,  14796,  14855,  14914,  14973,  15031,  15088,  15145,
+                 15201,  15256,  15311,  15366,  15420,  15473,  15526,  15578,
+                 15630,  15681,  15731,  15781,  15830,  15878,  15926,  15974,
+                 16021,  16067,  16112,  16157,  16202,  16246,  16289,  16331,
+                 16373,  16414,  16455,  16495,  16535,  16574,  16612,  16649,
+                 16686,  16723,  16758,  16793,  16828,  16862,  16895,  16927,
+                 16959,  16990,  17021,  17051,  17080,  17109,  17137,  17164,
+                 17191,  17217,  17243,  17267,  17292,  17315,  17338,  17360,
+                 17382,  17403,  17423,  17442,  17461,  17480,  17497,  17514,
+                 17530,  17546,  17561,  17575,  17589,  17602,  17614,  17626,
+                 17637,  17647,  17657,  17666,  17674,  17682,  17689,  17695,
+                 17701,  17706,  17710,  17714,  17717,  17719,  17721,  17722,
+                 17722,  17722,  17721,  17719,  17717,  17714,  17710,  17706,
+                 17701,  17695,  17689,  17682,  17674,  17666,  17657,  17647,
+                 17637,  17626,  17614,  17602,  17589,  17575,  17561,  17546,
+                 17530,  17514,  17497,  17480,  17461,  17442,  17423,  17403,
+                 17382,  17360,  17338,  17315,  17292,  17267,  17243,  17217,
+                 17191,  17164,  17137,  17109,  17080,  17051,  17021,  16990,
+                 16959,  16927,  16895,  16862,  16828,  16793,  16758,  16723,
+                 16686,  16649,  16612,  16574,  16535,  16495,  16455,  16414,
+                 16373,  16331,  16289,  16246,  16202,  16157,  16112,  16067,
+                 16021,  15974,  15926,  15878,  15830,  15781,  15731,  15681,
+                 15630,  15578,  15526,  15473,  15420,  15366,  15311,  15256,
+                 15201,  15145,  15088,  15031,  14973,  14914,  14855,  14796,
+                 14735,  14675,  14614,  14552,  14489,  14427,  14363,  14299,
+                 14235,  14170,  14104,  14038,  13971,  13904,  13836,  13768,
+                 13699,  13630,  13560,  13490,  13419,  13348,  13276,  13204,
+                 13131,  13058,  12984,  12910,  12835,  12760,  12684,  12608,
+                 12531,  12454,  12377,  12299,  12220,  12141,  12062,  11982,
+                 11901,  11821,  11739,  11658,  11576,  11493,  11410,  11327,
+                 11243,  11159,  11074,  10989,  10903,  10817,  10731,  10644,
+                 10557,  10470,  10382,  10293,  10205,  10115,  10026,   9936,
+                  9846,   9755,   9664,   9573,   9481,   9389,   9297,   9204,
+                  9111,   9018,   8924,   8830,   8735,   8640,   8545,   8450,
+                  8354,   8258,   8162,   8065,   7968,   7871,   7773,   7675,
+                  7577,   7479,   7380,   7281,   7182,   7082,   6982,   6882,
+                  6782,   6681,   6581,   6479,   6378,   6277,   6175,   6073,
+                  5970,   5868,   5765,   5662,   5559,   5456,   5352,   5248,
+                  5144,   5040,   4936,   4831,   4727,   4622,   4517,   4412,
+                  4306,   4201,   4095,   3989,   3883,   3777,   3670,   3564,
+                  3457,   3351,   3244,   3137,   3030,   2923,   2815,   2708,
+                  2600,   2493,   2385,   2277,   2169,   2061,   1953,   1845,
+                  1737,   1629,   1521,   1412,   1304,   1195,   1087,    978,
+                   870,    761,    652,    544,    435,    326,    217,    109,
+                     0,
+            }},
+            // 2 harmonics
+            {{
+                     0,   -217,   -435,   -652,   -870,  -1087,  -1304,  -1521,
+                 -1738,  -1955,  -2171,  -2388,  -2604,  -2820,  -3035,  -3251,
+                 -3466,  -3680,  -3895,  -4109,  -4322,  -4536,  -4748,  -4961,
+                 -5173,  -5384,  -5595,  -5805,  -6015,  -6224,  -6433,  -6641,
+                 -6848,  -7055,  -7261,  -7467,  -7672,  -7876,  -8079,  -8281,
+                 -8483,  -8684,  -8884,  -9084,  -9282,  -9480,  -9677,  -9873,
+                -10067, -10261, -10455, -10647, -10838, -11028, -11217, -11405,
+                -11592, -11778, -11963, -12146, -12329, -12510, -12691, -12870,
+                -13048, -13224, -13400, -13574, -13747, -13919, -14090, -14259,
+                -14427, -14594, -14759, -14923, -15085, -15247, -15406, -15565,
+                -15722, -15878, -16032, -16184, -16336, -16485, -16634, -16781,
+                -16926, -17070, -17212, -17353, -17492, -17629, -17765, -17900,
+                -18033, -18164, -18293, -18421, -18548, -18672, -18795, -18917,
+                -19037, -19155, -19271, -19386, -19499, -19610, -19720, -19828,
+                -19934, -20038, -20141, -20242, -20341, -20438, -20534, -20628,
+                -20720, -20810, -20899, -20986, -21071, -21154, -21235, -21315,
+                -21393, -21469, -21543, -21615, -21686, -21754, -21821, -21886,
+                -21950, -22011, -22071, -22129, -22185, -22239, -22291, -22342,
+                -22390, -22437, -22482, -22525, -22567, -22606, -22644, -22680,
+                -22714, -22746, -22777, -22806, -22833, -22858, -22881, -22902,
+                -22922, -22940, -22956, -22970, -22983, -22994, -23003, -23010,
+                -23016, -23019, -23021, -23022, -23020, -23017, -23012, -23006,
+                -22997, -22987, -22976, -22962, -22947, -22930, -22912, -22892,
+                -22870, -22847, -22822, -22796, -22767, -22738, -22706, -22673,
+                -22639, -22603, -22565, -22526, -22485, -22443, -22400, -22354,
+                -22308, -22259, -22210, -22159, -22106, -22052, -21997, -21940,
+                -21882, -21823, -21762, -21699, -21636, -21571, -21505, -21437,
+                -21368, -21298, -21227, -21154, -21080, -21005, -20929, -20851,
+                -20773, -20693, -20612, -20530, -20446, -20362, -20277, -20190,
+                -20103, -20014, -19924, -19834, -19742, -19649, -19556, -19461,
+                -19366, -19269, -19172, -19074, -18974, -18874, -18774, -18672,
+                -18569, -18466, -18362, -18257, -18152, -18045, -17938, -17831,
+                -17722, -17613, -17503, -17393, -17282, -17170, -17058, -16946,
+                -16832, -16718, -16604, -16489, -16374, -16258, -16142, -16025,
+                -15908, -15791, -15673, -15554, -15436, -15317, -15198, -15078,
+                -14958, -14838, -14718, -14597, -14476, -14355, -14234, -14112,
+                -13991, -13869, -13747, -13625, -13503, -13381, -13259, -13136,
+                -13014, -12892, -12769, -12647, -12525, -12402, -12280, -12158,
+                -12036, -11914, -11792, -11671, -11549, -11428, -11307, -11186,
+                -11065, -10944, -10824, -10704, -10584, -10464, -10345, -10226,
+                -10107,  -9989,  -9871,  -9753,  -9636,  -9519,  -9403,  -9287,
+                 -9171,  -9056,  -8941,  -8826,  -8713,  -8599,  -8486,  -8374,
+                 -8262,  -8150,  -8040,  -7929,  -7819,  -7710,  -7602,  -7494,
+                 -7386,  -7279,  -7173,  -7067,  -6962,  -6858,  -6754,  -6651,
+                 -6549,  -6447,  -6346,  -6246,  -6146,  -6047,  -5949,  -5852,
+                 -5755,  -5659,  -5564,  -5469,  -5376,  -5283,  -5191,  -5099,
+                 -5009,  -4919,  -4830,  -4742,  -4654,  -4568,  -4482,  -4397,
+                 -4313,  -4230,  -4147,  -4066,  -3985,  -3905,  -3826,  -3748,
+                 -3670,  -3594,  -3518,  -3444,  -3370,  -3297,  -3225,  -3153,
+                 -3083,  -3014,  -2945,  -2877,  -2810,  -2745,  -2679,  -2615,
+                 -2552,  -2490,  -2428,  -2367,  -2308,  -2249,  -2191,  -2134,
+                 -2078,  -2022,  -1968,  -1914,  -1861,  -1810,  -1759,  -1709,
+                 -1659,  -1611,  -1563,  -1517,  -1471,  -1426,  -1382,  -1339,
+                 -1296,  -1255,  -1214,  -1174,  -1135,  -1097,  -1059,  -1022,
+                  -986,   -951,   -917,   -884,   -851,   -819,   -788,   -757,
+                  -727,   -699,   -670,   -643,   -616,   -590,   -565,   -540,
+                  -516,   -493,   -470,   -449,   -427,   -407,   -387,   -368,
+                  -349,   -331,   -314,   -297,   -281,   -265,   -250,   -235,
+                  -222,   -208,   -195,   -183,   -171,   -160,   -149,   -139,
+                  -129,   -120,   -111,   -102,    -94,    -87,    -80,    -73,
+                   -66,    -60,    -55,    -50,    -45,    -40,    -36,    -32,
+                   -28,    -25,    -22,    -19,    -16,    -14,    -12,    -10,
+                    -8,     -7,     -6,     -4,     -4,     -3,     -2,     -1,
+                    -1,     -1,      0,      0,      0,      0,      0,      0,
+                     0,      0,      0,      0,      0,      0,      0,      1,
+                     1,      1,      2,      3,      4,      4,      6,      7,
+                     8,     10,     12,     14,     16,     19,     22,     25,
+                    28,     32,     36,     40,     45,     50,     55,     60,
+                    66,     73,     80,     87,     94,    102,    111,    120,
+                   129,    139,    149,    160,    171,    183,    195,    208,
+                   222,    235,    250,    265,    281,    297,    314,    331,
+                   349,    368,    387,    407,    427,    449,    470,    493,
+                   516,    540,    565,    590,    616,    643,    670,    699,
+                   727,    757,    788,    819,    851,    884,    917,    951,
+                   986,   1022,   1059,   1097,   1135,   1174,   1214,   1255,
+                  1296,   1339,   1382,   1426,   1471,   1517,   1563,   1611,
+                  1659,   1709,   1759,   1810,   1861,   1914,   1968,   2022,
+                  2078,   2134,   2191,   2249,   2308,   2367,   2428,   2490,
+                  2552,   2615,   2679,   2745,   2810,   2877,   2945,   3014,
+                  3083,   3153,   3225,   3297,   3370,   3444,   3518,   3594,
+                  3670,   3748,   3826,   3905,   3985,   4066,   4147,   4230,
+                  4313,   4397,   4482,   4568,   4654,   4742,   4830,   4919,
+                  5009,   5099,   5191,   5283,   5376,   5469,   5564,   5659,
+                  5755,   5852,   5949,   6047,   6146,   6246,   6346,   6447,
+                  6549,   6651,   6754,   6858,   6962,   7067,   7173,   7279,
+                  7386,   7494,   7602,   7710,   7819,   7929,   8040,   8150,
+                  8262,   8374,   8486,   8599,   8713,   8826,   8941,   9056,
+                  9171,   9287,   9403,   9519,   9636,   9753,   9871,   9989,
+                 10107,  10226,  10345,  10464,  10584,  10704,  10824,  10944,
+                 11065,  11186,  11307,  11428,  11549,  11671,  11792,  11914,
+                 12036,  12158,  12280,  12402,  12525,  12647,  12769,  12892,
+                 13014,  13136,  13259,  13381,  13503,  13625,  13747,  13869,
+                 13991,  14112,  14234,  14355,  14476,  14597,  14718,  14838,
+                 14958,  15078,  15198,  15317,  15436,  15554,  15673,  15791,
+                 15908,  16025,  16142,  16258,  16374,  16489,  16604,  16718,
+                 16832,  16946,  17058,  17170,  17282,  17393,  17503,  17613,
+                 17722,  17831,  17938,  18045,  18152,  18257,  18362,  18466,
+                 18569,  18672,  18774,  18874,  18974,  19074,  19172,  19269,
+                 19366,  19461,  19556,  19649,  19742,  19834,  19924,  20014,
+                 20103,  20190,  20277,  20362,  20446,  20530,  20612,  20693,
+                 20773,  20851,  20929,  21005,  21080,  21154,  21227,  21298,
+                 21368,  21437,  21505,  21571,  21636,  21699,  21762,  21823,
+                 21882,  21940,  21997,  22052,  22106,  22159,  22210,  22259,
+                 22308,  22354,  22400,  22443,  22485,  22526,  22565,  22603,
+                 22639,  22673,  22706,  22738,  22767,  22796,  22822,  22847,
+                 22870,  22892,  22912,  22930,  22947,  22962,  22976,  22987,
+                 22997,  23006,  23012,  23017,  23020,  23022,  23021,  23019,
+                 23016,  23010,  23003,  22994,  22983,  22970,  22956,  22940,
+                 22922,  22902,  22881,  22858,  22833,  22806,  22777,  22746,
+                 22714,  22680,  22644,  22606,  22567,  22525,  22482,  22437,
+                 22390,  22342,  22291,  22239,  22185,  22129,  22071,  22011,
+                 21950,  21886,  21821,  21754,  21686,  21615,  21543,  21469,
+                 21393,  21315,  21235,  21154,  21071,  20986,  20899,  20810,
+                 20720,  20628,  20534,  20438,  20341,  20242,  20141,  20038,
+                 19934,  19828,  19720,  19610,  19499,  19386,  19271,  19155,
+                 19037,  18917,  18795,  18672,  18548,  18421,  18293,  18164,
+                 18033,  17900,  17765,  17629,  17492,  17353,  17212,  17070,
+                 16926,  16781,  16634,  16485,  16336,  16184,  16032,  15878,
+                 15722,  15565,  15406,  15247,  15085,  14923,  14759,  14594,
+                 14427,  14259,  14090,  13919,  13747,  13574,  13400,  13224,
+                 13048,  12870,  12691,  12510,  12329,  12146,  11963,  11778,
+                 11592,  11405,  11217,  11028,  10838,  10647,  10455,  10261,
+                 10067,   9873,   9677,   9480,   9282,   9084,   8884,   8684,
+                  8483,   8281,   8079,   7876,   7672,   7467,   7261,   7055,
+                  6848,   6641,   6433,   6224,   6015,   5805,   5595,   5384,
+                  5173,   4961,   4748,   4536,   4322,   4109,   3895,   3680,
+                  3466,   3251,   3035,   2820,   2604,   2388,   2171,   1955,
+                  1738,   1521,   1304,   1087,    870,    652,    435,    217,
+                     0,
+            }},
+            // 4 harmonics
+            {{
+                     0,   -435,   -870,  -1304,  -1739,  -2172,  -2605,  -3038,
+                 -3469,  -3900,  -4329,  -4757,  -5184,  -5610,  -6034,  -6456,
+                 -6876,  -7295,  -7711,  -8125,  -8537,  -8947,  -9354,  -9758,
+                -10160, -10559, -10955, -11348, -11737, -12124, -12507, -12887,
+                -13263, -13636, -14005, -14370, -14731, -15088, -15441, -15790,
+                -16134, -16474, -16810, -17141, -17468, -17790, -18107, -18420,
+                -18727, -19030, -19327, -19620, -19907, -20189, -20466, -20738,
+                -21004, -21265, -21520, -21770, -22015, -22254, -22487, -22714,
+                -22936, -23152, -23362, -23567, -23766, -23959, -24146, -24327,
+                -24503, -24672, -24836, -24994, -25146, -25292, -25432, -25566,
+                -25694, -25817, -25933, -26044, -26149, -26248, -26341, -26428,
+                -26510, -26586, -26656, -26721, -26780, -26833, -26880, -26923,
+                -26959, -26990, -27016, -27037, -27052, -27062, -27066, -27066,
+                -27060, -27050, -27034, -27013, -26988, -26958, -26923, -26883,
+                -26839, -26790, -26737, -26680, -26618, -26552, -26482, -26407,
+                -26329, -26247, -26161, -26071, -25978, -25881, -25781, -25677,
+                -25570, -25459, -25346, -25229, -25110, -24988, -24863, -24735,
+                -24604, -24472, -24336, -24199, -24059, -23917, -23773, -23627,
+                -23480, -23330, -23179, -23026, -22872, -22717, -22560, -22402,
+                -22243, -22083, -21922, -21760, -21597, -21434, -21270, -21106,
+                -20942, -20777, -20612, -20447, -20281, -20116, -19951, -19786,
+                -19622, -19457, -19294, -19130, -18968, -18806, -18645, -18484,
+                -18325, -18167, -18009, -17853, -17697, -17544, -17391, -17240,
+                -17090, -16941, -16794, -16649, -16505, -16363, -16223, -16084,
+                -15948, -15813, -15680, -15549, -15420, -15293, -15168, -15046,
+                -14925, -14807, -14691, -14577, -14465, -14356, -14248, -14144,
+                -14041, -13941, -13843, -13748, -13655, -13564, -13476, -13391,
+                -13307, -13226, -13148, -13072, -12998, -12927, -12858, -12792,
+                -12728, -12666, -12607, -12550, -12496, -12444, -12394, -12346,
+                -12301, -12258, -12217, -12178, -12142, -12108, -12075, -12045,
+                -12017, -11991, -11967, -11945, -11924, -11906, -11889, -11875,
+                -11862, -11850, -11841, -11832, -11826, -11821, -11818, -11815,
+                -11815, -11815, -11817, -11821, -11825, -11830, -11837, -11845,
+                -11853, -11863, -11873, -11884, -11896, -11909, -11922, -11936,
+                -11951, -11966, -11981, -11997, -12013, -12029, -12046, -12063,
+                -12079, -12096, -12113, -12130, -12147, -12163, -12180, -12196,
+                -12212, -12227, -12242, -12257, -12271, -12284, -12297, -12309,
+                -12321, -12331, -12341, -12351, -12359, -12366, -12372, -12378,
+                -12382, -12385, -12387, -12388, -12387, -12386, -12383, -12379,
+                -12373, -12366, -12358, -12348, -12337, -12324, -12310, -12295,
+                -12277, -12258, -12238, -12216, -12192, -12167, -12140, -12111,
+                -12081, -12049, -12015, -11980, -11942, -11903, -11863, -11820,
+                -11776, -11730, -11682, -11633, -11582, -11529, -11474, -11418,
+                -11360, -11300, -11238, -11175, -11110, -11044, -10976, -10906,
+                -10834, -10761, -10687, -10610, -10533, -10453, -10373, -10290,
+                -10207, -10122, -10035,  -9947,  -9858,  -9768,  -9676,  -9583,
+                 -9489,  -9393,  -9297,  -9199,  -9101,  -9001,  -8900,  -8799,
+                 -8696,  -8593,  -8489,  -8383,  -8278,  -8171,  -8064,  -7956,
+                 -7848,  -7739,  -7629,  -7519,  -7409,  -7298,  -7187,  -7075,
+                 -6964,  -6852,  -6740,  -6627,  -6515,  -6403,  -6291,  -6178,
+                 -6066,  -5954,  -5843,  -5731,  -5620,  -5509,  -5398,  -5288,
+                 -5178,  -5069,  -4960,  -4852,  -4744,  -4637,  -4531,  -4425,
+                 -4320,  -4216,  -4113,  -4011,  -3909,  -3809,  -3709,  -3610,
+                 -3513,  -3416,  -3321,  -3226,  -3133,  -3041,  -2950,  -2861,
+                 -2772,  -2685,  -2599,  -2515,  -2431,  -2350,  -2269,  -2190,
+                 -2112,  -2036,  -1961,  -1888,  -1816,  -1746,  -1677,  -1609,
+                 -1543,  -1479,  -1416,  -1355,  -1295,  -1236,  -1180,  -1124,
+                 -1071,  -1018,   -968,   -918,   -871,   -824,   -780,   -736,
+                  -695,   -654,   -616,   -578,   -542,   -508,   -475,   -443,
+                  -412,   -383,   -356,   -329,   -304,   -280,   -257,   -236,
+                  -216,   -196,   -178,   -161,   -146,   -131,   -117,   -104,
+                   -92,    -81,    -71,    -62,    -54,    -46,    -39,    -33,
+                   -28,    -23,    -19,    -15,    -12,     -9,     -7,     -5,
+                    -3,     -2,     -1,     -1,      0,      0,      0,      0,
+                     0,      0,      0,      0,      0,      1,      1,      2,
+                     3,      5,      7,      9,     12,     15,     19,     23,
+                    28,     33,     39,     46,     54,     62,     71,     81,
+                    92,    104,    117,    131,    146,    161,    178,    196,
+                   216,    236,    257,    280,    304,    329,    356,    383,
+                   412,    443,    475,    508,    542,    578,    616,    654,
+                   695,    736,    780,    824,    871,    918,    968,   1018,
+                  1071,   1124,   1180,   1236,   1295,   1355,   1416,   1479,
+                  1543,   1609,   1677,   1746,   1816,   1888,   1961,   2036,
+                  2112,   2190,   2269,   2350,   2431,   2515,   2599,   2685,
+                  2772,   2861,   2950,   3041,   3133,   3226,   3321,   3416,
+                  3513,   3610,   3709,   3809,   3909,   4011,   4113,   4216,
+                  4320,   4425,   4531,   4637,   4744,   4852,   4960,   5069,
+                  5178,   5288,   5398,   5509,   5620,   5731,   5843,   5954,
+                  6066,   6178,   6291,   6403,   6515,   6627,   6740,   6852,
+                  6964,   7075,   7187,   7298,   7409,   7519,   7629,   7739,
+                  7848,   7956,   8064,   8171,   8278,   8383,   8489,   8593,
+                  8696,   8799,   8900,   9001,   9101,   9199,   9297,   9393,
+                  9489,   9583,   9676,   9768,   9858,   9947,  10035,  10122,
+                 10207,  10290,  10373,  10453,  10533,  10610,  10687,  10761,
+                 10834,  10906,  10976,  11044,  11110,  11175,  11238,  11300,
+                 11360,  11418,  11474,  11529,  11582,  11633,  11682,  11730,
+                 11776,  11820,  11863,  11903,  11942,  11980,  12015,  12049,
+                 12081,  12111,  12140,  12167,  12192,  12216,  12238,  12258,
+                 12277,  12295,  12310,  12324,  12337,  12348,  12358,  12366,
+                 12373,  12379,  12383,  12386,  12387,  12388,  12387,  12385,
+                 12382,  12378,  12372,  12366,  12359,  12351,  12341,  12331,
+                 12321,  12309,  12297,  12284,  12271,  12257,  12242,  12227,
+                 12212,  12196,  12180,  12163,  12147,  12130,  12113,  12096,
+                 12079,  12063,  12046,  12029,  12013,  11997,  11981,  11966,
+                 11951,  11936,  11922,  11909,  11896,  11884,  11873,  11863,
+                 11853,  11845,  11837,  11830,  11825,  11821,  11817,  11815,
+                 11815,  11815,  11818,  11821,  11826,  11832,  11841,  11850,
+                 11862,  11875,  11889,  11906,  11924,  11945,  11967,  11991,
+                 12017,  12045,  12075,  12108,  12142,  12178,  12217,  12258,
+                 12301,  12346,  12394,  12444,  12496,  12550,  12607,  12666,
+                 12728,  12792,  12858,  12927,  12998,  13072,  13148,  13226,
+                 13307,  13391,  13476,  13564,  13655,  13748,  13843,  13941,
+                 14041,  14144,  14248,  14356,  14465,  14577,  14691,  14807,
+                 14925,  15046,  15168,  15293,  15420,  15549,  15680,  15813,
+                 15948,  16084,  16223,  16363,  16505,  16649,  16794,  16941,
+                 17090,  17240,  17391,  17544,  17697,  17853,  18009,  18167,
+                 18325,  18484,  18645,  18806,  18968,  19130,  19294,  19457,
+                 19622,  19786,  19951,  20116,  20281,  20447,  20612,  20777,
+                 20942,  21106,  21270,  21434,  21597,  21760,  21922,  22083,
+                 22243,  22402,  22560,  22717,  22872,  23026,  23179,  23330,
+                 23480,  23627,  23773,  23917,  24059,  24199,  24336,  24472,
+                 24604,  24735,  24863,  24988,  25110,  25229,  25346,  25459,
+                 25570,  25677,  25781,  25881,  25978,  26071,  26161,  26247,
+                 26329,  26407,  26482,  26552,  26618,  26680,  26737,  26790,
+                 26839,  26883,  26923,  26958,  26988,  27013,  27034,  27050,
+                 27060,  27066,  27066,  27062,  27052,  27037,  27016,  26990,
+                 26959,  26923,  26880,  26833,  26780,  26721,  26656,  26586,
+                 26510,  26428,  26341,  26248,  26149,  26044,  25933,  25817,
+                 25694,  25566,  25432,  25292,  25146,  24994,  24836,  24672,
+                 24503,  24327,  24146,  23959,  23766,  23567,  23362,  23152,
+                 22936,  22714,  22487,  22254,  22015,  21770,  21520,  21265,
+                 21004,  20738,  20466,  20189,  19907,  19620,  19327,  19030,
+                 18727,  18420,  18107,  17790,  17468,  17141,  16810,  16474,
+                 16134,  15790,  15441,  15088,  14731,  14370,  14005,  13636,
+                 13263,  12887,  12507,  12124,  11737,  11348,  10955,  10559,
+                 10160,   9758,   9354,   8947,   8537,   8125,   7711,   7295,
+                  6876,   6456,   6034,   5610,   5184,   4757,   4329,   3900,
+                  3469,   3038,   2605,   2172,   1739,   1304,    870,    435,
+                     0,
+            }},
+            // 8 harmonics
+            {{
+                     0,   -870,  -1739,  -2606,  -3471,  -4332,  -5190,  -6042,
+                 -6889,  -7729,  -8561,  -9386, -10201, -11008, -11803, -12588,
+                -13360, -14121, -14868, -15601, -16321, -17025, -17713, -18386,
+                -19042, -19680, -20302, -20905, -21490, -22056, -22603, -23130,
+                -23638, -24125, -24593, -25039, -25466, -25871, -26256, -26619,
+                -26962, -27284, -27584, -27864, -28122, -28360, -28578, -28774,
+                -28951, -29107, -29244, -29361, -29458, -29537, -29597, -29639,
+                -29663, -29670, -29660, -29633, -29590, -29531, -29458, -29370,
+                -29268, -29153, -29025, -28884, -28732, -28569, -28395, -28211,
+                -28018, -27817, -27608, -27391, -27167, -26937, -26702, -26462,
+                -26218, -25970, -25719, -25465, -25210, -24953, -24696, -24438,
+                -24181, -23925, -23670, -23418, -23167, -22920, -22676, -22436,
+                -22200, -21969, -21743, -21522, -21307, -21098, -20895, -20699,
+                -20510, -20328, -20153, -19986, -19827, -19675, -19531, -19396,
+                -19268, -19149, -19038, -18935, -18841, -18754, -18676, -18606,
+                -18544, -18490, -18444, -18405, -18374, -18350, -18333, -18323,
+                -18320, -18323, -18332, -18347, -18368, -18395, -18426, -18462,
+                -18503, -18548, -18596, -18649, -18704, -18762, -18823, -18885,
+                -18950, -19016, -19083, -19151, -19220, -19288, -19356, -19424,
+                -19491, -19556, -19620, -19683, -19743, -19800, -19856, -19908,
+                -19957, -20002, -20044, -20082, -20116, -20146, -20172, -20192,
+                -20208, -20219, -20225, -20226, -20222, -20212, -20197, -20176,
+                -20151, -20119, -20082, -20040, -19992, -19939, -19880, -19816,
+                -19747, -19673, -19593, -19509, -19420, -19326, -19228, -19126,
+                -19019, -18908, -18794, -18676, -18554, -18429, -18302, -18171,
+                -18038, -17903, -17766, -17627, -17486, -17344, -17201, -17057,
+                -16913, -16768, -16623, -16478, -16334, -16190, -16048, -15906,
+                -15766, -15627, -15490, -15355, -15222, -15092, -14964, -14839,
+                -14717, -14598, -14482, -14370, -14261, -14155, -14054, -13956,
+                -13862, -13772, -13687, -13605, -13528, -13455, -13386, -13321,
+                -13260, -13204, -13152, -13104, -13061, -13021, -12985, -12954,
+                -12926, -12902, -12881, -12864, -12851, -12840, -12833, -12829,
+                -12827, -12829, -12833, -12839, -12847, -12857, -12869, -12883,
+                -12898, -12914, -12931, -12950, -12968, -12987, -13007, -13026,
+                -13045, -13064, -13082, -13099, -13115, -13131, -13144, -13157,
+                -13167, -13176, -13183, -13188, -13190, -13190, -13187, -13182,
+                -13173, -13162, -13148, -13130, -13110, -13086, -13058, -13028,
+                -12994, -12956, -12914, -12870, -12821, -12769, -12714, -12655,
+                -12592, -12526, -12457, -12384, -12308, -12228, -12146, -12060,
+                -11972, -11880, -11786, -11690, -11590, -11489, -11385, -11279,
+                -11171, -11062, -10951, -10838, -10724, -10609, -10493, -10376,
+                -10258, -10140, -10022,  -9904,  -9785,  -9667,  -9550,  -9433,
+                 -9316,  -9201,  -9087,  -8974,  -8862,  -8752,  -8643,  -8537,
+                 -8432,  -8329,  -8229,  -8131,  -8035,  -7942,  -7852,  -7764,
+                 -7680,  -7598,  -7518,  -7442,  -7370,  -7300,  -7233,  -7169,
+                 -7109,  -7052,  -6997,  -6947,  -6899,  -6854,  -6812,  -6774,
+                 -6738,  -6706,  -6676,  -6649,  -6625,  -6603,  -6584,  -6567,
+                 -6552,  -6540,  -6530,  -6522,  -6515,  -6510,  -6507,  -6505,
+                 -6505,  -6505,  -6507,  -6509,  -6512,  -6515,  -6519,  -6523,
+                 -6527,  -6531,  -6534,  -6537,  -6540,  -6541,  -6542,  -6542,
+                 -6540,  -6537,  -6533,  -6527,  -6519,  -6510,  -6498,  -6485,
+                 -6469,  -6451,  -6430,  -6407,  -6382,  -6353,  -6322,  -6289,
+                 -6252,  -6213,  -6171,  -6126,  -6078,  -6027,  -5973,  -5916,
+                 -5856,  -5793,  -5728,  -5659,  -5588,  -5514,  -5437,  -5358,
+                 -5276,  -5192,  -5105,  -5016,  -4924,  -4831,  -4735,  -4638,
+                 -4539,  -4438,  -4336,  -4232,  -4127,  -4022,  -3915,  -3807,
+                 -3698,  -3589,  -3480,  -3370,  -3261,  -3151,  -3042,  -2933,
+                 -2824,  -2716,  -2609,  -2503,  -2398,  -2294,  -2192,  -2091,
+                 -1991,  -1894,  -1798,  -1704,  -1612,  -1523,  -1435,  -1350,
+                 -1268,  -1188,  -1110,  -1035,   -963,   -893,   -827,   -763,
+                  -702,   -643,   -588,   -535,   -485,   -438,   -394,   -353,
+                  -314,   -278,   -245,   -214,   -186,   -161,   -137,   -116,
+                   -97,    -80,    -66,    -53,    -42,    -32,    -24,    -18,
+                   -12,     -8,     -5,     -3,     -2,     -1,      0,      0,
+                     0,      0,      0,      1,      2,      3,      5,      8,
+                    12,     18,     24,     32,     42,     53,     66,     80,
+                    97,    116,    137,    161,    186,    214,    245,    278,
+                   314,    353,    394,    438,    485,    535,    588,    643,
+                   702,    763,    827,    893,    963,   1035,   1110,   1188,
+                  1268,   1350,   1435,   1523,   1612,   1704,   1798,   1894,
+                  1991,   2091,   2192,   2294,   2398,   2503,   2609,   2716,
+                  2824,   2933,   3042,   3151,   3261,   3370,   3480,   3589,
+                  3698,   3807,   3915,   4022,   4127,   4232,   4336,   4438,
+                  4539,   4638,   4735,   4831,   4924,   5016,   5105,   5192,
+                  5276,   5358,   5437,   5514,   5588,   5659,   5728,   5793,
+                  5856,   5916,   5973,   6027,   6078,   6126,   6171,   6213,
+                  6252,   6289,   6322,   6353,   6382,   6407,   6430,   6451,
+                  6469,   6485,   6498,   6510,   6519,   6527,   6533,   6537,
+                  6540,   6542,   6542,   6541,   6540,   6537,   6534,   6531,
+                  6527,   6523,   6519,   6515,   6512,   6509,   6507,   6505,
+                  6505,   6505,   6507,   6510,   6515,   6522,   6530,   6540,
+                  6552,   6567,   6584,   6603,   6625,   6649,   6676,   6706,
+                  6738,   6774,   6812,   6854,   6899,   6947,   6997,   7052,
+                  7109,   7169,   7233,   7300,   7370,   7442,   7518,   7598,
+                  7680,   7764,   7852,   7942,   8035,   8131,   8229,   8329,
+                  8432,   8537,   8643,   8752,   8862,   8974,   9087,   9201,
+                  9316,   9433,   9550,   9667,   9785,   9904,  10022,  10140,
+                 10258,  10376,  10493,  10609,  10724,  10838,  10951,  11062,
+                 11171,  11279,  11385,  11489,  11590,  11690,  11786,  11880,
+                 11972,  12060,  12146,  12228,  12308,  12384,  12457,  12526,
+                 12592,  12655,  12714,  12769,  12821,  12870,  12914,  12956,
+                 12994,  13028,  13058,  13086,  13110,  13130,  13148,  13162,
+                 13173,  13182,  13187,  13190,  13190,  13188,  13183,  13176,
+                 13167,  13157,  13144,  13131,  13115,  13099,  13082,  13064,
+                 13045,  13026,  13007,  12987,  12968,  12950,  12931,  12914,
+                 12898,  12883,  12869,  12857,  12847,  12839,  12833,  12829,
+                 12827,  12829,  12833,  12840,  12851,  12864,  12881,  12902,
+                 12926,  12954,  12985,  13021,  13061,  13104,  13152,  13204,
+                 13260,  13321,  13386,  13455,  13528,  13605,  13687,  13772,
+                 13862,  13956,  14054,  14155,  14261,  14370,  14482,  14598,
+                 14717,  14839,  14964,  15092,  15222,  15355,  15490,  15627,
+                 15766,  15906,  16048,  16190,  16334,  16478,  16623,  16768,
+                 16913,  17057,  17201,  17344,  17486,  17627,  17766,  17903,
+                 18038,  18171,  18302,  18429,  18554,  18676,  18794,  18908,
+                 19019,  19126,  19228,  19326,  19420,  19509,  19593,  19673,
+                 19747,  19816,  19880,  19939,  19992,  20040,  20082,  20119,
+                 20151,  20176,  20197,  20212,  20222,  20226,  20225,  20219,
+                 20208,  20192,  20172,  20146,  20116,  20082,  20044,  20002,
+                 19957,  19908,  19856,  19800,  19743,  19683,  19620,  19556,
+                 19491,  19424,  19356,  19288,  19220,  19151,  19083,  19016,
+                 18950,  18885,  18823,  18762,  18704,  18649,  18596,  18548,
+                 18503,  18462,  18426,  18395,  18368,  18347,  18332,  18323,
+                 18320,  18323,  18333,  18350,  18374,  18405,  18444,  18490,
+                 18544,  18606,  18676,  18754,  18841,  18935,  19038,  19149,
+                 19268,  19396,  19531,  19675,  19827,  19986,  20153,  20328,
+                 20510,  20699,  20895,  21098,  21307,  21522,  21743,  21969,
+                 22200,  22436,  22676,  22920,  23167,  23418,  23670,  23925,
+                 24181,  24438,  24696,  24953,  25210,  25465,  25719,  25970,
+                 26218,  26462,  26702,  26937,  27167,  27391,  27608,  27817,
+                 28018,  28211,  28395,  28569,  28732,  28884,  29025,  29153,
+                 29268,  29370,  29458,  29531,  29590,  29633,  29660,  29670,
+                 29663,  29639,  29597,  29537,  29458,  29361,  29244,  29107,
+                 28951,  28774,  28578,  28360,  28122,  27864,  27584,  27284,
+                 26962,  26619,  26256,  25871,  25466,  25039,  24593,  24125,
+                 23638,  23130,  22603,  22056,  21490,  20905,  20302,  19680,
+                 19042,  18386,  17713,  17025,  16321,  15601,  14868,  14121,
+                 13360,  12588,  11803,  11008,  10201,   9386,   8561,   7729,
+                  6889,   6042,   5190,   4332,   3471,   2606,   1739,    870,
+                     0,
+            }},
+            // 16 harmonics
+            {{
+                     0,  -1739,  -3472,  -5192,  -6894,  -8573, -10221, -11834,
+                -13406, -14933, -16409, -17829, -19191, -20489, -21720, -22882,
+                -23971, -24986, -25924, -26785, -27567, -28270, -28893, -29438,
+                -29905, -30295, -30611, -30853, -31024, -31128, -31166, -31143,
+                -31062, -30927, -30742, -30511, -30238, -29928, -29585, -29214,
+                -28820, -28407, -27979, -27541, -27098, -26652, -26210, -25773,
+                -25346, -24932, -24535, -24156, -23799, -23465, -23157, -22876,
+                -22624, -22402, -22209, -22047, -21916, -21816, -21745, -21703,
+                -21689, -21703, -21741, -21803, -21887, -21991, -22112, -22249,
+                -22398, -22558, -22727, -22901, -23078, -23256, -23432, -23605,
+                -23771, -23929, -24077, -24214, -24336, -24444, -24535, -24609,
+                -24665, -24701, -24718, -24715, -24692, -24650, -24587, -24506,
+                -24406, -24289, -24155, -24005, -23842, -23665, -23478, -23280,
+                -23074, -22862, -22645, -22425, -22204, -21984, -21765, -21550,
+                -21341, -21138, -20944, -20759, -20584, -20421, -20271, -20135,
+                -20012, -19904, -19810, -19731, -19668, -19619, -19585, -19565,
+                -19558, -19564, -19583, -19612, -19652, -19701, -19757, -19821,
+                -19889, -19962, -20037, -20114, -20190, -20265, -20338, -20407,
+                -20470, -20527, -20577, -20619, -20652, -20674, -20686, -20687,
+                -20677, -20654, -20620, -20574, -20515, -20445, -20363, -20270,
+                -20166, -20052, -19930, -19798, -19659, -19514, -19362, -19207,
+                -19047, -18886, -18723, -18560, -18397, -18237, -18080, -17927,
+                -17779, -17637, -17502, -17374, -17255, -17144, -17043, -16952,
+                -16870, -16798, -16737, -16686, -16645, -16613, -16592, -16579,
+                -16575, -16579, -16590, -16608, -16631, -16660, -16692, -16728,
+                -16766, -16805, -16845, -16883, -16920, -16955, -16986, -17013,
+                -17034, -17050, -17060, -17062, -17057, -17044, -17022, -16992,
+                -16953, -16905, -16848, -16782, -16708, -16625, -16534, -16436,
+                -16330, -16219, -16101, -15978, -15851, -15720, -15586, -15450,
+                -15313, -15175, -15038, -14903, -14769, -14639, -14512, -14390,
+                -14273, -14162, -14057, -13958, -13867, -13783, -13707, -13639,
+                -13578, -13526, -13481, -13445, -13416, -13394, -13379, -13370,
+                -13367, -13370, -13377, -13388, -13403, -13421, -13440, -13460,
+                -13481, -13501, -13521, -13538, -13552, -13564, -13571, -13574,
+                -13572, -13564, -13549, -13529, -13502, -13467, -13426, -13377,
+                -13321, -13258, -13188, -13110, -13026, -12936, -12840, -12739,
+                -12632, -12521, -12407, -12289, -12169, -12047, -11924, -11800,
+                -11677, -11555, -11434, -11316, -11201, -11089, -10982, -10879,
+                -10782, -10690, -10604, -10525, -10452, -10385, -10325, -10272,
+                -10226, -10186, -10153, -10126, -10104, -10089, -10078, -10072,
+                -10070, -10072, -10077, -10084, -10092, -10102, -10112, -10122,
+                -10131, -10139, -10144, -10147, -10146, -10142, -10133, -10119,
+                -10100, -10075, -10045, -10008,  -9965,  -9916,  -9861,  -9799,
+                 -9731,  -9657,  -9577,  -9492,  -9401,  -9306,  -9206,  -9102,
+                 -8995,  -8885,  -8772,  -8658,  -8543,  -8428,  -8312,  -8198,
+                 -8085,  -7974,  -7865,  -7760,  -7658,  -7561,  -7468,  -7380,
+                 -7297,  -7219,  -7148,  -7082,  -7023,  -6969,  -6922,  -6880,
+                 -6844,  -6814,  -6789,  -6769,  -6754,  -6743,  -6736,  -6732,
+                 -6731,  -6732,  -6734,  -6738,  -6742,  -6746,  -6749,  -6751,
+                 -6751,  -6749,  -6744,  -6735,  -6722,  -6705,  -6683,  -6656,
+                 -6624,  -6586,  -6543,  -6494,  -6439,  -6378,  -6311,  -6239,
+                 -6162,  -6079,  -5992,  -5900,  -5804,  -5704,  -5601,  -5495,
+                 -5387,  -5278,  -5167,  -5056,  -4945,  -4835,  -4726,  -4619,
+                 -4514,  -4412,  -4314,  -4219,  -4128,  -4042,  -3961,  -3885,
+                 -3814,  -3749,  -3689,  -3635,  -3587,  -3544,  -3507,  -3475,
+                 -3448,  -3426,  -3408,  -3394,  -3384,  -3377,  -3373,  -3370,
+                 -3370,  -3370,  -3371,  -3372,  -3372,  -3371,  -3369,  -3364,
+                 -3356,  -3345,  -3330,  -3312,  -3289,  -3261,  -3228,  -3190,
+                 -3146,  -3097,  -3042,  -2982,  -2916,  -2845,  -2769,  -2688,
+                 -2602,  -2512,  -2418,  -2320,  -2219,  -2116,  -2010,  -1903,
+                 -1794,  -1685,  -1577,  -1468,  -1361,  -1256,  -1152,  -1052,
+                  -954,   -861,   -771,   -685,   -605,   -529,   -458,   -393,
+                  -333,   -279,   -230,   -187,   -149,   -116,    -88,    -65,
+                   -46,    -31,    -20,    -11,     -6,     -2,     -1,      0,
+                     0,      0,      1,      2,      6,     11,     20,     31,
+                    46,     65,     88,    116,    149,    187,    230,    279,
+                   333,    393,    458,    529,    605,    685,    771,    861,
+                   954,   1052,   1152,   1256,   1361,   1468,   1577,   1685,
+                  1794,   1903,   2010,   2116,   2219,   2320,   2418,   2512,
+                  2602,   2688,   2769,   2845,   2916,   2982,   3042,   3097,
+                  3146,   3190,   3228,   3261,   3289,   3312,   3330,   3345,
+                  3356,   3364,   3369,   3371,   3372,   3372,   3371,   3370,
+                  3370,   3370,   3373,   3377,   3384,   3394,   3408,   3426,
+                  3448,   3475,   3507,   3544,   3587,   3635,   3689,   3749,
+                  3814,   3885,   3961,   4042,   4128,   4219,   4314,   4412,
+                  4514,   4619,   4726,   4835,   4945,   5056,   5167,   5278,
+                  5387,   5495,   5601,   5704,   5804,   5900,   5992,   6079,
+                  6162,   6239,   6311,   6378,   6439,   6494,   6543,   6586,
+                  6624,   6656,   6683,   6705,   6722,   6735,   6744,   6749,
+                  6751,   6751,   6749,   6746,   6742,   6738,   6734,   6732,
+                  6731,   6732,   6736,   6743,   6754,   6769,   6789,   6814,
+                  6844,   6880,   6922,   6969,   7023,   7082,   7148,   7219,
+                  7297,   7380,   7468,   7561,   7658,   7760,   7865,   7974,
+                  8085,   8198,   8312,   8428,   8543,   8658,   8772,   8885,
+                  8995,   9102,   9206,   9306,   9401,   9492,   9577,   9657,
+                  9731,   9799,   9861,   9916,   9965,  10008,  10045,  10075,
+                 10100,  10119,  10133,  10142,  10146,  10147,  10144,  10139,
+                 10131,  10122,  10112,  10102,  10092,  10084,  10077,  10072,
+                 10070,  10072,  10078,  10089,  10104,  10126,  10153,  10186,
+                 10226,  10272,  10325,  10385,  10452,  10525,  10604,  10690,
+                 10782,  10879,  10982,  11089,  11201,  11316,  11434,  11555,
+                 11677,  11800,  11924,  12047,  12169,  12289,  12407,  12521,
+                 12632,  12739,  12840,  12936,  13026,  13110,  13188,  13258,
+                 13321,  13377,  13426,  13467,  13502,  13529,  13549,  13564,
+                 13572,  13574,  13571,  13564,  13552,  13538,  13521,  13501,
+                 13481,  13460,  13440,  13421,  13403,  13388,  13377,  13370,
+                 13367,  13370,  13379,  13394,  13416,  13445,  13481,  13526,
+                 13578,  13639,  13707,  13783,  13867,  13958,  14057,  14162,
+                 14273,  14390,  14512,  14639,  14769,  14903,  15038,  15175,
+                 15313,  15450,  15586,  15720,  15851,  15978,  16101,  16219,
+                 16330,  16436,  16534,  16625,  16708,  16782,  16848,  16905,
+                 16953,  16992,  17022,  17044,  17057,  17062,  17060,  17050,
+                 17034,  17013,  16986,  16955,  16920,  16883,  16845,  16805,
+                 16766,  16728,  16692,  16660,  16631,  16608,  16590,  16579,
+                 16575,  16579,  16592,  16613,  16645,  16686,  16737,  16798,
+                 16870,  16952,  17043,  17144,  17255,  17374,  17502,  17637,
+                 17779,  17927,  18080,  18237,  18397,  18560,  18723,  18886,
+                 19047,  19207,  19362,  19514,  19659,  19798,  19930,  20052,
+                 20166,  20270,  20363,  20445,  20515,  20574,  20620,  20654,
+                 20677,  20687,  20686,  20674,  20652,  20619,  20577,  20527,
+                 20470,  20407,  20338,  20265,  20190,  20114,  20037,  19962,
+                 19889,  19821,  19757,  19701,  19652,  19612,  19583,  19564,
+                 19558,  19565,  19585,  19619,  19668,  19731,  19810,  19904,
+                 20012,  20135,  20271,  20421,  20584,  20759,  20944,  21138,
+                 21341,  21550,  21765,  21984,  22204,  22425,  22645,  22862,
+                 23074,  23280,  23478,  23665,  23842,  24005,  24155,  24289,
+                 24406,  24506,  24587,  24650,  24692,  24715,  24718,  24701,
+                 24665,  24609,  24535,  24444,  24336,  24214,  24077,  23929,
+                 23771,  23605,  23432,  23256,  23078,  22901,  22727,  22558,
+                 22398,  22249,  22112,  21991,  21887,  21803,  21741,  21703,
+                 21689,  21703,  21745,  21816,  21916,  22047,  22209,  22402,
+                 22624,  22876,  23157,  23465,  23799,  24156,  24535,  24932,
+                 25346,  25773,  26210,  26652,  27098,  27541,  27979,  28407,
+                 28820,  29214,  29585,  29928,  30238,  30511,  30742,  30927,
+                 31062,  31143,  31166,  31128,  31024,  30853,  30611,  30295,
+                 29905,  29438,  28893,  28270,  27567,  26785,  25924,  24986,
+                 23971,  22882,  21720,  20489,  19191,  17829,  16409,  14933,
+                 13406,  11834,  10221,   8573,   6894,   5192,   3472,   1739,
+                     0,
+            }},
+            // 32 harmonics
+            {{
+                     0,  -3472,  -6897, -10231, -13429, -16452, -19263, -21832,
+                -24133, -26148, -27862, -29270, -30372, -31175, -31692, -31941,
+                -31946, -31734, -31335, -30783, -30112, -29357, -28553, -27731,
+                -26924, -26157, -25455, -24839, -24322, -23917, -23628, -23457,
+                -23402, -23455, -23605, -23839, -24141, -24494, -24880, -25279,
+                -25673, -26046, -26382, -26667, -26891, -27046, -27126, -27129,
+                -27057, -26913, -26704, -26438, -26126, -25779, -25410, -25032,
+                -24658, -24300, -23970, -23678, -23430, -23234, -23094, -23010,
+                -22983, -23009, -23084, -23201, -23352, -23529, -23721, -23919,
+                -24112, -24292, -24448, -24574, -24663, -24711, -24714, -24672,
+                -24585, -24456, -24288, -24086, -23859, -23612, -23353, -23092,
+                -22836, -22593, -22370, -22173, -22008, -21877, -21784, -21729,
+                -21711, -21728, -21776, -21852, -21949, -22061, -22180, -22302,
+                -22417, -22520, -22605, -22666, -22700, -22703, -22674, -22612,
+                -22519, -22396, -22246, -22074, -21885, -21684, -21477, -21270,
+                -21070, -20881, -20710, -20560, -20434, -20336, -20266, -20225,
+                -20212, -20225, -20260, -20314, -20382, -20459, -20541, -20621,
+                -20694, -20756, -20802, -20827, -20831, -20809, -20762, -20690,
+                -20592, -20473, -20334, -20178, -20011, -19837, -19660, -19485,
+                -19318, -19162, -19021, -18899, -18798, -18720, -18664, -18632,
+                -18622, -18631, -18658, -18698, -18749, -18805, -18862, -18916,
+                -18963, -18998, -19019, -19022, -19005, -18968, -18909, -18829,
+                -18730, -18613, -18480, -18336, -18184, -18027, -17870, -17717,
+                -17572, -17438, -17318, -17215, -17130, -17065, -17020, -16993,
+                -16985, -16993, -17013, -17045, -17083, -17124, -17164, -17200,
+                -17228, -17244, -17247, -17234, -17204, -17155, -17088, -17003,
+                -16902, -16786, -16659, -16523, -16381, -16237, -16095, -15957,
+                -15828, -15710, -15606, -15517, -15444, -15389, -15351, -15329,
+                -15322, -15328, -15345, -15369, -15397, -15427, -15455, -15477,
+                -15491, -15493, -15483, -15458, -15416, -15359, -15285, -15197,
+                -15094, -14980, -14856, -14726, -14593, -14459, -14328, -14203,
+                -14086, -13981, -13888, -13810, -13746, -13699, -13666, -13648,
+                -13642, -13647, -13660, -13679, -13700, -13721, -13739, -13750,
+                -13753, -13744, -13723, -13688, -13638, -13574, -13495, -13403,
+                -13300, -13187, -13066, -12941, -12814, -12688, -12566, -12451,
+                -12345, -12249, -12166, -12097, -12041, -12000, -11972, -11957,
+                -11952, -11956, -11966, -11981, -11996, -12009, -12019, -12021,
+                -12014, -11996, -11966, -11923, -11866, -11796, -11713, -11619,
+                -11514, -11402, -11284, -11163, -11042, -10923, -10809, -10702,
+                -10604, -10517, -10442, -10380, -10331, -10295, -10271, -10258,
+                -10254, -10258, -10266, -10276, -10286, -10293, -10295, -10290,
+                -10275, -10250, -10212, -10162, -10099, -10024,  -9937,  -9840,
+                 -9735,  -9624,  -9508,  -9391,  -9274,  -9161,  -9053,  -8954,
+                 -8863,  -8784,  -8716,  -8660,  -8617,  -8586,  -8566,  -8555,
+                 -8551,  -8554,  -8560,  -8567,  -8572,  -8574,  -8570,  -8558,
+                 -8536,  -8503,  -8459,  -8403,  -8334,  -8255,  -8165,  -8066,
+                 -7960,  -7849,  -7736,  -7622,  -7509,  -7402,  -7300,  -7206,
+                 -7123,  -7050,  -6988,  -6939,  -6901,  -6874,  -6856,  -6847,
+                 -6845,  -6847,  -6851,  -6855,  -6856,  -6853,  -6843,  -6825,
+                 -6796,  -6758,  -6707,  -6645,  -6572,  -6489,  -6396,  -6295,
+                 -6189,  -6078,  -5966,  -5855,  -5747,  -5644,  -5548,  -5460,
+                 -5382,  -5316,  -5260,  -5216,  -5183,  -5159,  -5145,  -5138,
+                 -5136,  -5137,  -5139,  -5140,  -5138,  -5130,  -5115,  -5091,
+                 -5057,  -5012,  -4956,  -4889,  -4811,  -4724,  -4628,  -4526,
+                 -4419,  -4309,  -4199,  -4091,  -3986,  -3887,  -3796,  -3714,
+                 -3642,  -3581,  -3531,  -3492,  -3463,  -3444,  -3432,  -3426,
+                 -3425,  -3425,  -3426,  -3424,  -3418,  -3406,  -3386,  -3357,
+                 -3317,  -3267,  -3205,  -3133,  -3051,  -2961,  -2862,  -2758,
+                 -2651,  -2542,  -2433,  -2327,  -2226,  -2132,  -2046,  -1969,
+                 -1902,  -1847,  -1802,  -1768,  -1743,  -1727,  -1718,  -1713,
+                 -1713,  -1713,  -1712,  -1708,  -1698,  -1682,  -1657,  -1622,
+                 -1577,  -1522,  -1455,  -1378,  -1292,  -1198,  -1097,   -992,
+                  -884,   -775,   -668,   -565,   -467,   -377,   -295,   -223,
+                  -162,   -112,    -72,    -43,    -22,    -10,     -3,      0,
+                     0,      0,      3,     10,     22,     43,     72,    112,
+                   162,    223,    295,    377,    467,    565,    668,    775,
+                   884,    992,   1097,   1198,   1292,   1378,   1455,   1522,
+                  1577,   1622,   1657,   1682,   1698,   1708,   1712,   1713,
+                  1713,   1713,   1718,   1727,   1743,   1768,   1802,   1847,
+                  1902,   1969,   2046,   2132,   2226,   2327,   2433,   2542,
+                  2651,   2758,   2862,   2961,   3051,   3133,   3205,   3267,
+                  3317,   3357,   3386,   3406,   3418,   3424,   3426,   3425,
+                  3425,   3426,   3432,   3444,   3463,   3492,   3531,   3581,
+                  3642,   3714,   3796,   3887,   3986,   4091,   4199,   4309,
+                  4419,   4526,   4628,   4724,   4811,   4889,   4956,   5012,
+                  5057,   5091,   5115,   5130,   5138,   5140,   5139,   5137,
+                  5136,   5138,   5145,   5159,   5183,   5216,   5260,   5316,
+                  5382,   5460,   5548,   5644,   5747,   5855,   5966,   6078,
+                  6189,   6295,   6396,   6489,   6572,   6645,   6707,   6758,
+                  6796,   6825,   6843,   6853,   6856,   6855,   6851,   6847,
+                  6845,   6847,   6856,   6874,   6901,   6939,   6988,   7050,
+                  7123,   7206,   7300,   7402,   7509,   7622,   7736,   7849,
+                  7960,   8066,   8165,   8255,   8334,   8403,   8459,   8503,
+                  8536,   8558,   8570,   8574,   8572,   8567,   8560,   8554,
+                  8551,   8555,   8566,   8586,   8617,   8660,   8716,   8784,
+                  8863,   8954,   9053,   9161,   9274,   9391,   9508,   9624,
+                  9735,   9840,   9937,  10024,  10099,  10162,  10212,  10250,
+                 10275,  10290,  10295,  10293,  10286,  10276,  10266,  10258,
+                 10254,  10258,  10271,  10295,  10331,  10380,  10442,  10517,
+                 10604,  10702,  10809,  10923,  11042,  11163,  11284,  11402,
+                 11514,  11619,  11713,  11796,  11866,  11923,  11966,  11996,
+                 12014,  12021,  12019,  12009,  11996,  11981,  11966,  11956,
+                 11952,  11957,  11972,  12000,  12041,  12097,  12166,  12249,
+                 12345,  12451,  12566,  12688,  12814,  12941,  13066,  13187,
+                 13300,  13403,  13495,  13574,  13638,  13688,  13723,  13744,
+                 13753,  13750,  13739,  13721,  13700,  13679,  13660,  13647,
+                 13642,  13648,  13666,  13699,  13746,  13810,  13888,  13981,
+                 14086,  14203,  14328,  14459,  14593,  14726,  14856,  14980,
+                 15094,  15197,  15285,  15359,  15416,  15458,  15483,  15493,
+                 15491,  15477,  15455,  15427,  15397,  15369,  15345,  15328,
+                 15322,  15329,  15351,  15389,  15444,  15517,  15606,  15710,
+                 15828,  15957,  16095,  16237,  16381,  16523,  16659,  16786,
+                 16902,  17003,  17088,  17155,  17204,  17234,  17247,  17244,
+                 17228,  17200,  17164,  17124,  17083,  17045,  17013,  16993,
+                 16985,  16993,  17020,  17065,  17130,  17215,  17318,  17438,
+                 17572,  17717,  17870,  18027,  18184,  18336,  18480,  18613,
+                 18730,  18829,  18909,  18968,  19005,  19022,  19019,  18998,
+                 18963,  18916,  18862,  18805,  18749,  18698,  18658,  18631,
+                 18622,  18632,  18664,  18720,  18798,  18899,  19021,  19162,
+                 19318,  19485,  19660,  19837,  20011,  20178,  20334,  20473,
+                 20592,  20690,  20762,  20809,  20831,  20827,  20802,  20756,
+                 20694,  20621,  20541,  20459,  20382,  20314,  20260,  20225,
+                 20212,  20225,  20266,  20336,  20434,  20560,  20710,  20881,
+                 21070,  21270,  21477,  21684,  21885,  22074,  22246,  22396,
+                 22519,  22612,  22674,  22703,  22700,  22666,  22605,  22520,
+                 22417,  22302,  22180,  22061,  21949,  21852,  21776,  21728,
+                 21711,  21729,  21784,  21877,  22008,  22173,  22370,  22593,
+                 22836,  23092,  23353,  23612,  23859,  24086,  24288,  24456,
+                 24585,  24672,  24714,  24711,  24663,  24574,  24448,  24292,
+                 24112,  23919,  23721,  23529,  23352,  23201,  23084,  23009,
+                 22983,  23010,  23094,  23234,  23430,  23678,  23970,  24300,
+                 24658,  25032,  25410,  25779,  26126,  26438,  26704,  26913,
+                 27057,  27129,  27126,  27046,  26891,  26667,  26382,  26046,
+                 25673,  25279,  24880,  24494,  24141,  23839,  23605,  23455,
+                 23402,  23457,  23628,  23917,  24322,  24839,  25455,  26157,
+                 26924,  27731,  28553,  29357,  30112,  30783,  31335,  31734,
+                 31946,  31941,  31692,  31175,  30372,  29270,  27862,  26148,
+                 24133,  21832,  19263,  16452,  13429,  10231,   6897,   3472,
+                     0,
+            }},
+            // 64 harmonics
+            {{
+                     0,  -6899, -13440, -19299, -24214, -28008, -30603, -32023,
+                -32384, -31880, -30756, -29279, -27713, -26287, -25177, -24490,
+                -24265, -24470, -25017, -25783, -26623, -27400, -27997, -28333,
+                -28372, -28126, -27644, -27009, -26318, -25669, -25150, -24820,
+                -24709, -24812, -25094, -25492, -25932, -26339, -26643, -26797,
+                -26777, -26586, -26252, -25825, -25366, -24936, -24592, -24373,
+                -24300, -24369, -24555, -24818, -25107, -25368, -25555, -25634,
+                -25588, -25420, -25153, -24821, -24469, -24143, -23883, -23719,
+                -23664, -23715, -23853, -24046, -24254, -24438, -24561, -24598,
+                -24538, -24384, -24154, -23877, -23587, -23322, -23112, -22980,
+                -22937, -22977, -23085, -23234, -23393, -23528, -23611, -23622,
+                -23553, -23408, -23202, -22960, -22711, -22486, -22309, -22199,
+                -22163, -22196, -22283, -22403, -22527, -22629, -22684, -22677,
+                -22602, -22463, -22274, -22057, -21838, -21641, -21488, -21393,
+                -21362, -21390, -21463, -21561, -21660, -21737, -21772, -21752,
+                -21672, -21538, -21362, -21163, -20965, -20790, -20654, -20571,
+                -20544, -20568, -20630, -20712, -20792, -20851, -20870, -20839,
+                -20756, -20625, -20458, -20275, -20094, -19935, -19813, -19740,
+                -19716, -19737, -19790, -19859, -19924, -19967, -19974, -19935,
+                -19848, -19720, -19562, -19390, -19223, -19077, -18967, -18901,
+                -18880, -18898, -18944, -19002, -19055, -19086, -19082, -19037,
+                -18948, -18822, -18670, -18508, -18352, -18218, -18117, -18057,
+                -18038, -18054, -18094, -18143, -18186, -18206, -18194, -18143,
+                -18052, -17928, -17782, -17628, -17481, -17356, -17264, -17209,
+                -17192, -17206, -17241, -17283, -17316, -17328, -17309, -17253,
+                -17160, -17038, -16897, -16749, -16611, -16494, -16408, -16358,
+                -16342, -16355, -16386, -16421, -16447, -16451, -16425, -16365,
+                -16271, -16150, -16013, -15872, -15741, -15631, -15551, -15504,
+                -15490, -15502, -15528, -15558, -15577, -15575, -15544, -15479,
+                -15384, -15265, -15131, -14995, -14870, -14767, -14692, -14649,
+                -14636, -14646, -14670, -14694, -14708, -14700, -14663, -14596,
+                -14499, -14381, -14250, -14120, -14000, -13902, -13832, -13793,
+                -13781, -13790, -13810, -13830, -13838, -13824, -13784, -13713,
+                -13616, -13498, -13371, -13244, -13130, -13037, -12971, -12935,
+                -12924, -12932, -12949, -12965, -12968, -12950, -12905, -12832,
+                -12733, -12617, -12492, -12370, -12260, -12172, -12110, -12076,
+                -12066, -12073, -12088, -12100, -12098, -12076, -12027, -11951,
+                -11852, -11737, -11614, -11495, -11390, -11306, -11248, -11216,
+                -11207, -11213, -11225, -11234, -11228, -11202, -11150, -11072,
+                -10972, -10857, -10737, -10621, -10520, -10440, -10385, -10355,
+                -10347, -10352, -10363, -10368, -10359, -10328, -10273, -10193,
+                -10092,  -9978,  -9860,  -9747,  -9650,  -9573,  -9522,  -9494,
+                 -9486,  -9491,  -9500,  -9502,  -9489,  -9455,  -9396,  -9314,
+                 -9213,  -9099,  -8983,  -8874,  -8780,  -8707,  -8658,  -8632,
+                 -8625,  -8630,  -8636,  -8635,  -8619,  -8581,  -8520,  -8436,
+                 -8334,  -8221,  -8107,  -8001,  -7910,  -7840,  -7794,  -7770,
+                 -7764,  -7768,  -7772,  -7769,  -7749,  -7708,  -7644,  -7558,
+                 -7456,  -7344,  -7231,  -7128,  -7040,  -6973,  -6930,  -6908,
+                 -6902,  -6905,  -6908,  -6902,  -6879,  -6835,  -6769,  -6681,
+                 -6578,  -6467,  -6356,  -6255,  -6170,  -6106,  -6066,  -6045,
+                 -6040,  -6042,  -6044,  -6035,  -6009,  -5963,  -5893,  -5804,
+                 -5700,  -5590,  -5480,  -5382,  -5300,  -5239,  -5201,  -5182,
+                 -5178,  -5179,  -5179,  -5168,  -5139,  -5090,  -5018,  -4927,
+                 -4823,  -4713,  -4605,  -4509,  -4430,  -4372,  -4336,  -4319,
+                 -4315,  -4316,  -4314,  -4301,  -4270,  -4217,  -4143,  -4051,
+                 -3946,  -3836,  -3730,  -3636,  -3560,  -3505,  -3471,  -3456,
+                 -3452,  -3453,  -3449,  -3433,  -3400,  -3344,  -3268,  -3174,
+                 -3069,  -2960,  -2855,  -2763,  -2690,  -2638,  -2606,  -2592,
+                 -2589,  -2589,  -2584,  -2566,  -2530,  -2472,  -2393,  -2298,
+                 -2192,  -2083,  -1980,  -1891,  -1820,  -1770,  -1741,  -1729,
+                 -1726,  -1726,  -1719,  -1699,  -1660,  -1599,  -1519,  -1422,
+                 -1315,  -1207,  -1106,  -1018,   -950,   -903,   -876,   -865,
+                  -863,   -862,   -854,   -832,   -790,   -727,   -644,   -545,
+                  -438,   -331,   -231,   -146,    -80,    -36,    -11,     -1,
+                     0,      1,     11,     36,     80,    146,    231,    331,
+                   438,    545,    644,    727,    790,    832,    854,    862,
+                   863,    865,    876,    903,    950,   1018,   1106,   1207,
+                  1315,   1422,   1519,   1599,   1660,   1699,   1719,   1726,
+                  1726,   1729,   1741,   1770,   1820,   1891,   1980,   2083,
+                  2192,   2298,   2393,   2472,   2530,   2566,   2584,   2589,
+                  2589,   2592,   2606,   2638,   2690,   2763,   2855,   2960,
+                  3069,   3174,   3268,   3344,   3400,   3433,   3449,   3453,
+                  3452,   3456,   3471,   3505,   3560,   3636,   3730,   3836,
+                  3946,   4051,   4143,   4217,   4270,   4301,   4314,   4316,
+                  4315,   4319,   4336,   4372,   4430,   4509,   4605,   4713,
+                  4823,   4927,   5018,   5090,   5139,   5168,   5179,   5179,
+                  5178,   5182,   5201,   5239,   5300,   5382,   5480,   5590,
+                  5700,   5804,   5893,   5963,   6009,   6035,   6044,   6042,
+                  6040,   6045,   6066,   6106,   6170,   6255,   6356,   6467,
+                  6578,   6681,   6769,   6835,   6879,   6902,   6908,   6905,
+                  6902,   6908,   6930,   6973,   7040,   7128,   7231,   7344,
+                  7456,   7558,   7644,   7708,   7749,   7769,   7772,   7768,
+                  7764,   7770,   7794,   7840,   7910,   8001,   8107,   8221,
+                  8334,   8436,   8520,   8581,   8619,   8635,   8636,   8630,
+                  8625,   8632,   8658,   8707,   8780,   8874,   8983,   9099,
+                  9213,   9314,   9396,   9455,   9489,   9502,   9500,   9491,
+                  9486,   9494,   9522,   9573,   9650,   9747,   9860,   9978,
+                 10092,  10193,  10273,  10328,  10359,  10368,  10363,  10352,
+                 10347,  10355,  10385,  10440,  10520,  10621,  10737,  10857,
+                 10972,  11072,  11150,  11202,  11228,  11234,  11225,  11213,
+                 11207,  11216,  11248,  11306,  11390,  11495,  11614,  11737,
+                 11852,  11951,  12027,  12076,  12098,  12100,  12088,  12073,
+                 12066,  12076,  12110,  12172,  12260,  12370,  12492,  12617,
+                 12733,  12832,  12905,  12950,  12968,  12965,  12949,  12932,
+                 12924,  12935,  12971,  13037,  13130,  13244,  13371,  13498,
+                 13616,  13713,  13784,  13824,  13838,  13830,  13810,  13790,
+                 13781,  13793,  13832,  13902,  14000,  14120,  14250,  14381,
+                 14499,  14596,  14663,  14700,  14708,  14694,  14670,  14646,
+                 14636,  14649,  14692,  14767,  14870,  14995,  15131,  15265,
+                 15384,  15479,  15544,  15575,  15577,  15558,  15528,  15502,
+                 15490,  15504,  15551,  15631,  15741,  15872,  16013,  16150,
+                 16271,  16365,  16425,  16451,  16447,  16421,  16386,  16355,
+                 16342,  16358,  16408,  16494,  16611,  16749,  16897,  17038,
+                 17160,  17253,  17309,  17328,  17316,  17283,  17241,  17206,
+                 17192,  17209,  17264,  17356,  17481,  17628,  17782,  17928,
+                 18052,  18143,  18194,  18206,  18186,  18143,  18094,  18054,
+                 18038,  18057,  18117,  18218,  18352,  18508,  18670,  18822,
+                 18948,  19037,  19082,  19086,  19055,  19002,  18944,  18898,
+                 18880,  18901,  18967,  19077,  19223,  19390,  19562,  19720,
+                 19848,  19935,  19974,  19967,  19924,  19859,  19790,  19737,
+                 19716,  19740,  19813,  19935,  20094,  20275,  20458,  20625,
+                 20756,  20839,  20870,  20851,  20792,  20712,  20630,  20568,
+                 20544,  20571,  20654,  20790,  20965,  21163,  21362,  21538,
+                 21672,  21752,  21772,  21737,  21660,  21561,  21463,  21390,
+                 21362,  21393,  21488,  21641,  21838,  22057,  22274,  22463,
+                 22602,  22677,  22684,  22629,  22527,  22403,  22283,  22196,
+                 22163,  22199,  22309,  22486,  22711,  22960,  23202,  23408,
+                 23553,  23622,  23611,  23528,  23393,  23234,  23085,  22977,
+                 22937,  22980,  23112,  23322,  23587,  23877,  24154,  24384,
+                 24538,  24598,  24561,  24438,  24254,  24046,  23853,  23715,
+                 23664,  23719,  23883,  24143,  24469,  24821,  25153,  25420,
+                 25588,  25634,  25555,  25368,  25107,  24818,  24555,  24369,
+                 24300,  24373,  24592,  24936,  25366,  25825,  26252,  26586,
+                 26777,  26797,  26643,  26339,  25932,  25492,  25094,  24812,
+                 24709,  24820,  25150,  25669,  26318,  27009,  27644,  28126,
+                 28372,  28333,  27997,  27400,  26623,  25783,  25017,  24470,
+                 24265,  24490,  25177,  26287,  27713,  29279,  30756,  31880,
+                 32384,  32023,  30603,  28008,  24214,  19299,  13440,   6899,
+                     0,
+            }},
+            // 128 harmonics
+            {{
+                     0, -13445, -24253, -30718, -32603, -31077, -28109, -25605,
+                -24698, -25457, -27098, -28548, -29027, -28402, -27148, -26012,
+                -25576, -25967, -26842, -27631, -27869, -27446, -26631, -25888,
+                -25600, -25862, -26452, -26978, -27116, -26783, -26169, -25613,
+                -25397, -25594, -26034, -26420, -26503, -26220, -25722, -25276,
+                -25103, -25259, -25607, -25906, -25954, -25704, -25281, -24906,
+                -24762, -24892, -25177, -25416, -25440, -25213, -24843, -24518,
+                -24395, -24505, -24745, -24940, -24947, -24736, -24405, -24119,
+                -24010, -24106, -24312, -24474, -24468, -24269, -23969, -23712,
+                -23615, -23699, -23878, -24014, -23997, -23809, -23533, -23299,
+                -23212, -23287, -23444, -23559, -23533, -23354, -23097, -22883,
+                -22803, -22871, -23010, -23107, -23074, -22902, -22661, -22463,
+                -22390, -22451, -22576, -22658, -22619, -22452, -22226, -22041,
+                -21974, -22029, -22141, -22211, -22167, -22005, -21790, -21617,
+                -21555, -21606, -21707, -21766, -21717, -21560, -21355, -21192,
+                -21134, -21181, -21272, -21321, -21269, -21115, -20920, -20766,
+                -20711, -20755, -20837, -20878, -20822, -20672, -20485, -20339,
+                -20287, -20327, -20402, -20436, -20377, -20230, -20050, -19911,
+                -19862, -19899, -19968, -19994, -19933, -19788, -19614, -19482,
+                -19436, -19471, -19533, -19554, -19489, -19347, -19179, -19053,
+                -19009, -19041, -19098, -19113, -19047, -18907, -18744, -18623,
+                -18581, -18612, -18663, -18673, -18605, -18467, -18309, -18193,
+                -18153, -18181, -18228, -18234, -18164, -18027, -17874, -17762,
+                -17724, -17751, -17793, -17795, -17723, -17588, -17439, -17331,
+                -17295, -17320, -17358, -17356, -17282, -17149, -17004, -16900,
+                -16865, -16889, -16923, -16917, -16842, -16711, -16569, -16468,
+                -16435, -16457, -16489, -16479, -16402, -16272, -16134, -16037,
+                -16005, -16026, -16054, -16041, -15963, -15834, -15699, -15605,
+                -15575, -15594, -15619, -15603, -15524, -15396, -15264, -15173,
+                -15144, -15162, -15184, -15165, -15085, -14959, -14829, -14740,
+                -14713, -14729, -14749, -14727, -14646, -14521, -14394, -14308,
+                -14281, -14297, -14314, -14290, -14207, -14083, -13959, -13876,
+                -13850, -13865, -13879, -13852, -13769, -13646, -13524, -13443,
+                -13418, -13432, -13444, -13415, -13331, -13209, -13089, -13010,
+                -12986, -12999, -13009, -12978, -12893, -12772, -12654, -12577,
+                -12554, -12566, -12574, -12541, -12455, -12335, -12219, -12144,
+                -12122, -12133, -12139, -12104, -12017, -11898, -11784, -11711,
+                -11690, -11700, -11704, -11667, -11579, -11461, -11349, -11278,
+                -11258, -11267, -11269, -11230, -11142, -11024, -10914, -10845,
+                -10825, -10834, -10834, -10794, -10704, -10587, -10479, -10412,
+                -10393, -10401, -10399, -10357, -10267, -10150, -10044,  -9979,
+                 -9960,  -9968,  -9964,  -9920,  -9829,  -9714,  -9609,  -9545,
+                 -9528,  -9534,  -9529,  -9484,  -9392,  -9277,  -9174,  -9112,
+                 -9095,  -9101,  -9094,  -9047,  -8955,  -8841,  -8739,  -8679,
+                 -8662,  -8668,  -8660,  -8611,  -8518,  -8404,  -8304,  -8245,
+                 -8230,  -8234,  -8225,  -8174,  -8081,  -7968,  -7869,  -7812,
+                 -7797,  -7801,  -7790,  -7738,  -7644,  -7531,  -7434,  -7378,
+                 -7364,  -7367,  -7355,  -7301,  -7207,  -7095,  -6999,  -6945,
+                 -6931,  -6934,  -6920,  -6865,  -6770,  -6658,  -6564,  -6511,
+                 -6498,  -6500,  -6485,  -6429,  -6333,  -6222,  -6129,  -6078,
+                 -6065,  -6067,  -6050,  -5992,  -5896,  -5786,  -5694,  -5644,
+                 -5632,  -5633,  -5615,  -5556,  -5459,  -5349,  -5259,  -5210,
+                 -5199,  -5199,  -5180,  -5120,  -5022,  -4913,  -4824,  -4777,
+                 -4765,  -4766,  -4745,  -4683,  -4585,  -4477,  -4389,  -4343,
+                 -4332,  -4332,  -4310,  -4247,  -4149,  -4041,  -3955,  -3909,
+                 -3899,  -3898,  -3875,  -3811,  -3712,  -3604,  -3520,  -3475,
+                 -3466,  -3465,  -3440,  -3375,  -3275,  -3168,  -3085,  -3042,
+                 -3033,  -3031,  -3005,  -2938,  -2838,  -2732,  -2650,  -2608,
+                 -2600,  -2597,  -2570,  -2502,  -2402,  -2296,  -2215,  -2174,
+                 -2166,  -2163,  -2135,  -2066,  -1965,  -1860,  -1780,  -1741,
+                 -1733,  -1730,  -1700,  -1630,  -1528,  -1423,  -1345,  -1307,
+                 -1300,  -1296,  -1265,  -1194,  -1092,   -987,   -910,   -873,
+                  -867,   -862,   -830,   -758,   -655,   -551,   -475,   -439,
+                  -433,   -428,   -395,   -321,   -218,   -115,    -40,     -5,
+                     0,      5,     40,    115,    218,    321,    395,    428,
+                   433,    439,    475,    551,    655,    758,    830,    862,
+                   867,    873,    910,    987,   1092,   1194,   1265,   1296,
+                  1300,   1307,   1345,   1423,   1528,   1630,   1700,   1730,
+                  1733,   1741,   1780,   1860,   1965,   2066,   2135,   2163,
+                  2166,   2174,   2215,   2296,   2402,   2502,   2570,   2597,
+                  2600,   2608,   2650,   2732,   2838,   2938,   3005,   3031,
+                  3033,   3042,   3085,   3168,   3275,   3375,   3440,   3465,
+                  3466,   3475,   3520,   3604,   3712,   3811,   3875,   3898,
+                  3899,   3909,   3955,   4041,   4149,   4247,   4310,   4332,
+                  4332,   4343,   4389,   4477,   4585,   4683,   4745,   4766,
+                  4765,   4777,   4824,   4913,   5022,   5120,   5180,   5199,
+                  5199,   5210,   5259,   5349,   5459,   5556,   5615,   5633,
+                  5632,   5644,   5694,   5786,   5896,   5992,   6050,   6067,
+                  6065,   6078,   6129,   6222,   6333,   6429,   6485,   6500,
+                  6498,   6511,   6564,   6658,   6770,   6865,   6920,   6934,
+                  6931,   6945,   6999,   7095,   7207,   7301,   7355,   7367,
+                  7364,   7378,   7434,   7531,   7644,   7738,   7790,   7801,
+                  7797,   7812,   7869,   7968,   8081,   8174,   8225,   8234,
+                  8230,   8245,   8304,   8404,   8518,   8611,   8660,   8668,
+                  8662,   8679,   8739,   8841,   8955,   9047,   9094,   9101,
+                  9095,   9112,   9174,   9277,   9392,   9484,   9529,   9534,
+                  9528,   9545,   9609,   9714,   9829,   9920,   9964,   9968,
+                  9960,   9979,  10044,  10150,  10267,  10357,  10399,  10401,
+                 10393,  10412,  10479,  10587,  10704,  10794,  10834,  10834,
+                 10825,  10845,  10914,  11024,  11142,  11230,  11269,  11267,
+                 11258,  11278,  11349,  11461,  11579,  11667,  11704,  11700,
+                 11690,  11711,  11784,  11898,  12017,  12104,  12139,  12133,
+                 12122,  12144,  12219,  12335,  12455,  12541,  12574,  12566,
+                 12554,  12577,  12654,  12772,  12893,  12978,  13009,  12999,
+                 12986,  13010,  13089,  13209,  13331,  13415,  13444,  13432,
+                 13418,  13443,  13524,  13646,  13769,  13852,  13879,  13865,
+                 13850,  13876,  13959,  14083,  14207,  14290,  14314,  14297,
+                 14281,  14308,  14394,  14521,  14646,  14727,  14749,  14729,
+                 14713,  14740,  14829,  14959,  15085,  15165,  15184,  15162,
+                 15144,  15173,  15264,  15396,  15524,  15603,  15619,  15594,
+                 15575,  15605,  15699,  15834,  15963,  16041,  16054,  16026,
+                 16005,  16037,  16134,  16272,  16402,  16479,  16489,  16457,
+                 16435,  16468,  16569,  16711,  16842,  16917,  16923,  16889,
+                 16865,  16900,  17004,  17149,  17282,  17356,  17358,  17320,
+                 17295,  17331,  17439,  17588,  17723,  17795,  17793,  17751,
+                 17724,  17762,  17874,  18027,  18164,  18234,  18228,  18181,
+                 18153,  18193,  18309,  18467,  18605,  18673,  18663,  18612,
+                 18581,  18623,  18744,  18907,  19047,  19113,  19098,  19041,
+                 19009,  19053,  19179,  19347,  19489,  19554,  19533,  19471,
+                 19436,  19482,  19614,  19788,  19933,  19994,  19968,  19899,
+                 19862,  19911,  20050,  20230,  20377,  20436,  20402,  20327,
+                 20287,  20339,  20485,  20672,  20822,  20878,  20837,  20755,
+                 20711,  20766,  20920,  21115,  21269,  21321,  21272,  21181,
+                 21134,  21192,  21355,  21560,  21717,  21766,  21707,  21606,
+                 21555,  21617,  21790,  22005,  22167,  22211,  22141,  22029,
+                 21974,  22041,  22226,  22452,  22619,  22658,  22576,  22451,
+                 22390,  22463,  22661,  22902,  23074,  23107,  23010,  22871,
+                 22803,  22883,  23097,  23354,  23533,  23559,  23444,  23287,
+                 23212,  23299,  23533,  23809,  23997,  24014,  23878,  23699,
+                 23615,  23712,  23969,  24269,  24468,  24474,  24312,  24106,
+                 24010,  24119,  24405,  24736,  24947,  24940,  24745,  24505,
+                 24395,  24518,  24843,  25213,  25440,  25416,  25177,  24892,
+                 24762,  24906,  25281,  25704,  25954,  25906,  25607,  25259,
+                 25103,  25276,  25722,  26220,  26503,  26420,  26034,  25594,
+                 25397,  25613,  26169,  26783,  27116,  26978,  26452,  25862,
+                 25600,  25888,  26631,  27446,  27869,  27631,  26842,  25967,
+                 25576,  26012,  27148,  28402,  29027,  28548,  27098,  25457,
+                 24698,  25605,  28109,  31077,  32603,  30718,  24253,  13445,
+                     0,
+            }},
+            // 256 harmonics
+            {{
+                     0, -24273, -32712, -28306, -24915, -27335, -29354, -27563,
+                -26010, -27297, -28413, -27264, -26251, -27124, -27879, -27019,
+                -26266, -26924, -27484, -26790, -26188, -26715, -27153, -26566,
+                -26064, -26502, -26857, -26345, -25914, -26287, -26582, -26125,
+                -25747, -26072, -26320, -25906, -25569, -25856, -26067, -25688,
+                -25383, -25639, -25821, -25469, -25191, -25422, -25580, -25251,
+                -24995, -25205, -25343, -25033, -24796, -24988, -25109, -24815,
+                -24594, -24771, -24877, -24598, -24390, -24554, -24647, -24380,
+                -24184, -24337, -24418, -24162, -23977, -24119, -24191, -23944,
+                -23769, -23902, -23964, -23727, -23560, -23685, -23739, -23509,
+                -23350, -23467, -23514, -23292, -23139, -23250, -23290, -23074,
+                -22928, -23033, -23067, -22856, -22716, -22815, -22844, -22639,
+                -22504, -22598, -22621, -22421, -22292, -22380, -22399, -22204,
+                -22079, -22163, -22177, -21986, -21865, -21946, -21956, -21769,
+                -21652, -21728, -21735, -21551, -21438, -21511, -21514, -21334,
+                -21224, -21293, -21293, -21116, -21009, -21076, -21072, -20899,
+                -20795, -20858, -20852, -20681, -20580, -20641, -20632, -20464,
+                -20365, -20423, -20412, -20246, -20150, -20206, -20192, -20029,
+                -19935, -19988, -19972, -19811, -19720, -19771, -19752, -19594,
+                -19505, -19553, -19533, -19376, -19289, -19336, -19313, -19159,
+                -19074, -19119, -19094, -18941, -18858, -18901, -18874, -18724,
+                -18643, -18684, -18655, -18506, -18427, -18466, -18436, -18289,
+                -18211, -18249, -18217, -18071, -17995, -18031, -17998, -17854,
+                -17779, -17814, -17779, -17636, -17563, -17596, -17560, -17419,
+                -17347, -17379, -17341, -17201, -17131, -17161, -17122, -16984,
+                -16915, -16944, -16904, -16766, -16698, -16726, -16685, -16549,
+                -16482, -16509, -16466, -16331, -16266, -16291, -16247, -16114,
+                -16049, -16074, -16029, -15896, -15833, -15856, -15810, -15679,
+                -15617, -15639, -15592, -15461, -15400, -15421, -15373, -15244,
+                -15184, -15204, -15155, -15026, -14967, -14986, -14936, -14809,
+                -14751, -14769, -14718, -14591, -14534, -14552, -14499, -14374,
+                -14318, -14334, -14281, -14156, -14101, -14117, -14063, -13939,
+                -13884, -13899, -13844, -13721, -13668, -13682, -13626, -13504,
+                -13451, -13464, -13408, -13286, -13234, -13247, -13190, -13069,
+                -13018, -13029, -12971, -12851, -12801, -12812, -12753, -12634,
+                -12584, -12594, -12535, -12416, -12367, -12377, -12317, -12199,
+                -12151, -12159, -12098, -11981, -11934, -11942, -11880, -11764,
+                -11717, -11724, -11662, -11547, -11500, -11507, -11444, -11329,
+                -11283, -11289, -11226, -11112, -11067, -11072, -11008, -10894,
+                -10850, -10854, -10790, -10677, -10633, -10637, -10571, -10459,
+                -10416, -10419, -10353, -10242, -10199, -10202, -10135, -10024,
+                 -9982,  -9984,  -9917,  -9807,  -9765,  -9767,  -9699,  -9589,
+                 -9549,  -9549,  -9481,  -9372,  -9332,  -9332,  -9263,  -9154,
+                 -9115,  -9114,  -9045,  -8937,  -8898,  -8897,  -8827,  -8719,
+                 -8681,  -8680,  -8609,  -8502,  -8464,  -8462,  -8391,  -8284,
+                 -8247,  -8245,  -8173,  -8067,  -8030,  -8027,  -7955,  -7849,
+                 -7813,  -7810,  -7737,  -7632,  -7596,  -7592,  -7519,  -7414,
+                 -7379,  -7375,  -7301,  -7197,  -7162,  -7157,  -7083,  -6979,
+                 -6945,  -6940,  -6865,  -6762,  -6728,  -6722,  -6647,  -6544,
+                 -6511,  -6505,  -6429,  -6327,  -6294,  -6287,  -6211,  -6109,
+                 -6077,  -6070,  -5993,  -5892,  -5860,  -5852,  -5775,  -5674,
+                 -5643,  -5635,  -5557,  -5457,  -5426,  -5417,  -5339,  -5239,
+                 -5209,  -5200,  -5121,  -5022,  -4992,  -4982,  -4903,  -4804,
+                 -4775,  -4765,  -4685,  -4587,  -4558,  -4547,  -4467,  -4370,
+                 -4341,  -4330,  -4249,  -4152,  -4124,  -4112,  -4031,  -3935,
+                 -3907,  -3895,  -3814,  -3717,  -3690,  -3677,  -3596,  -3500,
+                 -3473,  -3460,  -3378,  -3282,  -3256,  -3242,  -3160,  -3065,
+                 -3039,  -3025,  -2942,  -2847,  -2822,  -2807,  -2724,  -2630,
+                 -2605,  -2590,  -2506,  -2412,  -2388,  -2372,  -2288,  -2195,
+                 -2171,  -2155,  -2070,  -1977,  -1954,  -1938,  -1852,  -1760,
+                 -1736,  -1720,  -1634,  -1542,  -1519,  -1503,  -1416,  -1325,
+                 -1302,  -1285,  -1199,  -1107,  -1085,  -1068,   -981,   -890,
+                  -868,   -850,   -763,   -672,   -651,   -633,   -545,   -455,
+                  -434,   -415,   -327,   -237,   -217,   -198,   -109,    -20,
+                     0,     20,    109,    198,    217,    237,    327,    415,
+                   434,    455,    545,    633,    651,    672,    763,    850,
+                   868,    890,    981,   1068,   1085,   1107,   1199,   1285,
+                  1302,   1325,   1416,   1503,   1519,   1542,   1634,   1720,
+                  1736,   1760,   1852,   1938,   1954,   1977,   2070,   2155,
+                  2171,   2195,   2288,   2372,   2388,   2412,   2506,   2590,
+                  2605,   2630,   2724,   2807,   2822,   2847,   2942,   3025,
+                  3039,   3065,   3160,   3242,   3256,   3282,   3378,   3460,
+                  3473,   3500,   3596,   3677,   3690,   3717,   3814,   3895,
+                  3907,   3935,   4031,   4112,   4124,   4152,   4249,   4330,
+                  4341,   4370,   4467,   4547,   4558,   4587,   4685,   4765,
+                  4775,   4804,   4903,   4982,   4992,   5022,   5121,   5200,
+                  5209,   5239,   5339,   5417,   5426,   5457,   5557,   5635,
+                  5643,   5674,   5775,   5852,   5860,   5892,   5993,   6070,
+                  6077,   6109,   6211,   6287,   6294,   6327,   6429,   6505,
+                  6511,   6544,   6647,   6722,   6728,   6762,   6865,   6940,
+                  6945,   6979,   7083,   7157,   7162,   7197,   7301,   7375,
+                  7379,   7414,   7519,   7592,   7596,   7632,   7737,   7810,
+                  7813,   7849,   7955,   8027,   8030,   8067,   8173,   8245,
+                  8247,   8284,   8391,   8462,   8464,   8502,   8609,   8680,
+                  8681,   8719,   8827,   8897,   8898,   8937,   9045,   9114,
+                  9115,   9154,   9263,   9332,   9332,   9372,   9481,   9549,
+                  9549,   9589,   9699,   9767,   9765,   9807,   9917,   9984,
+                  9982,  10024,  10135,  10202,  10199,  10242,  10353,  10419,
+                 10416,  10459,  10571,  10637,  10633,  10677,  10790,  10854,
+                 10850,  10894,  11008,  11072,  11067,  11112,  11226,  11289,
+                 11283,  11329,  11444,  11507,  11500,  11547,  11662,  11724,
+                 11717,  11764,  11880,  11942,  11934,  11981,  12098,  12159,
+                 12151,  12199,  12317,  12377,  12367,  12416,  12535,  12594,
+                 12584,  12634,  12753,  12812,  12801,  12851,  12971,  13029,
+                 13018,  13069,  13190,  13247,  13234,  13286,  13408,  13464,
+                 13451,  13504,  13626,  13682,  13668,  13721,  13844,  13899,
+                 13884,  13939,  14063,  14117,  14101,  14156,  14281,  14334,
+                 14318,  14374,  14499,  14552,  14534,  14591,  14718,  14769,
+                 14751,  14809,  14936,  14986,  14967,  15026,  15155,  15204,
+                 15184,  15244,  15373,  15421,  15400,  15461,  15592,  15639,
+                 15617,  15679,  15810,  15856,  15833,  15896,  16029,  16074,
+                 16049,  16114,  16247,  16291,  16266,  16331,  16466,  16509,
+                 16482,  16549,  16685,  16726,  16698,  16766,  16904,  16944,
+                 16915,  16984,  17122,  17161,  17131,  17201,  17341,  17379,
+                 17347,  17419,  17560,  17596,  17563,  17636,  17779,  17814,
+                 17779,  17854,  17998,  18031,  17995,  18071,  18217,  18249,
+                 18211,  18289,  18436,  18466,  18427,  18506,  18655,  18684,
+                 18643,  18724,  18874,  18901,  18858,  18941,  19094,  19119,
+                 19074,  19159,  19313,  19336,  19289,  19376,  19533,  19553,
+                 19505,  19594,  19752,  19771,  19720,  19811,  19972,  19988,
+                 19935,  20029,  20192,  20206,  20150,  20246,  20412,  20423,
+                 20365,  20464,  20632,  20641,  20580,  20681,  20852,  20858,
+                 20795,  20899,  21072,  21076,  21009,  21116,  21293,  21293,
+                 21224,  21334,  21514,  21511,  21438,  21551,  21735,  21728,
+                 21652,  21769,  21956,  21946,  21865,  21986,  22177,  22163,
+                 22079,  22204,  22399,  22380,  22292,  22421,  22621,  22598,
+                 22504,  22639,  22844,  22815,  22716,  22856,  23067,  23033,
+                 22928,  23074,  23290,  23250,  23139,  23292,  23514,  23467,
+                 23350,  23509,  23739,  23685,  23560,  23727,  23964,  23902,
+                 23769,  23944,  24191,  24119,  23977,  24162,  24418,  24337,
+                 24184,  24380,  24647,  24554,  24390,  24598,  24877,  24771,
+                 24594,  24815,  25109,  24988,  24796,  25033,  25343,  25205,
+                 24995,  25251,  25580,  25422,  25191,  25469,  25821,  25639,
+                 25383,  25688,  26067,  25856,  25569,  25906,  26320,  26072,
+                 25747,  26125,  26582,  26287,  25914,  26345,  26857,  26502,
+                 26064,  26566,  27153,  26715,  26188,  26790,  27484,  26924,
+                 26266,  27019,  27879,  27124,  26251,  27264,  28413,  27297,
+                 26010,  27563,  29354,  27335,  24915,  28306,  32712,  24273,
+                     0,
+            }},
+            // 512 harmonics
+            {{
+                     0, -32766, -25024, -29517, -26227, -28685, -26577, -28260,
+                -26700, -27974, -26731, -27752, -26716, -27564, -26674, -27398,
+                -26616, -27245, -26546, -27101, -26469, -26964, -26386, -26832,
+                -26299, -26704, -26208, -26578, -26115, -26455, -26019, -26334,
+                -25922, -26214, -25824, -26096, -25725, -25978, -25624, -25861,
+                -25523, -25746, -25421, -25630, -25318, -25516, -25215, -25402,
+                -25111, -25288, -25007, -25175, -24903, -25062, -24798, -24949,
+                -24693, -24837, -24588, -24725, -24483, -24613, -24377, -24501,
+                -24271, -24389, -24165, -24278, -24059, -24167, -23953, -24056,
+                -23846, -23945, -23740, -23834, -23633, -23723, -23526, -23613,
+                -23419, -23502, -23312, -23392, -23205, -23281, -23098, -23171,
+                -22991, -23061, -22883, -22951, -22776, -22840, -22669, -22730,
+                -22561, -22620, -22454, -22510, -22346, -22401, -22239, -22291,
+                -22131, -22181, -22023, -22071, -21916, -21961, -21808, -21852,
+                -21700, -21742, -21592, -21632, -21484, -21523, -21376, -21413,
+                -21269, -21304, -21161, -21194, -21053, -21084, -20945, -20975,
+                -20837, -20866, -20729, -20756, -20621, -20647, -20513, -20537,
+                -20404, -20428, -20296, -20318, -20188, -20209, -20080, -20100,
+                -19972, -19990, -19864, -19881, -19756, -19772, -19647, -19663,
+                -19539, -19553, -19431, -19444, -19323, -19335, -19214, -19226,
+                -19106, -19116, -18998, -19007, -18890, -18898, -18781, -18789,
+                -18673, -18680, -18565, -18570, -18456, -18461, -18348, -18352,
+                -18240, -18243, -18131, -18134, -18023, -18025, -17915, -17916,
+                -17806, -17806, -17698, -17697, -17590, -17588, -17481, -17479,
+                -17373, -17370, -17264, -17261, -17156, -17152, -17048, -17043,
+                -16939, -16934, -16831, -16825, -16722, -16716, -16614, -16607,
+                -16505, -16498, -16397, -16389, -16289, -16280, -16180, -16171,
+                -16072, -16061, -15963, -15952, -15855, -15843, -15746, -15734,
+                -15638, -15625, -15529, -15516, -15421, -15407, -15312, -15298,
+                -15204, -15189, -15095, -15080, -14987, -14971, -14878, -14862,
+                -14770, -14754, -14661, -14645, -14553, -14536, -14444, -14427,
+                -14336, -14318, -14227, -14209, -14119, -14100, -14010, -13991,
+                -13902, -13882, -13793, -13773, -13685, -13664, -13576, -13555,
+                -13468, -13446, -13359, -13337, -13250, -13228, -13142, -13119,
+                -13033, -13010, -12925, -12901, -12816, -12792, -12708, -12683,
+                -12599, -12575, -12491, -12466, -12382, -12357, -12273, -12248,
+                -12165, -12139, -12056, -12030, -11948, -11921, -11839, -11812,
+                -11731, -11703, -11622, -11594, -11513, -11485, -11405, -11376,
+                -11296, -11268, -11188, -11159, -11079, -11050, -10971, -10941,
+                -10862, -10832, -10753, -10723, -10645, -10614, -10536, -10505,
+                -10428, -10396, -10319, -10287, -10210, -10179, -10102, -10070,
+                 -9993,  -9961,  -9885,  -9852,  -9776,  -9743,  -9668,  -9634,
+                 -9559,  -9525,  -9450,  -9416,  -9342,  -9307,  -9233,  -9199,
+                 -9125,  -9090,  -9016,  -8981,  -8907,  -8872,  -8799,  -8763,
+                 -8690,  -8654,  -8582,  -8545,  -8473,  -8436,  -8364,  -8328,
+                 -8256,  -8219,  -8147,  -8110,  -8038,  -8001,  -7930,  -7892,
+                 -7821,  -7783,  -7713,  -7674,  -7604,  -7565,  -7495,  -7457,
+                 -7387,  -7348,  -7278,  -7239,  -7170,  -7130,  -7061,  -7021,
+                 -6952,  -6912,  -6844,  -6803,  -6735,  -6694,  -6626,  -6586,
+                 -6518,  -6477,  -6409,  -6368,  -6301,  -6259,  -6192,  -6150,
+                 -6083,  -6041,  -5975,  -5932,  -5866,  -5824,  -5757,  -5715,
+                 -5649,  -5606,  -5540,  -5497,  -5432,  -5388,  -5323,  -5279,
+                 -5214,  -5170,  -5106,  -5062,  -4997,  -4953,  -4888,  -4844,
+                 -4780,  -4735,  -4671,  -4626,  -4563,  -4517,  -4454,  -4408,
+                 -4345,  -4300,  -4237,  -4191,  -4128,  -4082,  -4019,  -3973,
+                 -3911,  -3864,  -3802,  -3755,  -3694,  -3646,  -3585,  -3538,
+                 -3476,  -3429,  -3368,  -3320,  -3259,  -3211,  -3150,  -3102,
+                 -3042,  -2993,  -2933,  -2885,  -2825,  -2776,  -2716,  -2667,
+                 -2607,  -2558,  -2499,  -2449,  -2390,  -2340,  -2281,  -2231,
+                 -2173,  -2123,  -2064,  -2014,  -1955,  -1905,  -1847,  -1796,
+                 -1738,  -1687,  -1630,  -1578,  -1521,  -1469,  -1412,  -1361,
+                 -1304,  -1252,  -1195,  -1143,  -1086,  -1034,   -978,   -925,
+                  -869,   -816,   -760,   -708,   -652,   -599,   -543,   -490,
+                  -435,   -381,   -326,   -272,   -217,   -163,   -109,    -54,
+                     0,     54,    109,    163,    217,    272,    326,    381,
+                   435,    490,    543,    599,    652,    708,    760,    816,
+                   869,    925,    978,   1034,   1086,   1143,   1195,   1252,
+                  1304,   1361,   1412,   1469,   1521,   1578,   1630,   1687,
+                  1738,   1796,   1847,   1905,   1955,   2014,   2064,   2123,
+                  2173,   2231,   2281,   2340,   2390,   2449,   2499,   2558,
+                  2607,   2667,   2716,   2776,   2825,   2885,   2933,   2993,
+                  3042,   3102,   3150,   3211,   3259,   3320,   3368,   3429,
+                  3476,   3538,   3585,   3646,   3694,   3755,   3802,   3864,
+                  3911,   3973,   4019,   4082,   4128,   4191,   4237,   4300,
+                  4345,   4408,   4454,   4517,   4563,   4626,   4671,   4735,
+                  4780,   4844,   4888,   4953,   4997,   5062,   5106,   5170,
+                  5214,   5279,   5323,   5388,   5432,   5497,   5540,   5606,
+                  5649,   5715,   5757,   5824,   5866,   5932,   5975,   6041,
+                  6083,   6150,   6192,   6259,   6301,   6368,   6409,   6477,
+                  6518,   6586,   6626,   6694,   6735,   6803,   6844,   6912,
+                  6952,   7021,   7061,   7130,   7170,   7239,   7278,   7348,
+                  7387,   7457,   7495,   7565,   7604,   7674,   7713,   7783,
+                  7821,   7892,   7930,   8001,   8038,   8110,   8147,   8219,
+                  8256,   8328,   8364,   8436,   8473,   8545,   8582,   8654,
+                  8690,   8763,   8799,   8872,   8907,   8981,   9016,   9090,
+                  9125,   9199,   9233,   9307,   9342,   9416,   9450,   9525,
+                  9559,   9634,   9668,   9743,   9776,   9852,   9885,   9961,
+                  9993,  10070,  10102,  10179,  10210,  10287,  10319,  10396,
+                 10428,  10505,  10536,  10614,  10645,  10723,  10753,  10832,
+                 10862,  10941,  10971,  11050,  11079,  11159,  11188,  11268,
+                 11296,  11376,  11405,  11485,  11513,  11594,  11622,  11703,
+                 11731,  11812,  11839,  11921,  11948,  12030,  12056,  12139,
+                 12165,  12248,  12273,  12357,  12382,  12466,  12491,  12575,
+                 12599,  12683,  12708,  12792,  12816,  12901,  12925,  13010,
+                 13033,  13119,  13142,  13228,  13250,  13337,  13359,  13446,
+                 13468,  13555,  13576,  13664,  13685,  13773,  13793,  13882,
+                 13902,  13991,  14010,  14100,  14119,  14209,  14227,  14318,
+                 14336,  14427,  14444,  14536,  14553,  14645,  14661,  14754,
+                 14770,  14862,  14878,  14971,  14987,  15080,  15095,  15189,
+                 15204,  15298,  15312,  15407,  15421,  15516,  15529,  15625,
+                 15638,  15734,  15746,  15843,  15855,  15952,  15963,  16061,
+                 16072,  16171,  16180,  16280,  16289,  16389,  16397,  16498,
+                 16505,  16607,  16614,  16716,  16722,  16825,  16831,  16934,
+                 16939,  17043,  17048,  17152,  17156,  17261,  17264,  17370,
+                 17373,  17479,  17481,  17588,  17590,  17697,  17698,  17806,
+                 17806,  17916,  17915,  18025,  18023,  18134,  18131,  18243,
+                 18240,  18352,  18348,  18461,  18456,  18570,  18565,  18680,
+                 18673,  18789,  18781,  18898,  18890,  19007,  18998,  19116,
+                 19106,  19226,  19214,  19335,  19323,  19444,  19431,  19553,
+                 19539,  19663,  19647,  19772,  19756,  19881,  19864,  19990,
+                 19972,  20100,  20080,  20209,  20188,  20318,  20296,  20428,
+                 20404,  20537,  20513,  20647,  20621,  20756,  20729,  20866,
+                 20837,  20975,  20945,  21084,  21053,  21194,  21161,  21304,
+                 21269,  21413,  21376,  21523,  21484,  21632,  21592,  21742,
+                 21700,  21852,  21808,  21961,  21916,  22071,  22023,  22181,
+                 22131,  22291,  22239,  22401,  22346,  22510,  22454,  22620,
+                 22561,  22730,  22669,  22840,  22776,  22951,  22883,  23061,
+                 22991,  23171,  23098,  23281,  23205,  23392,  23312,  23502,
+                 23419,  23613,  23526,  23723,  23633,  23834,  23740,  23945,
+                 23846,  24056,  23953,  24167,  24059,  24278,  24165,  24389,
+                 24271,  24501,  24377,  24613,  24483,  24725,  24588,  24837,
+                 24693,  24949,  24798,  25062,  24903,  25175,  25007,  25288,
+                 25111,  25402,  25215,  25516,  25318,  25630,  25421,  25746,
+                 25523,  25861,  25624,  25978,  25725,  26096,  25824,  26214,
+                 25922,  26334,  26019,  26455,  26115,  26578,  26208,  26704,
+                 26299,  26832,  26386,  26964,  26469,  27101,  26546,  27245,
+                 26616,  27398,  26674,  27564,  26716,  27752,  26731,  27974,
+                 26700,  28260,  26577,  28685,  26227,  29517,  25024,  32766,
+                     0,
+            }},
+        };
+
+        const MipmapData square[kLevels] = {
+            // 1 harmonic
+            {{
+                     0,    201,    402,    603,    804,   1005,   1206,   1407,
+                  1608,   1809,   2009,   2210,   2410,   2611,   2811,   3011,
+                  3212,   3412,   3612,   3811,   4011,   4210,   4410,   4609,
+                  4808,   5007,   5205,   5404,   5602,   5800,   5997,   6195,
+                  6392,   6589,   6786,   6983,   7179,   7375,   7571,   7766,
+                  7961,   8156,   8351,   8545,   8739,   8933,   9126,   9319,
+                  9511,   9704,   9896,  10087,  10278,  10469,  10659,  10849,
+                 11039,  11228,  11416,  11605,  11792,  11980,  12167,  12353,
+                 12539,  12725,  12910,  13094,  13278,  13462,  13645,  13827,
+                 14009,  14191,  14372,  14552,  14732,  14911,  15090,  15268,
+                 15446,  15623,  15799,  15975,  16150,  16325,  16499,  16672,
+                 16845,  17017,  17189,  17360,  17530,  17699,  17868,  18036,
+                 18204,  18371,  18537,  18702,  18867,  19031,  19194,  19357,
+                 19519,  19680,  19840,  20000,  20159,  20317,  20474,  20631,
+                 20787,  20942,  21096,  21249,  21402,  21554,  21705,  21855,
+                 22004,  22153,  22301,  22447,  22593,  22739,  22883,  23026,
+                 23169,  23311,  23452,  23592,  23731,  23869,  24006,  24143,
+                 24278,  24413,  24546,  24679,  24811,  24942,  25071,  25200,
+                 25328,  25456,  25582,  25707,  25831,  25954,  26076,  26198,
+                 26318,  26437,  26555,  26673,  26789,  26904,  27018,  27132,
+                 27244,  27355,  27465,  27574,  27682,  27790,  27896,  28000,
+                 28104,  28207,  28309,  28410,  28509,  28608,  28705,  28802,
+                 28897,  28991,  29084,  29176,  29267,  29357,  29446,  29534,
+                 29620,  29706,  29790,  29873,  29955,  30036,  30116,  30194,
+                 30272,  30348,  30423,  30498,  30570,  30642,  30713,  30782,
+                 30851,  30918,  30984,  31049,  31112,  31175,  31236,  31296,
+                 31355,  31413,  31469,  31525,  31579,  31632,  31684,  31735,
+                 31784,  31832,  31879,  31925,  31970,  32013,  32056,  32097,
+                 32136,  32175,  32212,  32249,  32284,  32317,  32350,  32381,
+                 32411,  32440,  32468,  32494,  32520,  32544,  32566,  32588,
+                 32608,  32627,  32645,  32662,  32677,  32691,  32704,  32716,
+                 32727,  32736,  32744,  32751,  32756,  32760,  32764,  32765,
+                 32766,  32765,  32764,  32760,  32756,  32751,  32744,  32736,
+                 32727,  32716,  32704,  32691,  32677,  32662,  32645,  32627,
+                 32608,  32588,  32566,  32544,  32520,  32494,  32468,  32440,
+                 32411,  32381,  32350,  32317,  32284,  32249,  32212,  32175,
+                 32136,  32097,  32056,  32013,  31970,  31925,  31879,  31832,
+                 31784,  31735,  31684,  31632,  31579,  31525,  31469,  31413,
+                 31355,  31296,  31236,  31175,  31112,  31049,  30984,  30918,
+                 30851,  30782,  30713,  30642,  30570,  30498,  30423,  30348,
+                 30272,  30194,  30116,  30036,  29955,  29873,  29790,  29706,
+                 29620,  29534,  29446,  29357,  29267,  29176,  29084,  28991,
+                 28897,  28802,  28705,  28608,  28509,  28410,  28309,  28207,
+                 28104,  28000,  27896,  27790,  27682,  27574,  27465,  27355,
+                 27244,  27132,  27018,  26904,  26789,  26673,  26555,  26437,
+                 26318,  26198,  26076,  25954,  25831,  25707,  25582,  25456,
+                 25328,  25200,  25071,  24942,  24811,  24679,  24546,  24413,
+                 24278,  24143,  24006,  23869,  23731,  23592,  23452,  23311,
+                 23169,  23026,  22883,  22739,  22593,  22447,  22301,  22153,
+                 22004,  21855,  21705,  21554,  21402,  21249,  21096,  20942,
+                 20787,  20631,  20474,  20317,  20159,  20000,  19840,  19680,
+                 19519,  19357,  19194,  19031,  18867,  18702,  18537,  18371,
+                 18204,  18036,  17868,  17699,  17530,  17360,  17189,  17017,
+                 16845,  16672,  16499,  16325,  16150,  15975,  15799,  15623,
+                 15446,  15268,  15090,  14911,  14732,  14552,  14372,  14191,
+                 14009,  13827,  13645,  13462,  13278,  13094,  12910,  12725,
+                 12539,  12353,  12167,  11980,  11792,  11605,  11416,  11228,
+                 11039,  10849,  10659,  10469,  10278,  10087,   9896,   9704,
+                  9511,   9319,   9126,   8933,   8739,   8545,   8351,   8156,
+                  7961,   7766,   7571,   7375,   7179,   6983,   6786,   6589,
+                  6392,   6195,   5997,   5800,   5602,   5404,   5205,   5007,
+                  4808,   4609,   4410,   4210,   4011,   3811,   3612,   3412,
+                  3212,   3011,   2811,   2611,   2410,   2210,   2009,   1809,
+                  1608,   1407,   1206,   1005,    804,    603,    402,    201,
+                     0,   -201,   -402,   -603,   -804,  -1005,  -1206,  -1407,
+                 -1608,  -1809,  -2009,  -2210,  -2410,  -2611,  -2811,  -3011,
+                 -3212,  -3412,  -3612,  -3811,  -4011,  -4210,  -4410,  -4609,
+                 -4808,  -5007,  -5205,  -5404,  -5602,  -5800,  -5997,  -6195,
+                 -6392,  -6589,  -6786,  -6983,  -7179,  -7375,  -7571,  -7766,
+                 -7961,  -8156,  -8351,  -8545,  -8739,  -8933,  -9126,  -9319,
+                 -9511,  -9704,  -9896, -10087, -10278, -10469, -10659, -10849,
+                -11039, -11228, -11416, -11605, -11792, -11980, -12167, -12353,
+                -12539, -12725, -12910, -13094, -13278, -13462, -13645, -13827,
+                -14009, -14191, -14372, -14552, -14732, -14911, -15090, -15268,
+                -15446, -15623, -15799, -15975, -16150, -16325, -16499, -16672,
+                -16845, -17017, -17189, -17360, -17530, -17699, -17868, -18036,
+                -18204, -18371, -18537, -18702, -18867, -19031, -19194, -19357,
+                -19519, -19680, -19840, -20000, -20159, -20317, -20474, -20631,
+                -20787, -20942, -21096, -21249, -21402, -21554, -21705, -21855,
+                -22004, -22153, -22301, -22447, -22593, -22739, -22883, -23026,
+                -23169, -23311, -23452, -23592, -23731, -23869, -24006, -24143,
+                -24278, -24413, -24546, -24679, -24811, -24942, -25071, -25200,
+                -25328, -25456, -25582, -25707, -25831, -25954, -26076, -26198,
+                -26318, -26437, -26555, -26673, -26789, -26904, -27018, -27132,
+                -27244, -27355, -27465, -27574, -27682, -27790, -27896, -28000,
+                -28104, -28207, -28309, -28410, -28509, -28608, -28705, -28802,
+                -28897, -28991, -29084, -29176, -29267, -29357, -29446, -29534,
+                -29620, -29706, -29790, -29873, -29955, -30036, -30116, -30194,
+                -30272, -30348, -30423, -30498, -30570, -30642, -30713, -30782,
+                -30851, -30918, -30984, -31049, -31112, -31175, -31236, -31296,
+                -31355, -31413, -31469, -31525, -31579, -31632, -31684, -31735,
+                -31784, -31832, -31879, -31925, -31970, -32013, -32056, -32097,
+                -32136, -32175, -32212, -32249, -32284, -32317, -32350, -32381,
+                -32411, -32440, -32468, -32494, -32520, -32544, -32566, -32588,
+                -32608, -32627, -32645, -32662, -32677, -32691, -32704, -32716,
+                -32727, -32736, -32744, -32751, -32756, -32760, -32764, -32765,
+                -32766, -32765, -32764, -32760, -32756, -32751, -32744, -32736,
+                -32727, -32716, -32704, -32691, -32677, -32662, -32645, -32627,
+                -32608, -32588, -32566, -32544, -32520, -32494, -32468, -32440,
+                -32411, -32381, -32350, -32317, -32284, -32249, -32212, -32175,
+                -32136, -32097, -32056, -32013, -31970, -31925, -31879, -31832,
+                -31784, -31735, -31684, -31632, -31579, -31525, -31469, -31413,
+                -31355, -31296, -31236, -31175, -31112, -31049, -30984, -30918,
+                -30851, -30782, -30713, -30642, -30570, -30498, -30423, -30348,
+                -30272, -30194, -30116, -30036, -29955, -29873, -29790, -29706,
+                -29620, -29534, -29446, -29357, -29267, -29176, -29084, -28991,
+                -28897, -28802, -28705, -28608, -28509, -28410, -28309, -28207,
+                -28104, -28000, -27896, -27790, -27682, -27574, -27465, -27355,
+                -27244, -27132, -27018, -26904, -26789, -26673, -26555, -26437,
+                -26318, -26198, -26076, -25954, -25831, -25707, -25582, -25456,
+                -25328, -25200, -25071, -24942, -24811, -24679, -24546, -24413,
+                -24278, -24143, -24006, -23869, -23731, -23592, -23452, -23311,
+                -23169, -23026, -22883, -22739, -22593, -22447, -22301, -22153,
+                -22004, -21855, -21705, -21554, -21402, -21249, -21096, -20942,
+                -20787, -20631, -20474, -20317, -20159, -20000, -19840, -19680,
+                -19519, -19357, -19194, -19031, -18867, -18702, -18537, -18371,
+                -18204, -18036, -17868, -17699, -17530, -17360, -17189, -17017,
+                -16845, -16672, -16499, -16325, -16150, -15975, -15799, -15623,
+                -15446, -15268, -15090, -14911, -14732, -14552, -14372, -14191,
+                -14009, -13827, -13645, -13462, -13278, -13094, -12910, -12725,
+                -12539, -12353, -12167, -11980, -11792, -11605, -11416, -11228,
+                -11039, -10849, -10659, -10469, -10278, -10087,  -9896,  -9704,
+                 -9511,  -9319,  -9126,  -8933,  -8739,  -8545,  -8351,  -8156,
+                 -7961,  -7766,  -7571,  -7375,  -7179,  -6983,  -6786,  -6589,
+                 -6392,  -6195,  -5997,  -5800,  -5602,  -5404,  -5205,  -5007,
+                 -4808,  -4609,  -4410,  -4210,  -4011,  -3811,  -3612,  -3412,
+                 -3212,  -3011,  -2811,  -2611,  -2410,  -2210,  -2009,  -1809,
+                 -1608,  -1407,  -1206,  -1005,   -804,   -603,   -402,   -201,
+                     0,
+            }},
+            // 2 harmonics
+            {{
+                     0,    201,    402,    603,    804,   1005,   1206,   1407,
+                  1608,   1809,   2009,   2210,   2410,   2611,   2811,   3011,
+                  3212,   3412,   3612,   3811,   4011,   4210,   4410,   4609,
+                  4808,   5007,   5205,   5404,   5602,   5800,   5997,   6195,
+                  6392,   6589,   6786,   6983,   7179,   7375,   7571,   7766,
+                  7961,   8156,   8351,   8545,   8739,   8933,   9126,   9319,
+                  9511,   9704,   9896,  10087,  10278,  10469,  10659,  10849,
+                 11039,  11228,  11416,  11605,  11792,  11980,  12167,  12353,
+                 12539,  12725,  12910,  13094,  13278,  13462,  13645,  13827,
+                 14009,  14191,  14372,  14552,  14732,  14911,  15090,  15268,
+                 15446,  15623,  15799,  15975,  16150,  16325,  16499,  16672,
+                 16845,  17017,  17189,  17360,  17530,  17699,  17868,  18036,
+                 18204,  18371,  18537,  18702,  18867,  19031,  19194,  19357,
+                 19519,  19680,  19840,  20000,  20159,  20317,  20474,  20631,
+                 20787,  20942,  21096,  21249,  21402,  21554,  21705,  21855,
+                 22004,  22153,  22301,  22447,  22593,  22739,  22883,  23026,
+                 23169,  23311,  23452,  23592,  23731,  23869,  24006,  24143,
+                 24278,  24413,  24546,  24679,  24811,  24942,  25071,  25200,
+                 25328,  25456,  25582,  25707,  25831,  25954,  26076,  26198,
+                 26318,  26437,  26555,  26673,  26789,  26904,  27018,  27132,
+                 27244,  27355,  27465,  27574,  27682,  27790,  27896,  28000,
+                 28104,  28207,  28309,  28410,  28509,  28608,  28705,  28802,
+                 28897,  28991,  29084,  29176,  29267,  29357,  29446,  29534,
+                 29620,  29706,  29790,  29873,  29955,  30036,  30116,  30194,
+                 30272,  30348,  30423,  30498,  30570,  30642,  30713,  30782,
+                 30851,  30918,  30984,  31049,  31112,  31175,  31236,  31296,
+                 31355,  31413,  31469,  31525,  31579,  31632,  31684,  31735,
+                 31784,  31832,  31879,  31925,  31970,  32013,  32056,  32097,
+                 32136,  32175,  32212,  32249,  32284,  32317,  32350,  32381,
+                 32411,  32440,  32468,  32494,  32520,  32544,  32566,  32588,
+                 32608,  32627,  32645,  32662,  32677,  32691,  32704,  32716,
+                 32727,  32736,  32744,  32751,  32756,  32760,  32764,  32765,
+                 32766,  32765,  32764,  32760,  32756,  32751,  32744,  32736,
+                 32727,  32716,  32704,  32691,  32677,  32662,  32645,  32627,
+                 32608,  32588,  32566,  32544,  32520,  32494,  32468,  32440,
+                 32411,  32381,  32350,  32317,  32284,  32249,  32212,  32175,
+                 32136,  32097,  32056,  32013,  31970,  31925,  31879,  31832,
+                 31784,  31735,  31684,  31632,  31579,  31525,  31469,  31413,
+                 31355,  31296,  31236,  31175,  31112,  31049,  30984,  30918,
+                 30851,  30782,  30713,  30642,  30570,  30498,  30423,  30348,
+                 30272,  30194,  30116,  30036,  29955,  29873,  29790,  29706,
+                 29620,  29534,  29446,  29357,  29267,  29176,  29084,  28991,
+                 28897,  28802,  28705,  28608,  28509,  28410,  28309,  28207,
+                 28104,  28000,  27896,  27790,  27682,  27574,  27465,  27355,
+                 27244,  27132,  27018,  26904,  26789,  26673,  26555,  26437,
+                 26318,  26198,  26076,  25954,  25831,  25707,  25582,  25456,
+                 25328,  25200,  25071,  24942,  24811,  24679,  24546,  24413,
+                 24278,  24143,  24006,  23869,  23731,  23592,  23452,  23311,
+                 23169,  23026,  22883,  22739,  22593,  22447,  22301,  22153,
+                 22004,  21855,  21705,  21554,  21402,  21249,  21096,  20942,
+                 20787,  20631,  20474,  20317,  20159,  20000,  19840,  19680,
+                 19519,  19357,  19194,  19031,  18867,  18702,  18537,  18371,
+                 18204,  18036,  17868,  17699,  17530,  17360,  17189,  17017,
+                 16845,  16672,  16499,  16325,  16150,  15975,  15799,  15623,
+                 15446,  15268,  15090,  14911,  14732,  14552,  14372,  14191,
+                 14009,  13827,  13645,  13462,  13278,  13094,  12910,  12725,
+                 12539,  12353,  12167,  11980,  11792,  11605,  11416,  11228,
+                 11039,  10849,  10659,  10469,  10278,  10087,   9896,   9704,
+                  9511,   9319,   9126,   8933,   8739,   8545,   8351,   8156,
+                  7961,   7766,   7571,   7375,   7179,   6983,   6786,   6589,
+                  6392,   6195,   5997,   5800,   5602,   5404,   5205,   5007,
+                  4808,   4609,   4410,   4210,   4011,   3811,   3612,   3412,
+                  3212,   3011,   2811,   2611,   2410,   2210,   2009,   1809,
+                  1608,   1407,   1206,   1005,    804,    603,    402,    201,
+                     0,   -201,   -402,   -603,   -804,  -1005,  -1206,  -1407,
+                 -1608,  -1809,  -2009,  -2210,  -2410,  -2611,  -2811,  -3011,
+                 -3212,  -3412,  -3612,  -3811,  -4011,  -4210,  -4410,  -4609,
+                 -4808,  -5007,  -5205,  -5404,  -5602,  -5800,  -5997,  -6195,
+                 -6392,  -6589,  -6786,  -6983,  -7179,  -7375,  -7571,  -7766,
+                 -7961,  -8156,  -8351,  -8545,  -8739,  -8933,  -9126,  -9319,
+                 -9511,  -9704,  -9896, -10087, -10278, -10469, -10659, -10849,
+                -11039, -11228, -11416, -11605, -11792, -11980, -12167, -12353,
+                -12539, -12725, -12910, -13094, -13278, -13462, -13645, -13827,
+                -14009, -14191, -14372, -14552, -14732, -14911, -15090, -15268,
+                -15446, -15623, -15799, -15975, -16150, -16325, -16499, -16672,
+                -16845, -17017, -17189, -17360, -17530, -17699, -17868, -18036,
+                -18204, -18371, -18537, -18702, -18867, -19031, -19194, -19357,
+                -19519, -19680, -19840, -20000, -20159, -20317, -20474, -20631,
+                -20787, -20942, -21096, -21249, -21402, -21554, -21705, -21855,
+                -22004, -22153, -22301, -22447, -22593, -22739, -22883, -23026,
+                -23169, -23311, -23452, -23592, -23731, -23869, -24006, -24143,
+                -24278, -24413, -24546, -24679, -24811, -24942, -25071, -25200,
+                -25328, -25456, -25582, -25707, -25831, -25954, -26076, -26198,
+                -26318, -26437, -26555, -26673, -26789, -26904, -27018, -27132,
+                -27244, -27355, -27465, -27574, -27682, -27790, -27896, -28000,
+                -28104, -28207, -28309, -28410, -28509, -28608, -28705, -28802,
+                -28897, -28991, -29084, -29176, -29267, -29357, -29446, -29534,
+                -29620, -29706, -29790, -29873, -29955, -30036, -30116, -30194,
+                -30272, -30348, -30423, -30498, -30570, -30642, -30713, -30782,
+                -30851, -30918, -30984, -31049, -31112, -31175, -31236, -31296,
+                -31355, -31413, -31469, -31525, -31579, -31632, -31684, -31735,
+                -31784, -31832, -31879, -31925, -31970, -32013, -32056, -32097,
+                -32136, -32175, -32212, -32249, -32284, -32317, -32350, -32381,
+                -32411, -32440, -32468, -32494, -32520, -32544, -32566, -32588,
+                -32608, -32627, -32645, -32662, -32677, -32691, -32704, -32716,
+                -32727, -32736, -32744, -32751, -32756, -32760, -32764, -32765,
+                -32766, -32765, -32764, -32760, -32756, -32751, -32744, -32736,
+                -32727, -32716, -32704, -32691, -32677, -32662, -32645, -32627,
+                -32608, -32588, -32566, -32544, -32520, -32494, -32468, -32440,
+                -32411, -32381, -32350, -32317, -32284, -32249, -32212, -32175,
+                -32136, -32097, -32056, -32013, -31970, -31925, -31879, -31832,
+                -31784, -31735, -31684, -31632, -31579, -31525, -31469, -31413,
+                -31355, -31296, -31236, -31175, -31112, -31049, -30984, -30918,
+                -30851, -30782, -30713, -30642, -30570, -30498, -30423, -30348,
+                -30272, -30194, -30116, -30036, -29955, -29873, -29790, -29706,
+                -29620, -29534, -29446, -29357, -29267, -29176, -29084, -28991,
+                -28897, -28802, -28705, -28608, -28509, -28410, -28309, -28207,
+                -28104, -28000, -27896, -27790, -27682, -27574, -27465, -27355,
+                -27244, -27132, -27018, -26904, -26789, -26673, -26555, -26437,
+                -26318, -26198, -26076, -25954, -25831, -25707, -25582, -25456,
+                -25328, -25200, -25071, -24942, -24811, -24679, -24546, -24413,
+                -24278, -24143, -24006, -23869, -23731, -23592, -23452, -23311,
+                -23169, -23026, -22883, -22739, -22593, -22447, -22301, -22153,
+                -22004, -21855, -21705, -21554, -21402, -21249, -21096, -20942,
+                -20787, -20631, -20474, -20317, -20159, -20000, -19840, -19680,
+                -19519, -19357, -19194, -19031, -18867, -18702, -18537, -18371,
+                -18204, -18036, -17868, -17699, -17530, -17360, -17189, -17017,
+                -16845, -16672, -16499, -16325, -16150, -15975, -15799, -15623,
+                -15446, -15268, -15090, -14911, -14732, -14552, -14372, -14191,
+                -14009, -13827, -13645, -13462, -13278, -13094, -12910, -12725,
+                -12539, -12353, -12167, -11980, -11792, -11605, -11416, -11228,
+                -11039, -10849, -10659, -10469, -10278, -10087,  -9896,  -9704,
+                 -9511,  -9319,  -9126,  -8933,  -8739,  -8545,  -8351,  -8156,
+                 -7961,  -7766,  -7571,  -7375,  -7179,  -6983,  -6786,  -6589,
+                 -6392,  -6195,  -5997,  -5800,  -5602,  -5404,  -5205,  -5007,
+                 -4808,  -4609,  -4410,  -4210,  -4011,  -3811,  -3612,  -3412,
+                 -3212,  -3011,  -2811,  -2611,  -2410,  -2210,  -2009,  -1809,
+                 -1608,  -1407,  -1206,  -1005,   -804,   -603,   -402,   -201,
+                     0,
+            }},
+            // 4 harmonics
+            {{
+                     0,    402,    804,   1206,   1608,   2009,   2410,   2810,
+                  3210,   3610,   4008,   4406,   4803,   5200,   5595,   5989,
+                  6382,   6774,   7165,   7554,   7942,   8328,   8713,   9096,
+                  9478,   9857,  10235,  10611,  10985,  11357,  11727,  12095,
+                 12460,  12823,  13184,  13543,  13899,  14252,  14603,  14951,
+                 15296,  15639,  15979,  16315,  16649,  16980,  17308,  17633,
+                 17954,  18273,  18588,  18899,  19208,  19513,  19814,  20112,
+                 20407,  20698,  20985,  21268,  21548,  21824,  22097,  22365,
+                 22630,  22890,  23147,  23400,  23649,  23894,  24135,  24371,
+                 24604,  24832,  25057,  25277,  25493,  25705,  25913,  26116,
+                 26315,  26510,  26701,  26887,  27069,  27247,  27420,  27589,
+                 27754,  27914,  28070,  28222,  28370,  28513,  28651,  28786,
+                 28916,  29042,  29163,  29280,  29393,  29502,  29606,  29706,
+                 29802,  29894,  29981,  30065,  30144,  30219,  30289,  30356,
+                 30419,  30477,  30532,  30583,  30629,  30672,  30711,  30746,
+                 30777,  30804,  30828,  30848,  30864,  30876,  30885,  30890,
+                 30892,  30890,  30885,  30877,  30865,  30849,  30831,  30809,
+                 30784,  30756,  30725,  30691,  30654,  30614,  30571,  30525,
+                 30477,  30426,  30372,  30316,  30257,  30196,  30132,  30066,
+                 29997,  29927,  29854,  29779,  29702,  29623,  29542,  29459,
+                 29375,  29288,  29200,  29111,  29019,  28927,  28833,  28737,
+                 28640,  28542,  28443,  28343,  28241,  28139,  28036,  27931,
+                 27826,  27721,  27615,  27508,  27400,  27292,  27184,  27075,
+                 26966,  26857,  26748,  26638,  26529,  26420,  26310,  26201,
+                 26092,  25984,  25875,  25767,  25660,  25553,  25446,  25341,
+                 25236,  25131,  25028,  24925,  24823,  24722,  24623,  24524,
+                 24426,  24330,  24235,  24141,  24048,  23957,  23867,  23778,
+                 23691,  23606,  23522,  23440,  23360,  23281,  23204,  23129,
+                 23055,  22984,  22914,  22846,  22781,  22717,  22655,  22596,
+                 22538,  22483,  22429,  22378,  22329,  22283,  22238,  22196,
+                 22157,  22119,  22084,  22051,  22021,  21993,  21967,  21944,
+                 21923,  21904,  21888,  21875,  21864,  21855,  21849,  21845,
+                 21844,  21845,  21849,  21855,  21864,  21875,  21888,  21904,
+                 21923,  21944,  21967,  21993,  22021,  22051,  22084,  22119,
+                 22157,  22196,  22238,  22283,  22329,  22378,  22429,  22483,
+                 22538,  22596,  22655,  22717,  22781,  22846,  22914,  22984,
+                 23055,  23129,  23204,  23281,  23360,  23440,  23522,  23606,
+                 23691,  23778,  23867,  23957,  24048,  24141,  24235,  24330,
+                 24426,  24524,  24623,  24722,  24823,  24925,  25028,  25131,
+                 25236,  25341,  25446,  25553,  25660,  25767,  25875,  25984,
+                 26092,  26201,  26310,  26420,  26529,  26638,  26748,  26857,
+                 26966,  27075,  27184,  27292,  27400,  27508,  27615,  27721,
+                 27826,  27931,  28036,  28139,  28241,  28343,  28443,  28542,
+                 28640,  28737,  28833,  28927,  29019,  29111,  29200,  29288,
+                 29375,  29459,  29542,  29623,  29702,  29779,  29854,  29927,
+                 29997,  30066,  30132,  30196,  30257,  30316,  30372,  30426,
+                 30477,  30525,  30571,  30614,  30654,  30691,  30725,  30756,
+                 30784,  30809,  30831,  30849,  30865,  30877,  30885,  30890,
+                 30892,  30890,  30885,  30876,  30864,  30848,  30828,  30804,
+                 30777,  30746,  30711,  30672,  30629,  30583,  30532,  30477,
+                 30419,  30356,  30289,  30219,  30144,  30065,  29981,  29894,
+                 29802,  29706,  29606,  29502,  29393,  29280,  29163,  29042,
+                 28916,  28786,  28651,  28513,  28370,  28222,  28070,  27914,
+                 27754,  27589,  27420,  27247,  27069,  26887,  26701,  26510,
+                 26315,  26116,  25913,  25705,  25493,  25277,  25057,  24832,
+                 24604,  24371,  24135,  23894,  23649,  23400,  23147,  22890,
+                 22630,  22365,  22097,  21824,  21548,  21268,  20985,  20698,
+                 20407,  20112,  19814,  19513,  19208,  18899,  18588,  18273,
+                 17954,  17633,  17308,  16980,  16649,  16315,  15979,  15639,
+                 15296,  14951,  14603,  14252,  13899,  13543,  13184,  12823,
+                 12460,  12095,  11727,  11357,  10985,  10611,  10235,   9857,
+                  9478,   9096,   8713,   8328,   7942,   7554,   7165,   6774,
+                  6382,   5989,   5595,   5200,   4803,   4406,   4008,   3610,
+                  3210,   2810,   2410,   2009,   1608,   1206,    804,    402,
+                     0,   -402,   -804,  -1206,  -1608,  -2009,  -2410,  -2810,
+                 -3210,  -3610,  -4008,  -4406,  -4803,  -5200,  -5595,  -5989,
+                 -6382,  -6774,  -7165,  -7554,  -7942,  -8328,  -8713,  -9096,
+                 -9478,  -9857, -10235, -10611, -10985, -11357, -11727, -12095,
+                -12460, -12823, -13184, -13543, -13899, -14252, -14603, -14951,
+                -15296, -15639, -15979, -16315, -16649, -16980, -17308, -17633,
+                -17954, -18273, -18588, -18899, -19208, -19513, -19814, -20112,
+                -20407, -20698, -20985, -21268, -21548, -21824, -22097, -22365,
+                -22630, -22890, -23147, -23400, -23649, -23894, -24135, -24371,
+                -24604, -24832, -25057, -25277, -25493, -25705, -25913, -26116,
+                -26315, -26510, -26701, -26887, -27069, -27247, -27420, -27589,
+                -27754, -27914, -28070, -28222, -28370, -28513, -28651, -28786,
+                -28916, -29042, -29163, -29280, -29393, -29502, -29606, -29706,
+                -29802, -29894, -29981, -30065, -30144, -30219, -30289, -30356,
+                -30419, -30477, -30532, -30583, -30629, -30672, -30711, -30746,
+                -30777, -30804, -30828, -30848, -30864, -30876, -30885, -30890,
+                -30892, -30890, -30885, -30877, -30865, -30849, -30831, -30809,
+                -30784, -30756, -30725, -30691, -30654, -30614, -30571, -30525,
+                -30477, -30426, -30372, -30316, -30257, -30196, -30132, -30066,
+                -29997, -29927, -29854, -29779, -29702, -29623, -29542, -29459,
+                -29375, -29288, -29200, -29111, -29019, -28927, -28833, -28737,
+                -28640, -28542, -28443, -28343, -28241, -28139, -28036, -27931,
+                -27826, -27721, -27615, -27508, -27400, -27292, -27184, -27075,
+                -26966, -26857, -26748, -26638, -26529, -26420, -26310, -26201,
+                -26092, -25984, -25875, -25767, -25660, -25553, -25446, -25341,
+                -25236, -25131, -25028, -24925, -24823, -24722, -24623, -24524,
+                -24426, -24330, -24235, -24141, -24048, -23957, -23867, -23778,
+                -23691, -23606, -23522, -23440, -23360, -23281, -23204, -23129,
+                -23055, -22984, -22914, -22846, -22781, -22717, -22655, -22596,
+                -22538, -22483, -22429, -22378, -22329, -22283, -22238, -22196,
+                -22157, -22119, -22084, -22051, -22021, -21993, -21967, -21944,
+                -21923, -21904, -21888, -21875, -21864, -21855, -21849, -21845,
+                -21844, -21845, -21849, -21855, -21864, -21875, -21888, -21904,
+                -21923, -21944, -21967, -21993, -22021, -22051, -22084, -22119,
+                -22157, -22196, -22238, -22283, -22329, -22378, -22429, -22483,
+                -22538, -22596, -22655, -22717, -22781, -22846, -22914, -22984,
+                -23055, -23129, -23204, -23281, -23360, -23440, -23522, -23606,
+                -23691, -23778, -23867, -23957, -24048, -24141, -24235, -24330,
+                -24426, -24524, -24623, -24722, -24823, -24925, -25028, -25131,
+                -25236, -25341, -25446, -25553, -25660, -25767, -25875, -25984,
+                -26092, -26201, -26310, -26420, -26529, -26638, -26748, -26857,
+                -26966, -27075, -27184, -27292, -27400, -27508, -27615, -27721,
+                -27826, -27931, -28036, -28139, -28241, -28343, -28443, -28542,
+                -28640, -28737, -28833, -28927, -29019, -29111, -29200, -29288,
+                -29375, -29459, -29542, -29623, -29702, -29779, -29854, -29927,
+                -29997, -30066, -30132, -30196, -30257, -30316, -30372, -30426,
+                -30477, -30525, -30571, -30614, -30654, -30691, -30725, -30756,
+                -30784, -30809, -30831, -30849, -30865, -30877, -30885, -30890,
+                -30892, -30890, -30885, -30876, -30864, -30848, -30828, -30804,
+                -30777, -30746, -30711, -30672, -30629, -30583, -30532, -30477,
+                -30419, -30356, -30289, -30219, -30144, -30065, -29981, -29894,
+                -29802, -29706, -29606, -29502, -29393, -29280, -29163, -29042,
+                -28916, -28786, -28651, -28513, -28370, -28222, -28070, -27914,
+                -27754, -27589, -27420, -27247, -27069, -26887, -26701, -26510,
+                -26315, -26116, -25913, -25705, -25493, -25277, -25057, -24832,
+                -24604, -24371, -24135, -23894, -23649, -23400, -23147, -22890,
+                -22630, -22365, -22097, -21824, -21548, -21268, -20985, -20698,
+                -20407, -20112, -19814, -19513, -19208, -18899, -18588, -18273,
+                -17954, -17633, -17308, -16980, -16649, -16315, -15979, -15639,
+                -15296, -14951, -14603, -14252, -13899, -13543, -13184, -12823,
+                -12460, -12095, -11727, -11357, -10985, -10611, -10235,  -9857,
+                 -9478,  -9096,  -8713,  -8328,  -7942,  -7554,  -7165,  -6774,
+                 -6382,  -5989,  -5595,  -5200,  -4803,  -4406,  -4008,  -3610,
+                 -3210,  -2810,  -2410,  -2009,  -1608,  -1206,   -804,   -402,
+                     0,
+            }},
+            // 8 harmonics
+            {{
+                     0,    804,   1608,   2410,   3210,   4008,   4802,   5593,
+                  6380,   7161,   7937,   8706,   9469,  10224,  10972,  11711,
+                 12441,  13161,  13871,  14571,  15259,  15936,  16601,  17254,
+                 17893,  18520,  19132,  19730,  20315,  20884,  21438,  21977,
+                 22500,  23007,  23498,  23973,  24432,  24873,  25298,  25706,
+                 26097,  26470,  26827,  27166,  27488,  27793,  28080,  28351,
+                 28604,  28840,  29060,  29263,  29449,  29619,  29773,  29910,
+                 30032,  30139,  30230,  30306,  30368,  30416,  30449,  30469,
+                 30475,  30469,  30450,  30419,  30376,  30322,  30258,  30182,
+                 30097,  30003,  29899,  29787,  29666,  29538,  29403,  29262,
+                 29114,  28960,  28801,  28638,  28470,  28299,  28124,  27947,
+                 27767,  27586,  27403,  27219,  27035,  26851,  26667,  26484,
+                 26302,  26122,  25944,  25769,  25596,  25427,  25260,  25098,
+                 24940,  24786,  24638,  24494,  24355,  24222,  24095,  23973,
+                 23858,  23749,  23647,  23551,  23462,  23380,  23305,  23237,
+                 23176,  23123,  23076,  23037,  23005,  22980,  22962,  22952,
+                 22948,  22952,  22962,  22979,  23003,  23033,  23070,  23113,
+                 23162,  23217,  23277,  23343,  23415,  23491,  23572,  23657,
+                 23747,  23841,  23939,  24040,  24145,  24252,  24362,  24475,
+                 24589,  24706,  24824,  24943,  25063,  25184,  25306,  25427,
+                 25548,  25669,  25788,  25907,  26025,  26140,  26254,  26366,
+                 26476,  26583,  26687,  26788,  26886,  26980,  27071,  27157,
+                 27240,  27319,  27393,  27462,  27527,  27587,  27642,  27693,
+                 27738,  27778,  27812,  27842,  27866,  27885,  27898,  27906,
+                 27909,  27906,  27898,  27885,  27867,  27843,  27814,  27781,
+                 27742,  27699,  27651,  27599,  27542,  27481,  27416,  27348,
+                 27275,  27199,  27120,  27037,  26952,  26864,  26773,  26681,
+                 26586,  26489,  26391,  26292,  26191,  26090,  25988,  25885,
+                 25783,  25680,  25578,  25477,  25376,  25277,  25179,  25082,
+                 24987,  24894,  24804,  24715,  24630,  24547,  24467,  24391,
+                 24318,  24248,  24182,  24120,  24062,  24008,  23958,  23913,
+                 23872,  23836,  23805,  23778,  23756,  23739,  23726,  23719,
+                 23716,  23719,  23726,  23739,  23756,  23778,  23805,  23836,
+                 23872,  23913,  23958,  24008,  24062,  24120,  24182,  24248,
+                 24318,  24391,  24467,  24547,  24630,  24715,  24804,  24894,
+                 24987,  25082,  25179,  25277,  25376,  25477,  25578,  25680,
+                 25783,  25885,  25988,  26090,  26191,  26292,  26391,  26489,
+                 26586,  26681,  26773,  26864,  26952,  27037,  27120,  27199,
+                 27275,  27348,  27416,  27481,  27542,  27599,  27651,  27699,
+                 27742,  27781,  27814,  27843,  27867,  27885,  27898,  27906,
+                 27909,  27906,  27898,  27885,  27866,  27842,  27812,  27778,
+                 27738,  27693,  27642,  27587,  27527,  27462,  27393,  27319,
+                 27240,  27157,  27071,  26980,  26886,  26788,  26687,  26583,
+                 26476,  26366,  26254,  26140,  26025,  25907,  25788,  25669,
+                 25548,  25427,  25306,  25184,  25063,  24943,  24824,  24706,
+                 24589,  24475,  24362,  24252,  24145,  24040,  23939,  23841,
+                 23747,  23657,  23572,  23491,  23415,  23343,  23277,  23217,
+                 23162,  23113,  23070,  23033,  23003,  22979,  22962,  22952,
+                 22948,  22952,  22962,  22980,  23005,  23037,  23076,  23123,
+                 23176,  23237,  23305,  23380,  23462,  23551,  23647,  23749,
+                 23858,  23973,  24095,  24222,  24355,  24494,  24638,  24786,
+                 24940,  25098,  25260,  25427,  25596,  25769,  25944,  26122,
+                 26302,  26484,  26667,  26851,  27035,  27219,  27403,  27586,
+                 27767,  27947,  28124,  28299,  28470,  28638,  28801,  28960,
+                 29114,  29262,  29403,  29538,  29666,  29787,  29899,  30003,
+                 30097,  30182,  30258,  30322,  30376,  30419,  30450,  30469,
+                 30475,  30469,  30449,  30416,  30368,  30306,  30230,  30139,
+                 30032,  29910,  29773,  29619,  29449,  29263,  29060,  28840,
+                 28604,  28351,  28080,  27793,  27488,  27166,  26827,  26470,
+                 26097,  25706,  25298,  24873,  24432,  23973,  23498,  23007,
+                 22500,  21977,  21438,  20884,  20315,  19730,  19132,  18520,
+                 17893,  17254,  16601,  15936,  15259,  14571,  13871,  13161,
+                 12441,  11711,  10972,  10224,   9469,   8706,   7937,   7161,
+                  6380,   5593,   4802,   4008,   3210,   2410,   1608,    804,
+                     0,   -804,  -1608,  -2410,  -3210,  -4008,  -4802,  -5593,
+                 -6380,  -7161,  -7937,  -8706,  -9469, -10224, -10972, -11711,
+                -12441, -13161, -13871, -14571, -15259, -15936, -16601, -17254,
+                -17893, -18520, -19132, -19730, -20315, -20884, -21438, -21977,
+                -22500, -23007, -23498, -23973, -24432, -24873, -25298, -25706,
+                -26097, -26470, -26827, -27166, -27488, -27793, -28080, -28351,
+                -28604, -28840, -29060, -29263, -29449, -29619, -29773, -29910,
+                -30032, -30139, -30230, -30306, -30368, -30416, -30449, -30469,
+                -30475, -30469, -30450, -30419, -30376, -30322, -30258, -30182,
+                -30097, -30003, -29899, -29787, -29666, -29538, -29403, -29262,
+                -29114, -28960, -28801, -28638, -28470, -28299, -28124, -27947,
+                -27767, -27586, -27403, -27219, -27035, -26851, -26667, -26484,
+                -26302, -26122, -25944, -25769, -25596, -25427, -25260, -25098,
+                -24940, -24786, -24638, -24494, -24355, -24222, -24095, -23973,
+                -23858, -23749, -23647, -23551, -23462, -23380, -23305, -23237,
+                -23176, -23123, -23076, -23037, -23005, -22980, -22962, -22952,
+                -22948, -22952, -22962, -22979, -23003, -23033, -23070, -23113,
+                -23162, -23217, -23277, -23343, -23415, -23491, -23572, -23657,
+                -23747, -23841, -23939, -24040, -24145, -24252, -24362, -24475,
+                -24589, -24706, -24824, -24943, -25063, -25184, -25306, -25427,
+                -25548, -25669, -25788, -25907, -26025, -26140, -26254, -26366,
+                -26476, -26583, -26687, -26788, -26886, -26980, -27071, -27157,
+                -27240, -27319, -27393, -27462, -27527, -27587, -27642, -27693,
+                -27738, -27778, -27812, -27842, -27866, -27885, -27898, -27906,
+                -27909, -27906, -27898, -27885, -27867, -27843, -27814, -27781,
+                -27742, -27699, -27651, -27599, -27542, -27481, -27416, -27348,
+                -27275, -27199, -27120, -27037, -26952, -26864, -26773, -26681,
+                -26586, -26489, -26391, -26292, -26191, -26090, -25988, -25885,
+                -25783, -25680, -25578, -25477, -25376, -25277, -25179, -25082,
+                -24987, -24894, -24804, -24715, -24630, -24547, -24467, -24391,
+                -24318, -24248, -24182, -24120, -24062, -24008, -23958, -23913,
+                -23872, -23836, -23805, -23778, -23756, -23739, -23726, -23719,
+                -23716, -23719, -23726, -23739, -23756, -23778, -23805, -23836,
+                -23872, -23913, -23958, -24008, -24062, -24120, -24182, -24248,
+                -24318, -24391, -24467, -24547, -24630, -24715, -24804, -24894,
+                -24987, -25082, -25179, -25277, -25376, -25477, -25578, -25680,
+                -25783, -25885, -25988, -26090, -26191, -26292, -26391, -26489,
+                -26586, -26681, -26773, -26864, -26952, -27037, -27120, -27199,
+                -27275, -27348, -27416, -27481, -27542, -27599, -27651, -27699,
+                -27742, -27781, -27814, -27843, -27867, -27885, -27898, -27906,
+                -27909, -27906, -27898, -27885, -27866, -27842, -27812, -27778,
+                -27738, -27693, -27642, -27587, -27527, -27462, -27393, -27319,
+                -27240, -27157, -27071, -26980, -26886, -26788, -26687, -26583,
+                -26476, -26366, -26254, -26140, -26025, -25907, -25788, -25669,
+                -25548, -25427, -25306, -25184, -25063, -24943, -24824, -24706,
+                -24589, -24475, -24362, -24252, -24145, -24040, -23939, -23841,
+                -23747, -23657, -23572, -23491, -23415, -23343, -23277, -23217,
+                -23162, -23113, -23070, -23033, -23003, -22979, -22962, -22952,
+                -22948, -22952, -22962, -22980, -23005, -23037, -23076, -23123,
+                -23176, -23237, -23305, -23380, -23462, -23551, -23647, -23749,
+                -23858, -23973, -24095, -24222, -24355, -24494, -24638, -24786,
+                -24940, -25098, -25260, -25427, -25596, -25769, -25944, -26122,
+                -26302, -26484, -26667, -26851, -27035, -27219, -27403, -27586,
+                -27767, -27947, -28124, -28299, -28470, -28638, -28801, -28960,
+                -29114, -29262, -29403, -29538, -29666, -29787, -29899, -30003,
+                -30097, -30182, -30258, -30322, -30376, -30419, -30450, -30469,
+                -30475, -30469, -30449, -30416, -30368, -30306, -30230, -30139,
+                -30032, -29910, -29773, -29619, -29449, -29263, -29060, -28840,
+                -28604, -28351, -28080, -27793, -27488, -27166, -26827, -26470,
+                -26097, -25706, -25298, -24873, -24432, -23973, -23498, -23007,
+                -22500, -21977, -21438, -20884, -20315, -19730, -19132, -18520,
+                -17893, -17254, -16601, -15936, -15259, -14571, -13871, -13161,
+                -12441, -11711, -10972, -10224,  -9469,  -8706,  -7937,  -7161,
+                 -6380,  -5593,  -4802,  -4008,  -3210,  -2410,  -1608,   -804,
+                     0,
+            }},
+            // 16 harmonics
+            {{
+                     0,   1608,   3210,   4802,   6379,   7936,   9467,  10969,
+                 12436,  13865,  15250,  16589,  17878,  19113,  20292,  21411,
+                 22468,  23461,  24389,  25250,  26043,  26767,  27423,  28009,
+                 28528,  28978,  29363,  29682,  29938,  30133,  30269,  30348,
+                 30374,  30349,  30277,  30161,  30004,  29811,  29584,  29329,
+                 29048,  28745,  28425,  28090,  27746,  27395,  27041,  26688,
+                 26339,  25997,  25664,  25345,  25040,  24753,  24486,  24240,
+                 24017,  23818,  23645,  23498,  23378,  23284,  23218,  23179,
+                 23166,  23178,  23216,  23277,  23362,  23467,  23592,  23734,
+                 23893,  24066,  24251,  24447,  24650,  24859,  25072,  25287,
+                 25501,  25712,  25920,  26121,  26314,  26497,  26669,  26829,
+                 26974,  27105,  27220,  27318,  27398,  27461,  27506,  27533,
+                 27542,  27533,  27507,  27464,  27405,  27331,  27242,  27141,
+                 27027,  26902,  26768,  26627,  26478,  26325,  26169,  26010,
+                 25851,  25694,  25539,  25388,  25243,  25104,  24974,  24852,
+                 24741,  24641,  24552,  24477,  24414,  24365,  24330,  24309,
+                 24302,  24309,  24330,  24364,  24411,  24470,  24541,  24622,
+                 24713,  24813,  24922,  25036,  25157,  25281,  25409,  25538,
+                 25669,  25798,  25926,  26050,  26171,  26286,  26394,  26495,
+                 26588,  26672,  26746,  26810,  26862,  26904,  26933,  26951,
+                 26957,  26951,  26934,  26905,  26864,  26814,  26753,  26683,
+                 26604,  26517,  26424,  26324,  26219,  26111,  25999,  25886,
+                 25772,  25659,  25546,  25437,  25331,  25229,  25133,  25043,
+                 24961,  24886,  24820,  24764,  24717,  24680,  24653,  24637,
+                 24632,  24637,  24653,  24679,  24716,  24762,  24817,  24880,
+                 24952,  25031,  25117,  25208,  25303,  25403,  25505,  25610,
+                 25714,  25819,  25923,  26024,  26123,  26217,  26306,  26389,
+                 26466,  26536,  26597,  26650,  26694,  26729,  26754,  26769,
+                 26774,  26769,  26754,  26729,  26695,  26651,  26599,  26538,
+                 26470,  26395,  26313,  26226,  26135,  26040,  25941,  25841,
+                 25741,  25640,  25540,  25442,  25347,  25256,  25170,  25089,
+                 25014,  24947,  24887,  24835,  24792,  24758,  24734,  24719,
+                 24714,  24719,  24734,  24758,  24792,  24835,  24887,  24947,
+                 25014,  25089,  25170,  25256,  25347,  25442,  25540,  25640,
+                 25741,  25841,  25941,  26040,  26135,  26226,  26313,  26395,
+                 26470,  26538,  26599,  26651,  26695,  26729,  26754,  26769,
+                 26774,  26769,  26754,  26729,  26694,  26650,  26597,  26536,
+                 26466,  26389,  26306,  26217,  26123,  26024,  25923,  25819,
+                 25714,  25610,  25505,  25403,  25303,  25208,  25117,  25031,
+                 24952,  24880,  24817,  24762,  24716,  24679,  24653,  24637,
+                 24632,  24637,  24653,  24680,  24717,  24764,  24820,  24886,
+                 24961,  25043,  25133,  25229,  25331,  25437,  25546,  25659,
+                 25772,  25886,  25999,  26111,  26219,  26324,  26424,  26517,
+                 26604,  26683,  26753,  26814,  26864,  26905,  26934,  26951,
+                 26957,  26951,  26933,  26904,  26862,  26810,  26746,  26672,
+                 26588,  26495,  26394,  26286,  26171,  26050,  25926,  25798,
+                 25669,  25538,  25409,  25281,  25157,  25036,  24922,  24813,
+                 24713,  24622,  24541,  24470,  24411,  24364,  24330,  24309,
+                 24302,  24309,  24330,  24365,  24414,  24477,  24552,  24641,
+                 24741,  24852,  24974,  25104,  25243,  25388,  25539,  25694,
+                 25851,  26010,  26169,  26325,  26478,  26627,  26768,  26902,
+                 27027,  27141,  27242,  27331,  27405,  27464,  27507,  27533,
+                 27542,  27533,  27506,  27461,  27398,  27318,  27220,  27105,
+                 26974,  26829,  26669,  26497,  26314,  26121,  25920,  25712,
+                 25501,  25287,  25072,  24859,  24650,  24447,  24251,  24066,
+                 23893,  23734,  23592,  23467,  23362,  23277,  23216,  23178,
+                 23166,  23179,  23218,  23284,  23378,  23498,  23645,  23818,
+                 24017,  24240,  24486,  24753,  25040,  25345,  25664,  25997,
+                 26339,  26688,  27041,  27395,  27746,  28090,  28425,  28745,
+                 29048,  29329,  29584,  29811,  30004,  30161,  30277,  30349,
+                 30374,  30348,  30269,  30133,  29938,  29682,  29363,  28978,
+                 28528,  28009,  27423,  26767,  26043,  25250,  24389,  23461,
+                 22468,  21411,  20292,  19113,  17878,  16589,  15250,  13865,
+                 12436,  10969,   9467,   7936,   6379,   4802,   3210,   1608,
+                     0,  -1608,  -3210,  -4802,  -6379,  -7936,  -9467, -10969,
+                -12436, -13865, -15250, -16589, -17878, -19113, -20292, -21411,
+                -22468, -23461, -24389, -25250, -26043, -26767, -27423, -28009,
+                -28528, -28978, -29363, -29682, -29938, -30133, -30269, -30348,
+                -30374, -30349, -30277, -30161, -30004, -29811, -29584, -29329,
+                -29048, -28745, -28425, -28090, -27746, -27395, -27041, -26688,
+                -26339, -25997, -25664, -25345, -25040, -24753, -24486, -24240,
+                -24017, -23818, -23645, -23498, -23378, -23284, -23218, -23179,
+                -23166, -23178, -23216, -23277, -23362, -23467, -23592, -23734,
+                -23893, -24066, -24251, -24447, -24650, -24859, -25072, -25287,
+                -25501, -25712, -25920, -26121, -26314, -26497, -26669, -26829,
+                -26974, -27105, -27220, -27318, -27398, -27461, -27506, -27533,
+                -27542, -27533, -27507, -27464, -27405, -27331, -27242, -27141,
+                -27027, -26902, -26768, -26627, -26478, -26325, -26169, -26010,
+                -25851, -25694, -25539, -25388, -25243, -25104, -24974, -24852,
+                -24741, -24641, -24552, -24477, -24414, -24365, -24330, -24309,
+                -24302, -24309, -24330, -24364, -24411, -24470, -24541, -24622,
+                -24713, -24813, -24922, -25036, -25157, -25281, -25409, -25538,
+                -25669, -25798, -25926, -26050, -26171, -26286, -26394, -26495,
+                -26588, -26672, -26746, -26810, -26862, -26904, -26933, -26951,
+                -26957, -26951, -26934, -26905, -26864, -26814, -26753, -26683,
+                -26604, -26517, -26424, -26324, -26219, -26111, -25999, -25886,
+                -25772, -25659, -25546, -25437, -25331, -25229, -25133, -25043,
+                -24961, -24886, -24820, -24764, -24717, -24680, -24653, -24637,
+                -24632, -24637, -24653, -24679, -24716, -24762, -24817, -24880,
+                -24952, -25031, -25117, -25208, -25303, -25403, -25505, -25610,
+                -25714, -25819, -25923, -26024, -26123, -26217, -26306, -26389,
+                -26466, -26536, -26597, -26650, -26694, -26729, -26754, -26769,
+                -26774, -26769, -26754, -26729, -26695, -26651, -26599, -26538,
+                -26470, -26395, -26313, -26226, -26135, -26040, -25941, -25841,
+                -25741, -25640, -25540, -25442, -25347, -25256, -25170, -25089,
+                -25014, -24947, -24887, -24835, -24792, -24758, -24734, -24719,
+                -24714, -24719, -24734, -24758, -24792, -24835, -24887, -24947,
+                -25014, -25089, -25170, -25256, -25347, -25442, -25540, -25640,
+                -25741, -25841, -25941, -26040, -26135, -26226, -26313, -26395,
+                -26470, -26538, -26599, -26651, -26695, -26729, -26754, -26769,
+                -26774, -26769, -26754, -26729, -26694, -26650, -26597, -26536,
+                -26466, -26389, -26306, -26217, -26123, -26024, -25923, -25819,
+                -25714, -25610, -25505, -25403, -25303, -25208, -25117, -25031,
+                -24952, -24880, -24817, -24762, -24716, -24679, -24653, -24637,
+                -24632, -24637, -24653, -24680, -24717, -24764, -24820, -24886,
+                -24961, -25043, -25133, -25229, -25331, -25437, -25546, -25659,
+                -25772, -25886, -25999, -26111, -26219, -26324, -26424, -26517,
+                -26604, -26683, -26753, -26814, -26864, -26905, -26934, -26951,
+                -26957, -26951, -26933, -26904, -26862, -26810, -26746, -26672,
+                -26588, -26495, -26394, -26286, -26171, -26050, -25926, -25798,
+                -25669, -25538, -25409, -25281, -25157, -25036, -24922, -24813,
+                -24713, -24622, -24541, -24470, -24411, -24364, -24330, -24309,
+                -24302, -24309, -24330, -24365, -24414, -24477, -24552, -24641,
+                -24741, -24852, -24974, -25104, -25243, -25388, -25539, -25694,
+                -25851, -26010, -26169, -26325, -26478, -26627, -26768, -26902,
+                -27027, -27141, -27242, -27331, -27405, -27464, -27507, -27533,
+                -27542, -27533, -27506, -27461, -27398, -27318, -27220, -27105,
+                -26974, -26829, -26669, -26497, -26314, -26121, -25920, -25712,
+                -25501, -25287, -25072, -24859, -24650, -24447, -24251, -24066,
+                -23893, -23734, -23592, -23467, -23362, -23277, -23216, -23178,
+                -23166, -23179, -23218, -23284, -23378, -23498, -23645, -23818,
+                -24017, -24240, -24486, -24753, -25040, -25345, -25664, -25997,
+                -26339, -26688, -27041, -27395, -27746, -28090, -28425, -28745,
+                -29048, -29329, -29584, -29811, -30004, -30161, -30277, -30349,
+                -30374, -30348, -30269, -30133, -29938, -29682, -29363, -28978,
+                -28528, -28009, -27423, -26767, -26043, -25250, -24389, -23461,
+                -22468, -21411, -20292, -19113, -17878, -16589, -15250, -13865,
+                -12436, -10969,  -9467,  -7936,  -6379,  -4802,  -3210,  -1608,
+                     0,
+            }},
+            // 32 harmonics
+            {{
+                     0,   3210,   6379,   9466,  12435,  15248,  17874,  20286,
+                 22460,  24378,  26029,  27406,  28509,  29341,  29915,  30244,
+                 30349,  30252,  29981,  29564,  29031,  28413,  27740,  27042,
+                 26347,  25680,  25064,  24517,  24054,  23688,  23425,  23268,
+                 23217,  23266,  23409,  23634,  23928,  24277,  24665,  25076,
+                 25492,  25898,  26279,  26623,  26917,  27153,  27325,  27429,
+                 27463,  27430,  27332,  27177,  26972,  26727,  26453,  26160,
+                 25861,  25567,  25289,  25037,  24820,  24644,  24516,  24438,
+                 24412,  24437,  24512,  24631,  24789,  24979,  25193,  25422,
+                 25657,  25890,  26110,  26311,  26484,  26625,  26728,  26791,
+                 26812,  26792,  26731,  26633,  26503,  26347,  26170,  25981,
+                 25785,  25592,  25408,  25240,  25094,  24976,  24889,  24835,
+                 24818,  24835,  24887,  24970,  25081,  25215,  25367,  25530,
+                 25699,  25866,  26025,  26171,  26297,  26400,  26476,  26523,
+                 26538,  26523,  26477,  26404,  26306,  26188,  26054,  25910,
+                 25760,  25612,  25471,  25341,  25228,  25136,  25068,  25026,
+                 25012,  25026,  25067,  25133,  25221,  25328,  25449,  25580,
+                 25715,  25849,  25978,  26096,  26199,  26282,  26344,  26382,
+                 26395,  26382,  26345,  26285,  26204,  26106,  25994,  25874,
+                 25749,  25625,  25506,  25397,  25302,  25224,  25167,  25132,
+                 25120,  25132,  25166,  25223,  25298,  25390,  25494,  25607,
+                 25723,  25839,  25951,  26053,  26142,  26216,  26270,  26303,
+                 26314,  26303,  26270,  26217,  26145,  26059,  25960,  25853,
+                 25743,  25632,  25527,  25429,  25344,  25275,  25223,  25192,
+                 25181,  25192,  25223,  25274,  25342,  25425,  25520,  25622,
+                 25728,  25834,  25936,  26029,  26111,  26178,  26228,  26258,
+                 26269,  26258,  26228,  26179,  26113,  26032,  25941,  25842,
+                 25738,  25636,  25537,  25446,  25366,  25301,  25253,  25223,
+                 25213,  25223,  25253,  25301,  25365,  25444,  25534,  25631,
+                 25732,  25833,  25930,  26019,  26097,  26161,  26209,  26238,
+                 26248,  26238,  26209,  26162,  26098,  26020,  25931,  25835,
+                 25735,  25635,  25539,  25450,  25373,  25309,  25262,  25233,
+                 25223,  25233,  25262,  25309,  25373,  25450,  25539,  25635,
+                 25735,  25835,  25931,  26020,  26098,  26162,  26209,  26238,
+                 26248,  26238,  26209,  26161,  26097,  26019,  25930,  25833,
+                 25732,  25631,  25534,  25444,  25365,  25301,  25253,  25223,
+                 25213,  25223,  25253,  25301,  25366,  25446,  25537,  25636,
+                 25738,  25842,  25941,  26032,  26113,  26179,  26228,  26258,
+                 26269,  26258,  26228,  26178,  26111,  26029,  25936,  25834,
+                 25728,  25622,  25520,  25425,  25342,  25274,  25223,  25192,
+                 25181,  25192,  25223,  25275,  25344,  25429,  25527,  25632,
+                 25743,  25853,  25960,  26059,  26145,  26217,  26270,  26303,
+                 26314,  26303,  26270,  26216,  26142,  26053,  25951,  25839,
+                 25723,  25607,  25494,  25390,  25298,  25223,  25166,  25132,
+                 25120,  25132,  25167,  25224,  25302,  25397,  25506,  25625,
+                 25749,  25874,  25994,  26106,  26204,  26285,  26345,  26382,
+                 26395,  26382,  26344,  26282,  26199,  26096,  25978,  25849,
+                 25715,  25580,  25449,  25328,  25221,  25133,  25067,  25026,
+                 25012,  25026,  25068,  25136,  25228,  25341,  25471,  25612,
+                 25760,  25910,  26054,  26188,  26306,  26404,  26477,  26523,
+                 26538,  26523,  26476,  26400,  26297,  26171,  26025,  25866,
+                 25699,  25530,  25367,  25215,  25081,  24970,  24887,  24835,
+                 24818,  24835,  24889,  24976,  25094,  25240,  25408,  25592,
+                 25785,  25981,  26170,  26347,  26503,  26633,  26731,  26792,
+                 26812,  26791,  26728,  26625,  26484,  26311,  26110,  25890,
+                 25657,  25422,  25193,  24979,  24789,  24631,  24512,  24437,
+                 24412,  24438,  24516,  24644,  24820,  25037,  25289,  25567,
+                 25861,  26160,  26453,  26727,  26972,  27177,  27332,  27430,
+                 27463,  27429,  27325,  27153,  26917,  26623,  26279,  25898,
+                 25492,  25076,  24665,  24277,  23928,  23634,  23409,  23266,
+                 23217,  23268,  23425,  23688,  24054,  24517,  25064,  25680,
+                 26347,  27042,  27740,  28413,  29031,  29564,  29981,  30252,
+                 30349,  30244,  29915,  29341,  28509,  27406,  26029,  24378,
+                 22460,  20286,  17874,  15248,  12435,   9466,   6379,   3210,
+                     0,  -3210,  -6379,  -9466, -12435, -15248, -17874, -20286,
+                -22460, -24378, -26029, -27406, -28509, -29341, -29915, -30244,
+                -30349, -30252, -29981, -29564, -29031, -28413, -27740, -27042,
+                -26347, -25680, -25064, -24517, -24054, -23688, -23425, -23268,
+                -23217, -23266, -23409, -23634, -23928, -24277, -24665, -25076,
+                -25492, -25898, -26279, -26623, -26917, -27153, -27325, -27429,
+                -27463, -27430, -27332, -27177, -26972, -26727, -26453, -26160,
+                -25861, -25567, -25289, -25037, -24820, -24644, -24516, -24438,
+                -24412, -24437, -24512, -24631, -24789, -24979, -25193, -25422,
+                -25657, -25890, -26110, -26311, -26484, -26625, -26728, -26791,
+                -26812, -26792, -26731, -26633, -26503, -26347, -26170, -25981,
+                -25785, -25592, -25408, -25240, -25094, -24976, -24889, -24835,
+                -24818, -24835, -24887, -24970, -25081, -25215, -25367, -25530,
+                -25699, -25866, -26025, -26171, -26297, -26400, -26476, -26523,
+                -26538, -26523, -26477, -26404, -26306, -26188, -26054, -25910,
+                -25760, -25612, -25471, -25341, -25228, -25136, -25068, -25026,
+                -25012, -25026, -25067, -25133, -25221, -25328, -25449, -25580,
+                -25715, -25849, -25978, -26096, -26199, -26282, -26344, -26382,
+                -26395, -26382, -26345, -26285, -26204, -26106, -25994, -25874,
+                -25749, -25625, -25506, -25397, -25302, -25224, -25167, -25132,
+                -25120, -25132, -25166, -25223, -25298, -25390, -25494, -25607,
+                -25723, -25839, -25951, -26053, -26142, -26216, -26270, -26303,
+                -26314, -26303, -26270, -26217, -26145, -26059, -25960, -25853,
+                -25743, -25632, -25527, -25429, -25344, -25275, -25223, -25192,
+                -25181, -25192, -25223, -25274, -25342, -25425, -25520, -25622,
+                -25728, -25834, -25936, -26029, -26111, -26178, -26228, -26258,
+                -26269, -26258, -26228, -26179, -26113, -26032, -25941, -25842,
+                -25738, -25636, -25537, -25446, -25366, -25301, -25253, -25223,
+                -25213, -25223, -25253, -25301, -25365, -25444, -25534, -25631,
+                -25732, -25833, -25930, -26019, -26097, -26161, -26209, -26238,
+                -26248, -26238, -26209, -26162, -26098, -26020, -25931, -25835,
+                -25735, -25635, -25539, -25450, -25373, -25309, -25262, -25233,
+                -25223, -25233, -25262, -25309, -25373, -25450, -25539, -25635,
+                -25735, -25835, -25931, -26020, -26098, -26162, -26209, -26238,
+                -26248, -26238, -26209, -26161, -26097, -26019, -25930, -25833,
+                -25732, -25631, -25534, -25444, -25365, -25301, -25253, -25223,
+                -25213, -25223, -25253, -25301, -25366, -25446, -25537, -25636,
+                -25738, -25842, -25941, -26032, -26113, -26179, -26228, -26258,
+                -26269, -26258, -26228, -26178, -26111, -26029, -25936, -25834,
+                -25728, -25622, -25520, -25425, -25342, -25274, -25223, -25192,
+                -25181, -25192, -25223, -25275, -25344, -25429, -25527, -25632,
+                -25743, -25853, -25960, -26059, -26145, -26217, -26270, -26303,
+                -26314, -26303, -26270, -26216, -26142, -26053, -25951, -25839,
+                -25723, -25607, -25494, -25390, -25298, -25223, -25166, -25132,
+                -25120, -25132, -25167, -25224, -25302, -25397, -25506, -25625,
+                -25749, -25874, -25994, -26106, -26204, -26285, -26345, -26382,
+                -26395, -26382, -26344, -26282, -26199, -26096, -25978, -25849,
+                -25715, -25580, -25449, -25328, -25221, -25133, -25067, -25026,
+                -25012, -25026, -25068, -25136, -25228, -25341, -25471, -25612,
+                -25760, -25910, -26054, -26188, -26306, -26404, -26477, -26523,
+                -26538, -26523, -26476, -26400, -26297, -26171, -26025, -25866,
+                -25699, -25530, -25367, -25215, -25081, -24970, -24887, -24835,
+                -24818, -24835, -24889, -24976, -25094, -25240, -25408, -25592,
+                -25785, -25981, -26170, -26347, -26503, -26633, -26731, -26792,
+                -26812, -26791, -26728, -26625, -26484, -26311, -26110, -25890,
+                -25657, -25422, -25193, -24979, -24789, -24631, -24512, -24437,
+                -24412, -24438, -24516, -24644, -24820, -25037, -25289, -25567,
+                -25861, -26160, -26453, -26727, -26972, -27177, -27332, -27430,
+                -27463, -27429, -27325, -27153, -26917, -26623, -26279, -25898,
+                -25492, -25076, -24665, -24277, -23928, -23634, -23409, -23266,
+                -23217, -23268, -23425, -23688, -24054, -24517, -25064, -25680,
+                -26347, -27042, -27740, -28413, -29031, -29564, -29981, -30252,
+                -30349, -30244, -29915, -29341, -28509, -27406, -26029, -24378,
+                -22460, -20286, -17874, -15248, -12435,  -9466,  -6379,  -3210,
+                     0,
+            }},
+            // 64 harmonics
+            {{
+                     0,   6379,  12434,  17873,  22458,  26026,  28504,  29909,
+                 30342,  29975,  29027,  27739,  26349,  25069,  24064,  23437,
+                 23229,  23420,  23937,  24669,  25490,  26271,  26903,  27307,
+                 27444,  27315,  26959,  26447,  25863,  25300,  24838,  24540,
+                 24438,  24536,  24807,  25202,  25655,  26096,  26461,  26698,
+                 26780,  26701,  26481,  26159,  25788,  25424,  25123,  24925,
+                 24857,  24923,  25109,  25381,  25696,  26006,  26263,  26433,
+                 26491,  26434,  26274,  26037,  25763,  25493,  25267,  25119,
+                 25067,  25118,  25260,  25469,  25712,  25952,  26153,  26286,
+                 26332,  26286,  26159,  25971,  25752,  25535,  25354,  25234,
+                 25192,  25233,  25349,  25520,  25720,  25918,  26084,  26193,
+                 26231,  26194,  26088,  25930,  25746,  25564,  25411,  25309,
+                 25274,  25309,  25408,  25554,  25725,  25894,  26036,  26131,
+                 26164,  26131,  26039,  25903,  25743,  25584,  25451,  25362,
+                 25331,  25362,  25448,  25577,  25727,  25877,  26003,  26086,
+                 26115,  26086,  26005,  25883,  25740,  25599,  25480,  25400,
+                 25373,  25400,  25478,  25593,  25729,  25864,  25978,  26053,
+                 26080,  26053,  25979,  25869,  25739,  25610,  25501,  25429,
+                 25403,  25429,  25500,  25606,  25730,  25854,  25959,  26029,
+                 26053,  26029,  25960,  25858,  25738,  25618,  25517,  25450,
+                 25427,  25450,  25516,  25615,  25731,  25847,  25945,  26010,
+                 26033,  26010,  25946,  25850,  25737,  25625,  25530,  25466,
+                 25444,  25466,  25529,  25622,  25732,  25842,  25934,  25996,
+                 26017,  25996,  25935,  25844,  25736,  25629,  25539,  25478,
+                 25457,  25478,  25538,  25628,  25733,  25838,  25926,  25985,
+                 26006,  25985,  25927,  25839,  25736,  25633,  25545,  25487,
+                 25467,  25487,  25545,  25631,  25733,  25835,  25921,  25978,
+                 25998,  25978,  25921,  25836,  25735,  25635,  25550,  25493,
+                 25473,  25493,  25550,  25634,  25734,  25833,  25917,  25973,
+                 25993,  25973,  25917,  25834,  25735,  25636,  25553,  25497,
+                 25477,  25497,  25552,  25636,  25734,  25832,  25915,  25971,
+                 25991,  25971,  25916,  25832,  25734,  25636,  25553,  25498,
+                 25478,  25498,  25553,  25636,  25734,  25832,  25916,  25971,
+                 25991,  25971,  25915,  25832,  25734,  25636,  25552,  25497,
+                 25477,  25497,  25553,  25636,  25735,  25834,  25917,  25973,
+                 25993,  25973,  25917,  25833,  25734,  25634,  25550,  25493,
+                 25473,  25493,  25550,  25635,  25735,  25836,  25921,  25978,
+                 25998,  25978,  25921,  25835,  25733,  25631,  25545,  25487,
+                 25467,  25487,  25545,  25633,  25736,  25839,  25927,  25985,
+                 26006,  25985,  25926,  25838,  25733,  25628,  25538,  25478,
+                 25457,  25478,  25539,  25629,  25736,  25844,  25935,  25996,
+                 26017,  25996,  25934,  25842,  25732,  25622,  25529,  25466,
+                 25444,  25466,  25530,  25625,  25737,  25850,  25946,  26010,
+                 26033,  26010,  25945,  25847,  25731,  25615,  25516,  25450,
+                 25427,  25450,  25517,  25618,  25738,  25858,  25960,  26029,
+                 26053,  26029,  25959,  25854,  25730,  25606,  25500,  25429,
+                 25403,  25429,  25501,  25610,  25739,  25869,  25979,  26053,
+                 26080,  26053,  25978,  25864,  25729,  25593,  25478,  25400,
+                 25373,  25400,  25480,  25599,  25740,  25883,  26005,  26086,
+                 26115,  26086,  26003,  25877,  25727,  25577,  25448,  25362,
+                 25331,  25362,  25451,  25584,  25743,  25903,  26039,  26131,
+                 26164,  26131,  26036,  25894,  25725,  25554,  25408,  25309,
+                 25274,  25309,  25411,  25564,  25746,  25930,  26088,  26194,
+                 26231,  26193,  26084,  25918,  25720,  25520,  25349,  25233,
+                 25192,  25234,  25354,  25535,  25752,  25971,  26159,  26286,
+                 26332,  26286,  26153,  25952,  25712,  25469,  25260,  25118,
+                 25067,  25119,  25267,  25493,  25763,  26037,  26274,  26434,
+                 26491,  26433,  26263,  26006,  25696,  25381,  25109,  24923,
+                 24857,  24925,  25123,  25424,  25788,  26159,  26481,  26701,
+                 26780,  26698,  26461,  26096,  25655,  25202,  24807,  24536,
+                 24438,  24540,  24838,  25300,  25863,  26447,  26959,  27315,
+                 27444,  27307,  26903,  26271,  25490,  24669,  23937,  23420,
+                 23229,  23437,  24064,  25069,  26349,  27739,  29027,  29975,
+                 30342,  29909,  28504,  26026,  22458,  17873,  12434,   6379,
+                     0,  -6379, -12434, -17873, -22458, -26026, -28504, -29909,
+                -30342, -29975, -29027, -27739, -26349, -25069, -24064, -23437,
+                -23229, -23420, -23937, -24669, -25490, -26271, -26903, -27307,
+                -27444, -27315, -26959, -26447, -25863, -25300, -24838, -24540,
+                -24438, -24536, -24807, -25202, -25655, -26096, -26461, -26698,
+                -26780, -26701, -26481, -26159, -25788, -25424, -25123, -24925,
+                -24857, -24923, -25109, -25381, -25696, -26006, -26263, -26433,
+                -26491, -26434, -26274, -26037, -25763, -25493, -25267, -25119,
+                -25067, -25118, -25260, -25469, -25712, -25952, -26153, -26286,
+                -26332, -26286, -26159, -25971, -25752, -25535, -25354, -25234,
+                -25192, -25233, -25349, -25520, -25720, -25918, -26084, -26193,
+                -26231, -26194, -26088, -25930, -25746, -25564, -25411, -25309,
+                -25274, -25309, -25408, -25554, -25725, -25894, -26036, -26131,
+                -26164, -26131, -26039, -25903, -25743, -25584, -25451, -25362,
+                -25331, -25362, -25448, -25577, -25727, -25877, -26003, -26086,
+                -26115, -26086, -26005, -25883, -25740, -25599, -25480, -25400,
+                -25373, -25400, -25478, -25593, -25729, -25864, -25978, -26053,
+                -26080, -26053, -25979, -25869, -25739, -25610, -25501, -25429,
+                -25403, -25429, -25500, -25606, -25730, -25854, -25959, -26029,
+                -26053, -26029, -25960, -25858, -25738, -25618, -25517, -25450,
+                -25427, -25450, -25516, -25615, -25731, -25847, -25945, -26010,
+                -26033, -26010, -25946, -25850, -25737, -25625, -25530, -25466,
+                -25444, -25466, -25529, -25622, -25732, -25842, -25934, -25996,
+                -26017, -25996, -25935, -25844, -25736, -25629, -25539, -25478,
+                -25457, -25478, -25538, -25628, -25733, -25838, -25926, -25985,
+                -26006, -25985, -25927, -25839, -25736, -25633, -25545, -25487,
+                -25467, -25487, -25545, -25631, -25733, -25835, -25921, -25978,
+                -25998, -25978, -25921, -25836, -25735, -25635, -25550, -25493,
+                -25473, -25493, -25550, -25634, -25734, -25833, -25917, -25973,
+                -25993, -25973, -25917, -25834, -25735, -25636, -25553, -25497,
+                -25477, -25497, -25552, -25636, -25734, -25832, -25915, -25971,
+                -25991, -25971, -25916, -25832, -25734, -25636, -25553, -25498,
+                -25478, -25498, -25553, -25636, -25734, -25832, -25916, -25971,
+                -25991, -25971, -25915, -25832, -25734, -25636, -25552, -25497,
+                -25477, -25497, -25553, -25636, -25735, -25834, -25917, -25973,
+                -25993, -25973, -25917, -25833, -25734, -25634, -25550, -25493,
+                -25473, -25493, -25550, -25635, -25735, -25836, -25921, -25978,
+                -25998, -25978, -25921, -25835, -25733, -25631, -25545, -25487,
+                -25467, -25487, -25545, -25633, -25736, -25839, -25927, -25985,
+                -26006, -25985, -25926, -25838, -25733, -25628, -25538, -25478,
+                -25457, -25478, -25539, -25629, -25736, -25844, -25935, -25996,
+                -26017, -25996, -25934, -25842, -25732, -25622, -25529, -25466,
+                -25444, -25466, -25530, -25625, -25737, -25850, -25946, -26010,
+                -26033, -26010, -25945, -25847, -25731, -25615, -25516, -25450,
+                -25427, -25450, -25517, -25618, -25738, -25858, -25960, -26029,
+                -26053, -26029, -25959, -25854, -25730, -25606, -25500, -25429,
+                -25403, -25429, -25501, -25610, -25739, -25869, -25979, -26053,
+                -26080, -26053, -25978, -25864, -25729, -25593, -25478, -25400,
+                -25373, -25400, -25480, -25599, -25740, -25883, -26005, -26086,
+                -26115, -26086, -26003, -25877, -25727, -25577, -25448, -25362,
+                -25331, -25362, -25451, -25584, -25743, -25903, -26039, -26131,
+                -26164, -26131, -26036, -25894, -25725, -25554, -25408, -25309,
+                -25274, -25309, -25411, -25564, -25746, -25930, -26088, -26194,
+                -26231, -26193, -26084, -25918, -25720, -25520, -25349, -25233,
+                -25192, -25234, -25354, -25535, -25752, -25971, -26159, -26286,
+                -26332, -26286, -26153, -25952, -25712, -25469, -25260, -25118,
+                -25067, -25119, -25267, -25493, -25763, -26037, -26274, -26434,
+                -26491, -26433, -26263, -26006, -25696, -25381, -25109, -24923,
+                -24857, -24925, -25123, -25424, -25788, -26159, -26481, -26701,
+                -26780, -26698, -26461, -26096, -25655, -25202, -24807, -24536,
+                -24438, -24540, -24838, -25300, -25863, -26447, -26959, -27315,
+                -27444, -27307, -26903, -26271, -25490, -24669, -23937, -23420,
+                -23229, -23437, -24064, -25069, -26349, -27739, -29027, -29975,
+                -30342, -29909, -28504, -26026, -22458, -17873, -12434,  -6379,
+                     0,
+            }},
+            // 128 harmonics
+            {{
+                     0,  12434,  22457,  28503,  30341,  29026,  26350,  24066,
+                 23233,  23939,  25489,  26900,  27439,  26956,  25864,  24843,
+                 24444,  24811,  25655,  26455,  26772,  26475,  25788,  25129,
+                 24867,  25116,  25696,  26255,  26480,  26266,  25763,  25276,
+                 25080,  25269,  25712,  26143,  26317,  26149,  25752,  25365,
+                 25209,  25360,  25720,  26071,  26213,  26075,  25747,  25425,
+                 25294,  25421,  25724,  26021,  26142,  26024,  25743,  25467,
+                 25355,  25465,  25727,  25984,  26090,  25987,  25741,  25499,
+                 25400,  25497,  25728,  25957,  26050,  25958,  25740,  25524,
+                 25435,  25522,  25730,  25935,  26019,  25936,  25739,  25543,
+                 25463,  25542,  25731,  25917,  25994,  25918,  25738,  25559,
+                 25485,  25558,  25731,  25903,  25974,  25904,  25737,  25572,
+                 25504,  25571,  25732,  25891,  25957,  25892,  25737,  25583,
+                 25520,  25582,  25732,  25881,  25942,  25882,  25736,  25592,
+                 25533,  25591,  25733,  25873,  25930,  25873,  25736,  25600,
+                 25544,  25599,  25733,  25865,  25920,  25866,  25736,  25607,
+                 25553,  25606,  25733,  25859,  25911,  25859,  25736,  25612,
+                 25562,  25612,  25733,  25854,  25903,  25854,  25735,  25617,
+                 25569,  25617,  25733,  25849,  25897,  25849,  25735,  25622,
+                 25575,  25622,  25733,  25845,  25891,  25845,  25735,  25626,
+                 25580,  25625,  25734,  25841,  25886,  25842,  25735,  25629,
+                 25585,  25629,  25734,  25838,  25881,  25838,  25735,  25632,
+                 25589,  25632,  25734,  25836,  25878,  25836,  25735,  25634,
+                 25593,  25634,  25734,  25833,  25874,  25833,  25735,  25636,
+                 25596,  25636,  25734,  25831,  25872,  25831,  25735,  25638,
+                 25598,  25638,  25734,  25830,  25869,  25830,  25735,  25640,
+                 25601,  25640,  25734,  25828,  25867,  25828,  25735,  25641,
+                 25602,  25641,  25734,  25827,  25866,  25827,  25735,  25642,
+                 25604,  25642,  25734,  25826,  25864,  25826,  25735,  25643,
+                 25605,  25643,  25734,  25826,  25863,  25826,  25734,  25643,
+                 25606,  25643,  25734,  25825,  25863,  25825,  25734,  25644,
+                 25606,  25644,  25734,  25825,  25862,  25825,  25734,  25644,
+                 25606,  25644,  25734,  25825,  25862,  25825,  25734,  25644,
+                 25606,  25644,  25734,  25825,  25863,  25825,  25734,  25643,
+                 25606,  25643,  25734,  25826,  25863,  25826,  25734,  25643,
+                 25605,  25643,  25735,  25826,  25864,  25826,  25734,  25642,
+                 25604,  25642,  25735,  25827,  25866,  25827,  25734,  25641,
+                 25602,  25641,  25735,  25828,  25867,  25828,  25734,  25640,
+                 25601,  25640,  25735,  25830,  25869,  25830,  25734,  25638,
+                 25598,  25638,  25735,  25831,  25872,  25831,  25734,  25636,
+                 25596,  25636,  25735,  25833,  25874,  25833,  25734,  25634,
+                 25593,  25634,  25735,  25836,  25878,  25836,  25734,  25632,
+                 25589,  25632,  25735,  25838,  25881,  25838,  25734,  25629,
+                 25585,  25629,  25735,  25842,  25886,  25841,  25734,  25625,
+                 25580,  25626,  25735,  25845,  25891,  25845,  25733,  25622,
+                 25575,  25622,  25735,  25849,  25897,  25849,  25733,  25617,
+                 25569,  25617,  25735,  25854,  25903,  25854,  25733,  25612,
+                 25562,  25612,  25736,  25859,  25911,  25859,  25733,  25606,
+                 25553,  25607,  25736,  25866,  25920,  25865,  25733,  25599,
+                 25544,  25600,  25736,  25873,  25930,  25873,  25733,  25591,
+                 25533,  25592,  25736,  25882,  25942,  25881,  25732,  25582,
+                 25520,  25583,  25737,  25892,  25957,  25891,  25732,  25571,
+                 25504,  25572,  25737,  25904,  25974,  25903,  25731,  25558,
+                 25485,  25559,  25738,  25918,  25994,  25917,  25731,  25542,
+                 25463,  25543,  25739,  25936,  26019,  25935,  25730,  25522,
+                 25435,  25524,  25740,  25958,  26050,  25957,  25728,  25497,
+                 25400,  25499,  25741,  25987,  26090,  25984,  25727,  25465,
+                 25355,  25467,  25743,  26024,  26142,  26021,  25724,  25421,
+                 25294,  25425,  25747,  26075,  26213,  26071,  25720,  25360,
+                 25209,  25365,  25752,  26149,  26317,  26143,  25712,  25269,
+                 25080,  25276,  25763,  26266,  26480,  26255,  25696,  25116,
+                 24867,  25129,  25788,  26475,  26772,  26455,  25655,  24811,
+                 24444,  24843,  25864,  26956,  27439,  26900,  25489,  23939,
+                 23233,  24066,  26350,  29026,  30341,  28503,  22457,  12434,
+                     0, -12434, -22457, -28503, -30341, -29026, -26350, -24066,
+                -23233, -23939, -25489, -26900, -27439, -26956, -25864, -24843,
+                -24444, -24811, -25655, -26455, -26772, -26475, -25788, -25129,
+                -24867, -25116, -25696, -26255, -26480, -26266, -25763, -25276,
+                -25080, -25269, -25712, -26143, -26317, -26149, -25752, -25365,
+                -25209, -25360, -25720, -26071, -26213, -26075, -25747, -25425,
+                -25294, -25421, -25724, -26021, -26142, -26024, -25743, -25467,
+                -25355, -25465, -25727, -25984, -26090, -25987, -25741, -25499,
+                -25400, -25497, -25728, -25957, -26050, -25958, -25740, -25524,
+                -25435, -25522, -25730, -25935, -26019, -25936, -25739, -25543,
+                -25463, -25542, -25731, -25917, -25994, -25918, -25738, -25559,
+                -25485, -25558, -25731, -25903, -25974, -25904, -25737, -25572,
+                -25504, -25571, -25732, -25891, -25957, -25892, -25737, -25583,
+                -25520, -25582, -25732, -25881, -25942, -25882, -25736, -25592,
+                -25533, -25591, -25733, -25873, -25930, -25873, -25736, -25600,
+                -25544, -25599, -25733, -25865, -25920, -25866, -25736, -25607,
+                -25553, -25606, -25733, -25859, -25911, -25859, -25736, -25612,
+                -25562, -25612, -25733, -25854, -25903, -25854, -25735, -25617,
+                -25569, -25617, -25733, -25849, -25897, -25849, -25735, -25622,
+                -25575, -25622, -25733, -25845, -25891, -25845, -25735, -25626,
+                -25580, -25625, -25734, -25841, -25886, -25842, -25735, -25629,
+                -25585, -25629, -25734, -25838, -25881, -25838, -25735, -25632,
+                -25589, -25632, -25734, -25836, -25878, -25836, -25735, -25634,
+                -25593, -25634, -25734, -25833, -25874, -25833, -25735, -25636,
+                -25596, -25636, -25734, -25831, -25872, -25831, -25735, -25638,
+                -25598, -25638, -25734, -25830, -25869, -25830, -25735, -25640,
+                -25601, -25640, -25734, -25828, -25867, -25828, -25735, -25641,
+                -25602, -25641, -25734, -25827, -25866, -25827, -25735, -25642,
+                -25604, -25642, -25734, -25826, -25864, -25826, -25735, -25643,
+                -25605, -25643, -25734, -25826, -25863, -25826, -25734, -25643,
+                -25606, -25643, -25734, -25825, -25863, -25825, -25734, -25644,
+                -25606, -25644, -25734, -25825, -25862, -25825, -25734, -25644,
+                -25606, -25644, -25734, -25825, -25862, -25825, -25734, -25644,
+                -25606, -25644, -25734, -25825, -25863, -25825, -25734, -25643,
+                -25606, -25643, -25734, -25826, -25863, -25826, -25734, -25643,
+                -25605, -25643, -25735, -25826, -25864, -25826, -25734, -25642,
+                -25604, -25642, -25735, -25827, -25866, -25827, -25734, -25641,
+                -25602, -25641, -25735, -25828, -25867, -25828, -25734, -25640,
+                -25601, -25640, -25735, -25830, -25869, -25830, -25734, -25638,
+                -25598, -25638, -25735, -25831, -25872, -25831, -25734, -25636,
+                -25596, -25636, -25735, -25833, -25874, -25833, -25734, -25634,
+                -25593, -25634, -25735, -25836, -25878, -25836, -25734, -25632,
+                -25589, -25632, -25735, -25838, -25881, -25838, -25734, -25629,
+                -25585, -25629, -25735, -25842, -25886, -25841, -25734, -25625,
+                -25580, -25626, -25735, -25845, -25891, -25845, -25733, -25622,
+                -25575, -25622, -25735, -25849, -25897, -25849, -25733, -25617,
+                -25569, -25617, -25735, -25854, -25903, -25854, -25733, -25612,
+                -25562, -25612, -25736, -25859, -25911, -25859, -25733, -25606,
+                -25553, -25607, -25736, -25866, -25920, -25865, -25733, -25599,
+                -25544, -25600, -25736, -25873, -25930, -25873, -25733, -25591,
+                -25533, -25592, -25736, -25882, -25942, -25881, -25732, -25582,
+                -25520, -25583, -25737, -25892, -25957, -25891, -25732, -25571,
+                -25504, -25572, -25737, -25904, -25974, -25903, -25731, -25558,
+                -25485, -25559, -25738, -25918, -25994, -25917, -25731, -25542,
+                -25463, -25543, -25739, -25936, -26019, -25935, -25730, -25522,
+                -25435, -25524, -25740, -25958, -26050, -25957, -25728, -25497,
+                -25400, -25499, -25741, -25987, -26090, -25984, -25727, -25465,
+                -25355, -25467, -25743, -26024, -26142, -26021, -25724, -25421,
+                -25294, -25425, -25747, -26075, -26213, -26071, -25720, -25360,
+                -25209, -25365, -25752, -26149, -26317, -26143, -25712, -25269,
+                -25080, -25276, -25763, -26266, -26480, -26255, -25696, -25116,
+                -24867, -25129, -25788, -26475, -26772, -26455, -25655, -24811,
+                -24444, -24843, -25864, -26956, -27439, -26900, -25489, -23939,
+                -23233, -24066, -26350, -29026, -30341, -28503, -22457, -12434,
+                     0,
+            }},
+            // 256 harmonics
+            {{
+                     0,  22457,  30340,  26350,  23233,  25489,  27438,  25864,
+                 24446,  25655,  26770,  25788,  24869,  25696,  26477,  25764,
+                 25083,  25712,  26314,  25753,  25213,  25719,  26209,  25747,
+                 25299,  25724,  26137,  25743,  25360,  25727,  26084,  25741,
+                 25407,  25728,  26043,  25740,  25442,  25730,  26011,  25739,
+                 25471,  25730,  25985,  25738,  25495,  25731,  25964,  25737,
+                 25514,  25732,  25946,  25737,  25530,  25732,  25931,  25737,
+                 25544,  25732,  25918,  25736,  25557,  25733,  25907,  25736,
+                 25567,  25733,  25897,  25736,  25576,  25733,  25888,  25736,
+                 25585,  25733,  25880,  25735,  25592,  25733,  25873,  25735,
+                 25599,  25733,  25867,  25735,  25605,  25733,  25861,  25735,
+                 25610,  25734,  25856,  25735,  25615,  25734,  25852,  25735,
+                 25619,  25734,  25847,  25735,  25623,  25734,  25844,  25735,
+                 25627,  25734,  25840,  25735,  25630,  25734,  25837,  25735,
+                 25633,  25734,  25834,  25735,  25636,  25734,  25831,  25735,
+                 25639,  25734,  25828,  25735,  25642,  25734,  25826,  25735,
+                 25644,  25734,  25824,  25735,  25646,  25734,  25822,  25735,
+                 25648,  25734,  25820,  25735,  25650,  25734,  25818,  25735,
+                 25652,  25734,  25816,  25735,  25653,  25734,  25815,  25735,
+                 25655,  25734,  25813,  25735,  25656,  25734,  25812,  25735,
+                 25657,  25734,  25811,  25735,  25659,  25734,  25810,  25735,
+                 25660,  25734,  25808,  25735,  25661,  25734,  25807,  25735,
+                 25662,  25734,  25806,  25734,  25663,  25734,  25806,  25734,
+                 25664,  25734,  25805,  25734,  25664,  25734,  25804,  25734,
+                 25665,  25734,  25803,  25734,  25666,  25734,  25803,  25734,
+                 25666,  25734,  25802,  25734,  25667,  25734,  25801,  25734,
+                 25667,  25734,  25801,  25734,  25668,  25734,  25801,  25734,
+                 25668,  25734,  25800,  25734,  25669,  25734,  25800,  25734,
+                 25669,  25734,  25799,  25734,  25669,  25734,  25799,  25734,
+                 25670,  25734,  25799,  25734,  25670,  25734,  25799,  25734,
+                 25670,  25734,  25799,  25734,  25670,  25734,  25798,  25734,
+                 25670,  25734,  25798,  25734,  25670,  25734,  25798,  25734,
+                 25670,  25734,  25798,  25734,  25670,  25734,  25798,  25734,
+                 25670,  25734,  25798,  25734,  25670,  25734,  25799,  25734,
+                 25670,  25734,  25799,  25734,  25670,  25734,  25799,  25734,
+                 25670,  25734,  25799,  25734,  25669,  25734,  25799,  25734,
+                 25669,  25734,  25800,  25734,  25669,  25734,  25800,  25734,
+                 25668,  25734,  25801,  25734,  25668,  25734,  25801,  25734,
+                 25667,  25734,  25801,  25734,  25667,  25734,  25802,  25734,
+                 25666,  25734,  25803,  25734,  25666,  25734,  25803,  25734,
+                 25665,  25734,  25804,  25734,  25664,  25734,  25805,  25734,
+                 25664,  25734,  25806,  25734,  25663,  25734,  25806,  25734,
+                 25662,  25735,  25807,  25734,  25661,  25735,  25808,  25734,
+                 25660,  25735,  25810,  25734,  25659,  25735,  25811,  25734,
+                 25657,  25735,  25812,  25734,  25656,  25735,  25813,  25734,
+                 25655,  25735,  25815,  25734,  25653,  25735,  25816,  25734,
+                 25652,  25735,  25818,  25734,  25650,  25735,  25820,  25734,
+                 25648,  25735,  25822,  25734,  25646,  25735,  25824,  25734,
+                 25644,  25735,  25826,  25734,  25642,  25735,  25828,  25734,
+                 25639,  25735,  25831,  25734,  25636,  25735,  25834,  25734,
+                 25633,  25735,  25837,  25734,  25630,  25735,  25840,  25734,
+                 25627,  25735,  25844,  25734,  25623,  25735,  25847,  25734,
+                 25619,  25735,  25852,  25734,  25615,  25735,  25856,  25734,
+                 25610,  25735,  25861,  25733,  25605,  25735,  25867,  25733,
+                 25599,  25735,  25873,  25733,  25592,  25735,  25880,  25733,
+                 25585,  25736,  25888,  25733,  25576,  25736,  25897,  25733,
+                 25567,  25736,  25907,  25733,  25557,  25736,  25918,  25732,
+                 25544,  25737,  25931,  25732,  25530,  25737,  25946,  25732,
+                 25514,  25737,  25964,  25731,  25495,  25738,  25985,  25730,
+                 25471,  25739,  26011,  25730,  25442,  25740,  26043,  25728,
+                 25407,  25741,  26084,  25727,  25360,  25743,  26137,  25724,
+                 25299,  25747,  26209,  25719,  25213,  25753,  26314,  25712,
+                 25083,  25764,  26477,  25696,  24869,  25788,  26770,  25655,
+                 24446,  25864,  27438,  25489,  23233,  26350,  30340,  22457,
+                     0, -22457, -30340, -26350, -23233, -25489, -27438, -25864,
+                -24446, -25655, -26770, -25788, -24869, -25696, -26477, -25764,
+                -25083, -25712, -26314, -25753, -25213, -25719, -26209, -25747,
+                -25299, -25724, -26137, -25743, -25360, -25727, -26084, -25741,
+                -25407, -25728, -26043, -25740, -25442, -25730, -26011, -25739,
+                -25471, -25730, -25985, -25738, -25495, -25731, -25964, -25737,
+                -25514, -25732, -25946, -25737, -25530, -25732, -25931, -25737,
+                -25544, -25732, -25918, -25736, -25557, -25733, -25907, -25736,
+                -25567, -25733, -25897, -25736, -25576, -25733, -25888, -25736,
+                -25585, -25733, -25880, -25735, -25592, -25733, -25873, -25735,
+                -25599, -25733, -25867, -25735, -25605, -25733, -25861, -25735,
+                -25610, -25734, -25856, -25735, -25615, -25734, -25852, -25735,
+                -25619, -25734, -25847, -25735, -25623, -25734, -25844, -25735,
+                -25627, -25734, -25840, -25735, -25630, -25734, -25837, -25735,
+                -25633, -25734, -25834, -25735, -25636, -25734, -25831, -25735,
+                -25639, -25734, -25828, -25735, -25642, -25734, -25826, -25735,
+                -25644, -25734, -25824, -25735, -25646, -25734, -25822, -25735,
+                -25648, -25734, -25820, -25735, -25650, -25734, -25818, -25735,
+                -25652, -25734, -25816, -25735, -25653, -25734, -25815, -25735,
+                -25655, -25734, -25813, -25735, -25656, -25734, -25812, -25735,
+                -25657, -25734, -25811, -25735, -25659, -25734, -25810, -25735,
+                -25660, -25734, -25808, -25735, -25661, -25734, -25807, -25735,
+                -25662, -25734, -25806, -25734, -25663, -25734, -25806, -25734,
+                -25664, -25734, -25805, -25734, -25664, -25734, -25804, -25734,
+                -25665, -25734, -25803, -25734, -25666, -25734, -25803, -25734,
+                -25666, -25734, -25802, -25734, -25667, -25734, -25801, -25734,
+                -25667, -25734, -25801, -25734, -25668, -25734, -25801, -25734,
+                -25668, -25734, -25800, -25734, -25669, -25734, -25800, -25734,
+                -25669, -25734, -25799, -25734, -25669, -25734, -25799, -25734,
+                -25670, -25734, -25799, -25734, -25670, -25734, -25799, -25734,
+                -25670, -25734, -25799, -25734, -25670, -25734, -25798, -25734,
+                -25670, -25734, -25798, -25734, -25670, -25734, -25798, -25734,
+                -25670, -25734, -25798, -25734, -25670, -25734, -25798, -25734,
+                -25670, -25734, -25798, -25734, -25670, -25734, -25799, -25734,
+                -25670, -25734, -25799, -25734, -25670, -25734, -25799, -25734,
+                -25670, -25734, -25799, -25734, -25669, -25734, -25799, -25734,
+                -25669, -25734, -25800, -25734, -25669, -25734, -25800, -25734,
+                -25668, -25734, -25801, -25734, -25668, -25734, -25801, -25734,
+                -25667, -25734, -25801, -25734, -25667, -25734, -25802, -25734,
+                -25666, -25734, -25803, -25734, -25666, -25734, -25803, -25734,
+                -25665, -25734, -25804, -25734, -25664, -25734, -25805, -25734,
+                -25664, -25734, -25806, -25734, -25663, -25734, -25806, -25734,
+                -25662, -25735, -25807, -25734, -25661, -25735, -25808, -25734,
+                -25660, -25735, -25810, -25734, -25659, -25735, -25811, -25734,
+                -25657, -25735, -25812, -25734, -25656, -25735, -25813, -25734,
+                -25655, -25735, -25815, -25734, -25653, -25735, -25816, -25734,
+                -25652, -25735, -25818, -25734, -25650, -25735, -25820, -25734,
+                -25648, -25735, -25822, -25734, -25646, -25735, -25824, -25734,
+                -25644, -25735, -25826, -25734, -25642, -25735, -25828, -25734,
+                -25639, -25735, -25831, -25734, -25636, -25735, -25834, -25734,
+                -25633, -25735, -25837, -25734, -25630, -25735, -25840, -25734,
+                -25627, -25735, -25844, -25734, -25623, -25735, -25847, -25734,
+                -25619, -25735, -25852, -25734, -25615, -25735, -25856, -25734,
+                -25610, -25735, -25861, -25733, -25605, -25735, -25867, -25733,
+                -25599, -25735, -25873, -25733, -25592, -25735, -25880, -25733,
+                -25585, -25736, -25888, -25733, -25576, -25736, -25897, -25733,
+                -25567, -25736, -25907, -25733, -25557, -25736, -25918, -25732,
+                -25544, -25737, -25931, -25732, -25530, -25737, -25946, -25732,
+                -25514, -25737, -25964, -25731, -25495, -25738, -25985, -25730,
+                -25471, -25739, -26011, -25730, -25442, -25740, -26043, -25728,
+                -25407, -25741, -26084, -25727, -25360, -25743, -26137, -25724,
+                -25299, -25747, -26209, -25719, -25213, -25753, -26314, -25712,
+                -25083, -25764, -26477, -25696, -24869, -25788, -26770, -25655,
+                -24446, -25864, -27438, -25489, -23233, -26350, -30340, -22457,
+                     0,
+            }},
+            // 512 harmonics
+            {{
+                     0,  30340,  23234,  27438,  24446,  26769,  24870,  26477,
+                 25084,  26313,  25214,  26208,  25300,  26135,  25362,  26082,
+                 25408,  26041,  25444,  26009,  25473,  25983,  25497,  25962,
+                 25516,  25944,  25533,  25928,  25547,  25915,  25560,  25904,
+                 25570,  25893,  25580,  25884,  25588,  25876,  25596,  25869,
+                 25603,  25863,  25609,  25857,  25614,  25852,  25619,  25847,
+                 25624,  25842,  25628,  25838,  25632,  25834,  25636,  25831,
+                 25639,  25828,  25643,  25825,  25645,  25822,  25648,  25819,
+                 25651,  25817,  25653,  25814,  25655,  25812,  25658,  25810,
+                 25660,  25808,  25661,  25806,  25663,  25805,  25665,  25803,
+                 25666,  25801,  25668,  25800,  25669,  25799,  25671,  25797,
+                 25672,  25796,  25673,  25795,  25675,  25794,  25676,  25792,
+                 25677,  25791,  25678,  25790,  25679,  25789,  25680,  25789,
+                 25681,  25788,  25682,  25787,  25682,  25786,  25683,  25785,
+                 25684,  25784,  25685,  25784,  25685,  25783,  25686,  25782,
+                 25687,  25782,  25687,  25781,  25688,  25780,  25689,  25780,
+                 25689,  25779,  25690,  25779,  25690,  25778,  25691,  25778,
+                 25691,  25777,  25692,  25777,  25692,  25776,  25693,  25776,
+                 25693,  25776,  25693,  25775,  25694,  25775,  25694,  25774,
+                 25695,  25774,  25695,  25774,  25695,  25773,  25696,  25773,
+                 25696,  25773,  25696,  25772,  25696,  25772,  25697,  25772,
+                 25697,  25772,  25697,  25771,  25698,  25771,  25698,  25771,
+                 25698,  25771,  25698,  25770,  25699,  25770,  25699,  25770,
+                 25699,  25770,  25699,  25769,  25699,  25769,  25700,  25769,
+                 25700,  25769,  25700,  25769,  25700,  25769,  25700,  25768,
+                 25700,  25768,  25701,  25768,  25701,  25768,  25701,  25768,
+                 25701,  25768,  25701,  25768,  25701,  25768,  25701,  25767,
+                 25701,  25767,  25701,  25767,  25702,  25767,  25702,  25767,
+                 25702,  25767,  25702,  25767,  25702,  25767,  25702,  25767,
+                 25702,  25767,  25702,  25767,  25702,  25767,  25702,  25767,
+                 25702,  25766,  25702,  25766,  25702,  25766,  25702,  25766,
+                 25702,  25766,  25702,  25766,  25702,  25766,  25702,  25766,
+                 25702,  25766,  25702,  25766,  25702,  25766,  25702,  25766,
+                 25702,  25766,  25702,  25766,  25702,  25766,  25702,  25766,
+                 25702,  25767,  25702,  25767,  25702,  25767,  25702,  25767,
+                 25702,  25767,  25702,  25767,  25702,  25767,  25702,  25767,
+                 25702,  25767,  25702,  25767,  25702,  25767,  25701,  25767,
+                 25701,  25767,  25701,  25768,  25701,  25768,  25701,  25768,
+                 25701,  25768,  25701,  25768,  25701,  25768,  25701,  25768,
+                 25700,  25768,  25700,  25769,  25700,  25769,  25700,  25769,
+                 25700,  25769,  25700,  25769,  25699,  25769,  25699,  25770,
+                 25699,  25770,  25699,  25770,  25699,  25770,  25698,  25771,
+                 25698,  25771,  25698,  25771,  25698,  25771,  25697,  25772,
+                 25697,  25772,  25697,  25772,  25696,  25772,  25696,  25773,
+                 25696,  25773,  25696,  25773,  25695,  25774,  25695,  25774,
+                 25695,  25774,  25694,  25775,  25694,  25775,  25693,  25776,
+                 25693,  25776,  25693,  25776,  25692,  25777,  25692,  25777,
+                 25691,  25778,  25691,  25778,  25690,  25779,  25690,  25779,
+                 25689,  25780,  25689,  25780,  25688,  25781,  25687,  25782,
+                 25687,  25782,  25686,  25783,  25685,  25784,  25685,  25784,
+                 25684,  25785,  25683,  25786,  25682,  25787,  25682,  25788,
+                 25681,  25789,  25680,  25789,  25679,  25790,  25678,  25791,
+                 25677,  25792,  25676,  25794,  25675,  25795,  25673,  25796,
+                 25672,  25797,  25671,  25799,  25669,  25800,  25668,  25801,
+                 25666,  25803,  25665,  25805,  25663,  25806,  25661,  25808,
+                 25660,  25810,  25658,  25812,  25655,  25814,  25653,  25817,
+                 25651,  25819,  25648,  25822,  25645,  25825,  25643,  25828,
+                 25639,  25831,  25636,  25834,  25632,  25838,  25628,  25842,
+                 25624,  25847,  25619,  25852,  25614,  25857,  25609,  25863,
+                 25603,  25869,  25596,  25876,  25588,  25884,  25580,  25893,
+                 25570,  25904,  25560,  25915,  25547,  25928,  25533,  25944,
+                 25516,  25962,  25497,  25983,  25473,  26009,  25444,  26041,
+                 25408,  26082,  25362,  26135,  25300,  26208,  25214,  26313,
+                 25084,  26477,  24870,  26769,  24446,  27438,  23234,  30340,
+                     0, -30340, -23234, -27438, -24446, -26769, -24870, -26477,
+                -25084, -26313, -25214, -26208, -25300, -26135, -25362, -26082,
+                -25408, -26041, -25444, -26009, -25473, -25983, -25497, -25962,
+                -25516, -25944, -25533, -25928, -25547, -25915, -25560, -25904,
+                -25570, -25893, -25580, -25884, -25588, -25876, -25596, -25869,
+                -25603, -25863, -25609, -25857, -25614, -25852, -25619, -25847,
+                -25624, -25842, -25628, -25838, -25632, -25834, -25636, -25831,
+                -25639, -25828, -25643, -25825, -25645, -25822, -25648, -25819,
+                -25651, -25817, -25653, -25814, -25655, -25812, -25658, -25810,
+                -25660, -25808, -25661, -25806, -25663, -25805, -25665, -25803,
+                -25666, -25801, -25668, -25800, -25669, -25799, -25671, -25797,
+                -25672, -25796, -25673, -25795, -25675, -25794, -25676, -25792,
+                -25677, -25791, -25678, -25790, -25679, -25789, -25680, -25789,
+                -25681, -25788, -25682, -25787, -25682, -25786, -25683, -25785,
+                -25684, -25784, -25685, -25784, -25685, -25783, -25686, -25782,
+                -25687, -25782, -25687, -25781, -25688, -25780, -25689, -25780,
+                -25689, -25779, -25690, -25779, -25690, -25778, -25691, -25778,
+                -25691, -25777, -25692, -25777, -25692, -25776, -25693, -25776,
+                -25693, -25776, -25693, -25775, -25694, -25775, -25694, -25774,
+                -25695, -25774, -25695, -25774, -25695, -25773, -25696, -25773,
+                -25696, -25773, -25696, -25772, -25696, -25772, -25697, -25772,
+                -25697, -25772, -25697, -25771, -25698, -25771, -25698, -25771,
+                -25698, -25771, -25698, -25770, -25699, -25770, -25699, -25770,
+                -25699, -25770, -25699, -25769, -25699, -25769, -25700, -25769,
+                -25700, -25769, -25700, -25769, -25700, -25769, -25700, -25768,
+                -25700, -25768, -25701, -25768, -25701, -25768, -25701, -25768,
+                -25701, -25768, -25701, -25768, -25701, -25768, -25701, -25767,
+                -25701, -25767, -25701, -25767, -25702, -25767, -25702, -25767,
+                -25702, -25767, -25702, -25767, -25702, -25767, -25702, -25767,
+                -25702, -25767, -25702, -25767, -25702, -25767, -25702, -25767,
+                -25702, -25766, -25702, -25766, -25702, -25766, -25702, -25766,
+                -25702, -25766, -25702, -25766, -25702, -25766, -25702, -25766,
+                -25702, -25766, -25702, -25766, -25702, -25766, -25702, -25766,
+                -25702, -25766, -25702, -25766, -25702, -25766, -25702, -25766,
+                -25702, -25767, -25702, -25767, -25702, -25767, -25702, -25767,
+                -25702, -25767, -25702, -25767, -25702, -25767, -25702, -25767,
+                -25702, -25767, -25702, -25767, -25702, -25767, -25701, -25767,
+                -25701, -25767, -25701, -25768, -25701, -25768, -25701, -25768,
+                -25701, -25768, -25701, -25768, -25701, -25768, -25701, -25768,
+                -25700, -25768, -25700, -25769, -25700, -25769, -25700, -25769,
+                -25700, -25769, -25700, -25769, -25699, -25769, -25699, -25770,
+                -25699, -25770, -25699, -25770, -25699, -25770, -25698, -25771,
+                -25698, -25771, -25698, -25771, -25698, -25771, -25697, -25772,
+                -25697, -25772, -25697, -25772, -25696, -25772, -25696, -25773,
+                -25696, -25773, -25696, -25773, -25695, -25774, -25695, -25774,
+                -25695, -25774, -25694, -25775, -25694, -25775, -25693, -25776,
+                -25693, -25776, -25693, -25776, -25692, -25777, -25692, -25777,
+                -25691, -25778, -25691, -25778, -25690, -25779, -25690, -25779,
+                -25689, -25780, -25689, -25780, -25688, -25781, -25687, -25782,
+                -25687, -25782, -25686, -25783, -25685, -25784, -25685, -25784,
+                -25684, -25785, -25683, -25786, -25682, -25787, -25682, -25788,
+                -25681, -25789, -25680, -25789, -25679, -25790, -25678, -25791,
+                -25677, -25792, -25676, -25794, -25675, -25795, -25673, -25796,
+                -25672, -25797, -25671, -25799, -25669, -25800, -25668, -25801,
+                -25666, -25803, -25665, -25805, -25663, -25806, -25661, -25808,
+                -25660, -25810, -25658, -25812, -25655, -25814, -25653, -25817,
+                -25651, -25819, -25648, -25822, -25645, -25825, -25643, -25828,
+                -25639, -25831, -25636, -25834, -25632, -25838, -25628, -25842,
+                -25624, -25847, -25619, -25852, -25614, -25857, -25609, -25863,
+                -25603, -25869, -25596, -25876, -25588, -25884, -25580, -25893,
+                -25570, -25904, -25560, -25915, -25547, -25928, -25533, -25944,
+                -25516, -25962, -25497, -25983, -25473, -26009, -25444, -26041,
+                -25408, -26082, -25362, -26135, -25300, -26208, -25214, -26313,
+                -25084, -26477, -24870, -26769, -24446, -27438, -23234, -30340,
+                     0,
+            }},
+        };
+
+        const MipmapData pulse_25[kLevels] = {
+            // 1 harmonic
+            {{
+                 11355,  11424,  11493,  11562,  11630,  11698,  11765,  11832,
+                 11898,  11964,  12030,  12095,  12159,  12224,  12287,  12350,
+                 12413,  12476,  12537,  12599,  12660,  12720,  12780,  12839,
+                 12898,  12957,  13015,  13072,  13129,  13186,  13242,  13297,
+                 13352,  13406,  13460,  13514,  13567,  13619,  13671,  13723,
+                 13774,  13824,  13874,  13923,  13972,  14020,  14068,  14115,
+                 14162,  14208,  14254,  14299,  14344,  14388,  14431,  14474,
+                 14517,  14558,  14600,  14640,  14681,  14720,  14759,  14798,
+                 14836,  14873,  14910,  14947,  14982,  15017,  15052,  15086,
+                 15120,  15153,  15185,  15217,  15248,  15278,  15308,  15338,
+                 15367,  15395,  15423,  15450,  15477,  15503,  15528,  15553,
+                 15577,  15601,  15624,  15646,  15668,  15689,  15710,  15730,
+                 15750,  15769,  15787,  15805,  15822,  15838,  15854,  15870,
+                 15884,  15899,  15912,  15925,  15938,  15949,  15960,  15971,
+                 15981,  15990,  15999,  16007,  16015,  16022,  16028,  16034,
+                 16039,  16043,  16047,  16051,  16053,  16056,  16057,  16058,
+                 16058,  16058,  16057,  16056,  16053,  16051,  16047,  16043,
+                 16039,  16034,  16028,  16022,  16015,  16007,  15999,  15990,
+                 15981,  15971,  15960,  15949,  15938,  15925,  15912,  15899,
+                 15884,  15870,  15854,  15838,  15822,  15805,  15787,  15769,
+                 15750,  15730,  15710,  15689,  15668,  15646,  15624,  15601,
+                 15577,  15553,  15528,  15503,  15477,  15450,  15423,  15395,
+                 15367,  15338,  15308,  15278,  15248,  15217,  15185,  15153,
+                 15120,  15086,  15052,  15017,  14982,  14947,  14910,  14873,
+                 14836,  14798,  14759,  14720,  14681,  14640,  14600,  14558,
+                 14517,  14474,  14431,  14388,  14344,  14299,  14254,  14208,
+                 14162,  14115,  14068,  14020,  13972,  13923,  13874,  13824,
+                 13774,  13723,  13671,  13619,  13567,  13514,  13460,  13406,
+                 13352,  13297,  13242,  13186,  13129,  13072,  13015,  12957,
+                 12898,  12839,  12780,  12720,  12660,  12599,  12537,  12476,
+                 12413,  12350,  12287,  12224,  12159,  12095,  12030,  11964,
+                 11898,  11832,  11765,  11698,  11630,  11562,  11493,  11424,
+                 11355,  11285,  11215,  11144,  11073,  11001,  10929,  10857,
+                 10784,  10711,  10637,  10563,  10489,  10414,  10339,  10263,
+                 10187,  10111,  10034,   9957,   9880,   9802,   9723,   9645,
+                  9566,   9487,   9407,   9327,   9247,   9166,   9085,   9003,
+                  8922,   8839,   8757,   8674,   8591,   8508,   8424,   8340,
+                  8256,   8171,   8086,   8001,   7915,   7829,   7743,   7657,
+                  7570,   7483,   7395,   7308,   7220,   7132,   7043,   6955,
+                  6866,   6777,   6687,   6597,   6507,   6417,   6327,   6236,
+                  6145,   6054,   5963,   5871,   5779,   5687,   5595,   5503,
+                  5410,   5317,   5224,   5131,   5037,   4944,   4850,   4756,
+                  4661,   4567,   4473,   4378,   4283,   4188,   4093,   3997,
+                  3902,   3806,   3710,   3614,   3518,   3422,   3326,   3229,
+                  3133,   3036,   2939,   2842,   2745,   2648,   2551,   2454,
+                  2356,   2259,   2161,   2063,   1966,   1868,   1770,   1672,
+                  1574,   1476,   1378,   1280,   1181,   1083,    985,    886,
+                   788,    690,    591,    493,    394,    296,    197,     99,
+                     0,    -99,   -197,   -296,   -394,   -493,   -591,   -690,
+                  -788,   -886,   -985,  -1083,  -1181,  -1280,  -1378,  -1476,
+                 -1574,  -1672,  -1770,  -1868,  -1966,  -2063,  -2161,  -2259,
+                 -2356,  -2454,  -2551,  -2648,  -2745,  -2842,  -2939,  -3036,
+                 -3133,  -3229,  -3326,  -3422,  -3518,  -3614,  -3710,  -3806,
+                 -3902,  -3997,  -4093,  -4188,  -4283,  -4378,  -4473,  -4567,
+                 -4661,  -4756,  -4850,  -4944,  -5037,  -5131,  -5224,  -5317,
+                 -5410,  -5503,  -5595,  -5687,  -5779,  -5871,  -5963,  -6054,
+                 -6145,  -6236,  -6327,  -6417,  -6507,  -6597,  -6687,  -6777,
+                 -6866,  -6955,  -7043,  -7132,  -7220,  -7308,  -7395,  -7483,
+                 -7570,  -7657,  -7743,  -7829,  -7915,  -8001,  -8086,  -8171,
+                 -8256,  -8340,  -8424,  -8508,  -8591,  -8674,  -8757,  -8839,
+                 -8922,  -9003,  -9085,  -9166,  -9247,  -9327,  -9407,  -9487,
+                 -9566,  -9645,  -9723,  -9802,  -9880,  -9957, -10034, -10111,
+                -10187, -10263, -10339, -10414, -10489, -10563, -10637, -10711,
+                -10784, -10857, -10929, -11001, -11073, -11144, -11215, -11285,
+                -11355, -11424, -11493, -11562, -11630, -11698, -11765, -11832,
+                -11898, -11964, -12030, -12095, -12159, -12224, -12287, -12350,
+                -12413, -12476, -12537, -12599, -12660, -12720, -12780, -12839,
+                -12898, -12957, -13015, -13072, -13129, -13186, -13242, -13297,
+                -13352, -13406, -13460, -13514, -13567, -13619, -13671, -13723,
+                -13774, -13824, -13874, -13923, -13972, -14020, -14068, -14115,
+                -14162, -14208, -14254, -14299, -14344, -14388, -14431, -14474,
+                -14517, -14558, -14600, -14640, -14681, -14720, -14759, -14798,
+                -14836, -14873, -14910, -14947, -14982, -15017, -15052, -15086,
+                -15120, -15153, -15185, -15217, -15248, -15278, -15308, -15338,
+                -15367, -15395, -15423, -15450, -15477, -15503, -15528, -15553,
+                -15577, -15601, -15624, -15646, -15668, -15689, -15710, -15730,
+                -15750, -15769, -15787, -15805, -15822, -15838, -15854, -15870,
+                -15884, -15899, -15912, -15925, -15938, -15949, -15960, -15971,
+                -15981, -15990, -15999, -16007, -16015, -16022, -16028, -16034,
+                -16039, -16043, -16047, -16051, -16053, -16056, -16057, -16058,
+                -16058, -16058, -16057, -16056, -16053, -16051, -16047, -16043,
+                -16039, -16034, -16028, -16022, -16015, -16007, -15999, -15990,
+                -15981, -15971, -15960, -15949, -15938, -15925, -15912, -15899,
+                -15884, -15870, -15854, -15838, -15822, -15805, -15787, -15769,
+                -15750, -15730, -15710, -15689, -15668, -15646, -15624, -15601,
+                -15577, -15553, -15528, -15503, -15477, -15450, -15423, -15395,
+                -15367, -15338, -15308, -15278, -15248, -15217, -15185, -15153,
+                -15120, -15086, -15052, -15017, -14982, -14947, -14910, -14873,
+                -14836, -14798, -14759, -14720, -14681, -14640, -14600, -14558,
+                -14517, -14474, -14431, -14388, -14344, -14299, -14254, -14208,
+                -14162, -14115, -14068, -14020, -13972, -13923, -13874, -13824,
+                -13774, -13723, -13671, -13619, -13567, -13514, -13460, -13406,
+                -13352, -13297, -13242, -13186, -13129, -13072, -13015, -12957,
+                -12898, -12839, -12780, -12720, -12660, -12599, -12537, -12476,
+                -12413, -12350, -12287, -12224, -12159, -12095, -12030, -11964,
+                -11898, -11832, -11765, -11698, -11630, -11562, -11493, -11424,
+                -11355, -11285, -11215, -11144, -11073, -11001, -10929, -10857,
+                -10784, -10711, -10637, -10563, -10489, -10414, -10339, -10263,
+                -10187, -10111, -10034,  -9957,  -9880,  -9802,  -9723,  -9645,
+                 -9566,  -9487,  -9407,  -9327,  -9247,  -9166,  -9085,  -9003,
+                 -8922,  -8839,  -8757,  -8674,  -8591,  -8508,  -8424,  -8340,
+                 -8256,  -8171,  -8086,  -8001,  -7915,  -7829,  -7743,  -7657,
+                 -7570,  -7483,  -7395,  -7308,  -7220,  -7132,  -7043,  -6955,
+                 -6866,  -6777,  -6687,  -6597,  -6507,  -6417,  -6327,  -6236,
+                 -6145,  -6054,  -5963,  -5871,  -5779,  -5687,  -5595,  -5503,
+                 -5410,  -5317,  -5224,  -5131,  -5037,  -4944,  -4850,  -4756,
+                 -4661,  -4567,  -4473,  -4378,  -4283,  -4188,  -4093,  -3997,
+                 -3902,  -3806,  -3710,  -3614,  -3518,  -3422,  -3326,  -3229,
+                 -3133,  -3036,  -2939,  -2842,  -2745,  -2648,  -2551,  -2454,
+                 -2356,  -2259,  -2161,  -2063,  -1966,  -1868,  -1770,  -1672,
+                 -1574,  -1476,  -1378,  -1280,  -1181,  -1083,   -985,   -886,
+                  -788,   -690,   -591,   -493,   -394,   -296,   -197,    -99,
+                     0,     99,    197,    296,    394,    493,    591,    690,
+                   788,    886,    985,   1083,   1181,   1280,   1378,   1476,
+                  1574,   1672,   1770,   1868,   1966,   2063,   2161,   2259,
+                  2356,   2454,   2551,   2648,   2745,   2842,   2939,   3036,
+                  3133,   3229,   3326,   3422,   3518,   3614,   3710,   3806,
+                  3902,   3997,   4093,   4188,   4283,   4378,   4473,   4567,
+                  4661,   4756,   4850,   4944,   5037,   5131,   5224,   5317,
+                  5410,   5503,   5595,   5687,   5779,   5871,   5963,   6054,
+                  6145,   6236,   6327,   6417,   6507,   6597,   6687,   6777,
+                  6866,   6955,   7043,   7132,   7220,   7308,   7395,   7483,
+                  7570,   7657,   7743,   7829,   7915,   8001,   8086,   8171,
+                  8256,   8340,   8424,   8508,   8591,   8674,   8757,   8839,
+                  8922,   9003,   9085,   9166,   9247,   9327,   9407,   9487,
+                  9566,   9645,   9723,   9802,   9880,   9957,  10034,  10111,
+                 10187,  10263,  10339,  10414,  10489,  10563,  10637,  10711,
+                 10784,  10857,  10929,  11001,  11073,  11144,  11215,  11285,
+                 11355,
+            }},
+            // 2 harmonics
+            {{
+                 11355,  11564,  11772,  11980,  12187,  12394,  12601,  12806,
+                 13011,  13216,  13420,  13623,  13826,  14027,  14229,  14429,
+                 14628,  14827,  15025,  15222,  15419,  15614,  15808,  16002,
+                 16194,  16386,  16576,  16766,  16954,  17142,  17328,  17513,
+                 17697,  17880,  18062,  18242,  18422,  18600,  18777,  18952,
+                 19126,  19299,  19471,  19641,  19810,  19977,  20143,  20308,
+                 20471,  20632,  20792,  20951,  21108,  21263,  21417,  21569,
+                 21720,  21869,  22016,  22162,  22306,  22448,  22589,  22728,
+                 22865,  23000,  23134,  23266,  23396,  23524,  23650,  23775,
+                 23897,  24018,  24136,  24253,  24368,  24481,  24592,  24701,
+                 24808,  24913,  25016,  25117,  25216,  25313,  25408,  25501,
+                 25591,  25680,  25766,  25851,  25933,  26013,  26091,  26167,
+                 26240,  26312,  26381,  26448,  26513,  26576,  26636,  26694,
+                 26750,  26804,  26856,  26905,  26952,  26997,  27039,  27080,
+                 27118,  27153,  27187,  27218,  27247,  27273,  27298,  27320,
+                 27339,  27357,  27372,  27384,  27395,  27403,  27409,  27412,
+                 27413,  27412,  27409,  27403,  27395,  27384,  27372,  27357,
+                 27339,  27320,  27298,  27273,  27247,  27218,  27187,  27153,
+                 27118,  27080,  27039,  26997,  26952,  26905,  26856,  26804,
+                 26750,  26694,  26636,  26576,  26513,  26448,  26381,  26312,
+                 26240,  26167,  26091,  26013,  25933,  25851,  25766,  25680,
+                 25591,  25501,  25408,  25313,  25216,  25117,  25016,  24913,
+                 24808,  24701,  24592,  24481,  24368,  24253,  24136,  24018,
+                 23897,  23775,  23650,  23524,  23396,  23266,  23134,  23000,
+                 22865,  22728,  22589,  22448,  22306,  22162,  22016,  21869,
+                 21720,  21569,  21417,  21263,  21108,  20951,  20792,  20632,
+                 20471,  20308,  20143,  19977,  19810,  19641,  19471,  19299,
+                 19126,  18952,  18777,  18600,  18422,  18242,  18062,  17880,
+                 17697,  17513,  17328,  17142,  16954,  16766,  16576,  16386,
+                 16194,  16002,  15808,  15614,  15419,  15222,  15025,  14827,
+                 14628,  14429,  14229,  14027,  13826,  13623,  13420,  13216,
+                 13011,  12806,  12601,  12394,  12187,  11980,  11772,  11564,
+                 11355,  11146,  10936,  10726,  10516,  10305,  10094,   9883,
+                  9671,   9459,   9247,   9035,   8823,   8610,   8398,   8185,
+                  7972,   7759,   7546,   7333,   7121,   6908,   6695,   6482,
+                  6270,   6057,   5845,   5633,   5421,   5209,   4998,   4787,
+                  4576,   4366,   4156,   3946,   3736,   3527,   3319,   3111,
+                  2903,   2696,   2489,   2283,   2078,   1873,   1668,   1464,
+                  1261,   1059,    857,    656,    456,    256,     58,   -140,
+                  -338,   -534,   -730,   -924,  -1118,  -1311,  -1503,  -1694,
+                 -1884,  -2073,  -2261,  -2448,  -2634,  -2819,  -3003,  -3186,
+                 -3368,  -3548,  -3728,  -3906,  -4083,  -4259,  -4434,  -4607,
+                 -4780,  -4951,  -5121,  -5289,  -5456,  -5622,  -5787,  -5950,
+                 -6112,  -6273,  -6432,  -6590,  -6746,  -6901,  -7055,  -7207,
+                 -7358,  -7507,  -7655,  -7801,  -7946,  -8089,  -8231,  -8371,
+                 -8510,  -8647,  -8782,  -8916,  -9049,  -9180,  -9309,  -9437,
+                 -9563,  -9687,  -9810,  -9931, -10051, -10169, -10285, -10399,
+                -10512, -10624, -10733, -10841, -10947, -11052, -11154, -11256,
+                -11355, -11453, -11549, -11643, -11735, -11826, -11915, -12003,
+                -12088, -12172, -12254, -12335, -12413, -12490, -12566, -12639,
+                -12711, -12781, -12849, -12916, -12980, -13043, -13105, -13164,
+                -13222, -13278, -13333, -13386, -13437, -13486, -13533, -13579,
+                -13623, -13666, -13707, -13746, -13783, -13819, -13853, -13885,
+                -13916, -13945, -13972, -13998, -14022, -14045, -14066, -14085,
+                -14103, -14119, -14133, -14146, -14158, -14167, -14176, -14182,
+                -14187, -14191, -14193, -14194, -14193, -14190, -14187, -14181,
+                -14174, -14166, -14157, -14145, -14133, -14119, -14104, -14087,
+                -14069, -14050, -14029, -14007, -13984, -13960, -13934, -13907,
+                -13878, -13849, -13818, -13786, -13753, -13718, -13683, -13646,
+                -13608, -13569, -13529, -13488, -13446, -13403, -13358, -13313,
+                -13267, -13220, -13171, -13122, -13072, -13021, -12969, -12916,
+                -12862, -12807, -12752, -12696, -12639, -12581, -12522, -12463,
+                -12403, -12342, -12280, -12218, -12155, -12091, -12027, -11962,
+                -11897, -11831, -11765, -11698, -11630, -11562, -11493, -11424,
+                -11355, -11285, -11215, -11144, -11073, -11002, -10930, -10858,
+                -10785, -10713, -10640, -10567, -10493, -10420, -10346, -10272,
+                -10198, -10124, -10049,  -9975,  -9900,  -9826,  -9751,  -9677,
+                 -9602,  -9527,  -9453,  -9378,  -9304,  -9229,  -9155,  -9081,
+                 -9007,  -8933,  -8859,  -8785,  -8712,  -8639,  -8566,  -8493,
+                 -8421,  -8349,  -8277,  -8206,  -8135,  -8064,  -7993,  -7923,
+                 -7854,  -7784,  -7716,  -7647,  -7580,  -7512,  -7445,  -7379,
+                 -7313,  -7248,  -7183,  -7119,  -7055,  -6992,  -6930,  -6868,
+                 -6807,  -6746,  -6686,  -6627,  -6569,  -6511,  -6454,  -6398,
+                 -6342,  -6287,  -6233,  -6180,  -6127,  -6076,  -6025,  -5975,
+                 -5926,  -5877,  -5830,  -5783,  -5737,  -5692,  -5648,  -5605,
+                 -5563,  -5522,  -5481,  -5442,  -5403,  -5366,  -5329,  -5294,
+                 -5259,  -5226,  -5193,  -5161,  -5131,  -5101,  -5073,  -5045,
+                 -5018,  -4993,  -4969,  -4945,  -4923,  -4902,  -4881,  -4862,
+                 -4844,  -4827,  -4811,  -4796,  -4783,  -4770,  -4759,  -4748,
+                 -4739,  -4730,  -4723,  -4717,  -4712,  -4708,  -4706,  -4704,
+                 -4703,  -4704,  -4706,  -4708,  -4712,  -4717,  -4723,  -4730,
+                 -4739,  -4748,  -4759,  -4770,  -4783,  -4796,  -4811,  -4827,
+                 -4844,  -4862,  -4881,  -4902,  -4923,  -4945,  -4969,  -4993,
+                 -5018,  -5045,  -5073,  -5101,  -5131,  -5161,  -5193,  -5226,
+                 -5259,  -5294,  -5329,  -5366,  -5403,  -5442,  -5481,  -5522,
+                 -5563,  -5605,  -5648,  -5692,  -5737,  -5783,  -5830,  -5877,
+                 -5926,  -5975,  -6025,  -6076,  -6127,  -6180,  -6233,  -6287,
+                 -6342,  -6398,  -6454,  -6511,  -6569,  -6627,  -6686,  -6746,
+                 -6807,  -6868,  -6930,  -6992,  -7055,  -7119,  -7183,  -7248,
+                 -7313,  -7379,  -7445,  -7512,  -7580,  -7647,  -7716,  -7784,
+                 -7854,  -7923,  -7993,  -8064,  -8135,  -8206,  -8277,  -8349,
+                 -8421,  -8493,  -8566,  -8639,  -8712,  -8785,  -8859,  -8933,
+                 -9007,  -9081,  -9155,  -9229,  -9304,  -9378,  -9453,  -9527,
+                 -9602,  -9677,  -9751,  -9826,  -9900,  -9975, -10049, -10124,
+                -10198, -10272, -10346, -10420, -10493, -10567, -10640, -10713,
+                -10785, -10858, -10930, -11002, -11073, -11144, -11215, -11285,
+                -11355, -11424, -11493, -11562, -11630, -11698, -11765, -11831,
+                -11897, -11962, -12027, -12091, -12155, -12218, -12280, -12342,
+                -12403, -12463, -12522, -12581, -12639, -12696, -12752, -12807,
+                -12862, -12916, -12969, -13021, -13072, -13122, -13171, -13220,
+                -13267, -13313, -13358, -13403, -13446, -13488, -13529, -13569,
+                -13608, -13646, -13683, -13718, -13753, -13786, -13818, -13849,
+                -13878, -13907, -13934, -13960, -13984, -14007, -14029, -14050,
+                -14069, -14087, -14104, -14119, -14133, -14145, -14157, -14166,
+                -14174, -14181, -14187, -14190, -14193, -14194, -14193, -14191,
+                -14187, -14182, -14176, -14167, -14158, -14146, -14133, -14119,
+                -14103, -14085, -14066, -14045, -14022, -13998, -13972, -13945,
+                -13916, -13885, -13853, -13819, -13783, -13746, -13707, -13666,
+                -13623, -13579, -13533, -13486, -13437, -13386, -13333, -13278,
+                -13222, -13164, -13105, -13043, -12980, -12916, -12849, -12781,
+                -12711, -12639, -12566, -12490, -12413, -12335, -12254, -12172,
+                -12088, -12003, -11915, -11826, -11735, -11643, -11549, -11453,
+                -11355, -11256, -11154, -11052, -10947, -10841, -10733, -10624,
+                -10512, -10399, -10285, -10169, -10051,  -9931,  -9810,  -9687,
+                 -9563,  -9437,  -9309,  -9180,  -9049,  -8916,  -8782,  -8647,
+                 -8510,  -8371,  -8231,  -8089,  -7946,  -7801,  -7655,  -7507,
+                 -7358,  -7207,  -7055,  -6901,  -6746,  -6590,  -6432,  -6273,
+                 -6112,  -5950,  -5787,  -5622,  -5456,  -5289,  -5121,  -4951,
+                 -4780,  -4607,  -4434,  -4259,  -4083,  -3906,  -3728,  -3548,
+                 -3368,  -3186,  -3003,  -2819,  -2634,  -2448,  -2261,  -2073,
+                 -1884,  -1694,  -1503,  -1311,  -1118,   -924,   -730,   -534,
+                  -338,   -140,     58,    256,    456,    656,    857,   1059,
+                  1261,   1464,   1668,   1873,   2078,   2283,   2489,   2696,
+                  2903,   3111,   3319,   3527,   3736,   3946,   4156,   4366,
+                  4576,   4787,   4998,   5209,   5421,   5633,   5845,   6057,
+                  6270,   6482,   6695,   6908,   7121,   7333,   7546,   7759,
+                  7972,   8185,   8398,   8610,   8823,   9035,   9247,   9459,
+                  9671,   9883,  10094,  10305,  10516,  10726,  10936,  11146,
+                 11355,
+            }},
+            // 4 harmonics
+            {{
+                  7570,   7849,   8129,   8410,   8691,   8973,   9256,   9539,
+                  9823,  10107,  10392,  10677,  10962,  11247,  11533,  11819,
+                 12105,  12391,  12677,  12963,  13249,  13535,  13821,  14106,
+                 14391,  14676,  14960,  15244,  15527,  15809,  16091,  16373,
+                 16653,  16933,  17212,  17490,  17767,  18042,  18317,  18591,
+                 18864,  19135,  19405,  19674,  19941,  20207,  20471,  20734,
+                 20995,  21255,  21513,  21769,  22023,  22275,  22526,  22774,
+                 23021,  23265,  23507,  23747,  23985,  24221,  24454,  24685,
+                 24914,  25140,  25363,  25584,  25802,  26018,  26231,  26441,
+                 26649,  26854,  27055,  27254,  27450,  27643,  27833,  28020,
+                 28204,  28384,  28562,  28736,  28907,  29075,  29239,  29400,
+                 29557,  29711,  29862,  30009,  30153,  30293,  30429,  30562,
+                 30691,  30816,  30938,  31056,  31170,  31281,  31388,  31490,
+                 31589,  31684,  31776,  31863,  31946,  32026,  32101,  32173,
+                 32240,  32303,  32363,  32418,  32470,  32517,  32560,  32599,
+                 32634,  32665,  32692,  32714,  32733,  32747,  32758,  32764,
+                 32766,  32764,  32758,  32747,  32733,  32714,  32692,  32665,
+                 32634,  32599,  32560,  32517,  32470,  32418,  32363,  32303,
+                 32240,  32173,  32101,  32026,  31946,  31863,  31776,  31684,
+                 31589,  31490,  31388,  31281,  31170,  31056,  30938,  30816,
+                 30691,  30562,  30429,  30293,  30153,  30009,  29862,  29711,
+                 29557,  29400,  29239,  29075,  28907,  28736,  28562,  28384,
+                 28204,  28020,  27833,  27643,  27450,  27254,  27055,  26854,
+                 26649,  26441,  26231,  26018,  25802,  25584,  25363,  25140,
+                 24914,  24685,  24454,  24221,  23985,  23747,  23507,  23265,
+                 23021,  22774,  22526,  22275,  22023,  21769,  21513,  21255,
+                 20995,  20734,  20471,  20207,  19941,  19674,  19405,  19135,
+                 18864,  18591,  18317,  18042,  17767,  17490,  17212,  16933,
+                 16653,  16373,  16091,  15809,  15527,  15244,  14960,  14676,
+                 14391,  14106,  13821,  13535,  13249,  12963,  12677,  12391,
+                 12105,  11819,  11533,  11247,  10962,  10677,  10392,  10107,
+                  9823,   9539,   9256,   8973,   8691,   8410,   8129,   7849,
+                  7570,   7292,   7014,   6738,   6463,   6188,   5915,   5643,
+                  5372,   5102,   4833,   4566,   4300,   4036,   3773,   3511,
+                  3251,   2993,   2736,   2481,   2227,   1975,   1725,   1476,
+                  1230,    985,    742,    501,    262,     25,   -210,   -443,
+                  -674,   -903,  -1129,  -1354,  -1576,  -1796,  -2014,  -2230,
+                 -2443,  -2654,  -2863,  -3070,  -3274,  -3475,  -3675,  -3871,
+                 -4066,  -4257,  -4447,  -4634,  -4818,  -5000,  -5179,  -5356,
+                 -5530,  -5702,  -5871,  -6037,  -6201,  -6362,  -6520,  -6676,
+                 -6829,  -6980,  -7128,  -7273,  -7415,  -7555,  -7692,  -7827,
+                 -7959,  -8088,  -8215,  -8338,  -8460,  -8578,  -8694,  -8807,
+                 -8918,  -9025,  -9131,  -9233,  -9333,  -9431,  -9525,  -9617,
+                 -9707,  -9794,  -9878,  -9960, -10040, -10116, -10191, -10262,
+                -10332, -10398, -10463, -10525, -10584, -10641, -10696, -10748,
+                -10798, -10846, -10891, -10935, -10975, -11014, -11050, -11085,
+                -11117, -11146, -11174, -11200, -11224, -11245, -11265, -11282,
+                -11298, -11311, -11323, -11333, -11341, -11347, -11351, -11354,
+                -11355, -11354, -11352, -11347, -11342, -11334, -11325, -11315,
+                -11303, -11289, -11274, -11258, -11241, -11222, -11201, -11180,
+                -11157, -11133, -11108, -11081, -11054, -11025, -10996, -10965,
+                -10934, -10901, -10868, -10833, -10798, -10762, -10725, -10688,
+                -10650, -10611, -10571, -10531, -10490, -10449, -10407, -10364,
+                -10321, -10278, -10234, -10190, -10146, -10101, -10056, -10011,
+                 -9965,  -9919,  -9873,  -9827,  -9781,  -9735,  -9689,  -9642,
+                 -9596,  -9550,  -9504,  -9458,  -9412,  -9366,  -9320,  -9274,
+                 -9229,  -9184,  -9139,  -9095,  -9050,  -9006,  -8963,  -8920,
+                 -8877,  -8835,  -8793,  -8751,  -8710,  -8670,  -8630,  -8590,
+                 -8551,  -8513,  -8475,  -8438,  -8402,  -8366,  -8330,  -8296,
+                 -8262,  -8229,  -8196,  -8165,  -8134,  -8103,  -8074,  -8045,
+                 -8017,  -7990,  -7963,  -7938,  -7913,  -7889,  -7866,  -7844,
+                 -7822,  -7802,  -7782,  -7763,  -7745,  -7728,  -7712,  -7696,
+                 -7682,  -7668,  -7655,  -7644,  -7633,  -7623,  -7613,  -7605,
+                 -7598,  -7591,  -7586,  -7581,  -7577,  -7574,  -7572,  -7570,
+                 -7570,  -7570,  -7572,  -7574,  -7577,  -7581,  -7585,  -7591,
+                 -7597,  -7604,  -7612,  -7620,  -7630,  -7640,  -7651,  -7662,
+                 -7675,  -7688,  -7702,  -7716,  -7731,  -7747,  -7764,  -7781,
+                 -7799,  -7817,  -7836,  -7856,  -7876,  -7897,  -7918,  -7940,
+                 -7962,  -7985,  -8009,  -8033,  -8057,  -8082,  -8107,  -8132,
+                 -8158,  -8185,  -8211,  -8238,  -8266,  -8294,  -8322,  -8350,
+                 -8378,  -8407,  -8436,  -8465,  -8495,  -8524,  -8554,  -8584,
+                 -8614,  -8644,  -8674,  -8704,  -8734,  -8764,  -8795,  -8825,
+                 -8855,  -8885,  -8916,  -8946,  -8975,  -9005,  -9035,  -9065,
+                 -9094,  -9123,  -9152,  -9181,  -9210,  -9238,  -9266,  -9294,
+                 -9321,  -9349,  -9375,  -9402,  -9428,  -9454,  -9479,  -9504,
+                 -9529,  -9553,  -9577,  -9600,  -9623,  -9646,  -9668,  -9689,
+                 -9710,  -9730,  -9750,  -9769,  -9788,  -9806,  -9824,  -9841,
+                 -9857,  -9873,  -9888,  -9903,  -9917,  -9930,  -9943,  -9955,
+                 -9967,  -9977,  -9987,  -9997, -10005, -10014, -10021, -10028,
+                -10034, -10039, -10043, -10047, -10050, -10053, -10055, -10056,
+                -10056, -10056, -10055, -10053, -10050, -10047, -10043, -10039,
+                -10034, -10028, -10021, -10014, -10005,  -9997,  -9987,  -9977,
+                 -9967,  -9955,  -9943,  -9930,  -9917,  -9903,  -9888,  -9873,
+                 -9857,  -9841,  -9824,  -9806,  -9788,  -9769,  -9750,  -9730,
+                 -9710,  -9689,  -9668,  -9646,  -9623,  -9600,  -9577,  -9553,
+                 -9529,  -9504,  -9479,  -9454,  -9428,  -9402,  -9375,  -9349,
+                 -9321,  -9294,  -9266,  -9238,  -9210,  -9181,  -9152,  -9123,
+                 -9094,  -9065,  -9035,  -9005,  -8975,  -8946,  -8916,  -8885,
+                 -8855,  -8825,  -8795,  -8764,  -8734,  -8704,  -8674,  -8644,
+                 -8614,  -8584,  -8554,  -8524,  -8495,  -8465,  -8436,  -8407,
+                 -8378,  -8350,  -8322,  -8294,  -8266,  -8238,  -8211,  -8185,
+                 -8158,  -8132,  -8107,  -8082,  -8057,  -8033,  -8009,  -7985,
+                 -7962,  -7940,  -7918,  -7897,  -7876,  -7856,  -7836,  -7817,
+                 -7799,  -7781,  -7764,  -7747,  -7731,  -7716,  -7702,  -7688,
+                 -7675,  -7662,  -7651,  -7640,  -7630,  -7620,  -7612,  -7604,
+                 -7597,  -7591,  -7585,  -7581,  -7577,  -7574,  -7572,  -7570,
+                 -7570,  -7570,  -7572,  -7574,  -7577,  -7581,  -7586,  -7591,
+                 -7598,  -7605,  -7613,  -7623,  -7633,  -7644,  -7655,  -7668,
+                 -7682,  -7696,  -7712,  -7728,  -7745,  -7763,  -7782,  -7802,
+                 -7822,  -7844,  -7866,  -7889,  -7913,  -7938,  -7963,  -7990,
+                 -8017,  -8045,  -8074,  -8103,  -8134,  -8165,  -8196,  -8229,
+                 -8262,  -8296,  -8330,  -8366,  -8402,  -8438,  -8475,  -8513,
+                 -8551,  -8590,  -8630,  -8670,  -8710,  -8751,  -8793,  -8835,
+                 -8877,  -8920,  -8963,  -9006,  -9050,  -9095,  -9139,  -9184,
+                 -9229,  -9274,  -9320,  -9366,  -9412,  -9458,  -9504,  -9550,
+                 -9596,  -9642,  -9689,  -9735,  -9781,  -9827,  -9873,  -9919,
+                 -9965, -10011, -10056, -10101, -10146, -10190, -10234, -10278,
+                -10321, -10364, -10407, -10449, -10490, -10531, -10571, -10611,
+                -10650, -10688, -10725, -10762, -10798, -10833, -10868, -10901,
+                -10934, -10965, -10996, -11025, -11054, -11081, -11108, -11133,
+                -11157, -11180, -11201, -11222, -11241, -11258, -11274, -11289,
+                -11303, -11315, -11325, -11334, -11342, -11347, -11352, -11354,
+                -11355, -11354, -11351, -11347, -11341, -11333, -11323, -11311,
+                -11298, -11282, -11265, -11245, -11224, -11200, -11174, -11146,
+                -11117, -11085, -11050, -11014, -10975, -10935, -10891, -10846,
+                -10798, -10748, -10696, -10641, -10584, -10525, -10463, -10398,
+                -10332, -10262, -10191, -10116, -10040,  -9960,  -9878,  -9794,
+                 -9707,  -9617,  -9525,  -9431,  -9333,  -9233,  -9131,  -9025,
+                 -8918,  -8807,  -8694,  -8578,  -8460,  -8338,  -8215,  -8088,
+                 -7959,  -7827,  -7692,  -7555,  -7415,  -7273,  -7128,  -6980,
+                 -6829,  -6676,  -6520,  -6362,  -6201,  -6037,  -5871,  -5702,
+                 -5530,  -5356,  -5179,  -5000,  -4818,  -4634,  -4447,  -4257,
+                 -4066,  -3871,  -3675,  -3475,  -3274,  -3070,  -2863,  -2654,
+                 -2443,  -2230,  -2014,  -1796,  -1576,  -1354,  -1129,   -903,
+                  -674,   -443,   -210,     25,    262,    501,    742,    985,
+                  1230,   1476,   1725,   1975,   2227,   2481,   2736,   2993,
+                  3251,   3511,   3773,   4036,   4300,   4566,   4833,   5102,
+                  5372,   5643,   5915,   6188,   6463,   6738,   7014,   7292,
+                  7570,
+            }},
+            // 8 harmonics
+            {{
+                  8219,   8777,   9336,   9897,  10457,  11018,  11578,  12137,
+                 12695,  13251,  13805,  14356,  14904,  15449,  15989,  16525,
+                 17057,  17582,  18103,  18617,  19124,  19625,  20118,  20604,
+                 21082,  21551,  22012,  22464,  22906,  23338,  23761,  24173,
+                 24574,  24965,  25345,  25713,  26069,  26414,  26747,  27068,
+                 27376,  27672,  27956,  28226,  28484,  28729,  28961,  29180,
+                 29385,  29578,  29758,  29924,  30078,  30219,  30346,  30461,
+                 30563,  30653,  30730,  30794,  30847,  30887,  30916,  30933,
+                 30938,  30933,  30916,  30889,  30852,  30804,  30747,  30680,
+                 30604,  30519,  30426,  30325,  30216,  30099,  29976,  29845,
+                 29709,  29567,  29419,  29266,  29109,  28947,  28782,  28613,
+                 28441,  28267,  28090,  27912,  27733,  27552,  27372,  27191,
+                 27011,  26831,  26653,  26476,  26301,  26129,  25959,  25792,
+                 25629,  25470,  25314,  25164,  25018,  24877,  24741,  24611,
+                 24487,  24369,  24258,  24153,  24055,  23965,  23881,  23805,
+                 23737,  23676,  23623,  23578,  23541,  23512,  23492,  23479,
+                 23475,  23479,  23492,  23512,  23541,  23578,  23623,  23676,
+                 23737,  23805,  23881,  23965,  24055,  24153,  24258,  24369,
+                 24487,  24611,  24741,  24877,  25018,  25164,  25314,  25470,
+                 25629,  25792,  25959,  26129,  26301,  26476,  26653,  26831,
+                 27011,  27191,  27372,  27552,  27733,  27912,  28090,  28267,
+                 28441,  28613,  28782,  28947,  29109,  29266,  29419,  29567,
+                 29709,  29845,  29976,  30099,  30216,  30325,  30426,  30519,
+                 30604,  30680,  30747,  30804,  30852,  30889,  30916,  30933,
+                 30938,  30933,  30916,  30887,  30847,  30794,  30730,  30653,
+                 30563,  30461,  30346,  30219,  30078,  29924,  29758,  29578,
+                 29385,  29180,  28961,  28729,  28484,  28226,  27956,  27672,
+                 27376,  27068,  26747,  26414,  26069,  25713,  25345,  24965,
+                 24574,  24173,  23761,  23338,  22906,  22464,  22012,  21551,
+                 21082,  20604,  20118,  19625,  19124,  18617,  18103,  17582,
+                 17057,  16525,  15989,  15449,  14904,  14356,  13805,  13251,
+                 12695,  12137,  11578,  11018,  10457,   9897,   9336,   8777,
+                  8219,   7662,   7108,   6556,   6007,   5462,   4921,   4383,
+                  3850,   3323,   2800,   2283,   1773,   1268,    771,    281,
+                  -202,   -677,  -1145,  -1603,  -2054,  -2495,  -2927,  -3350,
+                 -3764,  -4167,  -4561,  -4944,  -5318,  -5680,  -6033,  -6374,
+                 -6705,  -7024,  -7333,  -7630,  -7917,  -8192,  -8456,  -8708,
+                 -8950,  -9180,  -9399,  -9607,  -9804,  -9989, -10164, -10328,
+                -10481, -10624, -10756, -10877, -10989, -11090, -11181, -11263,
+                -11335, -11398, -11452, -11496, -11533, -11560, -11580, -11591,
+                -11595, -11591, -11580, -11563, -11538, -11507, -11470, -11428,
+                -11379, -11326, -11267, -11204, -11137, -11065, -10990, -10911,
+                -10829, -10744, -10656, -10566, -10474, -10380, -10285, -10188,
+                -10091,  -9992,  -9893,  -9794,  -9695,  -9596,  -9498,  -9400,
+                 -9304,  -9208,  -9114,  -9021,  -8930,  -8841,  -8754,  -8669,
+                 -8586,  -8506,  -8429,  -8355,  -8283,  -8215,  -8149,  -8087,
+                 -8028,  -7973,  -7921,  -7872,  -7827,  -7786,  -7748,  -7714,
+                 -7683,  -7656,  -7633,  -7614,  -7598,  -7586,  -7577,  -7572,
+                 -7570,  -7572,  -7577,  -7585,  -7597,  -7611,  -7629,  -7650,
+                 -7673,  -7700,  -7728,  -7760,  -7794,  -7830,  -7868,  -7909,
+                 -7951,  -7995,  -8041,  -8088,  -8137,  -8187,  -8238,  -8290,
+                 -8343,  -8397,  -8451,  -8506,  -8561,  -8616,  -8671,  -8726,
+                 -8781,  -8835,  -8889,  -8942,  -8995,  -9047,  -9097,  -9147,
+                 -9196,  -9243,  -9289,  -9333,  -9376,  -9417,  -9457,  -9495,
+                 -9530,  -9564,  -9596,  -9626,  -9654,  -9680,  -9703,  -9725,
+                 -9744,  -9761,  -9776,  -9788,  -9798,  -9806,  -9812,  -9815,
+                 -9816,  -9815,  -9812,  -9806,  -9799,  -9789,  -9777,  -9764,
+                 -9748,  -9730,  -9711,  -9690,  -9667,  -9643,  -9617,  -9589,
+                 -9560,  -9530,  -9499,  -9466,  -9432,  -9398,  -9362,  -9326,
+                 -9289,  -9251,  -9213,  -9175,  -9136,  -9097,  -9058,  -9019,
+                 -8980,  -8941,  -8902,  -8864,  -8826,  -8789,  -8752,  -8716,
+                 -8680,  -8646,  -8612,  -8580,  -8548,  -8518,  -8489,  -8461,
+                 -8434,  -8409,  -8385,  -8362,  -8341,  -8322,  -8304,  -8288,
+                 -8274,  -8261,  -8250,  -8240,  -8233,  -8227,  -8222,  -8220,
+                 -8219,  -8220,  -8222,  -8226,  -8232,  -8240,  -8249,  -8260,
+                 -8272,  -8286,  -8301,  -8318,  -8336,  -8355,  -8376,  -8397,
+                 -8420,  -8444,  -8470,  -8496,  -8523,  -8550,  -8579,  -8608,
+                 -8638,  -8668,  -8699,  -8731,  -8762,  -8794,  -8826,  -8858,
+                 -8890,  -8922,  -8954,  -8985,  -9017,  -9048,  -9078,  -9108,
+                 -9137,  -9166,  -9194,  -9222,  -9248,  -9273,  -9298,  -9322,
+                 -9344,  -9365,  -9386,  -9405,  -9422,  -9439,  -9454,  -9468,
+                 -9480,  -9491,  -9501,  -9509,  -9515,  -9521,  -9524,  -9527,
+                 -9527,  -9527,  -9524,  -9521,  -9516,  -9509,  -9501,  -9492,
+                 -9481,  -9469,  -9455,  -9441,  -9425,  -9408,  -9389,  -9370,
+                 -9350,  -9328,  -9306,  -9282,  -9258,  -9233,  -9208,  -9182,
+                 -9155,  -9127,  -9099,  -9071,  -9043,  -9014,  -8985,  -8956,
+                 -8926,  -8897,  -8868,  -8839,  -8811,  -8782,  -8754,  -8727,
+                 -8699,  -8673,  -8647,  -8622,  -8597,  -8574,  -8551,  -8529,
+                 -8508,  -8488,  -8469,  -8451,  -8435,  -8419,  -8405,  -8392,
+                 -8380,  -8370,  -8361,  -8353,  -8347,  -8342,  -8338,  -8336,
+                 -8335,  -8336,  -8338,  -8342,  -8347,  -8353,  -8361,  -8370,
+                 -8380,  -8392,  -8405,  -8419,  -8435,  -8451,  -8469,  -8488,
+                 -8508,  -8529,  -8551,  -8574,  -8597,  -8622,  -8647,  -8673,
+                 -8699,  -8727,  -8754,  -8782,  -8811,  -8839,  -8868,  -8897,
+                 -8926,  -8956,  -8985,  -9014,  -9043,  -9071,  -9099,  -9127,
+                 -9155,  -9182,  -9208,  -9233,  -9258,  -9282,  -9306,  -9328,
+                 -9350,  -9370,  -9389,  -9408,  -9425,  -9441,  -9455,  -9469,
+                 -9481,  -9492,  -9501,  -9509,  -9516,  -9521,  -9524,  -9527,
+                 -9527,  -9527,  -9524,  -9521,  -9515,  -9509,  -9501,  -9491,
+                 -9480,  -9468,  -9454,  -9439,  -9422,  -9405,  -9386,  -9365,
+                 -9344,  -9322,  -9298,  -9273,  -9248,  -9222,  -9194,  -9166,
+                 -9137,  -9108,  -9078,  -9048,  -9017,  -8985,  -8954,  -8922,
+                 -8890,  -8858,  -8826,  -8794,  -8762,  -8731,  -8699,  -8668,
+                 -8638,  -8608,  -8579,  -8550,  -8523,  -8496,  -8470,  -8444,
+                 -8420,  -8397,  -8376,  -8355,  -8336,  -8318,  -8301,  -8286,
+                 -8272,  -8260,  -8249,  -8240,  -8232,  -8226,  -8222,  -8220,
+                 -8219,  -8220,  -8222,  -8227,  -8233,  -8240,  -8250,  -8261,
+                 -8274,  -8288,  -8304,  -8322,  -8341,  -8362,  -8385,  -8409,
+                 -8434,  -8461,  -8489,  -8518,  -8548,  -8580,  -8612,  -8646,
+                 -8680,  -8716,  -8752,  -8789,  -8826,  -8864,  -8902,  -8941,
+                 -8980,  -9019,  -9058,  -9097,  -9136,  -9175,  -9213,  -9251,
+                 -9289,  -9326,  -9362,  -9398,  -9432,  -9466,  -9499,  -9530,
+                 -9560,  -9589,  -9617,  -9643,  -9667,  -9690,  -9711,  -9730,
+                 -9748,  -9764,  -9777,  -9789,  -9799,  -9806,  -9812,  -9815,
+                 -9816,  -9815,  -9812,  -9806,  -9798,  -9788,  -9776,  -9761,
+                 -9744,  -9725,  -9703,  -9680,  -9654,  -9626,  -9596,  -9564,
+                 -9530,  -9495,  -9457,  -9417,  -9376,  -9333,  -9289,  -9243,
+                 -9196,  -9147,  -9097,  -9047,  -8995,  -8942,  -8889,  -8835,
+                 -8781,  -8726,  -8671,  -8616,  -8561,  -8506,  -8451,  -8397,
+                 -8343,  -8290,  -8238,  -8187,  -8137,  -8088,  -8041,  -7995,
+                 -7951,  -7909,  -7868,  -7830,  -7794,  -7760,  -7728,  -7700,
+                 -7673,  -7650,  -7629,  -7611,  -7597,  -7585,  -7577,  -7572,
+                 -7570,  -7572,  -7577,  -7586,  -7598,  -7614,  -7633,  -7656,
+                 -7683,  -7714,  -7748,  -7786,  -7827,  -7872,  -7921,  -7973,
+                 -8028,  -8087,  -8149,  -8215,  -8283,  -8355,  -8429,  -8506,
+                 -8586,  -8669,  -8754,  -8841,  -8930,  -9021,  -9114,  -9208,
+                 -9304,  -9400,  -9498,  -9596,  -9695,  -9794,  -9893,  -9992,
+                -10091, -10188, -10285, -10380, -10474, -10566, -10656, -10744,
+                -10829, -10911, -10990, -11065, -11137, -11204, -11267, -11326,
+                -11379, -11428, -11470, -11507, -11538, -11563, -11580, -11591,
+                -11595, -11591, -11580, -11560, -11533, -11496, -11452, -11398,
+                -11335, -11263, -11181, -11090, -10989, -10877, -10756, -10624,
+                -10481, -10328, -10164,  -9989,  -9804,  -9607,  -9399,  -9180,
+                 -8950,  -8708,  -8456,  -8192,  -7917,  -7630,  -7333,  -7024,
+                 -6705,  -6374,  -6033,  -5680,  -5318,  -4944,  -4561,  -4167,
+                 -3764,  -3350,  -2927,  -2495,  -2054,  -1603,  -1145,   -677,
+                  -202,    281,    771,   1268,   1773,   2283,   2800,   3323,
+                  3850,   4383,   4921,   5462,   6007,   6556,   7108,   7662,
+                  8219,
+            }},
+            // 16 harmonics
+            {{
+                  8565,   9681,  10796,  11908,  13013,  14107,  15187,  16249,
+                 17290,  18306,  19296,  20255,  21180,  22071,  22923,  23734,
+                 24504,  25229,  25908,  26541,  27126,  27661,  28148,  28585,
+                 28972,  29310,  29599,  29840,  30034,  30181,  30285,  30346,
+                 30365,  30346,  30291,  30201,  30079,  29928,  29750,  29549,
+                 29327,  29088,  28833,  28566,  28291,  28009,  27723,  27438,
+                 27154,  26875,  26603,  26340,  26089,  25852,  25630,  25425,
+                 25238,  25071,  24925,  24801,  24698,  24619,  24562,  24528,
+                 24517,  24528,  24560,  24614,  24688,  24781,  24891,  25018,
+                 25160,  25315,  25481,  25658,  25842,  26033,  26227,  26424,
+                 26622,  26818,  27011,  27199,  27380,  27553,  27716,  27868,
+                 28007,  28133,  28243,  28338,  28417,  28479,  28523,  28549,
+                 28558,  28549,  28523,  28480,  28420,  28345,  28254,  28150,
+                 28032,  27903,  27763,  27615,  27459,  27296,  27130,  26960,
+                 26789,  26618,  26450,  26285,  26125,  25972,  25826,  25690,
+                 25565,  25452,  25352,  25265,  25193,  25136,  25095,  25071,
+                 25062,  25071,  25095,  25136,  25193,  25265,  25352,  25452,
+                 25565,  25690,  25826,  25972,  26125,  26285,  26450,  26618,
+                 26789,  26960,  27130,  27296,  27459,  27615,  27763,  27903,
+                 28032,  28150,  28254,  28345,  28420,  28480,  28523,  28549,
+                 28558,  28549,  28523,  28479,  28417,  28338,  28243,  28133,
+                 28007,  27868,  27716,  27553,  27380,  27199,  27011,  26818,
+                 26622,  26424,  26227,  26033,  25842,  25658,  25481,  25315,
+                 25160,  25018,  24891,  24781,  24688,  24614,  24560,  24528,
+                 24517,  24528,  24562,  24619,  24698,  24801,  24925,  25071,
+                 25238,  25425,  25630,  25852,  26089,  26340,  26603,  26875,
+                 27154,  27438,  27723,  28009,  28291,  28566,  28833,  29088,
+                 29327,  29549,  29750,  29928,  30079,  30201,  30291,  30346,
+                 30365,  30346,  30285,  30181,  30034,  29840,  29599,  29310,
+                 28972,  28585,  28148,  27661,  27126,  26541,  25908,  25229,
+                 24504,  23734,  22923,  22071,  21180,  20255,  19296,  18306,
+                 17290,  16249,  15187,  14107,  13013,  11908,  10796,   9681,
+                  8565,   7452,   6347,   5252,   4170,   3106,   2062,   1042,
+                    48,   -917,  -1851,  -2750,  -3612,  -4437,  -5221,  -5964,
+                 -6663,  -7318,  -7929,  -8493,  -9012,  -9484,  -9910, -10291,
+                -10626, -10916, -11163, -11368, -11532, -11656, -11742, -11792,
+                -11809, -11793, -11748, -11675, -11577, -11457, -11316, -11158,
+                -10984, -10797, -10601, -10396, -10185,  -9972,  -9757,  -9543,
+                 -9331,  -9125,  -8925,  -8734,  -8552,  -8381,  -8222,  -8076,
+                 -7944,  -7827,  -7725,  -7639,  -7568,  -7514,  -7475,  -7452,
+                 -7445,  -7452,  -7474,  -7509,  -7557,  -7617,  -7688,  -7770,
+                 -7860,  -7957,  -8062,  -8171,  -8285,  -8402,  -8521,  -8641,
+                 -8759,  -8877,  -8991,  -9102,  -9208,  -9308,  -9402,  -9489,
+                 -9568,  -9639,  -9701,  -9754,  -9797,  -9831,  -9855,  -9870,
+                 -9874,  -9870,  -9856,  -9833,  -9802,  -9763,  -9717,  -9663,
+                 -9604,  -9539,  -9470,  -9396,  -9320,  -9241,  -9161,  -9079,
+                 -8998,  -8918,  -8839,  -8763,  -8689,  -8619,  -8553,  -8492,
+                 -8437,  -8387,  -8343,  -8305,  -8274,  -8250,  -8233,  -8222,
+                 -8219,  -8222,  -8232,  -8249,  -8272,  -8300,  -8334,  -8374,
+                 -8418,  -8466,  -8517,  -8572,  -8629,  -8689,  -8749,  -8810,
+                 -8872,  -8932,  -8992,  -9050,  -9107,  -9160,  -9210,  -9257,
+                 -9300,  -9339,  -9373,  -9402,  -9426,  -9445,  -9458,  -9466,
+                 -9469,  -9466,  -9458,  -9445,  -9427,  -9405,  -9378,  -9347,
+                 -9312,  -9273,  -9232,  -9188,  -9142,  -9095,  -9046,  -8997,
+                 -8948,  -8898,  -8850,  -8803,  -8757,  -8714,  -8673,  -8635,
+                 -8600,  -8568,  -8540,  -8516,  -8496,  -8481,  -8470,  -8463,
+                 -8461,  -8463,  -8470,  -8480,  -8495,  -8514,  -8537,  -8563,
+                 -8592,  -8624,  -8659,  -8696,  -8734,  -8774,  -8815,  -8857,
+                 -8899,  -8940,  -8981,  -9021,  -9060,  -9097,  -9132,  -9165,
+                 -9195,  -9222,  -9246,  -9266,  -9283,  -9296,  -9306,  -9312,
+                 -9314,  -9312,  -9306,  -9297,  -9284,  -9267,  -9248,  -9225,
+                 -9200,  -9172,  -9141,  -9109,  -9076,  -9041,  -9005,  -8968,
+                 -8931,  -8895,  -8859,  -8823,  -8789,  -8757,  -8726,  -8697,
+                 -8670,  -8646,  -8625,  -8607,  -8592,  -8580,  -8572,  -8566,
+                 -8565,  -8566,  -8571,  -8580,  -8591,  -8606,  -8624,  -8644,
+                 -8667,  -8692,  -8719,  -8748,  -8779,  -8810,  -8843,  -8876,
+                 -8909,  -8942,  -8975,  -9007,  -9038,  -9068,  -9096,  -9122,
+                 -9147,  -9168,  -9188,  -9204,  -9218,  -9229,  -9237,  -9242,
+                 -9243,  -9242,  -9237,  -9229,  -9219,  -9205,  -9189,  -9170,
+                 -9149,  -9126,  -9100,  -9073,  -9045,  -9016,  -8986,  -8955,
+                 -8924,  -8893,  -8862,  -8833,  -8804,  -8776,  -8749,  -8725,
+                 -8702,  -8682,  -8663,  -8648,  -8635,  -8625,  -8617,  -8613,
+                 -8611,  -8613,  -8617,  -8624,  -8635,  -8647,  -8663,  -8681,
+                 -8701,  -8723,  -8747,  -8772,  -8799,  -8827,  -8856,  -8885,
+                 -8915,  -8944,  -8974,  -9002,  -9030,  -9057,  -9082,  -9106,
+                 -9127,  -9147,  -9164,  -9180,  -9192,  -9202,  -9209,  -9213,
+                 -9215,  -9213,  -9209,  -9202,  -9192,  -9180,  -9165,  -9147,
+                 -9128,  -9106,  -9083,  -9058,  -9032,  -9005,  -8977,  -8948,
+                 -8919,  -8890,  -8862,  -8834,  -8806,  -8780,  -8756,  -8732,
+                 -8711,  -8692,  -8674,  -8660,  -8647,  -8638,  -8630,  -8626,
+                 -8625,  -8626,  -8630,  -8638,  -8647,  -8660,  -8674,  -8692,
+                 -8711,  -8732,  -8756,  -8780,  -8806,  -8834,  -8862,  -8890,
+                 -8919,  -8948,  -8977,  -9005,  -9032,  -9058,  -9083,  -9106,
+                 -9128,  -9147,  -9165,  -9180,  -9192,  -9202,  -9209,  -9213,
+                 -9215,  -9213,  -9209,  -9202,  -9192,  -9180,  -9164,  -9147,
+                 -9127,  -9106,  -9082,  -9057,  -9030,  -9002,  -8974,  -8944,
+                 -8915,  -8885,  -8856,  -8827,  -8799,  -8772,  -8747,  -8723,
+                 -8701,  -8681,  -8663,  -8647,  -8635,  -8624,  -8617,  -8613,
+                 -8611,  -8613,  -8617,  -8625,  -8635,  -8648,  -8663,  -8682,
+                 -8702,  -8725,  -8749,  -8776,  -8804,  -8833,  -8862,  -8893,
+                 -8924,  -8955,  -8986,  -9016,  -9045,  -9073,  -9100,  -9126,
+                 -9149,  -9170,  -9189,  -9205,  -9219,  -9229,  -9237,  -9242,
+                 -9243,  -9242,  -9237,  -9229,  -9218,  -9204,  -9188,  -9168,
+                 -9147,  -9122,  -9096,  -9068,  -9038,  -9007,  -8975,  -8942,
+                 -8909,  -8876,  -8843,  -8810,  -8779,  -8748,  -8719,  -8692,
+                 -8667,  -8644,  -8624,  -8606,  -8591,  -8580,  -8571,  -8566,
+                 -8565,  -8566,  -8572,  -8580,  -8592,  -8607,  -8625,  -8646,
+                 -8670,  -8697,  -8726,  -8757,  -8789,  -8823,  -8859,  -8895,
+                 -8931,  -8968,  -9005,  -9041,  -9076,  -9109,  -9141,  -9172,
+                 -9200,  -9225,  -9248,  -9267,  -9284,  -9297,  -9306,  -9312,
+                 -9314,  -9312,  -9306,  -9296,  -9283,  -9266,  -9246,  -9222,
+                 -9195,  -9165,  -9132,  -9097,  -9060,  -9021,  -8981,  -8940,
+                 -8899,  -8857,  -8815,  -8774,  -8734,  -8696,  -8659,  -8624,
+                 -8592,  -8563,  -8537,  -8514,  -8495,  -8480,  -8470,  -8463,
+                 -8461,  -8463,  -8470,  -8481,  -8496,  -8516,  -8540,  -8568,
+                 -8600,  -8635,  -8673,  -8714,  -8757,  -8803,  -8850,  -8898,
+                 -8948,  -8997,  -9046,  -9095,  -9142,  -9188,  -9232,  -9273,
+                 -9312,  -9347,  -9378,  -9405,  -9427,  -9445,  -9458,  -9466,
+                 -9469,  -9466,  -9458,  -9445,  -9426,  -9402,  -9373,  -9339,
+                 -9300,  -9257,  -9210,  -9160,  -9107,  -9050,  -8992,  -8932,
+                 -8872,  -8810,  -8749,  -8689,  -8629,  -8572,  -8517,  -8466,
+                 -8418,  -8374,  -8334,  -8300,  -8272,  -8249,  -8232,  -8222,
+                 -8219,  -8222,  -8233,  -8250,  -8274,  -8305,  -8343,  -8387,
+                 -8437,  -8492,  -8553,  -8619,  -8689,  -8763,  -8839,  -8918,
+                 -8998,  -9079,  -9161,  -9241,  -9320,  -9396,  -9470,  -9539,
+                 -9604,  -9663,  -9717,  -9763,  -9802,  -9833,  -9856,  -9870,
+                 -9874,  -9870,  -9855,  -9831,  -9797,  -9754,  -9701,  -9639,
+                 -9568,  -9489,  -9402,  -9308,  -9208,  -9102,  -8991,  -8877,
+                 -8759,  -8641,  -8521,  -8402,  -8285,  -8171,  -8062,  -7957,
+                 -7860,  -7770,  -7688,  -7617,  -7557,  -7509,  -7474,  -7452,
+                 -7445,  -7452,  -7475,  -7514,  -7568,  -7639,  -7725,  -7827,
+                 -7944,  -8076,  -8222,  -8381,  -8552,  -8734,  -8925,  -9125,
+                 -9331,  -9543,  -9757,  -9972, -10185, -10396, -10601, -10797,
+                -10984, -11158, -11316, -11457, -11577, -11675, -11748, -11793,
+                -11809, -11792, -11742, -11656, -11532, -11368, -11163, -10916,
+                -10626, -10291,  -9910,  -9484,  -9012,  -8493,  -7929,  -7318,
+                 -6663,  -5964,  -5221,  -4437,  -3612,  -2750,  -1851,   -917,
+                    48,   1042,   2062,   3106,   4170,   5252,   6347,   7452,
+                  8565,
+            }},
+            // 32 harmonics
+            {{
+                  8741,  10969,  13176,  15332,  17412,  19389,  21240,  22946,
+                 24488,  25853,  27032,  28018,  28810,  29410,  29824,  30063,
+                 30139,  30069,  29870,  29564,  29171,  28714,  28214,  27695,
+                 27176,  26676,  26212,  25799,  25449,  25171,  24971,  24851,
+                 24811,  24849,  24959,  25134,  25363,  25636,  25940,  26262,
+                 26591,  26913,  27216,  27490,  27725,  27915,  28053,  28137,
+                 28165,  28138,  28058,  27931,  27762,  27559,  27331,  27087,
+                 26837,  26590,  26355,  26142,  25957,  25808,  25697,  25630,
+                 25608,  25630,  25695,  25799,  25938,  26105,  26295,  26498,
+                 26708,  26916,  27114,  27295,  27453,  27581,  27675,  27733,
+                 27753,  27733,  27677,  27586,  27464,  27316,  27149,  26968,
+                 26781,  26596,  26418,  26255,  26113,  25998,  25912,  25859,
+                 25842,  25859,  25911,  25995,  26107,  26244,  26399,  26566,
+                 26740,  26914,  27080,  27232,  27366,  27475,  27556,  27606,
+                 27622,  27606,  27556,  27476,  27369,  27238,  27088,  26927,
+                 26759,  26591,  26430,  26282,  26152,  26045,  25966,  25917,
+                 25901,  25917,  25966,  26045,  26152,  26282,  26430,  26591,
+                 26759,  26927,  27088,  27238,  27369,  27476,  27556,  27606,
+                 27622,  27606,  27556,  27475,  27366,  27232,  27080,  26914,
+                 26740,  26566,  26399,  26244,  26107,  25995,  25911,  25859,
+                 25842,  25859,  25912,  25998,  26113,  26255,  26418,  26596,
+                 26781,  26968,  27149,  27316,  27464,  27586,  27677,  27733,
+                 27753,  27733,  27675,  27581,  27453,  27295,  27114,  26916,
+                 26708,  26498,  26295,  26105,  25938,  25799,  25695,  25630,
+                 25608,  25630,  25697,  25808,  25957,  26142,  26355,  26590,
+                 26837,  27087,  27331,  27559,  27762,  27931,  28058,  28138,
+                 28165,  28137,  28053,  27915,  27725,  27490,  27216,  26913,
+                 26591,  26262,  25940,  25636,  25363,  25134,  24959,  24849,
+                 24811,  24851,  24971,  25171,  25449,  25799,  26212,  26676,
+                 27176,  27695,  28214,  28714,  29171,  29564,  29870,  30069,
+                 30139,  30063,  29824,  29410,  28810,  28018,  27032,  25853,
+                 24488,  22946,  21240,  19389,  17412,  15332,  13176,  10969,
+                  8741,   6520,   4333,   2209,    174,  -1749,  -3539,  -5178,
+                 -6651,  -7947,  -9059,  -9984, -10722, -11277, -11659, -11878,
+                -11947, -11883, -11705, -11432, -11083, -10680, -10243,  -9790,
+                 -9341,  -8911,  -8515,  -8164,  -7869,  -7635,  -7468,  -7369,
+                 -7336,  -7367,  -7457,  -7598,  -7782,  -7999,  -8240,  -8495,
+                 -8752,  -9002,  -9236,  -9447,  -9627,  -9770,  -9875,  -9938,
+                 -9958,  -9938,  -9880,  -9787,  -9664,  -9518,  -9355,  -9182,
+                 -9005,  -8831,  -8668,  -8520,  -8393,  -8290,  -8216,  -8170,
+                 -8155,  -8170,  -8213,  -8281,  -8372,  -8481,  -8602,  -8733,
+                 -8866,  -8997,  -9121,  -9234,  -9331,  -9410,  -9468,  -9503,
+                 -9515,  -9503,  -9470,  -9416,  -9345,  -9259,  -9162,  -9059,
+                 -8953,  -8848,  -8748,  -8658,  -8579,  -8516,  -8469,  -8441,
+                 -8431,  -8441,  -8468,  -8512,  -8571,  -8641,  -8721,  -8806,
+                 -8894,  -8981,  -9063,  -9139,  -9204,  -9257,  -9296,  -9320,
+                 -9328,  -9320,  -9297,  -9260,  -9211,  -9151,  -9083,  -9011,
+                 -8936,  -8862,  -8791,  -8727,  -8671,  -8626,  -8592,  -8572,
+                 -8565,  -8571,  -8591,  -8623,  -8666,  -8718,  -8777,  -8840,
+                 -8905,  -8969,  -9031,  -9087,  -9136,  -9176,  -9205,  -9223,
+                 -9229,  -9223,  -9205,  -9177,  -9139,  -9094,  -9042,  -8986,
+                 -8929,  -8872,  -8817,  -8767,  -8724,  -8688,  -8662,  -8646,
+                 -8641,  -8646,  -8662,  -8687,  -8721,  -8762,  -8808,  -8858,
+                 -8910,  -8961,  -9010,  -9055,  -9094,  -9126,  -9150,  -9164,
+                 -9169,  -9164,  -9150,  -9127,  -9097,  -9059,  -9017,  -8972,
+                 -8925,  -8878,  -8833,  -8792,  -8757,  -8728,  -8706,  -8693,
+                 -8688,  -8693,  -8706,  -8727,  -8755,  -8789,  -8828,  -8869,
+                 -8913,  -8956,  -8997,  -9035,  -9068,  -9095,  -9114,  -9127,
+                 -9131,  -9127,  -9115,  -9095,  -9069,  -9038,  -9002,  -8963,
+                 -8923,  -8883,  -8844,  -8809,  -8779,  -8753,  -8735,  -8724,
+                 -8720,  -8723,  -8735,  -8753,  -8777,  -8807,  -8840,  -8877,
+                 -8914,  -8952,  -8988,  -9021,  -9050,  -9073,  -9091,  -9101,
+                 -9105,  -9101,  -9091,  -9074,  -9051,  -9023,  -8991,  -8957,
+                 -8921,  -8886,  -8852,  -8821,  -8793,  -8771,  -8754,  -8744,
+                 -8741,  -8744,  -8754,  -8771,  -8792,  -8819,  -8849,  -8882,
+                 -8916,  -8949,  -8982,  -9012,  -9038,  -9059,  -9075,  -9084,
+                 -9088,  -9084,  -9075,  -9059,  -9038,  -9013,  -8984,  -8953,
+                 -8920,  -8888,  -8857,  -8828,  -8803,  -8783,  -8768,  -8758,
+                 -8755,  -8758,  -8768,  -8783,  -8803,  -8827,  -8855,  -8885,
+                 -8917,  -8948,  -8978,  -9005,  -9029,  -9049,  -9064,  -9073,
+                 -9076,  -9073,  -9064,  -9049,  -9030,  -9006,  -8979,  -8950,
+                 -8919,  -8889,  -8860,  -8833,  -8810,  -8790,  -8776,  -8767,
+                 -8764,  -8767,  -8776,  -8790,  -8809,  -8832,  -8859,  -8887,
+                 -8917,  -8947,  -8975,  -9002,  -9025,  -9043,  -9057,  -9066,
+                 -9069,  -9066,  -9057,  -9043,  -9025,  -9002,  -8976,  -8948,
+                 -8919,  -8890,  -8862,  -8836,  -8813,  -8795,  -8781,  -8772,
+                 -8770,  -8772,  -8781,  -8795,  -8813,  -8835,  -8861,  -8889,
+                 -8918,  -8947,  -8974,  -9000,  -9022,  -9041,  -9054,  -9063,
+                 -9065,  -9063,  -9054,  -9041,  -9022,  -9000,  -8975,  -8947,
+                 -8918,  -8890,  -8862,  -8837,  -8814,  -8796,  -8782,  -8774,
+                 -8771,  -8774,  -8782,  -8796,  -8814,  -8837,  -8862,  -8890,
+                 -8918,  -8947,  -8975,  -9000,  -9022,  -9041,  -9054,  -9063,
+                 -9065,  -9063,  -9054,  -9041,  -9022,  -9000,  -8974,  -8947,
+                 -8918,  -8889,  -8861,  -8835,  -8813,  -8795,  -8781,  -8772,
+                 -8770,  -8772,  -8781,  -8795,  -8813,  -8836,  -8862,  -8890,
+                 -8919,  -8948,  -8976,  -9002,  -9025,  -9043,  -9057,  -9066,
+                 -9069,  -9066,  -9057,  -9043,  -9025,  -9002,  -8975,  -8947,
+                 -8917,  -8887,  -8859,  -8832,  -8809,  -8790,  -8776,  -8767,
+                 -8764,  -8767,  -8776,  -8790,  -8810,  -8833,  -8860,  -8889,
+                 -8919,  -8950,  -8979,  -9006,  -9030,  -9049,  -9064,  -9073,
+                 -9076,  -9073,  -9064,  -9049,  -9029,  -9005,  -8978,  -8948,
+                 -8917,  -8885,  -8855,  -8827,  -8803,  -8783,  -8768,  -8758,
+                 -8755,  -8758,  -8768,  -8783,  -8803,  -8828,  -8857,  -8888,
+                 -8920,  -8953,  -8984,  -9013,  -9038,  -9059,  -9075,  -9084,
+                 -9088,  -9084,  -9075,  -9059,  -9038,  -9012,  -8982,  -8949,
+                 -8916,  -8882,  -8849,  -8819,  -8792,  -8771,  -8754,  -8744,
+                 -8741,  -8744,  -8754,  -8771,  -8793,  -8821,  -8852,  -8886,
+                 -8921,  -8957,  -8991,  -9023,  -9051,  -9074,  -9091,  -9101,
+                 -9105,  -9101,  -9091,  -9073,  -9050,  -9021,  -8988,  -8952,
+                 -8914,  -8877,  -8840,  -8807,  -8777,  -8753,  -8735,  -8723,
+                 -8720,  -8724,  -8735,  -8753,  -8779,  -8809,  -8844,  -8883,
+                 -8923,  -8963,  -9002,  -9038,  -9069,  -9095,  -9115,  -9127,
+                 -9131,  -9127,  -9114,  -9095,  -9068,  -9035,  -8997,  -8956,
+                 -8913,  -8869,  -8828,  -8789,  -8755,  -8727,  -8706,  -8693,
+                 -8688,  -8693,  -8706,  -8728,  -8757,  -8792,  -8833,  -8878,
+                 -8925,  -8972,  -9017,  -9059,  -9097,  -9127,  -9150,  -9164,
+                 -9169,  -9164,  -9150,  -9126,  -9094,  -9055,  -9010,  -8961,
+                 -8910,  -8858,  -8808,  -8762,  -8721,  -8687,  -8662,  -8646,
+                 -8641,  -8646,  -8662,  -8688,  -8724,  -8767,  -8817,  -8872,
+                 -8929,  -8986,  -9042,  -9094,  -9139,  -9177,  -9205,  -9223,
+                 -9229,  -9223,  -9205,  -9176,  -9136,  -9087,  -9031,  -8969,
+                 -8905,  -8840,  -8777,  -8718,  -8666,  -8623,  -8591,  -8571,
+                 -8565,  -8572,  -8592,  -8626,  -8671,  -8727,  -8791,  -8862,
+                 -8936,  -9011,  -9083,  -9151,  -9211,  -9260,  -9297,  -9320,
+                 -9328,  -9320,  -9296,  -9257,  -9204,  -9139,  -9063,  -8981,
+                 -8894,  -8806,  -8721,  -8641,  -8571,  -8512,  -8468,  -8441,
+                 -8431,  -8441,  -8469,  -8516,  -8579,  -8658,  -8748,  -8848,
+                 -8953,  -9059,  -9162,  -9259,  -9345,  -9416,  -9470,  -9503,
+                 -9515,  -9503,  -9468,  -9410,  -9331,  -9234,  -9121,  -8997,
+                 -8866,  -8733,  -8602,  -8481,  -8372,  -8281,  -8213,  -8170,
+                 -8155,  -8170,  -8216,  -8290,  -8393,  -8520,  -8668,  -8831,
+                 -9005,  -9182,  -9355,  -9518,  -9664,  -9787,  -9880,  -9938,
+                 -9958,  -9938,  -9875,  -9770,  -9627,  -9447,  -9236,  -9002,
+                 -8752,  -8495,  -8240,  -7999,  -7782,  -7598,  -7457,  -7367,
+                 -7336,  -7369,  -7468,  -7635,  -7869,  -8164,  -8515,  -8911,
+                 -9341,  -9790, -10243, -10680, -11083, -11432, -11705, -11883,
+                -11947, -11878, -11659, -11277, -10722,  -9984,  -9059,  -7947,
+                 -6651,  -5178,  -3539,  -1749,    174,   2209,   4333,   6520,
+                  8741,
+            }},
+            // 64 harmonics
+            {{
+                  8829,  13257,  17474,  21272,  24484,  26992,  28738,  29732,
+                 30039,  29778,  29101,  28178,  27180,  26257,  25530,  25076,
+                 24925,  25064,  25443,  25981,  26586,  27164,  27633,  27934,
+                 28036,  27939,  27671,  27284,  26843,  26415,  26063,  25835,
+                 25756,  25832,  26042,  26348,  26701,  27045,  27331,  27517,
+                 27582,  27519,  27344,  27087,  26790,  26498,  26255,  26095,
+                 26040,  26094,  26246,  26469,  26729,  26985,  27199,  27341,
+                 27390,  27341,  27206,  27006,  26773,  26542,  26349,  26222,
+                 26177,  26221,  26344,  26527,  26741,  26952,  27130,  27248,
+                 27289,  27248,  27134,  26964,  26765,  26568,  26402,  26291,
+                 26253,  26291,  26399,  26559,  26747,  26933,  27090,  27195,
+                 27231,  27195,  27092,  26940,  26760,  26582,  26432,  26332,
+                 26297,  26331,  26430,  26577,  26750,  26922,  27068,  27165,
+                 27199,  27165,  27069,  26926,  26757,  26589,  26447,  26353,
+                 26319,  26352,  26447,  26587,  26753,  26918,  27058,  27151,
+                 27184,  27151,  27058,  26919,  26755,  26591,  26452,  26359,
+                 26326,  26359,  26452,  26591,  26755,  26919,  27058,  27151,
+                 27184,  27151,  27058,  26918,  26753,  26587,  26447,  26352,
+                 26319,  26353,  26447,  26589,  26757,  26926,  27069,  27165,
+                 27199,  27165,  27068,  26922,  26750,  26577,  26430,  26331,
+                 26297,  26332,  26432,  26582,  26760,  26940,  27092,  27195,
+                 27231,  27195,  27090,  26933,  26747,  26559,  26399,  26291,
+                 26253,  26291,  26402,  26568,  26765,  26964,  27134,  27248,
+                 27289,  27248,  27130,  26952,  26741,  26527,  26344,  26221,
+                 26177,  26222,  26349,  26542,  26773,  27006,  27206,  27341,
+                 27390,  27341,  27199,  26985,  26729,  26469,  26246,  26094,
+                 26040,  26095,  26255,  26498,  26790,  27087,  27344,  27519,
+                 27582,  27517,  27331,  27045,  26701,  26348,  26042,  25832,
+                 25756,  25835,  26063,  26415,  26843,  27284,  27671,  27939,
+                 28036,  27934,  27633,  27164,  26586,  25981,  25443,  25064,
+                 24925,  25076,  25530,  26257,  27180,  28178,  29101,  29778,
+                 30039,  29732,  28738,  26992,  24484,  21272,  17474,  13257,
+                  8829,   4415,    237,  -3504,  -6648,  -9087, -10777, -11731,
+                -12025, -11778, -11139, -10274,  -9344,  -8489,  -7820,  -7404,
+                 -7267,  -7393,  -7732,  -8213,  -8749,  -9259,  -9670,  -9932,
+                -10020,  -9937,  -9708,  -9380,  -9007,  -8648,  -8355,  -8165,
+                 -8101,  -8163,  -8333,  -8581,  -8864,  -9139,  -9365,  -9512,
+                 -9563,  -9514,  -9379,  -9182,  -8955,  -8733,  -8550,  -8430,
+                 -8389,  -8429,  -8540,  -8704,  -8892,  -9077,  -9230,  -9330,
+                 -9365,  -9331,  -9237,  -9098,  -8938,  -8780,  -8649,  -8563,
+                 -8533,  -8562,  -8644,  -8764,  -8903,  -9040,  -9155,  -9230,
+                 -9256,  -9231,  -9159,  -9053,  -8930,  -8809,  -8708,  -8641,
+                 -8618,  -8641,  -8704,  -8799,  -8908,  -9017,  -9107,  -9167,
+                 -9188,  -9168,  -9110,  -9025,  -8926,  -8828,  -8746,  -8692,
+                 -8674,  -8692,  -8744,  -8821,  -8911,  -9001,  -9075,  -9125,
+                 -9142,  -9125,  -9077,  -9006,  -8924,  -8842,  -8774,  -8728,
+                 -8712,  -8728,  -8772,  -8837,  -8913,  -8989,  -9052,  -9094,
+                 -9109,  -9094,  -9053,  -8993,  -8922,  -8852,  -8793,  -8754,
+                 -8741,  -8754,  -8792,  -8849,  -8914,  -8980,  -9035,  -9071,
+                 -9084,  -9071,  -9036,  -8983,  -8921,  -8860,  -8809,  -8774,
+                 -8762,  -8774,  -8808,  -8857,  -8915,  -8973,  -9022,  -9054,
+                 -9065,  -9054,  -9022,  -8976,  -8921,  -8866,  -8820,  -8790,
+                 -8779,  -8790,  -8820,  -8864,  -8916,  -8968,  -9011,  -9040,
+                 -9050,  -9040,  -9012,  -8970,  -8920,  -8871,  -8830,  -8802,
+                 -8792,  -8802,  -8829,  -8869,  -8916,  -8963,  -9003,  -9029,
+                 -9038,  -9029,  -9003,  -8965,  -8920,  -8875,  -8837,  -8812,
+                 -8803,  -8812,  -8837,  -8873,  -8917,  -8960,  -8996,  -9020,
+                 -9029,  -9020,  -8996,  -8961,  -8919,  -8878,  -8843,  -8820,
+                 -8812,  -8820,  -8843,  -8877,  -8917,  -8957,  -8991,  -9013,
+                 -9021,  -9013,  -8991,  -8958,  -8919,  -8881,  -8848,  -8826,
+                 -8819,  -8826,  -8848,  -8880,  -8917,  -8955,  -8986,  -9007,
+                 -9014,  -9007,  -8986,  -8955,  -8919,  -8883,  -8852,  -8832,
+                 -8825,  -8832,  -8852,  -8882,  -8917,  -8953,  -8982,  -9002,
+                 -9009,  -9002,  -8983,  -8953,  -8919,  -8885,  -8856,  -8836,
+                 -8829,  -8836,  -8855,  -8884,  -8917,  -8951,  -8979,  -8998,
+                 -9005,  -8998,  -8979,  -8952,  -8919,  -8886,  -8858,  -8840,
+                 -8833,  -8840,  -8858,  -8885,  -8918,  -8950,  -8977,  -8995,
+                 -9001,  -8995,  -8977,  -8950,  -8919,  -8887,  -8861,  -8843,
+                 -8837,  -8843,  -8860,  -8887,  -8918,  -8949,  -8975,  -8992,
+                 -8998,  -8992,  -8975,  -8949,  -8919,  -8888,  -8862,  -8845,
+                 -8839,  -8845,  -8862,  -8888,  -8918,  -8948,  -8973,  -8990,
+                 -8996,  -8990,  -8973,  -8948,  -8918,  -8889,  -8864,  -8847,
+                 -8841,  -8847,  -8864,  -8889,  -8918,  -8947,  -8972,  -8988,
+                 -8994,  -8988,  -8972,  -8947,  -8918,  -8889,  -8865,  -8849,
+                 -8843,  -8848,  -8865,  -8889,  -8918,  -8947,  -8971,  -8987,
+                 -8993,  -8987,  -8971,  -8947,  -8918,  -8890,  -8866,  -8849,
+                 -8844,  -8849,  -8866,  -8890,  -8918,  -8946,  -8970,  -8986,
+                 -8992,  -8986,  -8970,  -8946,  -8918,  -8890,  -8866,  -8850,
+                 -8844,  -8850,  -8866,  -8890,  -8918,  -8946,  -8970,  -8986,
+                 -8992,  -8986,  -8970,  -8946,  -8918,  -8890,  -8866,  -8850,
+                 -8845,  -8850,  -8866,  -8890,  -8918,  -8946,  -8970,  -8986,
+                 -8992,  -8986,  -8970,  -8946,  -8918,  -8890,  -8866,  -8850,
+                 -8844,  -8850,  -8866,  -8890,  -8918,  -8946,  -8970,  -8986,
+                 -8992,  -8986,  -8970,  -8946,  -8918,  -8890,  -8866,  -8849,
+                 -8844,  -8849,  -8866,  -8890,  -8918,  -8947,  -8971,  -8987,
+                 -8993,  -8987,  -8971,  -8947,  -8918,  -8889,  -8865,  -8848,
+                 -8843,  -8849,  -8865,  -8889,  -8918,  -8947,  -8972,  -8988,
+                 -8994,  -8988,  -8972,  -8947,  -8918,  -8889,  -8864,  -8847,
+                 -8841,  -8847,  -8864,  -8889,  -8918,  -8948,  -8973,  -8990,
+                 -8996,  -8990,  -8973,  -8948,  -8918,  -8888,  -8862,  -8845,
+                 -8839,  -8845,  -8862,  -8888,  -8919,  -8949,  -8975,  -8992,
+                 -8998,  -8992,  -8975,  -8949,  -8918,  -8887,  -8860,  -8843,
+                 -8837,  -8843,  -8861,  -8887,  -8919,  -8950,  -8977,  -8995,
+                 -9001,  -8995,  -8977,  -8950,  -8918,  -8885,  -8858,  -8840,
+                 -8833,  -8840,  -8858,  -8886,  -8919,  -8952,  -8979,  -8998,
+                 -9005,  -8998,  -8979,  -8951,  -8917,  -8884,  -8855,  -8836,
+                 -8829,  -8836,  -8856,  -8885,  -8919,  -8953,  -8983,  -9002,
+                 -9009,  -9002,  -8982,  -8953,  -8917,  -8882,  -8852,  -8832,
+                 -8825,  -8832,  -8852,  -8883,  -8919,  -8955,  -8986,  -9007,
+                 -9014,  -9007,  -8986,  -8955,  -8917,  -8880,  -8848,  -8826,
+                 -8819,  -8826,  -8848,  -8881,  -8919,  -8958,  -8991,  -9013,
+                 -9021,  -9013,  -8991,  -8957,  -8917,  -8877,  -8843,  -8820,
+                 -8812,  -8820,  -8843,  -8878,  -8919,  -8961,  -8996,  -9020,
+                 -9029,  -9020,  -8996,  -8960,  -8917,  -8873,  -8837,  -8812,
+                 -8803,  -8812,  -8837,  -8875,  -8920,  -8965,  -9003,  -9029,
+                 -9038,  -9029,  -9003,  -8963,  -8916,  -8869,  -8829,  -8802,
+                 -8792,  -8802,  -8830,  -8871,  -8920,  -8970,  -9012,  -9040,
+                 -9050,  -9040,  -9011,  -8968,  -8916,  -8864,  -8820,  -8790,
+                 -8779,  -8790,  -8820,  -8866,  -8921,  -8976,  -9022,  -9054,
+                 -9065,  -9054,  -9022,  -8973,  -8915,  -8857,  -8808,  -8774,
+                 -8762,  -8774,  -8809,  -8860,  -8921,  -8983,  -9036,  -9071,
+                 -9084,  -9071,  -9035,  -8980,  -8914,  -8849,  -8792,  -8754,
+                 -8741,  -8754,  -8793,  -8852,  -8922,  -8993,  -9053,  -9094,
+                 -9109,  -9094,  -9052,  -8989,  -8913,  -8837,  -8772,  -8728,
+                 -8712,  -8728,  -8774,  -8842,  -8924,  -9006,  -9077,  -9125,
+                 -9142,  -9125,  -9075,  -9001,  -8911,  -8821,  -8744,  -8692,
+                 -8674,  -8692,  -8746,  -8828,  -8926,  -9025,  -9110,  -9168,
+                 -9188,  -9167,  -9107,  -9017,  -8908,  -8799,  -8704,  -8641,
+                 -8618,  -8641,  -8708,  -8809,  -8930,  -9053,  -9159,  -9231,
+                 -9256,  -9230,  -9155,  -9040,  -8903,  -8764,  -8644,  -8562,
+                 -8533,  -8563,  -8649,  -8780,  -8938,  -9098,  -9237,  -9331,
+                 -9365,  -9330,  -9230,  -9077,  -8892,  -8704,  -8540,  -8429,
+                 -8389,  -8430,  -8550,  -8733,  -8955,  -9182,  -9379,  -9514,
+                 -9563,  -9512,  -9365,  -9139,  -8864,  -8581,  -8333,  -8163,
+                 -8101,  -8165,  -8355,  -8648,  -9007,  -9380,  -9708,  -9937,
+                -10020,  -9932,  -9670,  -9259,  -8749,  -8213,  -7732,  -7393,
+                 -7267,  -7404,  -7820,  -8489,  -9344, -10274, -11139, -11778,
+                -12025, -11731, -10777,  -9087,  -6648,  -3504,    237,   4415,
+                  8829,
+            }},
+            // 128 harmonics
+            {{
+                  8874,  17505,  24483,  28705,  29992,  29068,  27181,  25566,
+                 24975,  25478,  26585,  27595,  27982,  27634,  26844,  26104,
+                 25813,  26082,  26700,  27288,  27521,  27301,  26791,  26301,
+                 26105,  26292,  26728,  27150,  27320,  27157,  26774,  26402,
+                 26251,  26397,  26739,  27073,  27209,  27077,  26767,  26462,
+                 26339,  26459,  26744,  27025,  27139,  27027,  26763,  26502,
+                 26396,  26500,  26748,  26991,  27091,  26993,  26760,  26530,
+                 26436,  26529,  26749,  26968,  27057,  26969,  26759,  26551,
+                 26465,  26549,  26751,  26950,  27032,  26951,  26758,  26566,
+                 26487,  26565,  26752,  26937,  27013,  26938,  26757,  26577,
+                 26503,  26577,  26752,  26927,  26999,  26927,  26756,  26586,
+                 26516,  26586,  26753,  26919,  26988,  26920,  26756,  26593,
+                 26525,  26592,  26753,  26914,  26980,  26914,  26755,  26597,
+                 26532,  26597,  26754,  26910,  26974,  26910,  26755,  26601,
+                 26537,  26600,  26754,  26907,  26971,  26907,  26755,  26602,
+                 26539,  26602,  26754,  26906,  26969,  26906,  26755,  26603,
+                 26540,  26603,  26755,  26906,  26969,  26906,  26754,  26602,
+                 26539,  26602,  26755,  26907,  26971,  26907,  26754,  26600,
+                 26537,  26601,  26755,  26910,  26974,  26910,  26754,  26597,
+                 26532,  26597,  26755,  26914,  26980,  26914,  26753,  26592,
+                 26525,  26593,  26756,  26920,  26988,  26919,  26753,  26586,
+                 26516,  26586,  26756,  26927,  26999,  26927,  26752,  26577,
+                 26503,  26577,  26757,  26938,  27013,  26937,  26752,  26565,
+                 26487,  26566,  26758,  26951,  27032,  26950,  26751,  26549,
+                 26465,  26551,  26759,  26969,  27057,  26968,  26749,  26529,
+                 26436,  26530,  26760,  26993,  27091,  26991,  26748,  26500,
+                 26396,  26502,  26763,  27027,  27139,  27025,  26744,  26459,
+                 26339,  26462,  26767,  27077,  27209,  27073,  26739,  26397,
+                 26251,  26402,  26774,  27157,  27320,  27150,  26728,  26292,
+                 26105,  26301,  26791,  27301,  27521,  27288,  26700,  26082,
+                 25813,  26104,  26844,  27634,  27982,  27595,  26585,  25478,
+                 24975,  25566,  27181,  29068,  29992,  28705,  24483,  17505,
+                  8874,    269,  -6647, -10806, -12067, -11169,  -9345,  -7792,
+                 -7227,  -7704,  -8748,  -9696, -10057,  -9734,  -9008,  -8330,
+                 -8066,  -8308,  -8863,  -9388,  -9595,  -9402,  -8955,  -8528,
+                 -8358,  -8519,  -8892,  -9250,  -9394,  -9257,  -8938,  -8630,
+                 -8506,  -8624,  -8903,  -9173,  -9282,  -9177,  -8931,  -8691,
+                 -8594,  -8687,  -8908,  -9123,  -9210,  -9126,  -8927,  -8732,
+                 -8652,  -8729,  -8911,  -9089,  -9161,  -9091,  -8924,  -8761,
+                 -8694,  -8759,  -8913,  -9064,  -9126,  -9066,  -8923,  -8782,
+                 -8725,  -8781,  -8914,  -9045,  -9099,  -9046,  -8922,  -8799,
+                 -8749,  -8798,  -8915,  -9030,  -9077,  -9031,  -8921,  -8812,
+                 -8768,  -8811,  -8916,  -9018,  -9061,  -9019,  -8920,  -8823,
+                 -8783,  -8822,  -8916,  -9009,  -9047,  -9009,  -8920,  -8832,
+                 -8796,  -8831,  -8916,  -9001,  -9035,  -9001,  -8920,  -8839,
+                 -8806,  -8839,  -8917,  -8994,  -9025,  -8994,  -8920,  -8846,
+                 -8815,  -8845,  -8917,  -8988,  -9017,  -8988,  -8919,  -8851,
+                 -8823,  -8851,  -8917,  -8983,  -9010,  -8983,  -8919,  -8856,
+                 -8829,  -8855,  -8917,  -8979,  -9004,  -8979,  -8919,  -8860,
+                 -8835,  -8859,  -8917,  -8975,  -8998,  -8975,  -8919,  -8863,
+                 -8840,  -8863,  -8917,  -8971,  -8994,  -8972,  -8919,  -8866,
+                 -8845,  -8866,  -8917,  -8969,  -8990,  -8969,  -8919,  -8869,
+                 -8849,  -8869,  -8918,  -8966,  -8986,  -8966,  -8919,  -8872,
+                 -8852,  -8871,  -8918,  -8964,  -8983,  -8964,  -8919,  -8874,
+                 -8855,  -8874,  -8918,  -8962,  -8980,  -8962,  -8919,  -8876,
+                 -8858,  -8876,  -8918,  -8960,  -8977,  -8960,  -8919,  -8878,
+                 -8861,  -8877,  -8918,  -8958,  -8975,  -8958,  -8918,  -8879,
+                 -8863,  -8879,  -8918,  -8956,  -8972,  -8957,  -8918,  -8881,
+                 -8865,  -8880,  -8918,  -8955,  -8970,  -8955,  -8918,  -8882,
+                 -8867,  -8882,  -8918,  -8954,  -8969,  -8954,  -8918,  -8883,
+                 -8868,  -8883,  -8918,  -8953,  -8967,  -8953,  -8918,  -8884,
+                 -8870,  -8884,  -8918,  -8952,  -8966,  -8952,  -8918,  -8885,
+                 -8871,  -8885,  -8918,  -8951,  -8964,  -8951,  -8918,  -8886,
+                 -8873,  -8886,  -8918,  -8950,  -8963,  -8950,  -8918,  -8887,
+                 -8874,  -8887,  -8918,  -8949,  -8962,  -8949,  -8918,  -8888,
+                 -8875,  -8887,  -8918,  -8948,  -8961,  -8948,  -8918,  -8888,
+                 -8876,  -8888,  -8918,  -8948,  -8960,  -8948,  -8918,  -8889,
+                 -8877,  -8889,  -8918,  -8947,  -8959,  -8947,  -8918,  -8889,
+                 -8877,  -8889,  -8918,  -8947,  -8959,  -8947,  -8918,  -8890,
+                 -8878,  -8890,  -8918,  -8946,  -8958,  -8946,  -8918,  -8890,
+                 -8879,  -8890,  -8918,  -8946,  -8957,  -8946,  -8918,  -8891,
+                 -8879,  -8891,  -8918,  -8945,  -8957,  -8946,  -8918,  -8891,
+                 -8880,  -8891,  -8918,  -8945,  -8956,  -8945,  -8918,  -8891,
+                 -8880,  -8891,  -8918,  -8945,  -8956,  -8945,  -8918,  -8891,
+                 -8880,  -8891,  -8918,  -8945,  -8956,  -8945,  -8918,  -8892,
+                 -8881,  -8892,  -8918,  -8944,  -8955,  -8945,  -8918,  -8892,
+                 -8881,  -8892,  -8918,  -8944,  -8955,  -8944,  -8918,  -8892,
+                 -8881,  -8892,  -8918,  -8944,  -8955,  -8944,  -8918,  -8892,
+                 -8881,  -8892,  -8918,  -8944,  -8955,  -8944,  -8918,  -8892,
+                 -8881,  -8892,  -8918,  -8944,  -8955,  -8944,  -8918,  -8892,
+                 -8881,  -8892,  -8918,  -8944,  -8955,  -8944,  -8918,  -8892,
+                 -8881,  -8892,  -8918,  -8944,  -8955,  -8944,  -8918,  -8892,
+                 -8881,  -8892,  -8918,  -8944,  -8955,  -8944,  -8918,  -8892,
+                 -8881,  -8892,  -8918,  -8944,  -8955,  -8944,  -8918,  -8892,
+                 -8881,  -8892,  -8918,  -8945,  -8955,  -8944,  -8918,  -8892,
+                 -8881,  -8892,  -8918,  -8945,  -8956,  -8945,  -8918,  -8891,
+                 -8880,  -8891,  -8918,  -8945,  -8956,  -8945,  -8918,  -8891,
+                 -8880,  -8891,  -8918,  -8945,  -8956,  -8945,  -8918,  -8891,
+                 -8880,  -8891,  -8918,  -8946,  -8957,  -8945,  -8918,  -8891,
+                 -8879,  -8891,  -8918,  -8946,  -8957,  -8946,  -8918,  -8890,
+                 -8879,  -8890,  -8918,  -8946,  -8958,  -8946,  -8918,  -8890,
+                 -8878,  -8890,  -8918,  -8947,  -8959,  -8947,  -8918,  -8889,
+                 -8877,  -8889,  -8918,  -8947,  -8959,  -8947,  -8918,  -8889,
+                 -8877,  -8889,  -8918,  -8948,  -8960,  -8948,  -8918,  -8888,
+                 -8876,  -8888,  -8918,  -8948,  -8961,  -8948,  -8918,  -8887,
+                 -8875,  -8888,  -8918,  -8949,  -8962,  -8949,  -8918,  -8887,
+                 -8874,  -8887,  -8918,  -8950,  -8963,  -8950,  -8918,  -8886,
+                 -8873,  -8886,  -8918,  -8951,  -8964,  -8951,  -8918,  -8885,
+                 -8871,  -8885,  -8918,  -8952,  -8966,  -8952,  -8918,  -8884,
+                 -8870,  -8884,  -8918,  -8953,  -8967,  -8953,  -8918,  -8883,
+                 -8868,  -8883,  -8918,  -8954,  -8969,  -8954,  -8918,  -8882,
+                 -8867,  -8882,  -8918,  -8955,  -8970,  -8955,  -8918,  -8880,
+                 -8865,  -8881,  -8918,  -8957,  -8972,  -8956,  -8918,  -8879,
+                 -8863,  -8879,  -8918,  -8958,  -8975,  -8958,  -8918,  -8877,
+                 -8861,  -8878,  -8919,  -8960,  -8977,  -8960,  -8918,  -8876,
+                 -8858,  -8876,  -8919,  -8962,  -8980,  -8962,  -8918,  -8874,
+                 -8855,  -8874,  -8919,  -8964,  -8983,  -8964,  -8918,  -8871,
+                 -8852,  -8872,  -8919,  -8966,  -8986,  -8966,  -8918,  -8869,
+                 -8849,  -8869,  -8919,  -8969,  -8990,  -8969,  -8917,  -8866,
+                 -8845,  -8866,  -8919,  -8972,  -8994,  -8971,  -8917,  -8863,
+                 -8840,  -8863,  -8919,  -8975,  -8998,  -8975,  -8917,  -8859,
+                 -8835,  -8860,  -8919,  -8979,  -9004,  -8979,  -8917,  -8855,
+                 -8829,  -8856,  -8919,  -8983,  -9010,  -8983,  -8917,  -8851,
+                 -8823,  -8851,  -8919,  -8988,  -9017,  -8988,  -8917,  -8845,
+                 -8815,  -8846,  -8920,  -8994,  -9025,  -8994,  -8917,  -8839,
+                 -8806,  -8839,  -8920,  -9001,  -9035,  -9001,  -8916,  -8831,
+                 -8796,  -8832,  -8920,  -9009,  -9047,  -9009,  -8916,  -8822,
+                 -8783,  -8823,  -8920,  -9019,  -9061,  -9018,  -8916,  -8811,
+                 -8768,  -8812,  -8921,  -9031,  -9077,  -9030,  -8915,  -8798,
+                 -8749,  -8799,  -8922,  -9046,  -9099,  -9045,  -8914,  -8781,
+                 -8725,  -8782,  -8923,  -9066,  -9126,  -9064,  -8913,  -8759,
+                 -8694,  -8761,  -8924,  -9091,  -9161,  -9089,  -8911,  -8729,
+                 -8652,  -8732,  -8927,  -9126,  -9210,  -9123,  -8908,  -8687,
+                 -8594,  -8691,  -8931,  -9177,  -9282,  -9173,  -8903,  -8624,
+                 -8506,  -8630,  -8938,  -9257,  -9394,  -9250,  -8892,  -8519,
+                 -8358,  -8528,  -8955,  -9402,  -9595,  -9388,  -8863,  -8308,
+                 -8066,  -8330,  -9008,  -9734, -10057,  -9696,  -8748,  -7704,
+                 -7227,  -7792,  -9345, -11169, -12067, -10806,  -6647,    269,
+                  8874,
+            }},
+            // 256 harmonics
+            {{
+                  8896,  24483,  29969,  27181,  24999,  26585,  27958,  26844,
+                 25838,  26699,  27495,  26792,  26132,  26728,  27293,  26775,
+                 26280,  26739,  27179,  26767,  26369,  26744,  27107,  26763,
+                 26428,  26747,  27058,  26761,  26471,  26749,  27021,  26759,
+                 26502,  26750,  26993,  26758,  26527,  26751,  26972,  26757,
+                 26546,  26752,  26954,  26757,  26562,  26752,  26940,  26756,
+                 26575,  26753,  26928,  26756,  26586,  26753,  26918,  26756,
+                 26595,  26753,  26910,  26756,  26603,  26753,  26902,  26755,
+                 26610,  26753,  26896,  26755,  26616,  26754,  26891,  26755,
+                 26621,  26754,  26886,  26755,  26625,  26754,  26882,  26755,
+                 26629,  26754,  26878,  26755,  26632,  26754,  26875,  26755,
+                 26635,  26754,  26872,  26755,  26638,  26754,  26870,  26755,
+                 26640,  26754,  26868,  26755,  26642,  26754,  26866,  26755,
+                 26643,  26754,  26865,  26755,  26645,  26754,  26864,  26755,
+                 26646,  26754,  26863,  26755,  26646,  26754,  26862,  26755,
+                 26647,  26754,  26862,  26754,  26647,  26754,  26862,  26754,
+                 26647,  26754,  26862,  26754,  26647,  26754,  26862,  26754,
+                 26647,  26755,  26862,  26754,  26646,  26755,  26863,  26754,
+                 26646,  26755,  26864,  26754,  26645,  26755,  26865,  26754,
+                 26643,  26755,  26866,  26754,  26642,  26755,  26868,  26754,
+                 26640,  26755,  26870,  26754,  26638,  26755,  26872,  26754,
+                 26635,  26755,  26875,  26754,  26632,  26755,  26878,  26754,
+                 26629,  26755,  26882,  26754,  26625,  26755,  26886,  26754,
+                 26621,  26755,  26891,  26754,  26616,  26755,  26896,  26753,
+                 26610,  26755,  26902,  26753,  26603,  26756,  26910,  26753,
+                 26595,  26756,  26918,  26753,  26586,  26756,  26928,  26753,
+                 26575,  26756,  26940,  26752,  26562,  26757,  26954,  26752,
+                 26546,  26757,  26972,  26751,  26527,  26758,  26993,  26750,
+                 26502,  26759,  27021,  26749,  26471,  26761,  27058,  26747,
+                 26428,  26763,  27107,  26744,  26369,  26767,  27179,  26739,
+                 26280,  26775,  27293,  26728,  26132,  26792,  27495,  26699,
+                 25838,  26844,  27958,  26585,  24999,  27181,  29969,  24483,
+                  8896,  -6647, -12089,  -9345,  -7207,  -8748, -10077,  -9008,
+                 -8047,  -8863,  -9614,  -8955,  -8340,  -8891,  -9412,  -8938,
+                 -8488,  -8902,  -9298,  -8931,  -8577,  -8908,  -9226,  -8927,
+                 -8637,  -8911,  -9176,  -8924,  -8680,  -8913,  -9140,  -8923,
+                 -8711,  -8914,  -9112,  -8922,  -8736,  -8915,  -9090,  -8921,
+                 -8756,  -8915,  -9072,  -8921,  -8772,  -8916,  -9058,  -8920,
+                 -8785,  -8916,  -9045,  -8920,  -8796,  -8917,  -9035,  -8920,
+                 -8806,  -8917,  -9026,  -8919,  -8814,  -8917,  -9018,  -8919,
+                 -8821,  -8917,  -9012,  -8919,  -8828,  -8917,  -9006,  -8919,
+                 -8833,  -8917,  -9000,  -8919,  -8838,  -8917,  -8996,  -8919,
+                 -8843,  -8917,  -8991,  -8919,  -8847,  -8918,  -8987,  -8919,
+                 -8851,  -8918,  -8984,  -8919,  -8854,  -8918,  -8981,  -8919,
+                 -8857,  -8918,  -8978,  -8919,  -8860,  -8918,  -8975,  -8919,
+                 -8862,  -8918,  -8973,  -8919,  -8865,  -8918,  -8971,  -8918,
+                 -8867,  -8918,  -8969,  -8918,  -8869,  -8918,  -8967,  -8918,
+                 -8870,  -8918,  -8965,  -8918,  -8872,  -8918,  -8963,  -8918,
+                 -8874,  -8918,  -8962,  -8918,  -8875,  -8918,  -8960,  -8918,
+                 -8877,  -8918,  -8959,  -8918,  -8878,  -8918,  -8958,  -8918,
+                 -8879,  -8918,  -8957,  -8918,  -8880,  -8918,  -8955,  -8918,
+                 -8881,  -8918,  -8954,  -8918,  -8882,  -8918,  -8953,  -8918,
+                 -8883,  -8918,  -8952,  -8918,  -8884,  -8918,  -8952,  -8918,
+                 -8885,  -8918,  -8951,  -8918,  -8886,  -8918,  -8950,  -8918,
+                 -8887,  -8918,  -8949,  -8918,  -8887,  -8918,  -8949,  -8918,
+                 -8888,  -8918,  -8948,  -8918,  -8889,  -8918,  -8947,  -8918,
+                 -8889,  -8918,  -8947,  -8918,  -8890,  -8918,  -8946,  -8918,
+                 -8891,  -8918,  -8946,  -8918,  -8891,  -8918,  -8945,  -8918,
+                 -8892,  -8918,  -8945,  -8918,  -8892,  -8918,  -8944,  -8918,
+                 -8892,  -8918,  -8944,  -8918,  -8893,  -8918,  -8943,  -8918,
+                 -8893,  -8918,  -8943,  -8918,  -8894,  -8918,  -8942,  -8918,
+                 -8894,  -8918,  -8942,  -8918,  -8894,  -8918,  -8942,  -8918,
+                 -8895,  -8918,  -8941,  -8918,  -8895,  -8918,  -8941,  -8918,
+                 -8895,  -8918,  -8941,  -8918,  -8896,  -8918,  -8940,  -8918,
+                 -8896,  -8918,  -8940,  -8918,  -8896,  -8918,  -8940,  -8918,
+                 -8896,  -8918,  -8940,  -8918,  -8897,  -8918,  -8939,  -8918,
+                 -8897,  -8918,  -8939,  -8918,  -8897,  -8918,  -8939,  -8918,
+                 -8897,  -8918,  -8939,  -8918,  -8898,  -8918,  -8939,  -8918,
+                 -8898,  -8918,  -8938,  -8918,  -8898,  -8918,  -8938,  -8918,
+                 -8898,  -8918,  -8938,  -8918,  -8898,  -8918,  -8938,  -8918,
+                 -8898,  -8918,  -8938,  -8918,  -8899,  -8918,  -8938,  -8918,
+                 -8899,  -8918,  -8938,  -8918,  -8899,  -8918,  -8937,  -8918,
+                 -8899,  -8918,  -8937,  -8918,  -8899,  -8918,  -8937,  -8918,
+                 -8899,  -8918,  -8937,  -8918,  -8899,  -8918,  -8937,  -8918,
+                 -8899,  -8918,  -8937,  -8918,  -8899,  -8918,  -8937,  -8918,
+                 -8899,  -8918,  -8937,  -8918,  -8900,  -8918,  -8937,  -8918,
+                 -8900,  -8918,  -8937,  -8918,  -8900,  -8918,  -8937,  -8918,
+                 -8900,  -8918,  -8937,  -8918,  -8900,  -8918,  -8937,  -8918,
+                 -8900,  -8918,  -8937,  -8918,  -8900,  -8918,  -8937,  -8918,
+                 -8900,  -8918,  -8937,  -8918,  -8900,  -8918,  -8937,  -8918,
+                 -8900,  -8918,  -8937,  -8918,  -8900,  -8918,  -8937,  -8918,
+                 -8900,  -8918,  -8937,  -8918,  -8900,  -8918,  -8937,  -8918,
+                 -8900,  -8918,  -8937,  -8918,  -8900,  -8918,  -8937,  -8918,
+                 -8900,  -8918,  -8937,  -8918,  -8900,  -8918,  -8937,  -8918,
+                 -8900,  -8918,  -8937,  -8918,  -8900,  -8918,  -8937,  -8918,
+                 -8899,  -8918,  -8937,  -8918,  -8899,  -8918,  -8937,  -8918,
+                 -8899,  -8918,  -8937,  -8918,  -8899,  -8918,  -8937,  -8918,
+                 -8899,  -8918,  -8937,  -8918,  -8899,  -8918,  -8937,  -8918,
+                 -8899,  -8918,  -8937,  -8918,  -8899,  -8918,  -8938,  -8918,
+                 -8899,  -8918,  -8938,  -8918,  -8899,  -8918,  -8938,  -8918,
+                 -8898,  -8918,  -8938,  -8918,  -8898,  -8918,  -8938,  -8918,
+                 -8898,  -8918,  -8938,  -8918,  -8898,  -8918,  -8938,  -8918,
+                 -8898,  -8918,  -8939,  -8918,  -8898,  -8918,  -8939,  -8918,
+                 -8897,  -8918,  -8939,  -8918,  -8897,  -8918,  -8939,  -8918,
+                 -8897,  -8918,  -8939,  -8918,  -8897,  -8918,  -8940,  -8918,
+                 -8896,  -8918,  -8940,  -8918,  -8896,  -8918,  -8940,  -8918,
+                 -8896,  -8918,  -8940,  -8918,  -8896,  -8918,  -8941,  -8918,
+                 -8895,  -8918,  -8941,  -8918,  -8895,  -8918,  -8941,  -8918,
+                 -8895,  -8918,  -8942,  -8918,  -8894,  -8918,  -8942,  -8918,
+                 -8894,  -8918,  -8942,  -8918,  -8894,  -8918,  -8943,  -8918,
+                 -8893,  -8918,  -8943,  -8918,  -8893,  -8918,  -8944,  -8918,
+                 -8892,  -8918,  -8944,  -8918,  -8892,  -8918,  -8945,  -8918,
+                 -8892,  -8918,  -8945,  -8918,  -8891,  -8918,  -8946,  -8918,
+                 -8891,  -8918,  -8946,  -8918,  -8890,  -8918,  -8947,  -8918,
+                 -8889,  -8918,  -8947,  -8918,  -8889,  -8918,  -8948,  -8918,
+                 -8888,  -8918,  -8949,  -8918,  -8887,  -8918,  -8949,  -8918,
+                 -8887,  -8918,  -8950,  -8918,  -8886,  -8918,  -8951,  -8918,
+                 -8885,  -8918,  -8952,  -8918,  -8884,  -8918,  -8952,  -8918,
+                 -8883,  -8918,  -8953,  -8918,  -8882,  -8918,  -8954,  -8918,
+                 -8881,  -8918,  -8955,  -8918,  -8880,  -8918,  -8957,  -8918,
+                 -8879,  -8918,  -8958,  -8918,  -8878,  -8918,  -8959,  -8918,
+                 -8877,  -8918,  -8960,  -8918,  -8875,  -8918,  -8962,  -8918,
+                 -8874,  -8918,  -8963,  -8918,  -8872,  -8918,  -8965,  -8918,
+                 -8870,  -8918,  -8967,  -8918,  -8869,  -8918,  -8969,  -8918,
+                 -8867,  -8918,  -8971,  -8918,  -8865,  -8919,  -8973,  -8918,
+                 -8862,  -8919,  -8975,  -8918,  -8860,  -8919,  -8978,  -8918,
+                 -8857,  -8919,  -8981,  -8918,  -8854,  -8919,  -8984,  -8918,
+                 -8851,  -8919,  -8987,  -8918,  -8847,  -8919,  -8991,  -8917,
+                 -8843,  -8919,  -8996,  -8917,  -8838,  -8919,  -9000,  -8917,
+                 -8833,  -8919,  -9006,  -8917,  -8828,  -8919,  -9012,  -8917,
+                 -8821,  -8919,  -9018,  -8917,  -8814,  -8919,  -9026,  -8917,
+                 -8806,  -8920,  -9035,  -8917,  -8796,  -8920,  -9045,  -8916,
+                 -8785,  -8920,  -9058,  -8916,  -8772,  -8921,  -9072,  -8915,
+                 -8756,  -8921,  -9090,  -8915,  -8736,  -8922,  -9112,  -8914,
+                 -8711,  -8923,  -9140,  -8913,  -8680,  -8924,  -9176,  -8911,
+                 -8637,  -8927,  -9226,  -8908,  -8577,  -8931,  -9298,  -8902,
+                 -8488,  -8938,  -9412,  -8891,  -8340,  -8955,  -9614,  -8863,
+                 -8047,  -9008, -10077,  -8748,  -7207,  -9345, -12089,  -6647,
+                  8896,
+            }},
+            // 512 harmonics
+            {{
+                  8907,  29958,  25010,  27946,  25850,  27483,  26144,  27280,
+                 26292,  27167,  26382,  27094,  26442,  27044,  26485,  27007,
+                 26517,  26979,  26542,  26957,  26561,  26939,  26578,  26924,
+                 26591,  26912,  26603,  26901,  26613,  26892,  26621,  26884,
+                 26628,  26877,  26635,  26871,  26641,  26866,  26646,  26861,
+                 26650,  26856,  26654,  26852,  26658,  26849,  26662,  26846,
+                 26665,  26843,  26668,  26840,  26670,  26837,  26673,  26835,
+                 26675,  26833,  26677,  26831,  26679,  26829,  26680,  26828,
+                 26682,  26826,  26684,  26825,  26685,  26823,  26686,  26822,
+                 26688,  26821,  26689,  26820,  26690,  26819,  26691,  26818,
+                 26692,  26817,  26693,  26816,  26693,  26815,  26694,  26814,
+                 26695,  26814,  26695,  26813,  26696,  26813,  26697,  26812,
+                 26697,  26811,  26698,  26811,  26698,  26811,  26698,  26810,
+                 26699,  26810,  26699,  26810,  26699,  26809,  26700,  26809,
+                 26700,  26809,  26700,  26809,  26700,  26808,  26701,  26808,
+                 26701,  26808,  26701,  26808,  26701,  26808,  26701,  26808,
+                 26701,  26808,  26701,  26808,  26701,  26808,  26701,  26808,
+                 26701,  26808,  26701,  26808,  26700,  26809,  26700,  26809,
+                 26700,  26809,  26700,  26809,  26699,  26810,  26699,  26810,
+                 26699,  26810,  26698,  26811,  26698,  26811,  26698,  26811,
+                 26697,  26812,  26697,  26813,  26696,  26813,  26695,  26814,
+                 26695,  26814,  26694,  26815,  26693,  26816,  26693,  26817,
+                 26692,  26818,  26691,  26819,  26690,  26820,  26689,  26821,
+                 26688,  26822,  26686,  26823,  26685,  26825,  26684,  26826,
+                 26682,  26828,  26680,  26829,  26679,  26831,  26677,  26833,
+                 26675,  26835,  26673,  26837,  26670,  26840,  26668,  26843,
+                 26665,  26846,  26662,  26849,  26658,  26852,  26654,  26856,
+                 26650,  26861,  26646,  26866,  26641,  26871,  26635,  26877,
+                 26628,  26884,  26621,  26892,  26613,  26901,  26603,  26912,
+                 26591,  26924,  26578,  26939,  26561,  26957,  26542,  26979,
+                 26517,  27007,  26485,  27044,  26442,  27094,  26382,  27167,
+                 26292,  27280,  26144,  27483,  25850,  27946,  25010,  29958,
+                  8907, -12099,  -7196, -10088,  -8036,  -9625,  -8330,  -9422,
+                 -8478,  -9308,  -8568,  -9236,  -8628,  -9185,  -8671,  -9149,
+                 -8703,  -9120,  -8728,  -9098,  -8748,  -9080,  -8764,  -9065,
+                 -8777,  -9053,  -8789,  -9042,  -8799,  -9033,  -8807,  -9025,
+                 -8815,  -9018,  -8821,  -9012,  -8827,  -9007,  -8832,  -9002,
+                 -8837,  -8997,  -8841,  -8993,  -8845,  -8990,  -8848,  -8986,
+                 -8852,  -8983,  -8855,  -8980,  -8857,  -8978,  -8860,  -8975,
+                 -8862,  -8973,  -8864,  -8971,  -8866,  -8969,  -8868,  -8967,
+                 -8870,  -8966,  -8871,  -8964,  -8873,  -8963,  -8874,  -8961,
+                 -8876,  -8960,  -8877,  -8959,  -8878,  -8957,  -8879,  -8956,
+                 -8881,  -8955,  -8882,  -8954,  -8883,  -8953,  -8883,  -8952,
+                 -8884,  -8952,  -8885,  -8951,  -8886,  -8950,  -8887,  -8949,
+                 -8888,  -8948,  -8888,  -8948,  -8889,  -8947,  -8890,  -8946,
+                 -8890,  -8946,  -8891,  -8945,  -8891,  -8945,  -8892,  -8944,
+                 -8892,  -8944,  -8893,  -8943,  -8893,  -8943,  -8894,  -8942,
+                 -8894,  -8942,  -8895,  -8941,  -8895,  -8941,  -8896,  -8941,
+                 -8896,  -8940,  -8896,  -8940,  -8897,  -8939,  -8897,  -8939,
+                 -8897,  -8939,  -8898,  -8938,  -8898,  -8938,  -8898,  -8938,
+                 -8899,  -8937,  -8899,  -8937,  -8899,  -8937,  -8900,  -8937,
+                 -8900,  -8936,  -8900,  -8936,  -8900,  -8936,  -8901,  -8936,
+                 -8901,  -8935,  -8901,  -8935,  -8901,  -8935,  -8901,  -8935,
+                 -8902,  -8935,  -8902,  -8934,  -8902,  -8934,  -8902,  -8934,
+                 -8902,  -8934,  -8903,  -8934,  -8903,  -8933,  -8903,  -8933,
+                 -8903,  -8933,  -8903,  -8933,  -8903,  -8933,  -8904,  -8933,
+                 -8904,  -8932,  -8904,  -8932,  -8904,  -8932,  -8904,  -8932,
+                 -8904,  -8932,  -8904,  -8932,  -8905,  -8932,  -8905,  -8932,
+                 -8905,  -8931,  -8905,  -8931,  -8905,  -8931,  -8905,  -8931,
+                 -8905,  -8931,  -8905,  -8931,  -8906,  -8931,  -8906,  -8931,
+                 -8906,  -8931,  -8906,  -8930,  -8906,  -8930,  -8906,  -8930,
+                 -8906,  -8930,  -8906,  -8930,  -8906,  -8930,  -8906,  -8930,
+                 -8906,  -8930,  -8907,  -8930,  -8907,  -8930,  -8907,  -8930,
+                 -8907,  -8929,  -8907,  -8929,  -8907,  -8929,  -8907,  -8929,
+                 -8907,  -8929,  -8907,  -8929,  -8907,  -8929,  -8907,  -8929,
+                 -8907,  -8929,  -8907,  -8929,  -8907,  -8929,  -8907,  -8929,
+                 -8908,  -8929,  -8908,  -8929,  -8908,  -8929,  -8908,  -8929,
+                 -8908,  -8929,  -8908,  -8928,  -8908,  -8928,  -8908,  -8928,
+                 -8908,  -8928,  -8908,  -8928,  -8908,  -8928,  -8908,  -8928,
+                 -8908,  -8928,  -8908,  -8928,  -8908,  -8928,  -8908,  -8928,
+                 -8908,  -8928,  -8908,  -8928,  -8908,  -8928,  -8908,  -8928,
+                 -8908,  -8928,  -8908,  -8928,  -8908,  -8928,  -8909,  -8928,
+                 -8909,  -8928,  -8909,  -8928,  -8909,  -8928,  -8909,  -8928,
+                 -8909,  -8928,  -8909,  -8928,  -8909,  -8928,  -8909,  -8928,
+                 -8909,  -8928,  -8909,  -8928,  -8909,  -8928,  -8909,  -8928,
+                 -8909,  -8927,  -8909,  -8927,  -8909,  -8927,  -8909,  -8927,
+                 -8909,  -8927,  -8909,  -8927,  -8909,  -8927,  -8909,  -8927,
+                 -8909,  -8927,  -8909,  -8927,  -8909,  -8927,  -8909,  -8927,
+                 -8909,  -8927,  -8909,  -8927,  -8909,  -8927,  -8909,  -8927,
+                 -8909,  -8927,  -8909,  -8927,  -8909,  -8927,  -8909,  -8927,
+                 -8909,  -8927,  -8909,  -8927,  -8909,  -8927,  -8909,  -8927,
+                 -8909,  -8927,  -8909,  -8927,  -8909,  -8927,  -8909,  -8927,
+                 -8909,  -8927,  -8909,  -8927,  -8909,  -8927,  -8909,  -8927,
+                 -8909,  -8927,  -8909,  -8927,  -8909,  -8927,  -8909,  -8927,
+                 -8909,  -8927,  -8909,  -8927,  -8909,  -8927,  -8909,  -8927,
+                 -8909,  -8928,  -8909,  -8928,  -8909,  -8928,  -8909,  -8928,
+                 -8909,  -8928,  -8909,  -8928,  -8909,  -8928,  -8909,  -8928,
+                 -8909,  -8928,  -8909,  -8928,  -8909,  -8928,  -8909,  -8928,
+                 -8909,  -8928,  -8909,  -8928,  -8908,  -8928,  -8908,  -8928,
+                 -8908,  -8928,  -8908,  -8928,  -8908,  -8928,  -8908,  -8928,
+                 -8908,  -8928,  -8908,  -8928,  -8908,  -8928,  -8908,  -8928,
+                 -8908,  -8928,  -8908,  -8928,  -8908,  -8928,  -8908,  -8928,
+                 -8908,  -8928,  -8908,  -8928,  -8908,  -8928,  -8908,  -8929,
+                 -8908,  -8929,  -8908,  -8929,  -8908,  -8929,  -8908,  -8929,
+                 -8908,  -8929,  -8907,  -8929,  -8907,  -8929,  -8907,  -8929,
+                 -8907,  -8929,  -8907,  -8929,  -8907,  -8929,  -8907,  -8929,
+                 -8907,  -8929,  -8907,  -8929,  -8907,  -8929,  -8907,  -8929,
+                 -8907,  -8930,  -8907,  -8930,  -8907,  -8930,  -8907,  -8930,
+                 -8906,  -8930,  -8906,  -8930,  -8906,  -8930,  -8906,  -8930,
+                 -8906,  -8930,  -8906,  -8930,  -8906,  -8930,  -8906,  -8931,
+                 -8906,  -8931,  -8906,  -8931,  -8906,  -8931,  -8905,  -8931,
+                 -8905,  -8931,  -8905,  -8931,  -8905,  -8931,  -8905,  -8931,
+                 -8905,  -8932,  -8905,  -8932,  -8905,  -8932,  -8904,  -8932,
+                 -8904,  -8932,  -8904,  -8932,  -8904,  -8932,  -8904,  -8932,
+                 -8904,  -8933,  -8904,  -8933,  -8903,  -8933,  -8903,  -8933,
+                 -8903,  -8933,  -8903,  -8933,  -8903,  -8934,  -8903,  -8934,
+                 -8902,  -8934,  -8902,  -8934,  -8902,  -8934,  -8902,  -8935,
+                 -8902,  -8935,  -8901,  -8935,  -8901,  -8935,  -8901,  -8935,
+                 -8901,  -8936,  -8901,  -8936,  -8900,  -8936,  -8900,  -8936,
+                 -8900,  -8937,  -8900,  -8937,  -8899,  -8937,  -8899,  -8937,
+                 -8899,  -8938,  -8898,  -8938,  -8898,  -8938,  -8898,  -8939,
+                 -8897,  -8939,  -8897,  -8939,  -8897,  -8940,  -8896,  -8940,
+                 -8896,  -8941,  -8896,  -8941,  -8895,  -8941,  -8895,  -8942,
+                 -8894,  -8942,  -8894,  -8943,  -8893,  -8943,  -8893,  -8944,
+                 -8892,  -8944,  -8892,  -8945,  -8891,  -8945,  -8891,  -8946,
+                 -8890,  -8946,  -8890,  -8947,  -8889,  -8948,  -8888,  -8948,
+                 -8888,  -8949,  -8887,  -8950,  -8886,  -8951,  -8885,  -8952,
+                 -8884,  -8952,  -8883,  -8953,  -8883,  -8954,  -8882,  -8955,
+                 -8881,  -8956,  -8879,  -8957,  -8878,  -8959,  -8877,  -8960,
+                 -8876,  -8961,  -8874,  -8963,  -8873,  -8964,  -8871,  -8966,
+                 -8870,  -8967,  -8868,  -8969,  -8866,  -8971,  -8864,  -8973,
+                 -8862,  -8975,  -8860,  -8978,  -8857,  -8980,  -8855,  -8983,
+                 -8852,  -8986,  -8848,  -8990,  -8845,  -8993,  -8841,  -8997,
+                 -8837,  -9002,  -8832,  -9007,  -8827,  -9012,  -8821,  -9018,
+                 -8815,  -9025,  -8807,  -9033,  -8799,  -9042,  -8789,  -9053,
+                 -8777,  -9065,  -8764,  -9080,  -8748,  -9098,  -8728,  -9120,
+                 -8703,  -9149,  -8671,  -9185,  -8628,  -9236,  -8568,  -9308,
+                 -8478,  -9422,  -8330,  -9625,  -8036, -10088,  -7196, -12099,
+                  8907,
+            }},
+        };
+    }
+}
@@ -0,0 +1,72 @@
+#include "bandlimited_oscillator.h"
+
+namespace fixdsp {
+    namespace oscillator {
+
+        void BandLimitedOscillator::setPitch(int16_t pitch) {
+            phase_.setPitch(pitch);
+        }
+
+        void BandLimitedOscillator::setKey(uint8_t key) {
+            phase_.setKey(key);
+        }
+
+        void BandLimitedOscillator::setGlide(int16_t glide) {
+            phase_.setGlide(glide);
+        }
+
+        void BandLimitedOscillator::setMaxGlideDuration(float seconds) {
+            phase_.setMaxGlideDuration(seconds);
+        }
+
+        void BandLimitedOscillator::setShape(BandLimitedShape shape) {
+            switch (shape) {
+            case SHAPE_SQUARE:
+                mip_chain_ = mipmap::square;
+                break;
+            case SHAPE_PULSE_25:
+                mip_chain_ = mipmap::pulse_25;
+                break;
+            default:
+                mip_chain_ = mipmap::saw;
+            }
+        }
+
+        void BandLimitedOscillator::render(MonoBuffer &buffer) {
+            PhaseBuffer phase_buf;
+            auto phase_p = phase_buf.getReadPointer(0);
+            auto out = buffer.getWritePointer(0);
+            const auto len = buffer.getBufferLength();
+
+            phase_.render(phase_buf);
+
+            // The increment is between 2^-(octave + 1) and 2^-octave of the
+            // phase range, where level octave - 1 and the levels below do not
+            // alias. Fade from octave - 1 to octave - 2 as the pitch goes up.
+            const uint32_t increment = phase_p[1] - phase_p[0];
+            const int32_t octave = increment ? __builtin_clz(increment) : 32;
+            int32_t rich = octave - 1;
+            int32_t safe = octave - 2;
+
+            if (rich > mipmap::kLevels - 1) rich = mipmap::kLevels - 1;
+            if (safe > mipmap::kLevels - 1) safe = mipmap::kLevels - 1;
+            if (rich < 0) rich = 0;
+            if (safe < 0) safe = 0;
+
+            if (rich == safe) {
+                const int16_t *table = mip_chain_[rich].data();
+                for (size_t i = 0; i < len; i++) {
+                    out[i] = Interpolate1022(table, phase_p[i]);
+                }
+                return;
+            }
+
+            const uint16_t balance = (increment << octave << 1) >> 16;
+            const int16_t *table_a = mip_chain_[rich].data();
+            const int16_t *table_b = mip_chain_[safe].data();
+            for (size_t i = 0; i < len; i++) {
+                out[i] = Crossfade1022(table_a, table_b, phase_p[i], balance);
+            }
+        }
+    }
+}
@@ -0,0 +1,159 @@
+#include <array>
+#include "sample_decoder.h"
+
+namespace fixdsp {
+    namespace sample {
+
+        static constexpr int16_t muLawDecode(uint8_t u) {
+            u = ~u;
+            const int32_t t = (((u & 0x0F) << 3) + 0x84) << ((u >> 4) & 0x07);
+            return (u & 0x80) ? (0x84 - t) : (t - 0x84);
+        }
+
+        static constexpr std::array<int16_t, 256> muLawTable() {
+            std::array<int16_t, 256> table = {};
+            for (int i = 0; i < 256; i++) {
+                table[i] = muLawDecode(i);
+            }
+            return table;
+        }
+
+        static constexpr std::array<int16_t, 256> mu_law_table = muLawTable();
+
+        static const int16_t ima_step_table[89] = {
+            7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34,
+            37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+            157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494,
+            544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552,
+            1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428,
+            4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+            12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086,
+            29794, 32767
+        };
+
+        static const int8_t ima_index_table[16] = {
+            -1, -1, -1, -1, 2, 4, 6, 8,
+            -1, -1, -1, -1, 2, 4, 6, 8
+        };
+
+        void Decoder::setData(const SampleData &data) {
+            data_ = &data;
+            seek(0);
+        }
+
+        void Decoder::seek(uint32_t position) {
+            if (data_ == nullptr) {
+                return;
+            }
+            if (position > data_->length) {
+                position = data_->length;
+            }
+
+            // ADPCM: decode from the start of the block
+            const uint32_t offset = position % data_->block_samples;
+            position_ = position - offset;
+            if (offset > 0 && data_->format == FORMAT_IMA_ADPCM) {
+                int16_t skip[FIXDSP_BUFFER_LEN];
+                uint32_t left = offset;
+
+                while (left > 0) {
+                    const uint32_t n = left < FIXDSP_BUFFER_LEN ? left : FIXDSP_BUFFER_LEN;
+                    decode(skip, n);
+                    left -= n;
+                }
+            } else {
+                position_ = position;
+            }
+        }
+
+        void Decoder::startBlock() {
+            const uint8_t *header =
+                &data_->data[position_ / data_->block_samples * data_->block_bytes];
+
+            predictor_ = static_cast<int16_t>(header[0] | (header[1] << 8));
+            step_index_ = header[2];
+            if (step_index_ > 88) {
+                step_index_ = 88;
+            }
+        }
+
+        void Decoder::decodeRun(int16_t *output, uint32_t offset, uint32_t count) {
+            const uint8_t *block =
+                &data_->data[position_ / data_->block_samples * data_->block_bytes];
+
+            switch (data_->format) {
+            case FORMAT_S8:
+                for (uint32_t i = 0; i < count; i++) {
+                    output[i] = static_cast<int8_t>(block[offset + i]) << 8;
+                }
+                break;
+
+            case FORMAT_MU_LAW:
+                for (uint32_t i = 0; i < count; i++) {
+                    output[i] = mu_law_table[block[offset + i]];
+                }
+                break;
+
+            case FORMAT_IMA_ADPCM: {
+                const uint8_t *nibbles = block + 4;
+                int32_t predictor = predictor_;
+                int32_t index = step_index_;
+
+                for (uint32_t i = 0; i < count; i++) {
+                    const uint32_t n = offset + i;
+                    const uint8_t code = (nibbles[n >> 1] >> ((n & 1) << 2)) & 0x0F;
+                    const int32_t step = ima_step_table[index];
+                    int32_t diff = step >> 3;
+
+                    if (code & 4) diff += step;
+                    if (code & 2) diff += step >> 1;
+                    if (code & 1) diff += step >> 2;
+                    predictor += (code & 8) ? -diff : diff;
+                    predictor = clip(predictor);
+
+                    index += ima_index_table[code];
+                    if (index < 0) index = 0;
+                    if (index > 88) index = 88;
+
+                    output[i] = predictor;
+                }
+                predictor_ = predictor;
+                step_index_ = index;
+                break;
+            }
+            }
+        }
+
+        uint32_t Decoder::decode(int16_t *output, uint32_t count) {
+            uint32_t done = 0;
+
+            while (done < count && !this->done()) {
+                const uint32_t offset = position_ % data_->block_samples;
+                uint32_t n = data_->block_samples - offset;
+
+                if (n > count - done) {
+                    n = count - done;
+                }
+                if (n > data_->length - position_) {
+                    n = data_->length - position_;
+                }
+
+                if (offset == 0 && data_->format == FORMAT_IMA_ADPCM) {
+                    startBlock();
+                }
+                decodeRun(&output[done], offset, n);
+                position_ += n;
+                done += n;
+            }
+
+            for (uint32_t i = done; i < count; i++) {
+                output[i] = 0;
+            }
+            return done;
+        }
+
+        uint32_t Decoder::render(MonoBuffer &buffer) {
+            return decode(buffer.getWritePointer(0), buffer.getBufferLength());
+        }
+    }
+}
@@ -0,0 +1,180 @@
+#include "sampler.h"
+
+namespace fixdsp {
+    namespace sampler {
+
+        static inline int32_t toSample(int8_t s) { return s << 8; }
+        static inline int32_t toSample(uint8_t s) { return (s - 128) << 8; }
+        static inline int32_t toSample(int16_t s) { return s; }
+
+        void Voice::setSource(const Source &source) {
+            source_ = &source;
+            playing_ = false;
+            setPitch(pitch_);
+        }
+
+        bool Voice::setSource(const sample::SampleData &data, uint8_t root_key) {
+            if (data.format != sample::FORMAT_S8) {
+                return false;
+            }
+
+            // The blocks of S8 data are contiguous, the padding of the last
+            // one is after length
+            data_source_.data = data.data;
+            data_source_.format = SOURCE_S8;
+            data_source_.length = data.length;
+            data_source_.sample_rate = data.sample_rate;
+            data_source_.root_key = root_key;
+            data_source_.loop_start = 0;
+            data_source_.loop_end = 0;
+            setSource(data_source_);
+            return true;
+        }
+
+        void Voice::setMode(Mode mode) {
+            mode_ = mode;
+        }
+
+        void Voice::setPitch(int16_t pitch) {
+            pitch_ = pitch;
+            if (source_ == nullptr) {
+                return;
+            }
+
+            // Ratio of the pitch to the root key, Q32.32, then resample
+            // from the source rate
+            const uint64_t root = phase::ComputePhaseIncrement(keyToPitch(source_->root_key));
+            const uint64_t ratio = (static_cast<uint64_t>(phase::ComputePhaseIncrement(pitch)) << 32) / root;
+            increment_ = ratio * source_->sample_rate / FIXDSP_SAMPLE_RATE;
+        }
+
+        void Voice::on(uint8_t key, int16_t velocity) {
+            if (source_ == nullptr || source_->length == 0) {
+                return;
+            }
+            setKey(key);
+            env_.setHold(true);
+            env_.on(velocity);
+            looping_ = mode_ == MODE_GATED &&
+                source_->loop_end > source_->loop_start &&
+                source_->loop_end <= source_->length;
+            position_ = 0;
+            playing_ = true;
+        }
+
+        void Voice::off() {
+            if (mode_ == MODE_GATED) {
+                env_.off();
+            }
+        }
+
+        template<typename T>
+        inline int32_t Voice::at(const T *data, int32_t index) const {
+            if (index < 0) {
+                index = 0;
+            }
+            if (looping_ && index >= static_cast<int32_t>(source_->loop_end)) {
+                index -= source_->loop_end - source_->loop_start;
+            }
+            if (index >= static_cast<int32_t>(source_->length)) {
+                return 0;
+            }
+            return toSample(data[index]);
+        }
+
+        template<typename T>
+        uint32_t Voice::renderSamples(const T *data, int16_t *output, uint32_t len) {
+            const uint32_t end = looping_ ? source_->loop_end : source_->length;
+            const uint64_t loop_len =
+                static_cast<uint64_t>(source_->loop_end - source_->loop_start) << 32;
+            uint64_t position = position_;
+            uint32_t i = 0;
+
+            for (; i < len; i++) {
+                const int32_t index = position >> 32;
+                const uint32_t frac = static_cast<uint32_t>(position);
+
+                if (interpolation_ == INTERPOLATION_LINEAR) {
+                    int32_t x0, x1;
+                    if (static_cast<uint32_t>(index) + 1 < end) {
+                        x0 = toSample(data[index]);
+                        x1 = toSample(data[index + 1]);
+                    } else {
+                        x0 = at(data, index);
+                        x1 = at(data, index + 1);
+                    }
+                    output[i] = x0 + (((x1 - x0) * static_cast<int32_t>(frac >> 17)) >> 15);
+                } else {
+                    int32_t xm1, x0, x1, x2;
+                    if (index >= 1 && static_cast<uint32_t>(index) + 2 < end) {
+                        xm1 = toSample(data[index - 1]);
+                        x0 = toSample(data[index]);
+                        x1 = toSample(data[index + 1]);
+                        x2 = toSample(data[index + 2]);
+                    } else {
+                        xm1 = at(data, index - 1);
+                        x0 = at(data, index);
+                        x1 = at(data, index + 1);
+                        x2 = at(data, index + 2);
+                    }
+
+                    // Catmull-Rom coefficients, the fraction is Q12 so that
+                    // the products stay within 32 bits for full-scale input
+                    const int32_t t = frac >> 20;
+                    const int32_t c1 = (x1 - xm1) >> 1;
+                    const int32_t c2 = xm1 - ((5 * x0) >> 1) + 2 * x1 - (x2 >> 1);
+                    const int32_t c3 = ((x2 - xm1) >> 1) + ((3 * (x0 - x1)) >> 1);
+                    int32_t y = (c3 * t) >> 12;
+                    y = ((y + c2) * t) >> 12;
+                    y = ((y + c1) * t) >> 12;
+                    output[i] = clip(y + x0);
+                }
+
+                position += increment_;
+                if (looping_) {
+                    while ((position >> 32) >= end) {
+                        position -= loop_len;
+                    }
+                } else if ((position >> 32) >= end) {
+                    i++;
+                    break;
+                }
+            }
+
+            position_ = position;
+            return i;
+        }
+
+        void Voice::render(MonoBuffer &buffer) {
+            auto out = buffer.getWritePointer(0);
+            const uint32_t len = buffer.getBufferLength();
+            uint32_t done = 0;
+
+            if (playing_) {
+                switch (source_->format) {
+                case SOURCE_S8:
+                    done = renderSamples(static_cast<const int8_t *>(source_->data), out, len);
+                    break;
+                case SOURCE_U8:
+                    done = renderSamples(static_cast<const uint8_t *>(source_->data), out, len);
+                    break;
+                case SOURCE_S16:
+                    done = renderSamples(static_cast<const int16_t *>(source_->data), out, len);
+                    break;
+                }
+
+                for (uint32_t i = 0; i < done; i++) {
+                    out[i] = (static_cast<int32_t>(out[i]) * env_.render()) >> 15;
+                }
+
+                if (done < len || env_.segment() == envelope::ENV_SEGMENT_DEAD) {
+                    playing_ = false;
+                }
+            }
+
+            for (uint32_t i = done; i < len; i++) {
+                out[i] = 0;
+            }
+        }
+    }
+}
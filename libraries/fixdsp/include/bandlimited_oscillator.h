@@ -0,0 +1,41 @@
+#pragma once
+
+#include "fixdsp.h"
+#include "phase.h"
+#include "mipmaps.h"
+
+namespace fixdsp {
+
+    namespace oscillator {
+
+        enum BandLimitedShape {
+            SHAPE_SAW,
+            SHAPE_SQUARE,
+            SHAPE_PULSE_25,
+        };
+
+        // Reads mip-mapped tables (see scripts/mipmaps_compiler.py): the
+        // levels are selected from the phase increment, once per block, and
+        // the two levels around the pitch are crossfaded. Unlike the
+        // WaveformOscillator tables, the harmonics stay below Nyquist.
+        class BandLimitedOscillator {
+        public:
+            BandLimitedOscillator() { }
+            ~BandLimitedOscillator() { }
+
+            void setPitch(int16_t pitch);
+            void setKey(uint8_t key);
+
+            void setGlide(int16_t glide);
+            void setMaxGlideDuration(float seconds);
+
+            void setShape(BandLimitedShape shape);
+
+            void render(MonoBuffer &buffer);
+
+        private:
+            const mipmap::MipmapData *mip_chain_ = mipmap::saw;
+            phase::PitchGlide phase_;
+        };
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "fixdsp.h"
+#include "resources.h"
+
+namespace fixdsp {
+    namespace drum {
+
+        // tanh saturation, the input gain goes from 1x (drive = 0) to 4x
+        // (drive = MAX_PARAM). Full scale input stays at full scale.
+        inline void drive(MonoBuffer &buffer, int16_t drive) {
+            if (drive <= 0) {
+                return;
+            }
+
+            const int32_t gain = 32768 + 3 * static_cast<int32_t>(drive);
+
+            for (auto &sample : buffer.getBufferContainer()[0]) {
+                const int32_t x = clip((sample * gain) >> 15);
+                const int32_t y =
+                  Interpolate824(lut_tanh.data(), static_cast<uint32_t>(x + 32768) << 16);
+
+                // 1 / tanh(1)
+                sample = clip((y * 43030) >> 15);
+            }
+        }
+    }
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "fixdsp.h"
+#include "envelope-decay.h"
+#include "filter_svf.h"
+#include "phase.h"
+#include "random.h"
+#include "drum-drive.h"
+#include "drum-waveform_kick.h"
+
+namespace fixdsp {
+    namespace drum {
+
+        // Six detuned square waves (TR-808 cymbal ratios)
+        class MetallicBank {
+        public:
+            MetallicBank() { setKey(56); }
+
+            void setKey(uint8_t key) { setPitch(keyToPitch(key)); }
+            void setPitch(int16_t pitch);
+
+            void render(MonoBuffer &buffer);
+
+        private:
+            uint32_t phase_[6] = {};
+            uint32_t increment_[6];
+        };
+
+        class Snare {
+        public:
+            Snare();
+
+            void setKey(uint8_t key) { key_ = key; }
+            void setDecay(int16_t decay);
+            // Balance between the body (0) and the noise (MAX_PARAM)
+            void setTone(int16_t tone);
+            void setDrive(int16_t drive);
+
+            void on(int16_t velocity);
+            bool active() const;
+
+            void render(MonoBuffer &buffer, const MonoBuffer &noise);
+
+        private:
+            phase::PitchDecay body_;
+            envelope::Decay body_env_;
+            envelope::Decay noise_env_;
+            filter::SVF noise_filter_;
+
+            uint8_t key_ = 50;
+            int16_t tone_ = MAX_PARAM / 2;
+            int16_t drive_ = 0;
+        };
+
+        // Closed and open hats share the metallic bank, the filter and the
+        // drive, like on the TR-808: the closed hat chokes the open one.
+        class HiHat {
+        public:
+            HiHat();
+
+            void setKey(uint8_t key) { metal_.setKey(key); }
+            void setClosedDecay(int16_t decay);
+            void setOpenDecay(int16_t decay);
+            // Balance between the metallic bank (0) and the noise (MAX_PARAM)
+            void setTone(int16_t tone);
+            void setDrive(int16_t drive);
+
+            void closed(int16_t velocity);
+            void open(int16_t velocity);
+            bool active() const;
+
+            void render(MonoBuffer &buffer, const MonoBuffer &noise);
+
+        private:
+            MetallicBank metal_;
+            envelope::Decay closed_env_;
+            envelope::Decay open_env_;
+            filter::SVF filter_;
+
+            int16_t open_decay_ = 0;
+            int16_t tone_ = MAX_PARAM / 4;
+            int16_t drive_ = 0;
+        };
+
+        class Clap {
+        public:
+            Clap();
+
+            void setDecay(int16_t decay);
+            void setDrive(int16_t drive);
+
+            void on(int16_t velocity);
+            bool active() const;
+
+            void render(MonoBuffer &buffer, const MonoBuffer &noise);
+
+        private:
+            static const uint8_t kBursts = 3;
+            static const uint32_t kBurstSpacing = FIXDSP_SAMPLE_RATE / 100;
+
+            envelope::Decay burst_env_;
+            envelope::Decay tail_env_;
+            filter::SVF filter_;
+
+            uint8_t burst_ = kBursts;
+            uint32_t burst_pos_ = 0;
+            int16_t velocity_ = 0;
+            int16_t drive_ = 0;
+        };
+
+        class Tom {
+        public:
+            Tom();
+
+            void setKey(uint8_t key) { key_ = key; }
+            void setDecay(int16_t decay);
+            void setDrive(int16_t drive);
+
+            void on(int16_t velocity);
+            bool active() const;
+
+            void render(MonoBuffer &buffer, const MonoBuffer &noise);
+
+        private:
+            phase::PitchDecay body_;
+            envelope::Decay env_;
+            envelope::Decay click_env_;
+
+            uint8_t key_ = 45;
+            int16_t drive_ = 0;
+        };
+
+        enum KitVoice {
+            KIT_KICK,
+            KIT_SNARE,
+            KIT_CLOSED_HAT,
+            KIT_OPEN_HAT,
+            KIT_CLAP,
+            KIT_LOW_TOM,
+            KIT_MID_TOM,
+            KIT_HIGH_TOM,
+            KIT_NUM_VOICES,
+        };
+
+        // A full drum kit. The noise is rendered once per block for all the
+        // voices, and idle voices cost nothing.
+        class Kit {
+        public:
+            Kit();
+
+            void on(KitVoice voice, int16_t velocity);
+            bool active() const;
+
+            void render(MonoBuffer &buffer);
+
+            WaveformKick &kick() { return kick_; }
+            Snare &snare() { return snare_; }
+            HiHat &hiHat() { return hi_hat_; }
+            Clap &clap() { return clap_; }
+            Tom &tom(uint8_t index) { return toms_[index % 3]; }
+
+        private:
+            Random random_;
+            MonoBuffer noise_;
+
+            // Output of each voice, for the mix
+            MonoBuffer kick_out_;
+            MonoBuffer snare_out_;
+            MonoBuffer hi_hat_out_;
+            MonoBuffer clap_out_;
+            MonoBuffer toms_out_[3];
+
+            WaveformKick kick_;
+            uint8_t kick_key_ = 36;
+            Snare snare_;
+            HiHat hi_hat_;
+            Clap clap_;
+            Tom toms_[3];
+        };
+    }
+}
@@ -4,6 +4,7 @@
 #include "fixdsp.h"
 #include "envelope-ar.h"
 #include "phase.h"
+#include "drum-drive.h"
 
 namespace fixdsp {
     namespace drum {
@@ -15,10 +16,12 @@ namespace fixdsp {
                 env_.setAttackTimeRange (envelope::S_QUARTER_SECOND);
                 env_.setAttack(0);
                 env_.setReleaseTimeRange (envelope::S_2_SECONDS);
+                setDecay(MAX_PARAM / 4);
             }
             void setDecay(int16_t decay) {
                 if (decay < 0) decay = 0;
                 decay_ = decay;
+                env_.setRelease(decay_);
             }
             void setPunch(int16_t punch) {
                 phase_decay_.setPunch(punch);
@@ -35,6 +38,10 @@ namespace fixdsp {
                 phase_decay_.on(key);
             }
 
+            bool active() const {
+                return env_.segment() != envelope::ENV_SEGMENT_DEAD;
+            }
+
             void setWaveformData(const WaveformData &waveform_data) {
                 waveform_data_ = &waveform_data;
             }
@@ -48,6 +55,7 @@ namespace fixdsp {
 
                 Interpolate824(waveform_data_->data(), phase_buf, buffer);
                 modulate(buffer, env_buffer);
+                drive(buffer, drive_);
             }
 
         private:
@@ -57,8 +65,8 @@ namespace fixdsp {
 
             phase::PitchDecay phase_decay_;
 
-            int16_t decay_;
-            int16_t drive_;
+            int16_t decay_ = 0;
+            int16_t drive_ = 0;
 
         };
     }
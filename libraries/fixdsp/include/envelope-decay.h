@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include "fixdsp.h"
+#include "envelope-ar.h"
+#include "resources.h"
+
+namespace fixdsp {
+    namespace envelope {
+
+        // Instant attack and exponential decay, for percussions. Cheaper
+        // than AR: one multiply per sample and no curve lookup.
+        class Decay {
+        public:
+            Decay() {
+                updateCoefficient();
+            }
+
+            inline void setTimeRange(SegmentTime time) {
+                time_ = time;
+                updateCoefficient();
+            }
+
+            // Time to -60 dB, over the time range
+            inline void setDecay(int16_t decay) {
+                if (decay < 0) decay = 0;
+                decay_ = decay;
+                updateCoefficient();
+            }
+
+            inline void on(int16_t velocity) {
+                if (velocity < 0) velocity = 0;
+                value_ = static_cast<uint32_t>(velocity) << 16;
+            }
+
+            inline bool active() const { return value_ != 0; }
+
+            inline __attribute__((always_inline)) uint16_t render() {
+                value_ -= (value_ >> 16) * coefficient_;
+                if (value_ < kFloor) {
+                    value_ = 0;
+                }
+                return value_ >> 16;
+            }
+
+        private:
+            // Below 1 LSB, the decrement rounds to 0
+            static const uint32_t kFloor = 1 << 16;
+
+            inline void updateCoefficient() {
+                // The AR increment tables give the segment length T, the
+                // value is multiplied by (1 - 6.9 / T) every sample.
+                const uint32_t *increments;
+
+                switch (time_) {
+                  case S_10_SECONDS:
+                    increments = lut_env_increments_10seconds;
+                    break;
+                  case S_5_SECONDS:
+                    increments = lut_env_increments_5seconds;
+                    break;
+                  case S_2_SECONDS:
+                    increments = lut_env_increments_2seconds;
+                    break;
+                  case S_1_SECONDS:
+                    increments = lut_env_increments_1seconds;
+                    break;
+                  case S_HALF_SECOND:
+                    increments = lut_env_increments_half_second;
+                    break;
+                  default:
+                    increments = lut_env_increments_quarter_second;
+                }
+
+                const uint64_t increment = increments[decay_ >> 8];
+                uint32_t coefficient = (increment * 452198) >> 32;
+
+                if (coefficient < 1) coefficient = 1;
+                if (coefficient > 65535) coefficient = 65535;
+                coefficient_ = coefficient;
+            }
+
+            SegmentTime time_ = S_1_SECONDS;
+            int16_t decay_ = MAX_PARAM / 2;
+            uint32_t coefficient_ = 1;
+
+            // Q16
+            uint32_t value_ = 0;
+        };
+    }
+}
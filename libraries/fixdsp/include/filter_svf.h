@@ -22,6 +22,20 @@ namespace fixdsp {
             void setMode(SvfMode mode);
             void process(MonoBuffer &buffer);
 
+            // Sample by sample processing, prepare() once per block first.
+            // Same filter as the block version up to the rounding, with bp
+            // expanded so that lp and bp only depend on the previous state:
+            //   bp += f * (sample - lp) - (f * damp + f * f) * bp
+            // One multiply on the feedback path instead of two.
+            void prepare();
+            inline __attribute__((always_inline)) int16_t process(int32_t sample) {
+                const int32_t lp = clip(lp_ + (f_ * bp_ >> 15));
+                const int32_t hp = sample - (bp_ * damp_ >> 15) - lp;
+                bp_ = clip(bp_ + (f_ * (sample - lp_) >> 15) - (feedback_ * bp_ >> 15));
+                lp_ = lp;
+                return mode_ == SVF_MODE_BP ? bp_ : (mode_ == SVF_MODE_HP ? clip(hp) : lp_);
+            }
+
         private:
             bool dirty_ = true;
   
@@ -30,6 +44,7 @@ namespace fixdsp {
             
             int32_t f_;
             int32_t damp_;
+            int32_t feedback_; // f * damp + f * f, for process(int32_t)
           
             int32_t lp_ = 0;
             int32_t bp_ = 0;
@@ -41,6 +41,9 @@ namespace fixdsp {
 
     inline int16_t keyToPitch(uint8_t key);
 
+    inline int16_t clip(int32_t a)
+      __attribute__((always_inline));
+
     inline int16_t Interpolate824(const int16_t* table, uint32_t phase)
       __attribute__((always_inline));
 
@@ -0,0 +1,17 @@
+// This file is generated by mipmaps_compiler.py, do not edit
+#pragma once
+
+#include "fixdsp.h"
+
+namespace fixdsp {
+    namespace mipmap {
+
+        using MipmapData = std::array<int16_t, 1025>;
+
+        const uint8_t kLevels = 10;
+
+        extern const MipmapData saw[kLevels];
+        extern const MipmapData square[kLevels];
+        extern const MipmapData pulse_25[kLevels];
+    }
+}
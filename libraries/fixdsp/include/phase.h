@@ -119,7 +119,7 @@ namespace fixdsp {
                 phase_increment_ = ComputePhaseIncrement(pitch);
             }
 
-            inline uint32_t phaseRender() {
+            inline __attribute__((always_inline)) uint32_t phaseRender() {
                 phase_ += phase_increment_;
                 return phase_;
             }
@@ -171,7 +171,7 @@ namespace fixdsp {
                 }
             }
 
-            inline uint32_t phaseRender() {
+            inline __attribute__((always_inline)) uint32_t phaseRender() {
 
                 if (phase_increment_ > target_phase_increment_) {
                     phase_increment_ -= phase_incr_delta_;
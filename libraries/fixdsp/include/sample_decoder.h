@@ -0,0 +1,64 @@
+#pragma once
+
+#include "fixdsp.h"
+
+namespace fixdsp {
+    namespace sample {
+
+        // Sample formats, see scripts/samples_compiler.py
+        enum Format : uint8_t {
+            // Signed 8-bit PCM, 1 byte per sample
+            FORMAT_S8,
+            // G.711 mu-law, 1 byte per sample (14-bit dynamic range)
+            FORMAT_MU_LAW,
+            // IMA ADPCM, 4 bits per sample. Each block starts with a 4 bytes
+            // header: predictor (int16_t, little-endian), step index, 0.
+            // Samples follow, low nibble first.
+            FORMAT_IMA_ADPCM,
+        };
+
+        // Compiled sample, stored in flash. The data is a sequence of blocks
+        // of block_bytes, each decoding to block_samples samples (the last
+        // block is padded).
+        struct SampleData {
+            Format format;
+            uint32_t sample_rate;
+            uint32_t length;        // Samples
+            uint32_t block_samples;
+            uint32_t block_bytes;
+            const uint8_t *data;
+        };
+
+        // Decodes a sample into MonoBuffers, block by block. ADPCM blocks
+        // can be decoded independently thanks to their header, so seeking
+        // only decodes from the start of a block.
+        class Decoder {
+        public:
+            Decoder() {}
+
+            void setData(const SampleData &data);
+            void seek(uint32_t position);
+
+            uint32_t position() const { return position_; }
+            bool done() const {
+                return data_ == nullptr || position_ >= data_->length;
+            }
+
+            // Decodes the next samples of the buffer, silence after the end.
+            // Returns the number of samples decoded.
+            uint32_t render(MonoBuffer &buffer);
+            uint32_t decode(int16_t *output, uint32_t count);
+
+        private:
+            void startBlock();
+            void decodeRun(int16_t *output, uint32_t offset, uint32_t count);
+
+            const SampleData *data_ = nullptr;
+            uint32_t position_ = 0;
+
+            // ADPCM state at position_
+            int32_t predictor_ = 0;
+            int32_t step_index_ = 0;
+        };
+    }
+}
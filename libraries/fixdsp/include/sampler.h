@@ -0,0 +1,97 @@
+#pragma once
+
+#include "fixdsp.h"
+#include "envelope-ar.h"
+#include "phase.h"
+#include "sample_decoder.h"
+
+namespace fixdsp {
+    namespace sampler {
+
+        enum SourceFormat {
+            SOURCE_S8,
+            SOURCE_U8,  // 8-bit WAV data, 128 is zero
+            SOURCE_S16,
+        };
+
+        // Sample to play, in flash or RAM. It plays at its own rate on the
+        // root key, whatever FIXDSP_SAMPLE_RATE is.
+        struct Source {
+            const void *data;
+            SourceFormat format;
+            uint32_t length;       // Samples
+            uint32_t sample_rate;
+            uint8_t root_key;
+            // Loops between loop_start and loop_end (excluded) when
+            // loop_end > loop_start
+            uint32_t loop_start;
+            uint32_t loop_end;
+        };
+
+        enum Interpolation {
+            INTERPOLATION_LINEAR,
+            INTERPOLATION_HERMITE, // 4-point, 3rd order
+        };
+
+        enum Mode {
+            // Plays the whole sample, off() and the loop points are ignored
+            MODE_ONE_SHOT,
+            // Loops until off(), then the envelope releases
+            MODE_GATED,
+        };
+
+        class Voice {
+        public:
+            Voice() {
+                env_.setAttack(0);
+                env_.setAttackTimeRange(envelope::S_QUARTER_SECOND);
+                env_.setRelease(MAX_PARAM / 2);
+                env_.setReleaseTimeRange(envelope::S_1_SECONDS);
+            }
+
+            void setSource(const Source &source);
+            // Compiled sample (scripts/samples_compiler.py), played in place.
+            // Only FORMAT_S8 has random access: returns false for the other
+            // formats, decode them to RAM with sample::Decoder and play that
+            // as SOURCE_S16.
+            bool setSource(const sample::SampleData &data, uint8_t root_key = 60);
+            void setInterpolation(Interpolation interpolation) {
+                interpolation_ = interpolation;
+            }
+            void setMode(Mode mode);
+
+            void setKey(uint8_t key) { setPitch(keyToPitch(key)); }
+            void setPitch(int16_t pitch);
+
+            // Attack, release and curves of the amplitude envelope
+            envelope::AR &envelope() { return env_; }
+
+            void on(uint8_t key, int16_t velocity);
+            void off();
+            bool active() const { return playing_; }
+
+            void render(MonoBuffer &buffer);
+
+        private:
+            template<typename T>
+            uint32_t renderSamples(const T *data, int16_t *output, uint32_t len);
+
+            template<typename T>
+            inline int32_t at(const T *data, int32_t index) const;
+
+            const Source *source_ = nullptr;
+            Source data_source_ = {};  // Source of a SampleData
+            Interpolation interpolation_ = INTERPOLATION_LINEAR;
+            Mode mode_ = MODE_ONE_SHOT;
+            envelope::AR env_;
+
+            bool playing_ = false;
+            bool looping_ = false;
+            int16_t pitch_ = 60 << 7;
+
+            // Position and increment in samples of the source, Q32.32
+            uint64_t position_ = 0;
+            uint64_t increment_ = 0;
+        };
+    }
+}
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+#
+# Generates the band-limited mip-map tables of
+# fixdsp::oscillator::BandLimitedOscillator.
+#
+#   mipmaps_compiler.py
+#
+# Writes ../include/mipmaps.h and ../fixdsp-mipmaps.cpp. Level l of a
+# waveform holds its first 2^l harmonics, so it does not alias below
+# f / sample_rate = 1 / 2^(l + 1). The levels are selected from the phase
+# increment, the tables do not depend on the sample rate.
+#
+# The tables have 1024 points (+ 1 for the interpolation), with 256 points
+# the images of the linear interpolation alias at low pitches.
+
+import math
+import os
+
+TABLE_SIZE = 1024
+LEVELS = 10
+AMPLITUDE = 32766
+
+
+def saw(n, t):
+  # Rising ramp, -1 at t = 0
+  return -2.0 / math.pi * math.sin(2 * math.pi * n * t) / n
+
+
+def pulse(duty):
+  def harmonic(n, t):
+    return 2.0 / (n * math.pi) * math.sin(n * math.pi * duty) * \
+        math.cos(2 * math.pi * n * (t - duty / 2.0))
+  return harmonic
+
+
+WAVEFORMS = [
+    ('saw', saw),
+    ('square', pulse(0.5)),
+    ('pulse_25', pulse(0.25)),
+]
+
+
+def mip_chain(harmonic):
+  """Returns the LEVELS tables of TABLE_SIZE + 1 values."""
+  chain = []
+  for level in range(LEVELS):
+    table = []
+    for i in range(TABLE_SIZE):
+      t = i / float(TABLE_SIZE)
+      table.append(sum(harmonic(n, t) for n in range(1, 2 ** level + 1)))
+    chain.append(table)
+
+  # One scale for the whole chain, so that the levels crossfade without a
+  # change of loudness
+  peak = max(max(abs(v) for v in table) for table in chain)
+  return [[int(round(v / peak * AMPLITUDE)) for v in table + table[:1]]
+          for table in chain]
+
+
+def main():
+  root = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+  generated = '// This file is generated by mipmaps_compiler.py, do not edit\n'
+
+  with open(os.path.join(root, 'include', 'mipmaps.h'), 'w') as h:
+    h.write(generated)
+    h.write('#pragma once\n\n#include "fixdsp.h"\n\n')
+    h.write('namespace fixdsp {\n    namespace mipmap {\n\n')
+    h.write('        using MipmapData = std::array<int16_t, %d>;\n\n'
+            % (TABLE_SIZE + 1))
+    h.write('        const uint8_t kLevels = %d;\n\n' % LEVELS)
+    for name, _ in WAVEFORMS:
+      h.write('        extern const MipmapData %s[kLevels];\n' % name)
+    h.write('    }\n}\n')
+
+  with open(os.path.join(root, 'fixdsp-mipmaps.cpp'), 'w') as c:
+    c.write(generated)
+    c.write('#include "mipmaps.h"\n\n')
+    c.write('namespace fixdsp {\n    namespace mipmap {\n')
+    for name, harmonic in WAVEFORMS:
+      c.write('\n        const MipmapData %s[kLevels] = {\n' % name)
+      for level, table in enumerate(mip_chain(harmonic)):
+        c.write('            // %d harmonic%s\n            {{\n'
+                % (2 ** level, 's' if level else ''))
+        for i in range(0, len(table), 8):
+          c.write('                %s,\n'
+                  % ', '.join('%6d' % v for v in table[i:i + 8]))
+        c.write('            }},\n')
+      c.write('        };\n')
+    c.write('    }\n}\n')
+
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+#
+# Compiles WAV files into const sample arrays for fixdsp::sample::Decoder.
+#
+#   samples_compiler.py [--format adpcm|mulaw|s8] [--block 256] [--prefix smp_]
+#                       OUTPUT_STEM file.wav [file.wav ...]
+#
+# Writes OUTPUT_STEM.h and OUTPUT_STEM.cpp with one fixdsp::sample::SampleData
+# per WAV file, named smp_<file stem> (--prefix changes smp_). The arrays are const, so they stay in
+# flash. Multi-channel files are mixed down to mono, 8-bit (unsigned) and
+# 16-bit files are supported. Files are not resampled (see
+# drum_samples/convert_samples_to_raw.sh).
+#
+# Sizes for 16-bit input: s8 and mu-law are 2x smaller, IMA ADPCM is 3.9x
+# smaller (4 bits per sample plus a 4 bytes header per block).
+
+import argparse
+import os
+import re
+import struct
+import sys
+import wave
+
+FORMATS = {
+    's8': 'FORMAT_S8',
+    'mulaw': 'FORMAT_MU_LAW',
+    'adpcm': 'FORMAT_IMA_ADPCM',
+}
+
+IMA_STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34,
+    37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+    157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494,
+    544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552,
+    1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428,
+    4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+    12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086,
+    29794, 32767
+]
+
+IMA_INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def read_wav(path):
+  """Returns (sample rate, mono 16-bit samples)."""
+  with wave.open(path, 'rb') as w:
+    channels = w.getnchannels()
+    width = w.getsampwidth()
+    rate = w.getframerate()
+    frames = w.readframes(w.getnframes())
+
+  if width == 1:
+    values = [(b - 128) << 8 for b in frames]
+  elif width == 2:
+    values = list(struct.unpack('<%dh' % (len(frames) // 2), frames))
+  else:
+    sys.exit('%s: unsupported sample width %d' % (path, width))
+
+  mono = []
+  for i in range(0, len(values), channels):
+    mono.append(sum(values[i:i + channels]) // channels)
+  return rate, mono
+
+
+def encode_s8(samples):
+  return bytes((s >> 8) & 0xFF for s in samples)
+
+
+def encode_mu_law(samples):
+  out = bytearray()
+  for s in samples:
+    sign = 0x80 if s < 0 else 0
+    magnitude = min(abs(s), 32635) + 0x84
+    exponent = 7
+    while exponent > 0 and not magnitude & (0x4000 >> (7 - exponent)):
+      exponent -= 1
+    mantissa = (magnitude >> (exponent + 3)) & 0x0F
+    out.append(~(sign | (exponent << 4) | mantissa) & 0xFF)
+  return bytes(out)
+
+
+def clip(value):
+  return max(-32768, min(32767, value))
+
+
+def encode_adpcm_block(samples, predictor, index):
+  """Encodes a block, returns (bytes, predictor, index) of the decoder."""
+  out = bytearray(struct.pack('<hBB', predictor, index, 0))
+  nibbles = []
+  for s in samples:
+    step = IMA_STEP_TABLE[index]
+    delta = s - predictor
+    code = 8 if delta < 0 else 0
+    delta = abs(delta)
+    if delta >= step:
+      code |= 4
+      delta -= step
+    if delta >= step >> 1:
+      code |= 2
+      delta -= step >> 1
+    if delta >= step >> 2:
+      code |= 1
+
+    # Track the decoder output, not the input
+    diff = step >> 3
+    if code & 4:
+      diff += step
+    if code & 2:
+      diff += step >> 1
+    if code & 1:
+      diff += step >> 2
+    predictor = clip(predictor - diff if code & 8 else predictor + diff)
+    index = max(0, min(88, index + IMA_INDEX_TABLE[code]))
+    nibbles.append(code)
+
+  for i in range(0, len(nibbles), 2):
+    out.append(nibbles[i] | (nibbles[i + 1] << 4))
+  return bytes(out), predictor, index
+
+
+def encode(samples, fmt, block):
+  """Returns (data, block bytes), the last block is padded with silence."""
+  padded = samples + [0] * (-len(samples) % block)
+  if fmt == 's8':
+    return encode_s8(padded), block
+  if fmt == 'mulaw':
+    return encode_mu_law(padded), block
+
+  data = bytearray()
+  predictor, index = 0, 0
+  for i in range(0, len(padded), block):
+    encoded, predictor, index = encode_adpcm_block(
+        padded[i:i + block], predictor, index)
+    data += encoded
+  return bytes(data), 4 + block // 2
+
+
+def variable_name(path, prefix):
+  stem = os.path.splitext(os.path.basename(path))[0]
+  return prefix + re.sub(r'\W', '_', stem)
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__)
+  parser.add_argument('--format', choices=sorted(FORMATS), default='adpcm')
+  parser.add_argument('--block', type=int, default=256,
+                      help='samples per block (even)')
+  parser.add_argument('--prefix', default='smp_',
+                      help='prefix of the variable names')
+  parser.add_argument('output')
+  parser.add_argument('wav', nargs='+')
+  args = parser.parse_args()
+
+  if args.block <= 0 or args.block % 2:
+    sys.exit('the block size must be even')
+
+  header = args.output + '.h'
+  source = args.output + '.cpp'
+  generated = '// This file is generated by samples_compiler.py, do not edit\n'
+
+  with open(header, 'w') as h, open(source, 'w') as c:
+    h.write(generated)
+    h.write('#pragma once\n\n#include "sample_decoder.h"\n\n')
+    h.write('namespace fixdsp {\n    namespace samples {\n')
+
+    c.write(generated)
+    c.write('#include "%s"\n\n' % os.path.basename(header))
+    c.write('namespace fixdsp {\n    namespace samples {\n')
+
+    for path in args.wav:
+      rate, samples = read_wav(path)
+      data, block_bytes = encode(samples, args.format, args.block)
+      name = variable_name(path, args.prefix)
+
+      h.write('        extern const sample::SampleData %s;\n' % name)
+
+      c.write('\n        // %s: %d samples at %d Hz, %d bytes\n'
+              % (os.path.basename(path), len(samples), rate, len(data)))
+      c.write('        static const uint8_t %s_data[] '
+              '__attribute__((aligned(4))) = {\n' % name)
+      for i in range(0, len(data), 16):
+        c.write('            %s,\n' % ', '.join(str(b) for b in data[i:i + 16]))
+      c.write('        };\n\n')
+      c.write('        const sample::SampleData %s = {\n' % name)
+      c.write('            sample::%s, %d, %d, %d, %d, %s_data\n'
+              % (FORMATS[args.format], rate, len(samples), args.block,
+                 block_bytes, name))
+      c.write('        };\n')
+
+    h.write('    }\n}\n')
+    c.write('    }\n}\n')
+
+
+if __name__ == '__main__':
+  main()
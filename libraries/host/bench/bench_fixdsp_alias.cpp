@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Aliasing of the naive wavetable oscillator against the mip-mapped
+// band-limited one, per key.
+//
+// Each oscillator renders 64k samples at FIXDSP_SAMPLE_RATE, windowed with a
+// 4-term Blackman-Harris. The FFT bins within a few bins of a harmonic of f0
+// below Nyquist count as harmonics, all the others as aliases (folded
+// harmonics and quantization noise). The table gives the alias to harmonic
+// power in dB, the sine line is the floor of the wavetables.
+//
+// The program fails if a band-limited wave gets above NN_BENCH_MAX_ALIAS_DB
+// or does not beat the naive one, so it also runs with ctest.
+
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <utility>
+#include <vector>
+#include "bandlimited_oscillator.h"
+#include "waveform_oscillator.h"
+
+using namespace fixdsp;
+
+#define NN_BENCH_FFT_LEN 65536
+#define NN_BENCH_HARMONIC_BINS 6
+#define NN_BENCH_MAX_ALIAS_DB -50.0
+
+static const uint8_t keys[] = {36, 48, 60, 72, 84, 96, 108};
+
+typedef std::vector<std::complex<double>> spectrum;
+
+// In place radix-2
+static void fft(spectrum &a) {
+    const size_t n = a.size();
+
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(a[i], a[j]);
+        }
+    }
+
+    for (size_t len = 2; len <= n; len <<= 1) {
+        const double angle = -2 * M_PI / len;
+        const std::complex<double> step(cos(angle), sin(angle));
+
+        for (size_t i = 0; i < n; i += len) {
+            std::complex<double> w(1);
+            for (size_t j = 0; j < len / 2; j++) {
+                const auto u = a[i + j];
+                const auto v = a[i + j + len / 2] * w;
+                a[i + j] = u + v;
+                a[i + j + len / 2] = u - v;
+                w *= step;
+            }
+        }
+    }
+}
+
+static double key_frequency(uint8_t key) {
+    return phase::ComputePhaseIncrement(key * 128) * (double)FIXDSP_SAMPLE_RATE
+           / 4294967296.0;
+}
+
+template <class Osc> static double alias_db(Osc &osc, uint8_t key) {
+    const double rate = FIXDSP_SAMPLE_RATE;
+    const double f0 = key_frequency(key);
+    const double bin = rate / NN_BENCH_FFT_LEN;
+    spectrum a(NN_BENCH_FFT_LEN);
+    MonoBuffer buf;
+
+    osc.setKey(key);
+
+    // Let the glide and the mip level crossfade settle
+    for (int n = 0; n < 4; n++) {
+        osc.render(buf);
+    }
+
+    for (size_t i = 0; i < a.size();) {
+        osc.render(buf);
+        for (auto s : buf.getBufferContainer()[0]) {
+            if (i == a.size()) {
+                break;
+            }
+            const double t = 2 * M_PI * i / a.size();
+            a[i++] = s * (0.35875 - 0.48829 * cos(t) + 0.14128 * cos(2 * t)
+                          - 0.01168 * cos(3 * t));
+        }
+    }
+    fft(a);
+
+    double harmonics = 0;
+    double aliases = 0;
+    for (size_t k = 1; k < a.size() / 2; k++) {
+        const double f = k * bin;
+        const double n = std::round(f / f0);
+
+        if (n >= 1 && n * f0 < rate / 2 &&
+            std::fabs(f - n * f0) <= NN_BENCH_HARMONIC_BINS * bin) {
+            harmonics += std::norm(a[k]);
+        } else {
+            aliases += std::norm(a[k]);
+        }
+    }
+    return 10 * log10(aliases / harmonics);
+}
+
+static double naive_db(const WaveformData &waveform, uint8_t key) {
+    oscillator::WaveformOscillator osc;
+
+    osc.setWaveformData(waveform);
+    return alias_db(osc, key);
+}
+
+static double bandlimited_db(oscillator::BandLimitedShape shape, uint8_t key) {
+    oscillator::BandLimitedOscillator osc;
+
+    osc.setShape(shape);
+    return alias_db(osc, key);
+}
+
+// The naive level is 0 when there is no naive counterpart
+static bool check(const char *name, uint8_t key, double bl, double naive) {
+    if (bl > NN_BENCH_MAX_ALIAS_DB || bl >= naive) {
+        printf("FAIL: %s key %d: %.1f dB (naive %.1f dB)\n", name, key, bl,
+               naive);
+        return false;
+    }
+    return true;
+}
+
+int main(void) {
+    oscillator::WaveformOscillator sine;
+    bool ok = true;
+
+    printf("Alias to harmonic power in dB, %d Hz, %d-point FFT\n",
+           FIXDSP_SAMPLE_RATE, NN_BENCH_FFT_LEN);
+    printf("sine floor (key 36): %.1f\n\n", alias_db(sine, 36));
+    printf("key   f0 (Hz)  saw   bl saw  pulse25  bl pulse25  bl square\n");
+
+    for (const uint8_t key : keys) {
+        const double saw = naive_db(wav_sawtooth, key);
+        const double bl_saw = bandlimited_db(oscillator::SHAPE_SAW, key);
+        const double pulse = naive_db(wav_chip_pulse_25, key);
+        const double bl_pulse = bandlimited_db(oscillator::SHAPE_PULSE_25, key);
+        const double bl_square = bandlimited_db(oscillator::SHAPE_SQUARE, key);
+
+        printf("%3d %9.1f %6.1f %8.1f %8.1f %11.1f %10.1f\n", key,
+               key_frequency(key), saw, bl_saw, pulse, bl_pulse, bl_square);
+
+        ok &= check("saw", key, bl_saw, saw);
+        ok &= check("pulse25", key, bl_pulse, pulse);
+        ok &= check("square", key, bl_square, 0);
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Cost of the full drum::Kit against a single WaveformKick.
+//
+// Both render blocks with every voice retriggered often enough to never go
+// idle, so the kit runs its eight voices on each block. The kick and the kit
+// take turns for NN_BENCH_RUNS runs of NN_BENCH_BLOCKS blocks, and each
+// keeps its best run, to leave out the scheduling and frequency changes of
+// the host.
+//
+// The program fails if the kit costs NN_BENCH_MAX_KIT_RATIO kicks or more,
+// so it also runs with ctest.
+
+#include <chrono>
+#include <cstdio>
+#include "drum-voices.h"
+
+using namespace fixdsp;
+
+#define NN_BENCH_BLOCKS 256
+#define NN_BENCH_RUNS 200
+#define NN_BENCH_RETRIGGER_BLOCKS 256
+#define NN_BENCH_MAX_KIT_RATIO 8.0
+
+static volatile int32_t sink;
+
+static void consume(MonoBuffer &buf) {
+    int32_t sum = 0;
+
+    for (auto s : buf.getBufferContainer()[0]) {
+        sum += s;
+    }
+    sink = sink + sum;
+}
+
+// Fails if a voice went idle
+static bool render_kick(drum::WaveformKick &kick, int n) {
+    MonoBuffer buf;
+
+    if (n % NN_BENCH_RETRIGGER_BLOCKS == 0) {
+        kick.on(36, MAX_PARAM);
+    }
+    if (!kick.active()) {
+        return false;
+    }
+    kick.render(buf);
+    consume(buf);
+    return true;
+}
+
+static bool render_kit(drum::Kit &kit, int n) {
+    MonoBuffer buf;
+
+    if (n % NN_BENCH_RETRIGGER_BLOCKS == 0) {
+        // The open hat after the closed one, which chokes it
+        for (int v = 0; v < drum::KIT_NUM_VOICES; v++) {
+            kit.on(static_cast<drum::KitVoice>(v), MAX_PARAM);
+        }
+    }
+    if (!kit.kick().active() || !kit.snare().active() ||
+        !kit.hiHat().active() || !kit.clap().active() ||
+        !kit.tom(0).active() || !kit.tom(1).active() ||
+        !kit.tom(2).active()) {
+        return false;
+    }
+    kit.render(buf);
+    consume(buf);
+    return true;
+}
+
+// Time of a run in ns per block, negative if a voice went idle
+template <class Voice>
+static double run_ns(Voice &voice, bool (*render)(Voice &, int)) {
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int n = 0; n < NN_BENCH_BLOCKS; n++) {
+        if (!render(voice, n)) {
+            return -1;
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           NN_BENCH_BLOCKS;
+}
+
+int main(void) {
+    drum::WaveformKick kick_voice;
+    drum::Kit kit_voice;
+    double kick = 0;
+    double kit = 0;
+
+    kick_voice.setDecay(MAX_PARAM);
+    kit_voice.kick().setDecay(MAX_PARAM);
+    kit_voice.snare().setDecay(MAX_PARAM);
+    kit_voice.hiHat().setClosedDecay(MAX_PARAM);
+    kit_voice.hiHat().setOpenDecay(MAX_PARAM);
+    kit_voice.clap().setDecay(MAX_PARAM);
+    for (uint8_t i = 0; i < 3; i++) {
+        kit_voice.tom(i).setDecay(MAX_PARAM);
+    }
+
+    for (int run = 0; run < NN_BENCH_RUNS; run++) {
+        const double kick_run = run_ns(kick_voice, render_kick);
+        const double kit_run = run_ns(kit_voice, render_kit);
+
+        if (kick_run < 0 || kit_run < 0) {
+            printf("FAIL: a voice went idle, retrigger more often\n");
+            return 1;
+        }
+        if (run == 0 || kick_run < kick) {
+            kick = kick_run;
+        }
+        if (run == 0 || kit_run < kit) {
+            kit = kit_run;
+        }
+    }
+
+    printf("ns per %d-sample block at %d Hz, best of %d runs of %d blocks\n",
+           FIXDSP_BUFFER_LEN, FIXDSP_SAMPLE_RATE, NN_BENCH_RUNS,
+           NN_BENCH_BLOCKS);
+    printf("kick %8.1f\n", kick);
+    printf("kit  %8.1f\n", kit);
+
+    const double ratio = kit / kick;
+    printf("kit / kick: %.2f (max %.1f)\n", ratio, NN_BENCH_MAX_KIT_RATIO);
+    if (ratio >= NN_BENCH_MAX_KIT_RATIO) {
+        printf("FAIL: the kit costs %.2f kicks\n", ratio);
+        return 1;
+    }
+    return 0;
+}
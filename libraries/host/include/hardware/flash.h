@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file flash.h
+ * @brief Host replacement for hardware/flash.h, implemented in pico_host.c.
+ *
+ * The flash is a memory area of PICO_FLASH_SIZE_BYTES, mapped at XIP_BASE.
+ * It keeps the NOR flash semantic: erase sets a sector to 0xFF, program can
+ * only clear bits. With NN_HOST_FLASH set to a file path, the flash content
+ * is stored in that file and persists across runs.
+ */
+
+#pragma once
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FLASH_PAGE_SIZE (1u << 8)
+#define FLASH_SECTOR_SIZE (1u << 12)
+
+#ifndef PICO_FLASH_SIZE_BYTES
+#define PICO_FLASH_SIZE_BYTES (16 * 1024 * 1024)
+#endif
+
+/** Address of the emulated flash, instead of 0x10000000 */
+#define XIP_BASE ((uintptr_t)pico_host_flash_memory())
+
+uint8_t *pico_host_flash_memory(void);
+
+void flash_range_erase(uint32_t flash_offs, size_t count);
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file sync.h
+ * @brief Host replacement for hardware/sync.h, implemented in pico_host.c.
+ *
+ * __sev() and __wfe() emulate the per-core event register of the Cortex-M0+.
+ */
+
+#pragma once
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void __sev(void);
+void __wfe(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file flash.h
+ * @brief Host replacement for pico/flash.h.
+ *
+ * The emulated flash does not stop the execution, the function is called
+ * directly.
+ */
+
+#pragma once
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef PICO_OK
+#define PICO_OK 0
+#endif
+
+static inline int flash_safe_execute(void (*func)(void *), void *param,
+                                     uint32_t enter_exit_timeout_ms) {
+    (void)enter_exit_timeout_ms;
+    func(param);
+    return PICO_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
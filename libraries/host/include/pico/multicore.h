@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file multicore.h
+ * @brief Host replacement for pico/multicore.h, implemented in pico_host.c.
+ *
+ * Core 1 is a thread. Like on the RP2040, each direction of the inter-core
+ * FIFO holds 8 words. Every thread other than core 1 (main, audio and MIDI
+ * emulation) is considered to run on core 0.
+ */
+
+#pragma once
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void multicore_launch_core1(void (*entry)(void));
+void multicore_reset_core1(void);
+
+bool multicore_fifo_rvalid(void);
+bool multicore_fifo_wready(void);
+void multicore_fifo_push_blocking(uint32_t data);
+uint32_t multicore_fifo_pop_blocking(void);
+void multicore_fifo_drain(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file stdlib.h
+ * @brief Host replacement for the subset of pico/stdlib.h used by the SDK
+ * and examples, implemented in pico_host.c.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef unsigned int uint;
+
+bool stdio_init_all(void);
+
+void sleep_ms(uint32_t ms);
+void sleep_us(uint64_t us);
+void busy_wait_us(uint64_t us);
+void busy_wait_at_least_cycles(uint32_t cycles);
+
+uint32_t time_us_32(void);
+uint64_t time_us_64(void);
+
+typedef uint64_t absolute_time_t;
+
+static inline absolute_time_t from_us_since_boot(uint64_t us) {
+    return us;
+}
+
+static inline uint64_t to_us_since_boot(absolute_time_t t) {
+    return t;
+}
+
+bool best_effort_wfe_or_timeout(absolute_time_t timeout_timestamp);
+
+static inline void tight_loop_contents(void) {}
+
+/* All the code is in RAM on the host */
+#define __not_in_flash_func(func_name) func_name
+#define __no_inline_not_in_flash_func(func_name) func_name
+
+uint get_core_num(void);
+
+#ifdef __cplusplus
+}
+#endif
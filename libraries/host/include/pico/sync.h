@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file sync.h
+ * @brief Host replacement for the critical sections of pico/sync.h.
+ *
+ * A critical section is a mutex, interrupt handlers and cores are threads on
+ * the host.
+ */
+
+#pragma once
+#include <pthread.h>
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct critical_section {
+    pthread_mutex_t mutex;
+} critical_section_t;
+
+static inline void critical_section_init(critical_section_t *crit_sec) {
+    pthread_mutex_init(&crit_sec->mutex, NULL);
+}
+
+static inline void critical_section_enter_blocking(critical_section_t *crit_sec) {
+    pthread_mutex_lock(&crit_sec->mutex);
+}
+
+static inline void critical_section_exit(critical_section_t *crit_sec) {
+    pthread_mutex_unlock(&crit_sec->mutex);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,513 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "pico/stdlib.h"
+#include "noise_nugget_host.h"
+
+// Same fallback buffers as the device implementation
+#define DUMMY_AUDIO_BUFFER_SIZE 256
+static const uint32_t zeroes_audio_buffer[DUMMY_AUDIO_BUFFER_SIZE] = {0x0};
+static uint32_t dev_null_audio_buffer[DUMMY_AUDIO_BUFFER_SIZE] = {0x0};
+
+typedef struct dma_emu {
+    audio_cb_t callback;
+    uint32_t *buffer;   // Buffer of the transfer in progress
+    uint32_t count;     // Stereo points in the transfer
+    uint32_t pos;       // Stereo points already transferred
+    bool gap;           // Transfer in progress uses the fallback buffer
+} dma_emu;
+
+static nn_host_audio_config g_config = {NULL, NULL, true, true};
+
+static dma_emu g_out = {0};
+static dma_emu g_in = {0};
+static nn_host_audio_stats g_stats = {0};
+static uint32_t g_sample_rate = 0;
+static nn_clock_plan g_clock_plan = {0};
+static bool g_running = false;
+static bool g_atexit_registered = false;
+
+static FILE *g_wav = NULL;
+static FILE *g_input = NULL;
+
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_t g_thread;
+static bool g_thread_started = false;
+static volatile bool g_thread_stop = false;
+
+/*******************/
+/* WAV file output */
+/*******************/
+
+static void put_le(uint8_t *dst, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        dst[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+static void wav_write_header(FILE *f, uint32_t sample_rate, uint32_t frames) {
+    uint8_t h[44];
+    const uint32_t data_size = frames * 4;
+
+    memcpy(&h[0], "RIFF", 4);
+    put_le(&h[4], 36 + data_size, 4);
+    memcpy(&h[8], "WAVEfmt ", 8);
+    put_le(&h[16], 16, 4);              // fmt chunk size
+    put_le(&h[20], 1, 2);               // PCM
+    put_le(&h[22], 2, 2);               // Channels
+    put_le(&h[24], sample_rate, 4);
+    put_le(&h[28], sample_rate * 4, 4); // Byte rate
+    put_le(&h[32], 4, 2);               // Block align
+    put_le(&h[34], 16, 2);              // Bits per sample
+    memcpy(&h[36], "data", 4);
+    put_le(&h[40], data_size, 4);
+
+    fseek(f, 0, SEEK_SET);
+    fwrite(h, 1, sizeof(h), f);
+    fseek(f, 0, SEEK_END);
+}
+
+// Stereo points are sent MSB first on I2S: left sample in the high half-word
+static void wav_write_frames(const uint32_t *points, uint32_t count) {
+    uint8_t chunk[256 * 4];
+
+    while (count > 0) {
+        const uint32_t len = count < 256 ? count : 256;
+
+        for (uint32_t i = 0; i < len; i++) {
+            put_le(&chunk[i * 4], points[i] >> 16, 2);
+            put_le(&chunk[i * 4 + 2], points[i] & 0xFFFF, 2);
+        }
+        fwrite(chunk, 4, len, g_wav);
+        points += len;
+        count -= len;
+    }
+}
+
+static void input_read_frames(uint32_t *points, uint32_t count) {
+    uint8_t frame[4];
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (g_input == NULL || fread(frame, 1, 4, g_input) != 4) {
+            points[i] = 0;
+        } else {
+            const uint32_t left = frame[0] | (frame[1] << 8);
+            const uint32_t right = frame[2] | (frame[3] << 8);
+            points[i] = (left << 16) | right;
+        }
+    }
+}
+
+/*****************/
+/* DMA emulation */
+/*****************/
+
+static double frames_to_ms(uint64_t frames) {
+    return (double)frames * 1000.0 / (double)g_sample_rate;
+}
+
+// Equivalent of dma_out_handler()/dma_in_handler(): ask the user for the
+// next buffer and start a new transfer.
+static void dma_handler(dma_emu *dma, bool output) {
+    uint32_t *buffer = NULL;
+    uint32_t point_count = 0;
+
+    if (dma->callback != NULL) {
+        dma->callback(&buffer, &point_count);
+    }
+
+    // On the device an empty transfer would complete immediately and
+    // re-enter the handler, treat it as a gap instead of spinning.
+    if (buffer != NULL && point_count == 0) {
+        buffer = NULL;
+    }
+
+    if (buffer == NULL) {
+        buffer = output ? (uint32_t *)zeroes_audio_buffer : dev_null_audio_buffer;
+        point_count = DUMMY_AUDIO_BUFFER_SIZE;
+
+        // No callback at all is not a gap, the application just doesn't use
+        // this direction.
+        dma->gap = dma->callback != NULL;
+    } else {
+        dma->gap = false;
+    }
+
+    if (dma->gap) {
+        if (output) {
+            g_stats.out_gaps++;
+            g_stats.out_gap_frames += point_count;
+        } else {
+            g_stats.in_gaps++;
+            g_stats.in_gap_frames += point_count;
+        }
+
+        if (g_config.log_gaps) {
+            fprintf(stderr,
+                    "nn_host: %s gap at frame %llu (%.3f ms), %u points %s\n",
+                    output ? "output" : "input",
+                    (unsigned long long)g_stats.frames,
+                    frames_to_ms(g_stats.frames),
+                    (unsigned)point_count,
+                    output ? "of silence" : "lost");
+        }
+    } else if (dma->callback != NULL) {
+        if (output) {
+            g_stats.out_buffers++;
+        } else {
+            g_stats.in_buffers++;
+        }
+    }
+
+    dma->buffer = buffer;
+    __atomic_store_n(&dma->count, point_count, __ATOMIC_RELAXED);
+    dma->pos = 0;
+}
+
+// Transfer frames of the current buffers, the caller makes sure that no
+// transfer completes in the middle.
+static void dma_transfer(uint32_t frames) {
+    if (g_wav != NULL) {
+        wav_write_frames(&g_out.buffer[g_out.pos], frames);
+    }
+    g_out.pos += frames;
+
+    input_read_frames(&g_in.buffer[g_in.pos], frames);
+    g_in.pos += frames;
+
+    __atomic_store_n(&g_stats.frames, g_stats.frames + frames,
+                     __ATOMIC_RELAXED);
+}
+
+// Advance emulated time up to the next DMA completion, or at most max_frames.
+// Returns the number of frames emulated.
+static uint32_t dma_step(uint32_t max_frames) {
+    uint32_t len = max_frames;
+
+    if (g_out.count - g_out.pos < len) {
+        len = g_out.count - g_out.pos;
+    }
+    if (g_in.count - g_in.pos < len) {
+        len = g_in.count - g_in.pos;
+    }
+
+    dma_transfer(len);
+
+    // Completion interrupts, output has the higher priority (DMA_IRQ_0)
+    if (g_out.pos == g_out.count) {
+        dma_handler(&g_out, true);
+    }
+    if (g_in.pos == g_in.count) {
+        dma_handler(&g_in, false);
+    }
+
+    return len;
+}
+
+// Number of frames until the next DMA completion
+static uint32_t frames_to_next_event(void) {
+    const uint32_t out = g_out.count - g_out.pos;
+    const uint32_t in = g_in.count - g_in.pos;
+
+    return out < in ? out : in;
+}
+
+static void add_ns(struct timespec *t, uint64_t ns) {
+    ns += (uint64_t)t->tv_nsec;
+    t->tv_sec += (time_t)(ns / 1000000000u);
+    t->tv_nsec = (long)(ns % 1000000000u);
+}
+
+static void *realtime_thread(void *arg) {
+    (void)arg;
+    struct timespec start;
+    uint64_t frames = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    while (!g_thread_stop) {
+        pthread_mutex_lock(&g_lock);
+        const uint32_t next = frames_to_next_event();
+        pthread_mutex_unlock(&g_lock);
+
+        // Deadlines are computed from the start time to avoid drifting
+        frames += next;
+        struct timespec deadline = start;
+        add_ns(&deadline, frames * 1000000000u / g_sample_rate);
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+
+        pthread_mutex_lock(&g_lock);
+        dma_step(next);
+        pthread_mutex_unlock(&g_lock);
+    }
+    return NULL;
+}
+
+/*************/
+/* Audio API */
+/*************/
+
+void nn_host_audio_config_init(nn_host_audio_config *config) {
+    config->wav_path = NULL;
+    config->input_path = NULL;
+    config->realtime = true;
+    config->log_gaps = true;
+}
+
+void nn_host_audio_configure(const nn_host_audio_config *config) {
+    g_config = *config;
+}
+
+bool nn_audio_init(int sample_rate,
+                   audio_cb_t output_callback,
+                   audio_cb_t input_callback)
+{
+    if (g_running || sample_rate <= 0) {
+        return false;
+    }
+
+    // Report the plan the device would use
+    nn_clock_constraints constraints;
+    nn_clock_constraints_init(&constraints, NN_SYS_CLOCK_PLAN_MAX_KHZ * 1000);
+    constraints.max_error_ppm = NN_SAMPLE_RATE_MAX_ERROR_PPM;
+    if (NN_SYS_CLOCK_MAX_KHZ == 0 ||
+        !nn_clock_plan_for_rate(sample_rate, &constraints, &g_clock_plan))
+    {
+        nn_clock_plan_fixed(sample_rate, 125000000, &g_clock_plan);
+    }
+    nn_boot_mark("clock plan");
+
+    const char *wav_path = g_config.wav_path;
+    if (wav_path == NULL) {
+        wav_path = getenv("NN_HOST_WAV");
+    }
+
+    if (wav_path != NULL) {
+        g_wav = fopen(wav_path, "wb");
+        if (g_wav == NULL) {
+            perror(wav_path);
+            return false;
+        }
+        wav_write_header(g_wav, sample_rate, 0);
+    }
+
+    if (g_config.input_path != NULL) {
+        g_input = fopen(g_config.input_path, "rb");
+        if (g_input == NULL) {
+            perror(g_config.input_path);
+            return false;
+        }
+    }
+
+    g_sample_rate = sample_rate;
+    memset(&g_stats, 0, sizeof(g_stats));
+
+    g_out.callback = output_callback;
+    g_in.callback = input_callback;
+
+    // Start the first transfers, like init_i2s() does
+    dma_handler(&g_out, true);
+    dma_handler(&g_in, false);
+    nn_boot_mark("I2S");
+
+    g_running = true;
+    if (!g_atexit_registered) {
+        atexit(nn_host_audio_close);
+        g_atexit_registered = true;
+    }
+
+    if (g_config.realtime) {
+        g_thread_stop = false;
+        if (pthread_create(&g_thread, NULL, realtime_thread, NULL) != 0) {
+            return false;
+        }
+        g_thread_started = true;
+    }
+
+    nn_boot_mark("codec");
+    return true;
+}
+
+bool nn_host_audio_run(uint32_t frames) {
+    if (!g_running || g_config.realtime) {
+        return false;
+    }
+
+    pthread_mutex_lock(&g_lock);
+    while (frames > 0) {
+        frames -= dma_step(frames);
+    }
+    pthread_mutex_unlock(&g_lock);
+    return true;
+}
+
+// The counters are read without g_lock: the audio callbacks run with it
+// taken, and may call these functions as on the device
+uint32_t nn_audio_frame_count(void) {
+    return (uint32_t)__atomic_load_n(&g_stats.frames, __ATOMIC_RELAXED);
+}
+
+bool nn_audio_wait_headroom(uint32_t us, uint32_t timeout_us) {
+    (void)timeout_us;
+
+    // Host flash operations do not block the audio thread, but the device
+    // never finds the time in transfers shorter than us
+    const uint32_t frames = nn_audio_min_transfer_frames();
+    const uint32_t rate = g_clock_plan.actual_rate;
+
+    return frames == 0 || rate == 0 ||
+        (uint64_t)frames * 1000000 >= (uint64_t)us * rate;
+}
+
+uint32_t nn_audio_min_transfer_frames(void) {
+    if (!__atomic_load_n(&g_running, __ATOMIC_RELAXED)) {
+        return 0;
+    }
+
+    const uint32_t out = __atomic_load_n(&g_out.count, __ATOMIC_RELAXED);
+    const uint32_t in = __atomic_load_n(&g_in.count, __ATOMIC_RELAXED);
+    return in < out ? in : out;
+}
+
+void nn_host_audio_get_stats(nn_host_audio_stats *stats) {
+    pthread_mutex_lock(&g_lock);
+    *stats = g_stats;
+    pthread_mutex_unlock(&g_lock);
+}
+
+void nn_host_audio_close(void) {
+    if (g_thread_started) {
+        g_thread_stop = true;
+        pthread_join(g_thread, NULL);
+        g_thread_started = false;
+    }
+
+    pthread_mutex_lock(&g_lock);
+    if (g_wav != NULL) {
+        wav_write_header(g_wav, g_sample_rate, (uint32_t)g_stats.frames);
+        fclose(g_wav);
+        g_wav = NULL;
+    }
+    if (g_input != NULL) {
+        fclose(g_input);
+        g_input = NULL;
+    }
+    g_running = false;
+    pthread_mutex_unlock(&g_lock);
+}
+
+const nn_clock_plan *nn_audio_clock_plan(void) {
+    return &g_clock_plan;
+}
+
+uint32_t nn_flash_program_end(void) {
+    // The host program is not in the emulated flash
+    return 0;
+}
+
+/*****************/
+/* Codec control */
+/*****************/
+
+// There is no codec on the host and the played frames are recorded as sent
+// on the I2S bus. The device clamps out of range settings silently, here they
+// are also logged and counted in the stats so that host runs catch them.
+
+static bool check_range(const char *func, const char *arg,
+                        float value, float min, float max) {
+    if (value >= min && value <= max) {
+        return true;
+    }
+
+    __atomic_add_fetch(&g_stats.codec_range_errors, 1, __ATOMIC_RELAXED);
+    fprintf(stderr, "nn_host: %s: %s = %g is not in [%g, %g]\n",
+            func, arg, (double)value, (double)min, (double)max);
+    return false;
+}
+
+#define CHECK_VOLUME(v) check_range(__func__, #v, (v), 0.0f, 1.0f)
+#define CHECK_BOOST(b) check_range(__func__, #b, (b), 0.0f, 10.0f)
+
+bool nn_enable_line_out(bool left, bool right) {
+    (void)left;
+    (void)right;
+    return true;
+}
+
+bool nn_enable_speakers(bool left, bool right, uint8_t gain) {
+    (void)left;
+    (void)right;
+
+    // Out of range gains select 0 on the device
+    check_range(__func__, "gain", gain, 0.0f, 3.0f);
+    return true;
+}
+
+bool nn_set_line_out_volume(float L2L, float L2R, float R2L, float R2R) {
+    CHECK_VOLUME(L2L);
+    CHECK_VOLUME(L2R);
+    CHECK_VOLUME(R2L);
+    CHECK_VOLUME(R2R);
+    return true;
+}
+
+bool nn_set_adc_volume(float left, float right) {
+    CHECK_VOLUME(left);
+    CHECK_VOLUME(right);
+    return true;
+}
+
+bool nn_set_hp_volume(float left, float right) {
+    CHECK_VOLUME(left);
+    CHECK_VOLUME(right);
+    return true;
+}
+
+bool nn_set_line_in_boost(uint8_t line, uint8_t L2L, uint8_t L2R, uint8_t R2L, uint8_t R2R) {
+    CHECK_BOOST(L2L);
+    CHECK_BOOST(L2R);
+    CHECK_BOOST(R2L);
+    CHECK_BOOST(R2R);
+
+    // Line 2 has no cross routing, L2R and R2L are ignored on the device
+    if (line == 2 && (L2R != 0 || R2L != 0)) {
+        __atomic_add_fetch(&g_stats.codec_range_errors, 1, __ATOMIC_RELAXED);
+        fprintf(stderr, "nn_host: %s: line 2 cannot route L2R/R2L\n",
+                __func__);
+    }
+
+    return check_range(__func__, "line", line, 1.0f, 3.0f);
+}
+
+bool nn_enable_mic_bias(void) {
+    return true;
+}
+
+bool nn_set_dac_eq(const nn_eq_band *left, const nn_eq_band *right) {
+    nn_dac_eq_coefs coefs;
+
+    if (g_sample_rate == 0) {
+        return false;
+    }
+    if (left != NULL && !nn_dac_eq_compute(left, g_sample_rate, &coefs)) {
+        return false;
+    }
+    if (right != NULL && !nn_dac_eq_compute(right, g_sample_rate, &coefs)) {
+        return false;
+    }
+    return true;
+}
+
+bool nn_codec_sync(void) {
+    return true;
+}
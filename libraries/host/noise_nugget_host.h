@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file noise_nugget_host.h
+ * @brief Host (Linux) emulation of the Noise Nugget audio interface.
+ *
+ * noise_nugget_host.c implements the noise_nugget.h API on a host computer.
+ * The I2S DMA channels are emulated with the same cadence as on the device:
+ * a DMA transfer of N stereo points completes N sample periods after it was
+ * started, the audio callback is then called from the "interrupt" to get the
+ * next buffer, exactly like dma_out_handler()/dma_in_handler() do.
+ *
+ * Played frames are written to a WAV file and every time the zero buffer is
+ * substituted (callback returned NULL) the gap is logged on stderr and
+ * counted in the statistics.
+ *
+ * Emulated time advances either in real time, from a background thread, or
+ * under the control of the application with nn_host_audio_run(). The latter
+ * is deterministic and meant for test harnesses: render code can be delayed
+ * or skipped between two calls to reproduce core1 slowdowns.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "noise_nugget.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct nn_host_audio_config
+ * @brief Configuration of the host audio emulation.
+ */
+typedef struct nn_host_audio_config {
+    const char *wav_path;   ///< Output WAV file for played frames, or NULL.
+    const char *input_path; ///< Raw stereo s16le file fed to the input DMA,
+                            ///< or NULL for silence.
+    bool realtime;          ///< Advance emulated time from a thread at the
+                            ///< sample rate, otherwise use nn_host_audio_run().
+    bool log_gaps;          ///< Log zero buffer substitutions on stderr.
+} nn_host_audio_config;
+
+/**
+ * @struct nn_host_audio_stats
+ * @brief Statistics of the host audio emulation.
+ */
+typedef struct nn_host_audio_stats {
+    uint64_t frames;            ///< Emulated time, in stereo frames.
+    uint32_t out_buffers;       ///< Output buffers provided by the callback.
+    uint32_t out_gaps;          ///< Output zero buffer substitutions.
+    uint64_t out_gap_frames;    ///< Silent frames played because of gaps.
+    uint32_t in_buffers;        ///< Input buffers provided by the callback.
+    uint32_t in_gaps;           ///< Input buffer substitutions (data lost).
+    uint64_t in_gap_frames;     ///< Input frames lost because of gaps.
+    uint32_t codec_range_errors; ///< Codec settings outside of their documented
+                                 ///  range (logged on stderr).
+} nn_host_audio_stats;
+
+/**
+ * @brief Initializes a configuration with the default values
+ *
+ * @details Default is: no files, real time, gaps logged.
+ *
+ * @param config Configuration to initialize
+ */
+void nn_host_audio_config_init(nn_host_audio_config *config);
+
+/**
+ * @brief Configure the host audio emulation
+ *
+ * @details Must be called before nn_audio_init(), otherwise the default
+ * configuration is used. The environment variable NN_HOST_WAV can also be
+ * used to set the output WAV file without changing the application.
+ *
+ * @param config Configuration, copied (strings are not)
+ */
+void nn_host_audio_configure(const nn_host_audio_config *config);
+
+/**
+ * @brief Advance emulated time
+ *
+ * @details Only available when the emulation is not in real time. Frames are
+ * played/recorded and the callbacks are called at each DMA completion, from
+ * the calling thread.
+ *
+ * @param frames Number of stereo frames to emulate
+ *
+ * @return Returns false if the emulation is not running or in real time mode.
+ */
+bool nn_host_audio_run(uint32_t frames);
+
+/**
+ * @brief Get the statistics of the emulation
+ *
+ * @param stats Output statistics
+ */
+void nn_host_audio_get_stats(nn_host_audio_stats *stats);
+
+/**
+ * @brief Stop the emulation and finalize the WAV file
+ *
+ * @details Called automatically at exit.
+ */
+void nn_host_audio_close(void);
+
+#ifdef __cplusplus
+}
+#endif
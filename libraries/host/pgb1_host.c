@@ -0,0 +1,965 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <pthread.h>
+#include "pico/stdlib.h"
+#include "pgb1_host.h"
+#include "midi_utils.h"
+#include "noise_nugget.h"
+#include "screen_gfx.h"
+#include "leds_anim.h"
+
+static pgb1_host_config g_config;
+static bool g_configured = false;
+static pgb1_host_stats g_stats = {0};
+
+static void ensure_configured(void) {
+    if (!g_configured) {
+        pgb1_host_config_init(&g_config);
+        g_configured = true;
+    }
+}
+
+void pgb1_host_config_init(pgb1_host_config *config) {
+    const char *term = getenv("NN_HOST_TERM");
+
+    config->keys_path = getenv("NN_HOST_KEYS");
+    config->midi_path = getenv("NN_HOST_MIDI");
+    config->midi_out_path = getenv("NN_HOST_MIDI_OUT");
+    config->frames_dir = getenv("NN_HOST_FRAMES");
+    config->terminal = term == NULL || strcmp(term, "0") != 0;
+}
+
+void pgb1_host_configure(const pgb1_host_config *config) {
+    g_config = *config;
+    g_configured = true;
+}
+
+void pgb1_host_get_stats(pgb1_host_stats *stats) {
+    *stats = g_stats;
+}
+
+static void print_stats(void) {
+    fprintf(stderr,
+            "pgb1_host: %u scans, period avg %llu us max %u us, "
+            "%u screen updates (%llu bytes), %u LED updates, "
+            "%u key events, key to screen max %u us\n",
+            g_stats.scans,
+            g_stats.scans > 1
+            ? (unsigned long long)(g_stats.total_scan_period_us / (g_stats.scans - 1))
+            : 0ull,
+            g_stats.max_scan_period_us,
+            g_stats.screen_updates,
+            (unsigned long long)g_stats.screen_bytes,
+            g_stats.led_updates,
+            g_stats.key_events,
+            g_stats.max_key_to_screen_us);
+}
+
+/************/
+/* Keyboard */
+/************/
+
+typedef struct key_name {
+    const char *name;
+    uint32_t key;
+    char stdin_char;
+} key_name;
+
+// stdin layout: top row of keys on 1-8, bottom row on q-i, arrows on h/j/k/l
+static const key_name g_key_names[] = {
+    {"TRACK", K_TRACK, 'z'}, {"STEP", K_STEP, 'x'},
+    {"PLAY", K_PLAY, 'c'},   {"REC", K_REC, 'v'},
+    {"ALT", K_ALT, 'n'},     {"PATT", K_PATT, 'm'},
+    {"SONG", K_SONG, ','},   {"MENU", K_MENU, '.'},
+    {"UP", K_UP, 'k'},       {"DOWN", K_DOWN, 'j'},
+    {"RIGHT", K_RIGHT, 'l'}, {"LEFT", K_LEFT, 'h'},
+    {"A", K_A, 'a'},         {"B", K_B, 'b'},
+    {"1", K_1, '1'},  {"2", K_2, '2'},  {"3", K_3, '3'},  {"4", K_4, '4'},
+    {"5", K_5, '5'},  {"6", K_6, '6'},  {"7", K_7, '7'},  {"8", K_8, '8'},
+    {"9", K_9, 'q'},  {"10", K_10, 'w'}, {"11", K_11, 'e'}, {"12", K_12, 'r'},
+    {"13", K_13, 't'}, {"14", K_14, 'y'}, {"15", K_15, 'u'}, {"16", K_16, 'i'},
+};
+#define KEY_NAMES_COUNT (sizeof(g_key_names) / sizeof(g_key_names[0]))
+#define KEY_COUNT 32
+
+#define STDIN_QUIT_CHAR 0x1B // Escape
+
+typedef enum key_action {
+    KEY_DOWN,
+    KEY_UP,
+    KEY_TAP,
+    KEY_QUIT,
+} key_action;
+
+typedef struct key_event {
+    uint32_t time_ms;
+    key_action action;
+    uint32_t key;
+} key_event;
+
+static key_event *g_key_script = NULL;
+static int g_key_script_len = 0;
+static int g_key_script_pos = 0;
+
+static uint64_t g_keyboard_start_us = 0;
+static uint64_t g_key_release_us[KEY_COUNT] = {0};
+static uint32_t g_host_keys = 0;
+
+static uint32_t g_polled_keys = 0;    // g_host_keys at the last poll
+static uint32_t g_keys_down_acc = 0;  // Pressed since last scan
+static uint32_t g_keys_up_acc = 0;    // Released since last scan
+
+static uint32_t _keyboard_state = 0;
+static uint32_t _keyboard_falling = 0;
+static uint32_t _keyboard_raising = 0;
+
+#define KEY_EVENT_QUEUE_LEN 32
+
+static keyboard_event g_key_events[KEY_EVENT_QUEUE_LEN];
+static uint32_t g_key_events_head = 0;
+static uint32_t g_key_events_tail = 0;
+
+static uint64_t g_last_scan_us = 0;
+static uint64_t g_pending_key_us = 0; // Key event not shown on screen yet
+
+static bool g_term_raw = false;
+static struct termios g_term_saved;
+
+static uint32_t key_from_name(const char *name) {
+    for (size_t i = 0; i < KEY_NAMES_COUNT; i++) {
+        if (strcmp(g_key_names[i].name, name) == 0) {
+            return g_key_names[i].key;
+        }
+    }
+    return 0;
+}
+
+static uint32_t key_from_char(char c) {
+    for (size_t i = 0; i < KEY_NAMES_COUNT; i++) {
+        if (g_key_names[i].stdin_char == c) {
+            return g_key_names[i].key;
+        }
+    }
+    return 0;
+}
+
+static int key_index(uint32_t key) {
+    for (int i = 0; i < KEY_COUNT; i++) {
+        if (key == (1u << i)) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+static bool load_key_script(const char *path) {
+    FILE *f = fopen(path, "r");
+    char line[128];
+    int line_num = 0;
+
+    if (f == NULL) {
+        perror(path);
+        return false;
+    }
+
+    while (fgets(line, sizeof(line), f) != NULL) {
+        char action[16] = "", name[16] = "";
+        unsigned time_ms;
+
+        line_num++;
+        if (line[0] == '#' || sscanf(line, "%u %15s %15s", &time_ms, action, name) < 2) {
+            continue;
+        }
+
+        key_event ev = {time_ms, KEY_QUIT, 0};
+
+        if (strcmp(action, "quit") != 0) {
+            ev.key = key_from_name(name);
+            if (strcmp(action, "down") == 0) {
+                ev.action = KEY_DOWN;
+            } else if (strcmp(action, "up") == 0) {
+                ev.action = KEY_UP;
+            } else if (strcmp(action, "tap") == 0) {
+                ev.action = KEY_TAP;
+            } else {
+                ev.key = 0;
+            }
+
+            if (ev.key == 0) {
+                fprintf(stderr, "%s:%d: invalid key event\n", path, line_num);
+                continue;
+            }
+        }
+
+        key_event *script = realloc(g_key_script,
+                                    (g_key_script_len + 1) * sizeof(key_event));
+        if (script == NULL) {
+            break;
+        }
+        g_key_script = script;
+        g_key_script[g_key_script_len++] = ev;
+    }
+
+    fclose(f);
+    return true;
+}
+
+static void restore_terminal(void) {
+    if (g_term_raw) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &g_term_saved);
+        g_term_raw = false;
+    }
+}
+
+static void on_signal(int sig) {
+    restore_terminal();
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+static void setup_stdin(void) {
+    if (isatty(STDIN_FILENO) && tcgetattr(STDIN_FILENO, &g_term_saved) == 0) {
+        struct termios raw = g_term_saved;
+
+        raw.c_lflag &= ~(ICANON | ECHO);
+        raw.c_cc[VMIN] = 0;
+        raw.c_cc[VTIME] = 0;
+        tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+        g_term_raw = true;
+        atexit(restore_terminal);
+        signal(SIGINT, on_signal);
+        signal(SIGTERM, on_signal);
+    }
+
+    fcntl(STDIN_FILENO, F_SETFL, fcntl(STDIN_FILENO, F_GETFL) | O_NONBLOCK);
+}
+
+static void press_for(uint32_t key, uint64_t now_us, uint64_t hold_us) {
+    g_host_keys |= key;
+    g_key_release_us[key_index(key)] = now_us + hold_us;
+}
+
+static void poll_stdin(uint64_t now_us) {
+    char c;
+
+    while (read(STDIN_FILENO, &c, 1) == 1) {
+        if (c == STDIN_QUIT_CHAR) {
+            exit(0);
+        }
+
+        const uint32_t key = key_from_char(c);
+        if (key != 0) {
+            press_for(key, now_us, PGB1_HOST_KEY_HOLD_MS * 1000u);
+        }
+    }
+}
+
+static void poll_script(uint64_t now_us) {
+    const uint64_t elapsed_ms = (now_us - g_keyboard_start_us) / 1000u;
+
+    while (g_key_script_pos < g_key_script_len &&
+           g_key_script[g_key_script_pos].time_ms <= elapsed_ms)
+    {
+        const key_event *ev = &g_key_script[g_key_script_pos++];
+
+        switch (ev->action) {
+        case KEY_DOWN:
+            g_host_keys |= ev->key;
+            g_key_release_us[key_index(ev->key)] = 0;
+            break;
+        case KEY_UP:
+            g_host_keys &= ~ev->key;
+            break;
+        case KEY_TAP:
+            // Held for a single scan
+            press_for(ev->key, now_us, 1);
+            break;
+        case KEY_QUIT:
+            exit(0);
+        }
+    }
+}
+
+static void release_expired_keys(uint64_t now_us) {
+    for (int i = 0; i < KEY_COUNT; i++) {
+        const uint32_t key = 1u << i;
+
+        if ((g_host_keys & key) && g_key_release_us[i] != 0 &&
+            g_key_release_us[i] <= now_us)
+        {
+            g_host_keys &= ~key;
+            g_key_release_us[i] = 0;
+        }
+    }
+}
+
+void keyboard_init(void) {
+    ensure_configured();
+    atexit(print_stats);
+
+    if (g_config.keys_path != NULL) {
+        load_key_script(g_config.keys_path);
+    } else {
+        setup_stdin();
+    }
+    g_keyboard_start_us = time_us_64();
+}
+
+static void push_key_event(uint32_t key, bool pressed, uint64_t now_us) {
+    if (g_key_events_head - g_key_events_tail >= KEY_EVENT_QUEUE_LEN) {
+        return;
+    }
+
+    keyboard_event *ev = &g_key_events[g_key_events_head % KEY_EVENT_QUEUE_LEN];
+    ev->key = key;
+    ev->pressed = pressed;
+    ev->frame = nn_audio_frame_count();
+    ev->time_us = (uint32_t)now_us;
+    g_key_events_head++;
+}
+
+// Equivalent of the device scan interrupt, run from keyboard_scan() and
+// keyboard_get_event().
+static void poll_keys(uint64_t now_us) {
+    // Release first so that a tap is seen for exactly one scan
+    release_expired_keys(now_us);
+    if (g_config.keys_path != NULL) {
+        poll_script(now_us);
+    } else {
+        poll_stdin(now_us);
+    }
+
+    const uint32_t changed = g_host_keys ^ g_polled_keys;
+
+    for (int i = 0; i < KEY_COUNT; i++) {
+        const uint32_t key = 1u << i;
+
+        if (changed & key) {
+            push_key_event(key, (g_host_keys & key) != 0, now_us);
+        }
+    }
+
+    g_keys_down_acc |= changed & g_host_keys;
+    g_keys_up_acc |= changed & g_polled_keys;
+    g_polled_keys = g_host_keys;
+
+    if (changed != 0) {
+        g_stats.key_events += __builtin_popcount(changed);
+        if (g_pending_key_us == 0) {
+            g_pending_key_us = now_us;
+        }
+    }
+}
+
+void keyboard_scan(void) {
+    const uint64_t now = time_us_64();
+
+    if (g_last_scan_us != 0) {
+        const uint32_t period = (uint32_t)(now - g_last_scan_us);
+
+        g_stats.total_scan_period_us += period;
+        if (period > g_stats.max_scan_period_us) {
+            g_stats.max_scan_period_us = period;
+        }
+    }
+    g_last_scan_us = now;
+    g_stats.scans++;
+
+    poll_keys(now);
+
+    _keyboard_state = g_polled_keys;
+    _keyboard_falling = g_keys_down_acc;
+    _keyboard_raising = g_keys_up_acc;
+    g_keys_down_acc = 0;
+    g_keys_up_acc = 0;
+}
+
+bool keyboard_get_event(keyboard_event *ev) {
+    if (g_key_events_tail == g_key_events_head) {
+        poll_keys(time_us_64());
+    }
+
+    if (g_key_events_tail == g_key_events_head) {
+        return false;
+    }
+
+    *ev = g_key_events[g_key_events_tail % KEY_EVENT_QUEUE_LEN];
+    g_key_events_tail++;
+    return true;
+}
+
+bool pressed(uint32_t key) {
+    return (_keyboard_state & key) != 0;
+}
+
+bool falling(uint32_t key){
+    return (_keyboard_falling & key) != 0;
+}
+
+bool raising(uint32_t key){
+    return (_keyboard_raising & key) != 0;
+}
+
+/*************/
+/* Rendering */
+/*************/
+
+// What the device would show: last frames sent to the LEDs and screen
+static LedColor g_leds_shown[PGB1_LEDS_COUNT] = {0};
+static uint8_t g_screen_shown[SCREEN_FRAMEBUFFER_SIZE] = {0};
+static uint32_t g_frame_count = 0;
+
+// LED animation frames are rendered from their own thread
+static pthread_mutex_t g_render_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Approximate front panel position (column, row) of each LED
+static const uint8_t g_led_pos[PGB1_LEDS_COUNT][2] = {
+    {0, 0}, {1, 0}, {2, 0}, {3, 0},
+    {0, 1}, {1, 1}, {2, 1}, {3, 1}, {4, 1}, {5, 1}, {6, 1}, {7, 1}, {8, 1}, {9, 1},
+    {0, 2}, {1, 2}, {2, 2}, {3, 2}, {4, 2}, {5, 2}, {6, 2}, {7, 2}, {8, 2}, {9, 2},
+};
+#define LED_GRID_COLUMNS 10
+#define LED_GRID_ROWS 3
+
+// The LEDs are driven at low intensity, scale up for the display
+static uint8_t led_intensity(uint8_t v) {
+    const unsigned scaled = v * 8u;
+    return scaled > 255 ? 255 : (uint8_t)scaled;
+}
+
+static bool pixel_on(int x, int y) {
+    return (g_screen_shown[x + (y / 8) * SCREEN_WIDTH] >> (y % 8)) & 1;
+}
+
+static void render_terminal(void) {
+    printf("\x1b[H");
+
+    for (int row = 0; row < LED_GRID_ROWS; row++) {
+        int ids[LED_GRID_COLUMNS];
+
+        for (int col = 0; col < LED_GRID_COLUMNS; col++) {
+            ids[col] = -1;
+        }
+        for (int i = 0; i < PGB1_LEDS_COUNT; i++) {
+            if (g_led_pos[i][1] == row) {
+                ids[g_led_pos[i][0]] = i;
+            }
+        }
+        for (int col = 0; col < LED_GRID_COLUMNS; col++) {
+            if (ids[col] >= 0) {
+                const LedColor c = g_leds_shown[ids[col]];
+                printf("\x1b[38;2;%u;%u;%um● ", led_intensity(c.r),
+                       led_intensity(c.g), led_intensity(c.b));
+            } else {
+                printf("  ");
+            }
+        }
+        printf("\x1b[0m\x1b[K\n");
+    }
+
+    // Two pixel rows per character with the upper half block
+    for (int y = 0; y < SCREEN_HEIGHT; y += 2) {
+        for (int x = 0; x < SCREEN_WIDTH; x++) {
+            printf("\x1b[38;5;%dm\x1b[48;5;%dm▀",
+                   pixel_on(x, y) ? 15 : 0, pixel_on(x, y + 1) ? 15 : 0);
+        }
+        printf("\x1b[0m\n");
+    }
+    fflush(stdout);
+}
+
+/* Minimal PNG writer: RGB, no compression (stored deflate blocks) */
+
+static uint32_t g_crc_table[256];
+
+static void crc_init(void) {
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        g_crc_table[n] = c;
+    }
+}
+
+static uint32_t crc_update(uint32_t crc, const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        crc = g_crc_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+static void put_be32(uint8_t *dst, uint32_t v) {
+    dst[0] = (uint8_t)(v >> 24);
+    dst[1] = (uint8_t)(v >> 16);
+    dst[2] = (uint8_t)(v >> 8);
+    dst[3] = (uint8_t)v;
+}
+
+static void png_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len) {
+    uint8_t buf[4];
+
+    put_be32(buf, len);
+    fwrite(buf, 1, 4, f);
+    fwrite(type, 1, 4, f);
+    fwrite(data, 1, len, f);
+
+    uint32_t crc = crc_update(0xFFFFFFFFu, (const uint8_t *)type, 4);
+    crc = crc_update(crc, data, len);
+    put_be32(buf, crc ^ 0xFFFFFFFFu);
+    fwrite(buf, 1, 4, f);
+}
+
+static bool png_write(const char *path, const uint8_t *rgb, uint32_t w, uint32_t h) {
+    const uint32_t raw_len = (w * 3 + 1) * h;
+    const uint32_t blocks = (raw_len + 65534) / 65535;
+    const uint32_t z_len = 2 + raw_len + blocks * 5 + 4;
+    uint8_t *z = malloc(z_len);
+    FILE *f = fopen(path, "wb");
+
+    if (z == NULL || f == NULL) {
+        free(z);
+        if (f != NULL) {
+            fclose(f);
+        }
+        return false;
+    }
+
+    uint8_t *p = z;
+    uint32_t a = 1, b = 0; // Adler-32
+    uint32_t remaining = raw_len;
+    uint32_t pos = 0;
+
+    *p++ = 0x78;
+    *p++ = 0x01;
+
+    while (remaining > 0) {
+        const uint32_t len = remaining < 65535 ? remaining : 65535;
+
+        *p++ = remaining == len ? 1 : 0; // Final block flag, stored
+        *p++ = (uint8_t)len;
+        *p++ = (uint8_t)(len >> 8);
+        *p++ = (uint8_t)~len;
+        *p++ = (uint8_t)(~len >> 8);
+
+        for (uint32_t i = 0; i < len; i++, pos++) {
+            const uint32_t x = pos % (w * 3 + 1);
+            const uint32_t y = pos / (w * 3 + 1);
+            const uint8_t v = x == 0 ? 0 : rgb[y * w * 3 + x - 1];
+
+            *p++ = v;
+            a = (a + v) % 65521;
+            b = (b + a) % 65521;
+        }
+        remaining -= len;
+    }
+    put_be32(p, (b << 16) | a);
+
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    uint8_t ihdr[13];
+
+    put_be32(&ihdr[0], w);
+    put_be32(&ihdr[4], h);
+    ihdr[8] = 8;  // Bit depth
+    ihdr[9] = 2;  // RGB
+    ihdr[10] = 0; // Compression
+    ihdr[11] = 0; // Filter
+    ihdr[12] = 0; // No interlace
+
+    fwrite(signature, 1, sizeof(signature), f);
+    png_chunk(f, "IHDR", ihdr, sizeof(ihdr));
+    png_chunk(f, "IDAT", z, z_len);
+    png_chunk(f, "IEND", NULL, 0);
+
+    fclose(f);
+    free(z);
+    return true;
+}
+
+#define PNG_SCALE 2
+#define PNG_LED_CELL 16
+#define PNG_WIDTH (SCREEN_WIDTH * PNG_SCALE)
+#define PNG_HEIGHT (SCREEN_HEIGHT * PNG_SCALE + LED_GRID_ROWS * PNG_LED_CELL)
+
+static void render_png(void) {
+    static uint8_t rgb[PNG_WIDTH * PNG_HEIGHT * 3];
+    char path[512];
+
+    memset(rgb, 0x20, sizeof(rgb));
+
+    for (int y = 0; y < SCREEN_HEIGHT * PNG_SCALE; y++) {
+        for (int x = 0; x < PNG_WIDTH; x++) {
+            const uint8_t v = pixel_on(x / PNG_SCALE, y / PNG_SCALE) ? 0xFF : 0x00;
+            uint8_t *px = &rgb[(y * PNG_WIDTH + x) * 3];
+            px[0] = px[1] = px[2] = v;
+        }
+    }
+
+    for (int i = 0; i < PGB1_LEDS_COUNT; i++) {
+        const int x0 = g_led_pos[i][0] * PNG_LED_CELL + 2;
+        const int y0 = SCREEN_HEIGHT * PNG_SCALE + g_led_pos[i][1] * PNG_LED_CELL + 2;
+        const LedColor c = g_leds_shown[i];
+
+        for (int y = y0; y < y0 + PNG_LED_CELL - 4; y++) {
+            for (int x = x0; x < x0 + PNG_LED_CELL - 4; x++) {
+                uint8_t *px = &rgb[(y * PNG_WIDTH + x) * 3];
+                px[0] = led_intensity(c.r);
+                px[1] = led_intensity(c.g);
+                px[2] = led_intensity(c.b);
+            }
+        }
+    }
+
+    snprintf(path, sizeof(path), "%s/frame_%06u.png", g_config.frames_dir,
+             (unsigned)g_frame_count);
+    if (!png_write(path, rgb, PNG_WIDTH, PNG_HEIGHT)) {
+        perror(path);
+    }
+}
+
+static void render(void) {
+    if (g_config.terminal) {
+        render_terminal();
+    }
+    if (g_config.frames_dir != NULL) {
+        render_png();
+    }
+    g_frame_count++;
+}
+
+static void render_init(void) {
+    static bool done = false;
+
+    ensure_configured();
+    if (!done) {
+        crc_init();
+        if (g_config.terminal) {
+            printf("\x1b[2J");
+        }
+        done = true;
+    }
+}
+
+/********/
+/* LEDs */
+/********/
+
+static pthread_t g_leds_thread;
+static volatile bool g_leds_animating = false;
+static uint32_t g_leds_period_us = 0;
+
+void leds_init(void) {
+    render_init();
+}
+
+static void leds_show_frame(void) {
+    LedColor colors[PGB1_LEDS_COUNT];
+
+    pthread_mutex_lock(&g_render_lock);
+    if (leds_anim_compose(colors) || !g_leds_animating) {
+        memcpy(g_leds_shown, colors, sizeof(colors));
+        g_stats.led_updates++;
+        render();
+    }
+    pthread_mutex_unlock(&g_render_lock);
+}
+
+bool leds_update(void) {
+    if (!g_leds_animating) {
+        leds_show_frame();
+    }
+    return true;
+}
+
+// Equivalent of the device animation timer
+static void *leds_thread(void *arg) {
+    uint64_t next = time_us_64();
+
+    (void)arg;
+    while (g_leds_animating) {
+        leds_show_frame();
+
+        next += g_leds_period_us;
+        const uint64_t now = time_us_64();
+        if (next > now) {
+            sleep_us(next - now);
+        } else {
+            next = now;
+        }
+    }
+    return NULL;
+}
+
+bool leds_animation_start(uint32_t fps) {
+    if (fps == 0 || fps > LEDS_MAX_FPS) {
+        return false;
+    }
+
+    leds_animation_stop();
+    leds_anim_set_fps(fps);
+    render_init();
+
+    g_leds_period_us = 1000000 / fps;
+    g_leds_animating = true;
+    if (pthread_create(&g_leds_thread, NULL, leds_thread, NULL) != 0) {
+        g_leds_animating = false;
+    }
+    return g_leds_animating;
+}
+
+void leds_animation_stop(void) {
+    if (g_leds_animating) {
+        g_leds_animating = false;
+        pthread_join(g_leds_thread, NULL);
+    }
+}
+
+LedColor pgb1_host_led(int id) {
+    if (id >= 0 && id < PGB1_LEDS_COUNT) {
+        return g_leds_shown[id];
+    }
+    return (LedColor){0, 0, 0};
+}
+
+/**********/
+/* Screen */
+/**********/
+
+static screen_update_cb_t g_screen_update_cb = NULL;
+
+void screen_init(void) {
+    render_init();
+    screen_clear();
+    screen_mark_all_dirty();
+    nn_boot_mark("screen");
+}
+
+bool screen_update(void) {
+    int x0, x1, page0, page1;
+
+    g_stats.screen_updates++;
+    if (screen_take_dirty_window(&x0, &x1, &page0, &page1)) {
+        g_stats.screen_bytes += (x1 - x0 + 1) * (page1 - page0 + 1);
+    }
+
+    if (g_pending_key_us != 0) {
+        const uint32_t latency = (uint32_t)(time_us_64() - g_pending_key_us);
+
+        if (latency > g_stats.max_key_to_screen_us) {
+            g_stats.max_key_to_screen_us = latency;
+        }
+        g_pending_key_us = 0;
+    }
+
+    pthread_mutex_lock(&g_render_lock);
+    memcpy(g_screen_shown, screen_framebuffer, sizeof(g_screen_shown));
+    render();
+    pthread_mutex_unlock(&g_render_lock);
+
+    // Rendering is synchronous, the update is complete
+    if (g_screen_update_cb != NULL) {
+        g_screen_update_cb();
+    }
+    return true;
+}
+
+bool screen_update_in_progress(void) {
+    return false;
+}
+
+void screen_set_update_callback(screen_update_cb_t cb) {
+    g_screen_update_cb = cb;
+}
+
+const uint8_t *pgb1_host_screen_framebuffer(void) {
+    return g_screen_shown;
+}
+
+/********/
+/* MIDI */
+/********/
+
+#define MIDI_RING_LEN 256
+
+static midi_in_cb_t midi_in_user_cb = NULL;
+static midi_decoder pgb1_midi_decoder;
+static pthread_t g_midi_thread;
+
+// Received bytes with their exact reception time, the equivalent of the
+// device DMA ring.
+typedef struct midi_byte {
+    uint8_t byte;
+    uint32_t frame;
+    uint32_t time_us;
+} midi_byte;
+
+// Output is written directly, there is no queue
+static FILE *g_midi_out = NULL;
+static midi_encoder g_midi_encoder;
+static midi_tx_stats g_midi_tx_stats = {0};
+static uint64_t g_midi_start_us = 0;
+static bool g_midi_thru = false;
+static pthread_mutex_t g_midi_out_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static midi_byte g_midi_ring[MIDI_RING_LEN];
+static uint32_t g_midi_head = 0;
+static uint32_t g_midi_tail = 0;
+static pthread_mutex_t g_midi_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Equivalent of the UART, bytes are decoded by midi_poll()
+static void *midi_thread(void *arg) {
+    FILE *f = arg;
+    char line[256];
+    const uint64_t start = time_us_64();
+
+    while (fgets(line, sizeof(line), f) != NULL) {
+        unsigned time_ms;
+        int offset;
+
+        if (line[0] == '#' || sscanf(line, "%u%n", &time_ms, &offset) < 1) {
+            continue;
+        }
+
+        const uint64_t when = start + (uint64_t)time_ms * 1000u;
+        const uint64_t now = time_us_64();
+        if (when > now) {
+            sleep_us(when - now);
+        }
+
+        unsigned byte;
+        int len;
+        for (char *p = line + offset; sscanf(p, "%x%n", &byte, &len) == 1; p += len) {
+            sleep_us(MIDI_BYTE_US);
+
+            pthread_mutex_lock(&g_midi_lock);
+            if (g_midi_head - g_midi_tail >= MIDI_RING_LEN) {
+                // Overrun, the oldest byte is overwritten like on the device
+                g_midi_tail++;
+            }
+            g_midi_ring[g_midi_head % MIDI_RING_LEN] =
+                (midi_byte){(uint8_t)byte, nn_audio_frame_count(), time_us_32()};
+            g_midi_head++;
+            pthread_mutex_unlock(&g_midi_lock);
+        }
+    }
+
+    fclose(f);
+    return NULL;
+}
+
+void midi_init(midi_in_cb_t cb) {
+    ensure_configured();
+
+    midi_decoder_init(&pgb1_midi_decoder);
+    midi_encoder_init(&g_midi_encoder, true);
+    midi_in_user_cb = cb;
+    g_midi_start_us = time_us_64();
+
+    if (g_config.midi_out_path != NULL) {
+        g_midi_out = fopen(g_config.midi_out_path, "w");
+
+        if (g_midi_out == NULL) {
+            perror(g_config.midi_out_path);
+        }
+    }
+
+    if (g_config.midi_path != NULL) {
+        FILE *f = fopen(g_config.midi_path, "r");
+
+        if (f == NULL) {
+            perror(g_config.midi_path);
+        } else if (pthread_create(&g_midi_thread, NULL, midi_thread, f) == 0) {
+            pthread_detach(g_midi_thread);
+        } else {
+            fclose(f);
+        }
+    }
+}
+
+uint32_t midi_poll(midi_event *events, uint32_t max_events) {
+    uint32_t total = 0;
+
+    pthread_mutex_lock(&g_midi_lock);
+    while (g_midi_tail != g_midi_head &&
+           (events == NULL || total < max_events))
+    {
+        const midi_byte b = g_midi_ring[g_midi_tail % MIDI_RING_LEN];
+        const uint32_t msg = midi_decoder_push(&pgb1_midi_decoder, b.byte);
+
+        g_midi_tail++;
+        if (msg == 0) {
+            continue;
+        }
+
+        if (events != NULL) {
+            events[total] = (midi_event){msg, b.frame, b.time_us};
+        }
+        total++;
+
+        if (g_midi_thru) {
+            midi_send(msg);
+        }
+
+        if (midi_in_user_cb != NULL) {
+            pthread_mutex_unlock(&g_midi_lock);
+            midi_in_user_cb(msg);
+            pthread_mutex_lock(&g_midi_lock);
+        }
+    }
+    pthread_mutex_unlock(&g_midi_lock);
+
+    return total;
+}
+
+bool midi_send(uint32_t msg) {
+    uint8_t bytes[3];
+
+    pthread_mutex_lock(&g_midi_out_lock);
+    const uint32_t len = midi_encode(&g_midi_encoder, msg, bytes);
+
+    if (len == 0) {
+        g_midi_tx_stats.drops++;
+        pthread_mutex_unlock(&g_midi_out_lock);
+        return false;
+    }
+
+    g_midi_tx_stats.sent++;
+    if (len > g_midi_tx_stats.max_depth) {
+        g_midi_tx_stats.max_depth = len;
+    }
+
+    if (g_midi_out != NULL) {
+        fprintf(g_midi_out, "%u",
+                (unsigned)((time_us_64() - g_midi_start_us) / 1000u));
+        for (uint32_t i = 0; i < len; i++) {
+            fprintf(g_midi_out, " %02X", bytes[i]);
+        }
+        fprintf(g_midi_out, "\n");
+        fflush(g_midi_out);
+    }
+    pthread_mutex_unlock(&g_midi_out_lock);
+    return true;
+}
+
+void midi_set_thru(bool enable) {
+    g_midi_thru = enable;
+}
+
+void midi_get_tx_stats(midi_tx_stats *stats) {
+    pthread_mutex_lock(&g_midi_out_lock);
+    *stats = g_midi_tx_stats;
+    pthread_mutex_unlock(&g_midi_out_lock);
+}
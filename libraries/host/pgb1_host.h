@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pgb1_host.h
+ * @brief Virtual PGB-1: host (Linux) implementation of the pgb1.h API.
+ *
+ * pgb1_host.c implements the keyboard, LEDs, screen and MIDI functions of
+ * pgb1.h on a host computer, so that an application main loop runs unmodified
+ * on Linux (together with noise_nugget_host.c for audio and pico_host.c for
+ * the multicore, time and sync functions):
+ *
+ * - Screen and LEDs are rendered in the terminal (ANSI true color) and/or
+ *   written as PNG frames.
+ * - Keys come from a script or from stdin (one character per key, each press
+ *   is held for PGB1_HOST_KEY_HOLD_MS).
+ * - MIDI input comes from a timed text file.
+ *
+ * Without code changes, the configuration is taken from the environment:
+ *
+ * - NN_HOST_KEYS: key script, one event per line "<time_ms> <down|up|tap>
+ *   <key>" or "<time_ms> quit", with key names as in pgb1.h without the K_
+ *   prefix (e.g. "500 tap A", "1200 down 9").
+ * - NN_HOST_MIDI: MIDI script, one message per line "<time_ms> <hex bytes>"
+ *   (e.g. "250 90 3C 7F"), bytes are delivered at the MIDI baud rate.
+ * - NN_HOST_MIDI_OUT: file where the MIDI output is written, in the format of
+ *   the MIDI script (with running status, so it can be replayed as input).
+ * - NN_HOST_FRAMES: directory where PNG frames are written.
+ * - NN_HOST_TERM: set to 0 to disable terminal rendering.
+ *
+ * Times are relative to keyboard_init() and midi_init() respectively.
+ *
+ * At exit, frame time statistics are printed on stderr (see
+ * pgb1_host_stats).
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "pgb1.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Duration of a key press from stdin, terminals do not report key
+ * releases.
+ */
+#define PGB1_HOST_KEY_HOLD_MS 100
+
+/**
+ * @struct pgb1_host_config
+ * @brief Configuration of the virtual PGB-1.
+ */
+typedef struct pgb1_host_config {
+    const char *keys_path;  ///< Key script, or NULL to read keys from stdin.
+    const char *midi_path;  ///< MIDI script, or NULL.
+    const char *midi_out_path; ///< MIDI output file, or NULL.
+    const char *frames_dir; ///< Directory for PNG frames, or NULL.
+    bool terminal;          ///< Render screen and LEDs in the terminal.
+} pgb1_host_config;
+
+/**
+ * @struct pgb1_host_stats
+ * @brief Frame time statistics of the virtual PGB-1.
+ */
+typedef struct pgb1_host_stats {
+    uint32_t scans;              ///< Calls to keyboard_scan() (main loop frames).
+    uint32_t max_scan_period_us; ///< Longest time between two scans.
+    uint64_t total_scan_period_us; ///< Sum of the time between scans.
+    uint32_t screen_updates;     ///< Calls to screen_update().
+    uint64_t screen_bytes;       ///< Framebuffer bytes the device would send.
+    uint32_t led_updates;        ///< Calls to leds_update().
+    uint32_t key_events;         ///< Key presses and releases seen by the app.
+    uint32_t max_key_to_screen_us; ///< Longest time from a key event to the
+                                   ///< next screen update.
+} pgb1_host_stats;
+
+/**
+ * @brief Initializes a configuration from the environment variables
+ *
+ * @param config Configuration to initialize
+ */
+void pgb1_host_config_init(pgb1_host_config *config);
+
+/**
+ * @brief Configure the virtual PGB-1
+ *
+ * @details Must be called before any of the pgb1.h init functions, otherwise
+ * the configuration comes from the environment.
+ *
+ * @param config Configuration, copied (strings are not)
+ */
+void pgb1_host_configure(const pgb1_host_config *config);
+
+/**
+ * @brief Get the frame time statistics
+ *
+ * @param stats Output statistics
+ */
+void pgb1_host_get_stats(pgb1_host_stats *stats);
+
+/**
+ * @brief Get the screen content, as last sent with screen_update()
+ *
+ * @return Pointer to the 1024 bytes of the framebuffer, in SSD1306 page
+ *         order (8 vertical pixels per byte, LSB on top).
+ */
+const uint8_t *pgb1_host_screen_framebuffer(void);
+
+/**
+ * @brief Get the current color of a LED
+ *
+ * @param id The LED index, from 0 to PGB1_LEDS_COUNT - 1.
+ *
+ * @return Color of the LED as last sent with leds_update() or by the
+ *         animation engine.
+ */
+LedColor pgb1_host_led(int id);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+#include "hardware/flash.h"
+#include "sample_stream_dma_host.h"
+
+#define FIFO_DEPTH 8
+
+typedef struct fifo {
+    uint32_t data[FIFO_DEPTH];
+    int head;
+    int count;
+} fifo;
+
+// g_fifo[n] is read by core n
+static fifo g_fifo[2];
+static bool g_event[2];
+
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_cond = PTHREAD_COND_INITIALIZER;
+
+static pthread_t g_core1_thread;
+static bool g_core1_launched = false;
+static void (*g_core1_entry)(void) = NULL;
+
+static _Thread_local uint g_core_num = 0;
+
+/********/
+/* Time */
+/********/
+
+static uint64_t g_time_origin_us = 0;
+
+static uint64_t monotonic_us(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000u + (uint64_t)t.tv_nsec / 1000u;
+}
+
+bool stdio_init_all(void) {
+    return true;
+}
+
+// Like on the device, time starts close to 0 at power up (first call)
+uint64_t time_us_64(void) {
+    pthread_mutex_lock(&g_lock);
+    if (g_time_origin_us == 0) {
+        g_time_origin_us = monotonic_us();
+    }
+    pthread_mutex_unlock(&g_lock);
+
+    return monotonic_us() - g_time_origin_us;
+}
+
+uint32_t time_us_32(void) {
+    return (uint32_t)time_us_64();
+}
+
+void sleep_us(uint64_t us) {
+    struct timespec t;
+    t.tv_sec = (time_t)(us / 1000000u);
+    t.tv_nsec = (long)(us % 1000000u) * 1000;
+    while (nanosleep(&t, &t) != 0) {
+        continue;
+    }
+}
+
+void sleep_ms(uint32_t ms) {
+    sleep_us((uint64_t)ms * 1000u);
+}
+
+void busy_wait_us(uint64_t us) {
+    const uint64_t end = monotonic_us() + us;
+    while (monotonic_us() < end) {
+        continue;
+    }
+}
+
+void busy_wait_at_least_cycles(uint32_t cycles) {
+    (void)cycles;
+}
+
+/*************/
+/* Multicore */
+/*************/
+
+uint get_core_num(void) {
+    return g_core_num;
+}
+
+static void *core1_thread(void *arg) {
+    (void)arg;
+    g_core_num = 1;
+    g_core1_entry();
+    return NULL;
+}
+
+void multicore_launch_core1(void (*entry)(void)) {
+    if (g_core1_launched) {
+        return;
+    }
+    g_core1_entry = entry;
+    g_core1_launched = pthread_create(&g_core1_thread, NULL, core1_thread,
+                                      NULL) == 0;
+}
+
+void multicore_reset_core1(void) {
+    // Core 1 cannot be stopped, it only gets launched once
+}
+
+bool multicore_fifo_rvalid(void) {
+    pthread_mutex_lock(&g_lock);
+    const bool valid = g_fifo[get_core_num()].count > 0;
+    pthread_mutex_unlock(&g_lock);
+    return valid;
+}
+
+bool multicore_fifo_wready(void) {
+    pthread_mutex_lock(&g_lock);
+    const bool ready = g_fifo[1 - get_core_num()].count < FIFO_DEPTH;
+    pthread_mutex_unlock(&g_lock);
+    return ready;
+}
+
+void multicore_fifo_push_blocking(uint32_t data) {
+    fifo *f = &g_fifo[1 - get_core_num()];
+
+    pthread_mutex_lock(&g_lock);
+    while (f->count == FIFO_DEPTH) {
+        pthread_cond_wait(&g_cond, &g_lock);
+    }
+    f->data[(f->head + f->count) % FIFO_DEPTH] = data;
+    f->count++;
+
+    // The SDK sends an event after each push
+    g_event[0] = g_event[1] = true;
+    pthread_cond_broadcast(&g_cond);
+    pthread_mutex_unlock(&g_lock);
+}
+
+uint32_t multicore_fifo_pop_blocking(void) {
+    fifo *f = &g_fifo[get_core_num()];
+
+    pthread_mutex_lock(&g_lock);
+    while (f->count == 0) {
+        pthread_cond_wait(&g_cond, &g_lock);
+    }
+    const uint32_t data = f->data[f->head];
+    f->head = (f->head + 1) % FIFO_DEPTH;
+    f->count--;
+    pthread_cond_broadcast(&g_cond);
+    pthread_mutex_unlock(&g_lock);
+
+    return data;
+}
+
+void multicore_fifo_drain(void) {
+    pthread_mutex_lock(&g_lock);
+    g_fifo[get_core_num()].count = 0;
+    pthread_cond_broadcast(&g_cond);
+    pthread_mutex_unlock(&g_lock);
+}
+
+/**********/
+/* Events */
+/**********/
+
+void __sev(void) {
+    pthread_mutex_lock(&g_lock);
+    g_event[0] = g_event[1] = true;
+    pthread_cond_broadcast(&g_cond);
+    pthread_mutex_unlock(&g_lock);
+}
+
+void __wfe(void) {
+    const uint core = get_core_num();
+
+    pthread_mutex_lock(&g_lock);
+    while (!g_event[core]) {
+        pthread_cond_wait(&g_cond, &g_lock);
+    }
+    g_event[core] = false;
+    pthread_mutex_unlock(&g_lock);
+}
+
+bool best_effort_wfe_or_timeout(absolute_time_t timeout_timestamp) {
+    const uint core = get_core_num();
+    const uint64_t now = time_us_64();
+    bool timeout = false;
+
+    if (timeout_timestamp <= now) {
+        return true;
+    }
+
+    // Condition variables wait on CLOCK_REALTIME
+    struct timespec deadline;
+    const uint64_t delay_us = timeout_timestamp - now;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += (time_t)(delay_us / 1000000u);
+    deadline.tv_nsec += (long)(delay_us % 1000000u) * 1000;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&g_lock);
+    while (!g_event[core] && !timeout) {
+        timeout = pthread_cond_timedwait(&g_cond, &g_lock, &deadline) != 0;
+    }
+    g_event[core] = false;
+    pthread_mutex_unlock(&g_lock);
+
+    return timeout;
+}
+
+/*********/
+/* Flash */
+/*********/
+
+static uint8_t *g_flash = NULL;
+static pthread_mutex_t g_flash_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// The fake DMA of the sample streamer has a transfer in progress:
+// nn_stream_pause() was not called
+static void check_stream_paused(const char *op) {
+    if (nn_host_stream_reading()) {
+        fprintf(stderr, "%s: sample stream not paused\n", op);
+        abort();
+    }
+}
+
+// Maps the file given by NN_HOST_FLASH, a new or resized file is erased
+static uint8_t *map_flash_file(const char *path) {
+    struct stat st;
+    const int fd = open(path, O_RDWR | O_CREAT, 0644);
+
+    if (fd < 0) {
+        perror(path);
+        return NULL;
+    }
+
+    const bool erase = fstat(fd, &st) != 0 || st.st_size != PICO_FLASH_SIZE_BYTES;
+    if (erase && ftruncate(fd, PICO_FLASH_SIZE_BYTES) != 0) {
+        perror(path);
+        close(fd);
+        return NULL;
+    }
+
+    uint8_t *mem = mmap(NULL, PICO_FLASH_SIZE_BYTES, PROT_READ | PROT_WRITE,
+                        MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (mem == MAP_FAILED) {
+        perror(path);
+        return NULL;
+    }
+    if (erase) {
+        memset(mem, 0xFF, PICO_FLASH_SIZE_BYTES);
+    }
+    return mem;
+}
+
+uint8_t *pico_host_flash_memory(void) {
+    pthread_mutex_lock(&g_flash_lock);
+    if (g_flash == NULL) {
+        const char *path = getenv("NN_HOST_FLASH");
+
+        if (path != NULL) {
+            g_flash = map_flash_file(path);
+        }
+        if (g_flash == NULL) {
+            g_flash = malloc(PICO_FLASH_SIZE_BYTES);
+            memset(g_flash, 0xFF, PICO_FLASH_SIZE_BYTES);
+        }
+    }
+    pthread_mutex_unlock(&g_flash_lock);
+    return g_flash;
+}
+
+void flash_range_erase(uint32_t flash_offs, size_t count) {
+    uint8_t *flash = pico_host_flash_memory();
+
+    if (flash_offs % FLASH_SECTOR_SIZE != 0 || count % FLASH_SECTOR_SIZE != 0 ||
+        flash_offs + count > PICO_FLASH_SIZE_BYTES)
+    {
+        fprintf(stderr, "flash_range_erase: invalid range 0x%x + %zu\n",
+                (unsigned)flash_offs, count);
+        abort();
+    }
+    check_stream_paused("flash_range_erase");
+    memset(flash + flash_offs, 0xFF, count);
+}
+
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count) {
+    uint8_t *flash = pico_host_flash_memory();
+
+    if (flash_offs % FLASH_PAGE_SIZE != 0 || count % FLASH_PAGE_SIZE != 0 ||
+        flash_offs + count > PICO_FLASH_SIZE_BYTES)
+    {
+        fprintf(stderr, "flash_range_program: invalid range 0x%x + %zu\n",
+                (unsigned)flash_offs, count);
+        abort();
+    }
+
+    check_stream_paused("flash_range_program");
+
+    // Programming can only clear bits
+    for (size_t i = 0; i < count; i++) {
+        flash[flash_offs + i] &= data[i];
+    }
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include <pthread.h>
+#include "sample_stream_dma.h"
+#include "sample_stream_dma_host.h"
+
+typedef struct fake_transfer {
+    const void *src;
+    void *dst;
+    uint32_t words;
+    bool started;
+} fake_transfer;
+
+static fake_transfer g_transfer;
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+
+bool nn_stream_dma_init(void) {
+    return true;
+}
+
+// There is no XIP cache on the host
+const uint8_t *nn_stream_dma_source(const void *data) {
+    return data;
+}
+
+void nn_stream_dma_start(const void *src, void *dst, uint32_t words) {
+    pthread_mutex_lock(&g_lock);
+    g_transfer = (fake_transfer){src, dst, words, true};
+    pthread_mutex_unlock(&g_lock);
+}
+
+bool nn_host_stream_dma_run(void) {
+    pthread_mutex_lock(&g_lock);
+    const bool started = g_transfer.started;
+    if (started) {
+        memcpy(g_transfer.dst, g_transfer.src, g_transfer.words * 4);
+        g_transfer.started = false;
+    }
+    pthread_mutex_unlock(&g_lock);
+
+    // The completion may start the next transfer
+    if (started) {
+        nn_stream_dma_done();
+    }
+    return started;
+}
+
+// The interrupts are enabled while nn_stream_pause() waits, the completion
+// runs as soon as the transfer ends
+void nn_stream_dma_wait(void) {
+    nn_host_stream_dma_run();
+}
+
+bool nn_host_stream_reading(void) {
+    pthread_mutex_lock(&g_lock);
+    const bool reading = g_transfer.started;
+    pthread_mutex_unlock(&g_lock);
+    return reading;
+}
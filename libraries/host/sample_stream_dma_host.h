@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file sample_stream_dma_host.h
+ * @brief Fake DMA of the sample streamer on the host.
+ *
+ * The host build runs the scheduling of sample_stream.c unchanged on top of
+ * a fake DMA (sample_stream_dma.h). A transfer started by sample_stream.c
+ * only ends when nn_host_stream_dma_run() or nn_stream_pause() is called:
+ * the data is copied, then the completion interrupt runs. Until then the
+ * voices read the flash directly, as when the DMA is late on the device.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Completes the transfer in progress
+ *
+ * @details Copies the data, then runs the completion interrupt, which may
+ * start the next transfer.
+ *
+ * @return true if a transfer was in progress, false otherwise.
+ */
+bool nn_host_stream_dma_run(void);
+
+/**
+ * @brief Checks if the fake DMA has a transfer in progress
+ *
+ * @details Used by the flash emulation of pico_host.c: on the device, the
+ * DMA would read the flash during the operation.
+ */
+bool nn_host_stream_reading(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,49 @@
+// This file is generated by samples_compiler.py, do not edit
+#include "tone_adpcm.h"
+
+namespace fixdsp {
+    namespace samples {
+
+        // tone.wav: 1000 samples at 22050 Hz, 544 bytes
+        static const uint8_t smp_adpcm_tone_data[] __attribute__((aligned(4))) = {
+            0, 0, 0, 0, 112, 119, 119, 119, 119, 7, 0, 136, 136, 153, 169, 170,
+            187, 203, 171, 172, 170, 169, 136, 24, 49, 53, 53, 68, 51, 52, 36, 51,
+            35, 35, 18, 0, 185, 235, 219, 188, 219, 187, 172, 172, 186, 170, 169, 137,
+            0, 50, 69, 83, 67, 67, 51, 52, 51, 51, 50, 33, 128, 169, 204, 189,
+            204, 203, 187, 188, 220, 235, 62, 0, 172, 171, 171, 154, 137, 24, 50, 69,
+            52, 53, 67, 36, 51, 67, 34, 34, 2, 129, 153, 188, 189, 189, 188, 188,
+            203, 187, 187, 187, 170, 137, 24, 67, 84, 67, 52, 52, 36, 36, 50, 50,
+            34, 18, 128, 169, 219, 204, 219, 187, 204, 186, 187, 172, 170, 170, 152, 16,
+            65, 83, 83, 67, 67, 67, 50, 51, 47, 36, 57, 0, 51, 35, 18, 129,
+            169, 220, 219, 219, 187, 188, 203, 187, 172, 170, 154, 137, 0, 50, 84, 83,
+            67, 51, 37, 51, 36, 50, 18, 18, 128, 168, 219, 188, 189, 188, 188, 172,
+            187, 187, 187, 155, 138, 16, 66, 84, 67, 52, 52, 52, 51, 67, 35, 34,
+            18, 128, 169, 219, 204, 219, 187, 204, 186, 203, 170, 171, 181, 217, 53, 0,
+            154, 137, 0, 50, 69, 52, 52, 37, 67, 35, 67, 34, 18, 18, 128, 153,
+            219, 219, 219, 187, 188, 172, 203, 170, 170, 170, 152, 16, 49, 69, 83, 67,
+            67, 51, 67, 51, 51, 35, 18, 128, 184, 204, 204, 188, 188, 188, 172, 187,
+            203, 170, 169, 152, 16, 49, 53, 53, 53, 67, 67, 51, 51, 51, 35, 34,
+            59, 32, 44, 0, 128, 169, 220, 188, 204, 188, 203, 187, 203, 171, 171, 170,
+            137, 16, 50, 85, 67, 52, 52, 67, 51, 36, 35, 34, 17, 129, 169, 219,
+            204, 203, 188, 172, 172, 187, 171, 187, 170, 137, 24, 51, 70, 83, 67, 67,
+            51, 52, 50, 51, 35, 18, 129, 169, 204, 189, 204, 203, 187, 188, 203, 186,
+            170, 170, 137, 0, 138, 232, 40, 0, 66, 83, 52, 53, 67, 67, 51, 51,
+            51, 51, 18, 129, 185, 220, 219, 188, 188, 188, 203, 171, 203, 154, 154, 137,
+            24, 49, 53, 53, 68, 51, 119, 119, 4, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 240, 255, 141, 128, 8, 136, 128, 8, 136, 128, 8, 136, 128, 119,
+            7, 0, 0, 0, 0, 0, 0, 0, 255, 127, 73, 0, 0, 0, 0, 240,
+            255, 136, 128, 8, 136, 128, 8, 136, 128, 8, 136, 128, 119, 7, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 240, 255, 136, 128, 8, 136, 128, 8,
+            136, 128, 8, 136, 128, 119, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 240, 255, 136, 128, 8, 136, 128, 8, 136, 128, 8, 42, 131, 70, 0,
+            136, 128, 119, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 255,
+            136, 128, 8, 136, 128, 8, 136, 128, 8, 136, 128, 119, 7, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 240, 255, 136, 128, 8, 136, 128, 8, 136,
+            128, 8, 136, 128, 119, 1, 8, 128, 8, 128, 8, 128, 128, 8, 128, 8,
+        };
+
+        const sample::SampleData smp_adpcm_tone = {
+            sample::FORMAT_IMA_ADPCM, 22050, 1000, 128, 68, smp_adpcm_tone_data
+        };
+    }
+}
@@ -0,0 +1,79 @@
+// This file is generated by samples_compiler.py, do not edit
+#include "tone_mulaw.h"
+
+namespace fixdsp {
+    namespace samples {
+
+        // tone.wav: 1000 samples at 22050 Hz, 1024 bytes
+        static const uint8_t smp_mulaw_tone_data[] __attribute__((aligned(4))) = {
+            255, 177, 162, 154, 147, 142, 140, 137, 135, 133, 132, 131, 131, 131, 132, 133,
+            134, 136, 138, 140, 143, 148, 155, 163, 179, 255, 51, 36, 27, 21, 15, 13,
+            11, 9, 7, 6, 5, 5, 5, 5, 6, 7, 9, 11, 13, 16, 22, 28,
+            37, 52, 255, 181, 165, 156, 151, 145, 142, 140, 138, 136, 135, 135, 134, 134,
+            135, 136, 137, 138, 140, 142, 146, 152, 157, 167, 182, 255, 54, 39, 29, 24,
+            19, 15, 13, 11, 10, 9, 8, 8, 8, 8, 9, 10, 12, 13, 16, 20,
+            25, 30, 40, 56, 255, 184, 168, 159, 153, 149, 144, 142, 140, 139, 138, 138,
+            137, 137, 138, 138, 140, 141, 143, 145, 150, 154, 159, 170, 185, 255, 57, 42,
+            32, 27, 22, 18, 15, 14, 12, 11, 11, 11, 11, 11, 12, 13, 14, 16,
+            19, 23, 28, 33, 43, 58, 255, 186, 171, 162, 156, 152, 148, 145, 143, 142,
+            141, 140, 140, 140, 140, 141, 142, 143, 146, 149, 153, 157, 163, 172, 187, 255,
+            60, 44, 35, 29, 25, 22, 19, 16, 15, 14, 13, 13, 13, 13, 14, 15,
+            17, 19, 23, 26, 30, 37, 45, 61, 255, 189, 173, 165, 158, 155, 151, 148,
+            146, 144, 143, 142, 142, 142, 143, 143, 144, 146, 149, 152, 155, 159, 166, 174,
+            190, 255, 62, 46, 39, 31, 28, 25, 22, 20, 18, 16, 15, 15, 15, 16,
+            17, 18, 20, 23, 25, 29, 32, 40, 47, 63, 255, 191, 175, 168, 161, 157,
+            154, 151, 149, 147, 146, 145, 145, 145, 145, 147, 148, 150, 152, 155, 158, 162,
+            169, 177, 192, 255, 64, 49, 41, 35, 30, 27, 25, 23, 21, 20, 19, 19,
+            19, 19, 20, 22, 23, 26, 28, 31, 36, 42, 51, 66, 255, 194, 179, 171,
+            165, 159, 157, 154, 152, 151, 150, 149, 148, 149, 149, 150, 151, 153, 155, 157,
+            160, 166, 172, 180, 195, 255, 67, 53, 44, 38, 33, 30, 28, 26, 24, 23,
+            22, 22, 22, 23, 23, 25, 26, 28, 30, 34, 39, 45, 54, 69, 255, 197,
+            182, 173, 168, 163, 159, 157, 155, 154, 153, 152, 152, 152, 152, 153, 154, 155,
+            157, 159, 164, 169, 174, 184, 198, 255, 70, 56, 46, 41, 36, 32, 30, 28,
+            27, 26, 25, 25, 25, 25, 26, 27, 29, 30, 33, 37, 42, 47, 57, 72,
+            255, 200, 185, 175, 170, 166, 162, 159, 157, 156, 155, 155, 154, 154, 155, 155,
+            157, 158, 159, 163, 167, 171, 176, 186, 201, 255, 73, 58, 49, 44, 39, 36,
+            32, 30, 29, 28, 28, 28, 28, 28, 29, 30, 31, 33, 37, 40, 44, 50,
+            59, 74, 255, 202, 188, 179, 173, 169, 165, 162, 159, 158, 158, 157, 157, 157,
+            157, 158, 159, 160, 163, 166, 170, 174, 180, 189, 203, 255, 76, 61, 52, 46,
+            42, 39, 36, 33, 31, 31, 30, 30, 30, 30, 31, 32, 34, 37, 40, 43,
+            47, 54, 62, 77, 255, 205, 190, 182, 175, 171, 168, 166, 163, 161, 160, 159,
+            159, 159, 159, 160, 162, 164, 166, 169, 172, 176, 183, 191, 206, 255, 78, 63,
+            55, 48, 45, 42, 39, 37, 35, 34, 33, 32, 33, 33, 34, 36, 37, 40,
+            42, 45, 50, 56, 64, 79, 255, 207, 192, 185, 178, 174, 171, 169, 166, 165,
+            163, 163, 162, 162, 163, 164, 165, 167, 169, 172, 174, 179, 186, 194, 207, 255,
+            80, 66, 58, 52, 47, 44, 42, 40, 38, 37, 36, 36, 36, 37, 37, 39,
+            40, 42, 45, 47, 53, 59, 67, 81, 255, 209, 196, 187, 182, 176, 173, 171,
+            169, 168, 167, 166, 166, 166, 166, 167, 168, 170, 172, 174, 177, 183, 188, 197,
+            211, 255, 83, 69, 61, 55, 50, 46, 44, 43, 41, 40, 40, 39, 39, 40,
+            40, 42, 43, 45, 47, 51, 56, 61, 70, 84, 255, 212, 199, 190, 184, 180,
+            175, 174, 172, 171, 170, 169, 169, 169, 169, 170, 171, 172, 174, 176, 181, 185,
+            190, 200, 214, 255, 86, 72, 63, 58, 53, 49, 47, 45, 44, 43, 42, 42,
+            42, 42, 43, 44, 45, 47, 50, 54, 59, 63, 73, 87, 128, 128, 128, 128,
+            128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+            128, 128, 128, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128,
+            128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+            128, 128, 128, 128, 128, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+            128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+            128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+            128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+            128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        };
+
+        const sample::SampleData smp_mulaw_tone = {
+            sample::FORMAT_MU_LAW, 22050, 1000, 256, 256, smp_mulaw_tone_data
+        };
+    }
+}
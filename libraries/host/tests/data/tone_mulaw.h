@@ -0,0 +1,10 @@
+// This file is generated by samples_compiler.py, do not edit
+#pragma once
+
+#include "sample_decoder.h"
+
+namespace fixdsp {
+    namespace samples {
+        extern const sample::SampleData smp_mulaw_tone;
+    }
+}
@@ -0,0 +1,79 @@
+// This file is generated by samples_compiler.py, do not edit
+#include "tone_s8.h"
+
+namespace fixdsp {
+    namespace samples {
+
+        // tone.wav: 1000 samples at 22050 Hz, 1024 bytes
+        static const uint8_t smp_s8_tone_data[] __attribute__((aligned(4))) = {
+            0, 14, 28, 42, 55, 68, 79, 88, 96, 103, 108, 111, 113, 113, 111, 107,
+            101, 94, 86, 76, 65, 53, 40, 27, 13, 0, 242, 228, 215, 203, 192, 181,
+            172, 164, 158, 153, 150, 149, 149, 151, 155, 160, 166, 174, 184, 194, 205, 217,
+            230, 243, 0, 12, 25, 37, 49, 60, 69, 78, 85, 91, 95, 98, 100, 99,
+            98, 94, 89, 83, 76, 67, 57, 47, 36, 24, 12, 0, 243, 231, 220, 209,
+            199, 190, 182, 175, 170, 165, 163, 161, 162, 163, 167, 171, 177, 184, 192, 201,
+            211, 222, 233, 244, 0, 11, 22, 33, 43, 52, 61, 69, 75, 80, 84, 87,
+            88, 88, 86, 83, 79, 73, 67, 59, 51, 41, 31, 21, 10, 0, 245, 234,
+            224, 215, 206, 198, 191, 185, 180, 176, 174, 172, 173, 174, 177, 181, 186, 192,
+            200, 208, 216, 226, 235, 245, 0, 10, 19, 29, 38, 46, 54, 60, 66, 71,
+            74, 76, 78, 77, 76, 73, 70, 65, 59, 52, 45, 36, 28, 18, 9, 0,
+            246, 237, 228, 219, 212, 204, 198, 193, 189, 185, 183, 182, 182, 184, 186, 190,
+            194, 200, 206, 213, 221, 229, 238, 247, 0, 8, 17, 25, 33, 41, 47, 53,
+            58, 62, 65, 67, 68, 68, 67, 65, 61, 57, 52, 46, 39, 32, 24, 16,
+            8, 0, 247, 239, 231, 224, 217, 210, 205, 200, 196, 194, 192, 191, 191, 192,
+            194, 197, 201, 206, 212, 218, 225, 232, 240, 248, 0, 7, 15, 22, 29, 36,
+            42, 47, 51, 55, 58, 59, 60, 60, 59, 57, 54, 50, 46, 40, 35, 28,
+            21, 14, 7, 0, 248, 241, 234, 227, 221, 216, 211, 207, 203, 201, 199, 198,
+            199, 200, 202, 204, 208, 212, 217, 223, 229, 235, 242, 249, 0, 6, 13, 20,
+            26, 32, 37, 41, 45, 48, 51, 52, 53, 53, 52, 50, 48, 44, 40, 36,
+            30, 25, 19, 12, 6, 0, 249, 243, 237, 231, 225, 220, 216, 212, 209, 207,
+            206, 205, 205, 206, 208, 210, 213, 217, 222, 226, 232, 237, 243, 249, 0, 6,
+            12, 17, 23, 28, 32, 36, 40, 43, 45, 46, 47, 47, 46, 44, 42, 39,
+            35, 31, 27, 22, 17, 11, 5, 0, 250, 244, 239, 234, 229, 225, 221, 218,
+            215, 213, 212, 211, 211, 212, 213, 216, 218, 222, 226, 230, 235, 240, 245, 250,
+            0, 5, 10, 15, 20, 25, 29, 32, 35, 38, 39, 41, 41, 41, 40, 39,
+            37, 34, 31, 28, 24, 19, 15, 10, 5, 0, 250, 245, 241, 236, 232, 228,
+            225, 222, 220, 218, 217, 216, 216, 217, 218, 220, 223, 226, 229, 233, 237, 241,
+            246, 251, 0, 4, 9, 13, 18, 22, 25, 28, 31, 33, 35, 36, 36, 36,
+            36, 34, 33, 30, 28, 24, 21, 17, 13, 8, 4, 0, 251, 247, 242, 238,
+            235, 231, 228, 226, 224, 222, 221, 221, 221, 222, 223, 224, 227, 229, 232, 236,
+            239, 243, 247, 251, 0, 4, 8, 12, 16, 19, 22, 25, 27, 29, 31, 32,
+            32, 32, 31, 30, 29, 27, 24, 21, 18, 15, 11, 7, 3, 0, 252, 248,
+            244, 240, 237, 234, 232, 229, 228, 226, 225, 225, 225, 226, 227, 228, 230, 232,
+            235, 238, 241, 245, 248, 252, 0, 3, 7, 10, 14, 17, 19, 22, 24, 26,
+            27, 28, 28, 28, 28, 27, 25, 23, 21, 19, 16, 13, 10, 6, 3, 0,
+            252, 249, 245, 242, 239, 237, 234, 232, 231, 230, 229, 229, 229, 229, 230, 231,
+            233, 235, 237, 240, 243, 246, 249, 252, 0, 3, 6, 9, 12, 15, 17, 19,
+            21, 23, 24, 24, 25, 25, 24, 23, 22, 21, 19, 17, 14, 11, 9, 6,
+            3, 0, 252, 249, 247, 244, 241, 239, 237, 235, 234, 233, 232, 232, 232, 232,
+            233, 234, 236, 237, 239, 242, 244, 247, 250, 253, 0, 2, 5, 8, 11, 13,
+            15, 17, 19, 20, 21, 22, 22, 22, 21, 21, 20, 18, 16, 15, 12, 10,
+            8, 5, 2, 0, 253, 250, 248, 245, 243, 241, 239, 238, 236, 235, 235, 235,
+            235, 235, 236, 237, 238, 240, 241, 243, 246, 248, 250, 253, 127, 127, 127, 127,
+            127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+            127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+            128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127,
+            127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+            127, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+            128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+            127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+            127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 128,
+            128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+            128, 128, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+            127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128,
+            128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+            128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+            127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 128, 128,
+            128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+            128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+            127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128,
+            128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+            128, 128, 128, 128, 128, 128, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        };
+
+        const sample::SampleData smp_s8_tone = {
+            sample::FORMAT_S8, 22050, 1000, 256, 256, smp_s8_tone_data
+        };
+    }
+}
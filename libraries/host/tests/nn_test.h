@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file nn_test.h
+ * @brief Minimal check macros for the host unit tests.
+ *
+ * Each test is an executable registered with add_test() in
+ * libraries/host/CMakeLists.txt. Failed checks are printed and counted, and
+ * main() returns nn_test_result().
+ */
+
+#pragma once
+#include <stdio.h>
+#include <stdbool.h>
+
+static int nn_test_failures = 0;
+
+#define NN_CHECK(cond)                                                  \
+    do {                                                                \
+        if (!(cond)) {                                                  \
+            fprintf(stderr, "%s:%d: check failed: %s\n",                \
+                    __FILE__, __LINE__, #cond);                         \
+            nn_test_failures++;                                         \
+        }                                                               \
+    } while (0)
+
+#define NN_CHECK_EQ(a, b)                                               \
+    do {                                                                \
+        const long long nn_a_ = (long long)(a);                         \
+        const long long nn_b_ = (long long)(b);                         \
+        if (nn_a_ != nn_b_) {                                           \
+            fprintf(stderr, "%s:%d: check failed: %s == %s (%lld != %lld)\n", \
+                    __FILE__, __LINE__, #a, #b, nn_a_, nn_b_);          \
+            nn_test_failures++;                                         \
+        }                                                               \
+    } while (0)
+
+static inline int nn_test_result(const char *name) {
+    if (nn_test_failures) {
+        fprintf(stderr, "%s: %d check(s) failed\n", name, nn_test_failures);
+        return 1;
+    }
+    printf("%s: OK\n", name);
+    return 0;
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "nn_test.h"
+#include "noise_nugget.h"
+
+static const uint32_t rates[] = {8000, 16000, 22050, 32000, 44100, 48000};
+
+#define NUM_RATES (sizeof(rates) / sizeof(rates[0]))
+
+// Checks a plan against the RP2040 PLL and PIO limits
+static void check_plan(uint32_t rate, const nn_clock_constraints *c,
+                       const nn_clock_plan *p) {
+    const uint32_t post = p->post_div1 * p->post_div2;
+
+    NN_CHECK(p->fbdiv >= 16 && p->fbdiv <= 320);
+    NN_CHECK_EQ(p->vco_hz, (uint64_t)c->xosc_hz * p->fbdiv);
+    NN_CHECK(p->vco_hz >= 750000000u && p->vco_hz <= 1600000000u);
+    NN_CHECK(p->post_div1 >= 1 && p->post_div1 <= 7);
+    NN_CHECK(p->post_div2 >= 1 && p->post_div2 <= p->post_div1);
+    NN_CHECK_EQ(p->vco_hz % post, 0);
+    NN_CHECK_EQ(p->sys_hz, p->vco_hz / post);
+    NN_CHECK(p->sys_hz >= c->min_sys_hz && p->sys_hz <= c->max_sys_hz);
+
+    NN_CHECK(p->pio_div_int >= 1);
+    NN_CHECK(p->error_ppm <= (int32_t)c->max_error_ppm &&
+             p->error_ppm >= -(int32_t)c->max_error_ppm);
+    NN_CHECK_EQ(p->cycles_per_frame, p->sys_hz / rate);
+
+    // The divider gives the reported rate and error
+    const double div = p->pio_div_int + p->pio_div_frac / 256.0;
+    const double actual =
+        p->sys_hz / (div * NN_I2S_PIO_CYCLES_PER_FRAME);
+    const double ppm = (actual - rate) * 1e6 / rate;
+
+    NN_CHECK_EQ(p->actual_rate, (uint32_t)(actual + 0.5));
+    NN_CHECK(ppm - p->error_ppm > -1.0 && ppm - p->error_ppm < 1.0);
+}
+
+// Highest system clock with an integer divider, by brute force over the
+// system clocks in 1kHz steps
+static uint32_t best_integer_sys_hz(uint32_t rate,
+                                    const nn_clock_constraints *c) {
+    const uint32_t pio_hz = rate * NN_I2S_PIO_CYCLES_PER_FRAME;
+    uint32_t best = 0;
+
+    for (uint32_t fbdiv = 16; fbdiv <= 320; fbdiv++) {
+        const uint64_t vco = (uint64_t)c->xosc_hz * fbdiv;
+
+        if (vco < 750000000u || vco > 1600000000u) {
+            continue;
+        }
+        for (uint32_t post = 1; post <= 49; post++) {
+            // post must be a product of two dividers in 1..7
+            bool valid = false;
+            for (uint32_t pd1 = 1; pd1 <= 7; pd1++) {
+                if (post % pd1 == 0 && post / pd1 <= 7) {
+                    valid = true;
+                }
+            }
+            if (!valid || vco % post != 0) {
+                continue;
+            }
+
+            const uint32_t sys = (uint32_t)(vco / post);
+            if (sys < c->min_sys_hz || sys > c->max_sys_hz) {
+                continue;
+            }
+            if (sys % pio_hz == 0 && sys > best) {
+                best = sys;
+            }
+        }
+    }
+    return best;
+}
+
+int main(void) {
+    const uint32_t limits_khz[] = {NN_SYS_CLOCK_PLAN_MAX_KHZ, 133000, 250000};
+
+    // Default limits: flash SPI within NN_FLASH_SPI_MAX_KHZ
+    NN_CHECK(NN_SYS_CLOCK_PLAN_MAX_KHZ / PICO_FLASH_SPI_CLKDIV
+             <= NN_FLASH_SPI_MAX_KHZ);
+
+    for (size_t l = 0; l < sizeof(limits_khz) / sizeof(limits_khz[0]); l++) {
+        nn_clock_constraints c;
+        nn_clock_constraints_init(&c, limits_khz[l] * 1000);
+
+        for (size_t r = 0; r < NUM_RATES; r++) {
+            nn_clock_plan plan;
+
+            NN_CHECK(nn_clock_plan_for_rate(rates[r], &c, &plan));
+            check_plan(rates[r], &c, &plan);
+
+            // An integer divider is chosen whenever one exists, at the
+            // highest system clock
+            const uint32_t best = best_integer_sys_hz(rates[r], &c);
+            if (best != 0) {
+                NN_CHECK_EQ(plan.pio_div_frac, 0);
+                NN_CHECK_EQ(plan.error_ppm, 0);
+                NN_CHECK_EQ(plan.sys_hz, best);
+            }
+        }
+    }
+
+    // The default limit gives an integer divider for the main rates
+    {
+        nn_clock_constraints c;
+        nn_clock_constraints_init(&c, NN_SYS_CLOCK_PLAN_MAX_KHZ * 1000);
+
+        const uint32_t integer_rates[] = {8000, 16000, 44100, 48000};
+        for (size_t r = 0; r < 4; r++) {
+            nn_clock_plan plan;
+            NN_CHECK(nn_clock_plan_for_rate(integer_rates[r], &c, &plan));
+            NN_CHECK_EQ(plan.pio_div_frac, 0);
+        }
+    }
+
+    // No candidate within the error limit
+    {
+        nn_clock_constraints c;
+        nn_clock_plan plan;
+        nn_clock_constraints_init(&c, 126000000);
+        c.max_error_ppm = 0;
+        NN_CHECK(!nn_clock_plan_for_rate(22050, &c, &plan));
+    }
+
+    // Fixed system clock fallback
+    {
+        nn_clock_plan plan;
+
+        NN_CHECK(nn_clock_plan_fixed(48000, 125000000, &plan));
+        NN_CHECK_EQ(plan.vco_hz, 0);
+        NN_CHECK_EQ(plan.sys_hz, 125000000);
+        NN_CHECK_EQ(plan.pio_div_int, 20);
+        NN_CHECK_EQ(plan.pio_div_frac, 88); // 20.345
+        NN_CHECK_EQ(plan.actual_rate, 48003);
+
+        NN_CHECK(nn_clock_plan_fixed(48000, 153600000, &plan));
+        NN_CHECK_EQ(plan.pio_div_int, 25);
+        NN_CHECK_EQ(plan.pio_div_frac, 0);
+        NN_CHECK_EQ(plan.error_ppm, 0);
+
+        // Divider below 1
+        NN_CHECK(!nn_clock_plan_fixed(48000, 1000000, &plan));
+    }
+
+    return nn_test_result("clock_planner");
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <math.h>
+#include "nn_test.h"
+#include "dac_eq.h"
+
+#define RATE 48000
+
+// Magnitude response (dB) of the quantized coefficients at freq_hz
+static double response_db(const nn_dac_eq_coefs *c, double freq_hz) {
+    const double w = 2.0 * M_PI * freq_hz / RATE;
+    const double n[2][3] = {{c->n0, 2.0 * c->n1, c->n2},
+                            {c->n3, 2.0 * c->n4, c->n5}};
+    const double d[2][3] = {{32768.0, -2.0 * c->d1, -c->d2},
+                            {32768.0, -2.0 * c->d4, -c->d5}};
+    double gain = 1.0;
+
+    for (int s = 0; s < 2; s++) {
+        double nr = 0, ni = 0, dr = 0, di = 0;
+        for (int k = 0; k < 3; k++) {
+            nr += n[s][k] * cos(k * w);
+            ni -= n[s][k] * sin(k * w);
+            dr += d[s][k] * cos(k * w);
+            di -= d[s][k] * sin(k * w);
+        }
+        gain *= sqrt((nr * nr + ni * ni) / (dr * dr + di * di));
+    }
+    return 20.0 * log10(gain);
+}
+
+static double peak_db(const nn_dac_eq_coefs *c) {
+    double peak = -1000.0;
+    for (double f = 5.0; f < RATE / 2; f *= 1.005) {
+        const double db = response_db(c, f);
+        if (db > peak) peak = db;
+    }
+    return peak;
+}
+
+int main(void) {
+    nn_dac_eq_coefs c;
+
+    // Flat
+    {
+        const nn_eq_band bands[2] = {{NN_EQ_FLAT, 0, 0, 0},
+                                     {NN_EQ_PEAK, 1000, 0, 1}};
+        NN_CHECK(nn_dac_eq_compute(bands, RATE, &c));
+        NN_CHECK(fabs(c.headroom_db) < 0.001);
+        NN_CHECK(fabs(response_db(&c, 1000)) < 0.01);
+    }
+
+    // +6dB low shelf: the boost is turned into a cut of the highs
+    {
+        const nn_eq_band bands[2] = {{NN_EQ_LOW_SHELF, 200, 6, 0.707f},
+                                     {NN_EQ_FLAT, 0, 0, 0}};
+        NN_CHECK(nn_dac_eq_compute(bands, RATE, &c));
+        // Q15 rounding changes the DC gain of the shelf by about 0.5dB
+        NN_CHECK(c.headroom_db < -6.0 && c.headroom_db > -7.0);
+        NN_CHECK(peak_db(&c) < 0.01);
+        NN_CHECK(fabs(response_db(&c, 10000) - c.headroom_db) < 0.1);
+    }
+
+    // High-Q shelf overshoot and a narrow peak, in cascade
+    {
+        const nn_eq_band bands[2] = {{NN_EQ_HIGH_SHELF, 8000, 9, 2.0f},
+                                     {NN_EQ_PEAK, 120, 12, 8.0f}};
+        NN_CHECK(nn_dac_eq_compute(bands, RATE, &c));
+        NN_CHECK(c.headroom_db < -21.0);
+        NN_CHECK(peak_db(&c) < 0.05);
+    }
+
+    // Cuts are not scaled
+    {
+        const nn_eq_band bands[2] = {{NN_EQ_PEAK, 1000, -12, 1.0f},
+                                     {NN_EQ_HIGH_SHELF, 5000, -6, 0.707f}};
+        NN_CHECK(nn_dac_eq_compute(bands, RATE, &c));
+        NN_CHECK(fabs(c.headroom_db) < 0.001);
+        NN_CHECK(fabs(response_db(&c, 1000) + 12.0) < 0.2);
+    }
+
+    // Invalid bands
+    {
+        const nn_eq_band nyquist[2] = {{NN_EQ_PEAK, RATE / 2, 3, 1},
+                                       {NN_EQ_FLAT, 0, 0, 0}};
+        const nn_eq_band no_q[2] = {{NN_EQ_FLAT, 0, 0, 0},
+                                    {NN_EQ_PEAK, 1000, 3, 0}};
+        NN_CHECK(!nn_dac_eq_compute(nyquist, RATE, &c));
+        NN_CHECK(!nn_dac_eq_compute(no_q, RATE, &c));
+        NN_CHECK(!nn_dac_eq_compute(no_q, 0, &c));
+    }
+
+    return nn_test_result("dac_eq");
+}
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "nn_test.h"
+#include "midi_clock.h"
+
+#define RATE 48000
+#define BLOCK 64
+#define TICK ((uint64_t)1 << 32)
+
+// 120 BPM: 48000 * 60 / (120 * 24) frames per tick
+#define PERIOD_120 1000
+
+// +/-4ms
+#define JITTER_MAX (RATE * 4 / 1000)
+
+static midi_clock clk;
+
+// Follower input: the clock is polled every audio block between events
+static uint32_t frame;
+static uint64_t last_pos;
+static int64_t last_tick;
+static uint64_t max_block_step;
+static uint64_t cursor;
+static uint32_t last_step;
+static bool has_step;
+
+static uint32_t rand_state = 1;
+
+// Uniform in [-JITTER_MAX, JITTER_MAX]
+static int32_t jitter(void) {
+    rand_state = rand_state * 1664525u + 1013904223u;
+    return (int32_t)((rand_state >> 16) % (2 * JITTER_MAX + 1)) - JITTER_MAX;
+}
+
+static void event(uint32_t msg, uint32_t at) {
+    const midi_event ev = {msg, at, 0};
+    NN_CHECK(midi_clock_event(&clk, &ev));
+    if (msg == 0xF8) {
+        last_tick++;
+    }
+}
+
+// Checks the position continuity on every block up to frame end
+static void run_until(uint32_t end) {
+    while ((int32_t)(end - frame) > 0) {
+        uint32_t len = end - frame < BLOCK ? end - frame : BLOCK;
+        midi_clock_step steps[4];
+        const uint32_t n = midi_clock_steps(&clk, &cursor, frame, len, 6,
+                                            steps, 4);
+
+        // Each step once, in order
+        for (uint32_t i = 0; i < n; i++) {
+            if (has_step) {
+                NN_CHECK_EQ(steps[i].step, last_step + 1);
+            }
+            NN_CHECK(steps[i].offset < len);
+            last_step = steps[i].step;
+            has_step = true;
+        }
+
+        frame += len;
+
+        const uint64_t pos = midi_clock_position(&clk, frame);
+
+        // Never backward, never more than a tick ahead of the input
+        NN_CHECK(pos >= last_pos);
+        if (midi_clock_running(&clk) && last_tick >= 0) {
+            NN_CHECK(pos <= (uint64_t)(last_tick + 1) * TICK);
+        }
+        if (pos - last_pos > max_block_step) {
+            max_block_step = pos - last_pos;
+        }
+        last_pos = pos;
+    }
+}
+
+static void reset_follower(void) {
+    midi_clock_init(&clk, RATE);
+    frame = 1000;
+    last_pos = 0;
+    last_tick = -1;
+    max_block_step = 0;
+    cursor = 0;
+    has_step = false;
+    rand_state = 1;
+}
+
+// Sends count ticks at period frames with jitter, starting at tick_frame
+static uint32_t ticks(uint32_t tick_frame, uint32_t period, int count,
+                      bool jittery) {
+    for (int i = 0; i < count; i++) {
+        const uint32_t at = tick_frame + (jittery ? jitter() : 0);
+        run_until(at);
+        event(0xF8, at);
+        tick_frame += period;
+    }
+    return tick_frame;
+}
+
+static void test_jitter(void) {
+    reset_follower();
+
+    event(0xFA, frame);
+    uint32_t next = ticks(frame + 100, PERIOD_120, 24 * 16, true);
+    run_until(next);
+
+    // An early tick after a late one is off by twice the input jitter,
+    // plus the correction still in progress
+    NN_CHECK(midi_clock_jitter_max(&clk) > JITTER_MAX);
+    NN_CHECK(midi_clock_jitter_max(&clk) <= 2 * JITTER_MAX + JITTER_MAX / 4);
+
+    // The period is averaged
+    const uint32_t bpm = midi_clock_bpm(&clk);
+    NN_CHECK(bpm > 11700 && bpm < 12300);
+
+    // Smooth speed: at most 4x the nominal speed over a block
+    NN_CHECK(max_block_step <= 4 * (uint64_t)BLOCK * TICK / PERIOD_120);
+    NN_CHECK_EQ(last_step, 24 * 16 / 6 - 1);
+}
+
+static void test_relock(void) {
+    reset_follower();
+
+    event(0xFA, frame);
+    uint32_t next = ticks(frame + 100, PERIOD_120, 48, false);
+    NN_CHECK_EQ(midi_clock_bpm(&clk), 12000);
+
+    // 120 to 300 BPM: out of range intervals are rejected as jitter
+    // until MIDI_CLOCK_RELOCK_TICKS of them
+    const uint32_t period_300 = RATE * 60 / (300 * 24);
+
+    next = ticks(next - PERIOD_120 + period_300, period_300,
+                 MIDI_CLOCK_RELOCK_TICKS - 1, false);
+    NN_CHECK_EQ(midi_clock_bpm(&clk), 12000);
+
+    next = ticks(next, period_300, 1, false);
+    NN_CHECK_EQ(midi_clock_bpm(&clk), 30000);
+
+    // Locked on the new tempo after a few ticks
+    next = ticks(next, period_300, 24, false);
+    run_until(next - period_300 / 2);
+    const uint64_t pos = midi_clock_position(&clk, frame);
+    const uint64_t expected = (uint64_t)last_tick * TICK + TICK / 2;
+    NN_CHECK(pos > expected - TICK / 50 && pos < expected + TICK / 50);
+
+    // A single dropout is not a tempo change
+    next = ticks(next + period_300, period_300, 4, false);
+    NN_CHECK_EQ(midi_clock_bpm(&clk), 30000);
+}
+
+static void test_transport(void) {
+    reset_follower();
+
+    // Waiting for the first tick after start
+    event(0xFA, frame);
+    NN_CHECK(midi_clock_running(&clk));
+    run_until(frame + 500);
+    NN_CHECK_EQ(midi_clock_position(&clk, frame), 0);
+
+    uint32_t next = ticks(frame, PERIOD_120, 24, false);
+    run_until(next - PERIOD_120 / 2);
+
+    // Stop: the position freezes
+    event(0xFC, frame);
+    NN_CHECK(!midi_clock_running(&clk));
+    const uint64_t stopped = midi_clock_position(&clk, frame);
+    run_until(frame + 10 * PERIOD_120);
+    NN_CHECK_EQ(midi_clock_position(&clk, frame), stopped);
+
+    // Ticks while stopped do not move it
+    next = ticks(frame + 100, PERIOD_120, 3, false);
+    NN_CHECK_EQ(midi_clock_position(&clk, frame), stopped);
+    last_tick -= 3;
+
+    // Continue: waits for the next tick, then continues from the stop
+    // position
+    event(0xFB, frame);
+    NN_CHECK(midi_clock_running(&clk));
+    run_until(frame + PERIOD_120 / 2);
+    NN_CHECK_EQ(midi_clock_position(&clk, frame), stopped);
+    next = ticks(frame + 100, PERIOD_120, 24, false);
+    run_until(next);
+    NN_CHECK(midi_clock_position(&clk, frame) > stopped + 23 * TICK);
+    NN_CHECK_EQ(last_tick, 47);
+
+    // Song position while stopped: 16 sixteenth notes = tick 96
+    event(0xFC, frame);
+    const midi_event spp = {0xF2 | (16 << 8), frame, 0};
+    NN_CHECK(midi_clock_event(&clk, &spp));
+    NN_CHECK_EQ(midi_clock_position(&clk, frame), 96 * TICK);
+    last_pos = 96 * TICK;
+    last_tick = 95;
+    has_step = false;
+
+    event(0xFB, frame);
+    run_until(frame + 300);
+    NN_CHECK_EQ(midi_clock_position(&clk, frame), 96 * TICK);
+    next = ticks(frame + 100, PERIOD_120, 1, false);
+    NN_CHECK_EQ(midi_clock_position(&clk, frame), 96 * TICK);
+    run_until(frame + PERIOD_120 / 2);
+    NN_CHECK(midi_clock_position(&clk, frame) > 96 * TICK);
+
+    // Song position while running is ignored
+    NN_CHECK(midi_clock_event(&clk, &spp));
+    NN_CHECK(midi_clock_position(&clk, frame) > 96 * TICK);
+
+    // Start goes back to 0
+    event(0xFA, frame);
+    NN_CHECK_EQ(midi_clock_position(&clk, frame), 0);
+
+    // Other messages are not clock messages
+    const midi_event note = {0x90 | (60 << 8) | (100 << 16), frame, 0};
+    NN_CHECK(!midi_clock_event(&clk, &note));
+}
+
+static uint32_t sent[128];
+static int sent_count;
+
+static bool send_cb(uint32_t msg) {
+    if (sent_count < 128) {
+        sent[sent_count] = msg;
+    }
+    sent_count++;
+    return true;
+}
+
+static void test_master(void) {
+    midi_clock_init(&clk, RATE);
+    midi_clock_set_output(&clk, send_cb);
+    midi_clock_set_master(&clk, true);
+    midi_clock_set_bpm(&clk, 12000, 0);
+    sent_count = 0;
+
+    // Input clock is ignored
+    const midi_event tick = {0xF8, 0, 0};
+    NN_CHECK(midi_clock_event(&clk, &tick));
+    NN_CHECK(!midi_clock_running(&clk));
+
+    midi_clock_start(&clk, 0);
+    uint32_t ticks_sent = 0;
+    for (uint32_t f = 0; f <= RATE; f += RATE / 1000) {
+        ticks_sent += midi_clock_update(&clk, f);
+    }
+
+    // Ticks 0 to 48 in one second at 120 BPM
+    NN_CHECK_EQ(ticks_sent, 49);
+    NN_CHECK_EQ(sent[0], 0xFA);
+    NN_CHECK_EQ(sent[1], 0xF8);
+    NN_CHECK_EQ(sent_count, 50);
+
+    midi_clock_stop(&clk, RATE + 10);
+    NN_CHECK_EQ(sent[sent_count - 1], 0xFC);
+    NN_CHECK_EQ(midi_clock_update(&clk, 2 * RATE), 0);
+
+    midi_clock_continue(&clk, 2 * RATE);
+    NN_CHECK_EQ(sent[sent_count - 1], 0xFB);
+    NN_CHECK_EQ(midi_clock_update(&clk, 2 * RATE + PERIOD_120), 1);
+}
+
+int main(void) {
+    test_jitter();
+    test_relock();
+    test_transport();
+    test_master();
+
+    return nn_test_result("midi_clock");
+}
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "nn_test.h"
+#include "midi_utils.h"
+
+#define MSG(status, d1, d2) \
+    ((uint32_t)(status) | ((uint32_t)(d1) << 8) | ((uint32_t)(d2) << 16))
+
+#define MAX_MSGS 32
+#define MAX_CHUNKS 8
+#define SYSEX_SIZE 4
+
+typedef struct chunk {
+    uint8_t data[SYSEX_SIZE];
+    uint32_t len;
+    uint32_t flags;
+} chunk;
+
+static midi_decoder dec;
+static uint8_t sysex_buf[SYSEX_SIZE];
+
+static uint32_t msgs[MAX_MSGS];
+static int msg_count;
+static chunk chunks[MAX_CHUNKS];
+static int chunk_count;
+
+static void sysex_cb(void *user, const uint8_t *data, uint32_t len,
+                     uint32_t flags) {
+    NN_CHECK(user == &dec);
+    NN_CHECK(len <= SYSEX_SIZE);
+    if (chunk_count < MAX_CHUNKS && len <= SYSEX_SIZE) {
+        memcpy(chunks[chunk_count].data, data, len);
+        chunks[chunk_count].len = len;
+        chunks[chunk_count].flags = flags;
+    }
+    chunk_count++;
+}
+
+static void reset(bool sysex) {
+    midi_decoder_init(&dec);
+    if (sysex) {
+        midi_decoder_set_sysex(&dec, sysex_buf, SYSEX_SIZE, sysex_cb, &dec);
+    }
+    msg_count = 0;
+    chunk_count = 0;
+}
+
+static void push(const uint8_t *bytes, int len) {
+    for (int i = 0; i < len; i++) {
+        const uint32_t msg = midi_decoder_push(&dec, bytes[i]);
+        if (msg != 0) {
+            if (msg_count < MAX_MSGS) {
+                msgs[msg_count] = msg;
+            }
+            msg_count++;
+        }
+    }
+}
+
+#define PUSH(...)                                       \
+    do {                                                \
+        const uint8_t bytes_[] = {__VA_ARGS__};         \
+        push(bytes_, sizeof(bytes_));                   \
+    } while (0)
+
+static void test_running_status(void) {
+    reset(false);
+
+    // CC burst, then a note burst with running status and note off as
+    // velocity 0
+    PUSH(0xB3, 7, 100, 8, 50, 10, 64,
+         0x93, 60, 100, 64, 90, 60, 0, 64, 0);
+    NN_CHECK_EQ(msg_count, 7);
+    NN_CHECK_EQ(msgs[0], MSG(0xB3, 7, 100));
+    NN_CHECK_EQ(msgs[1], MSG(0xB3, 8, 50));
+    NN_CHECK_EQ(msgs[2], MSG(0xB3, 10, 64));
+    NN_CHECK_EQ(msgs[3], MSG(0x93, 60, 100));
+    NN_CHECK_EQ(msgs[4], MSG(0x93, 64, 90));
+    NN_CHECK_EQ(msgs[5], MSG(0x93, 60, 0));
+    NN_CHECK_EQ(msgs[6], MSG(0x93, 64, 0));
+
+    // Two bytes messages
+    reset(false);
+    PUSH(0xC0, 5, 6, 0xD1, 20, 30);
+    NN_CHECK_EQ(msg_count, 4);
+    NN_CHECK_EQ(msgs[0], MSG(0xC0, 5, 0));
+    NN_CHECK_EQ(msgs[1], MSG(0xC0, 6, 0));
+    NN_CHECK_EQ(msgs[2], MSG(0xD1, 20, 0));
+    NN_CHECK_EQ(msgs[3], MSG(0xD1, 30, 0));
+
+    // A new status byte interrupts an incomplete message
+    reset(false);
+    PUSH(0x90, 60, 0xE0, 0, 64, 1, 65);
+    NN_CHECK_EQ(msg_count, 2);
+    NN_CHECK_EQ(msgs[0], MSG(0xE0, 0, 64));
+    NN_CHECK_EQ(msgs[1], MSG(0xE0, 1, 65));
+
+    // Data bytes without any status are ignored
+    reset(false);
+    PUSH(60, 100, 0x80, 60, 0);
+    NN_CHECK_EQ(msg_count, 1);
+    NN_CHECK_EQ(msgs[0], MSG(0x80, 60, 0));
+}
+
+static void test_real_time(void) {
+    reset(true);
+
+    // In the middle of a message and of a running status message
+    PUSH(0x90, 0xF8, 60, 0xFE, 100, 62, 0xFA, 101);
+    NN_CHECK_EQ(msg_count, 5);
+    NN_CHECK_EQ(msgs[0], 0xF8);
+    NN_CHECK_EQ(msgs[1], 0xFE);
+    NN_CHECK_EQ(msgs[2], MSG(0x90, 60, 100));
+    NN_CHECK_EQ(msgs[3], 0xFA);
+    NN_CHECK_EQ(msgs[4], MSG(0x90, 62, 101));
+
+    // Undefined real time bytes are dropped without side effect
+    reset(true);
+    PUSH(0xB0, 0xF9, 1, 0xFD, 2);
+    NN_CHECK_EQ(msg_count, 1);
+    NN_CHECK_EQ(msgs[0], MSG(0xB0, 1, 2));
+
+    // In the middle of a SysEx, the SysEx continues
+    reset(true);
+    PUSH(0xF0, 1, 2, 0xF8, 3, 0xFC, 0xF7);
+    NN_CHECK_EQ(msg_count, 2);
+    NN_CHECK_EQ(msgs[0], 0xF8);
+    NN_CHECK_EQ(msgs[1], 0xFC);
+    NN_CHECK_EQ(chunk_count, 1);
+    NN_CHECK_EQ(chunks[0].len, 3);
+    NN_CHECK_EQ(chunks[0].flags, MIDI_SYSEX_START | MIDI_SYSEX_END);
+    NN_CHECK(memcmp(chunks[0].data, "\x01\x02\x03", 3) == 0);
+}
+
+static void test_sysex(void) {
+    // Exactly the buffer size: a single chunk
+    reset(true);
+    PUSH(0xF0, 1, 2, 3, 4, 0xF7);
+    NN_CHECK_EQ(chunk_count, 1);
+    NN_CHECK_EQ(chunks[0].len, 4);
+    NN_CHECK_EQ(chunks[0].flags, MIDI_SYSEX_START | MIDI_SYSEX_END);
+    NN_CHECK(memcmp(chunks[0].data, "\x01\x02\x03\x04", 4) == 0);
+    NN_CHECK_EQ(msg_count, 0);
+
+    // One byte more: a full first chunk and a one byte last chunk
+    reset(true);
+    PUSH(0xF0, 1, 2, 3, 4, 5, 0xF7);
+    NN_CHECK_EQ(chunk_count, 2);
+    NN_CHECK_EQ(chunks[0].len, 4);
+    NN_CHECK_EQ(chunks[0].flags, MIDI_SYSEX_START);
+    NN_CHECK_EQ(chunks[1].len, 1);
+    NN_CHECK_EQ(chunks[1].flags, MIDI_SYSEX_END);
+    NN_CHECK_EQ(chunks[1].data[0], 5);
+
+    // Two buffers exactly: the last chunk is full, no empty chunk
+    reset(true);
+    PUSH(0xF0, 1, 2, 3, 4, 5, 6, 7, 8, 0xF7);
+    NN_CHECK_EQ(chunk_count, 2);
+    NN_CHECK_EQ(chunks[1].len, 4);
+    NN_CHECK_EQ(chunks[1].flags, MIDI_SYSEX_END);
+
+    // Empty message
+    reset(true);
+    PUSH(0xF0, 0xF7);
+    NN_CHECK_EQ(chunk_count, 1);
+    NN_CHECK_EQ(chunks[0].len, 0);
+    NN_CHECK_EQ(chunks[0].flags, MIDI_SYSEX_START | MIDI_SYSEX_END);
+
+    // Aborted by a channel message, which is decoded
+    reset(true);
+    PUSH(0xF0, 1, 2, 3, 4, 5, 0x91, 60, 100);
+    NN_CHECK_EQ(chunk_count, 2);
+    NN_CHECK_EQ(chunks[0].flags, MIDI_SYSEX_START);
+    NN_CHECK_EQ(chunks[1].len, 1);
+    NN_CHECK_EQ(chunks[1].flags, MIDI_SYSEX_ABORTED);
+    NN_CHECK_EQ(msg_count, 1);
+    NN_CHECK_EQ(msgs[0], MSG(0x91, 60, 100));
+
+    // Aborted by a new SysEx
+    reset(true);
+    PUSH(0xF0, 1, 0xF0, 2, 0xF7);
+    NN_CHECK_EQ(chunk_count, 2);
+    NN_CHECK_EQ(chunks[0].flags, MIDI_SYSEX_START | MIDI_SYSEX_ABORTED);
+    NN_CHECK_EQ(chunks[1].flags, MIDI_SYSEX_START | MIDI_SYSEX_END);
+    NN_CHECK_EQ(chunks[1].data[0], 2);
+
+    // Without a callback, SysEx data is ignored and does not use the
+    // previous running status
+    reset(false);
+    PUSH(0x90, 60, 100, 0xF0, 61, 100, 0xF7, 62, 100);
+    NN_CHECK_EQ(msg_count, 1);
+    NN_CHECK_EQ(chunk_count, 0);
+
+    // Stray end of SysEx
+    reset(true);
+    PUSH(0xF7, 0xB0, 1, 2);
+    NN_CHECK_EQ(chunk_count, 0);
+    NN_CHECK_EQ(msg_count, 1);
+}
+
+static void test_system_common(void) {
+    // Tune request cancels the running status
+    reset(true);
+    PUSH(0x90, 60, 100, 0xF6, 61, 100);
+    NN_CHECK_EQ(msg_count, 2);
+    NN_CHECK_EQ(msgs[0], MSG(0x90, 60, 100));
+    NN_CHECK_EQ(msgs[1], 0xF6);
+
+    // Song position and song select, then data without status
+    reset(true);
+    PUSH(0xB0, 1, 2, 0xF2, 0x10, 0x20, 3, 4, 0xF3, 5, 6, 7);
+    NN_CHECK_EQ(msg_count, 3);
+    NN_CHECK_EQ(msgs[0], MSG(0xB0, 1, 2));
+    NN_CHECK_EQ(msgs[1], MSG(0xF2, 0x10, 0x20));
+    NN_CHECK_EQ(msgs[2], MSG(0xF3, 5, 0));
+
+    // Real time bytes keep the running status
+    reset(true);
+    PUSH(0x90, 60, 100, 0xF8, 0xFE, 61, 100);
+    NN_CHECK_EQ(msg_count, 4);
+    NN_CHECK_EQ(msgs[3], MSG(0x90, 61, 100));
+}
+
+static void test_encoder(void) {
+    const uint32_t seq[] = {
+        MSG(0x90, 60, 100), MSG(0x90, 64, 100), 0xF8, MSG(0x90, 60, 0),
+        MSG(0xB0, 7, 127), MSG(0xC2, 3, 0), MSG(0xC2, 4, 0),
+        MSG(0xF2, 1, 2), MSG(0x90, 67, 80), 0xF6, MSG(0x90, 67, 0),
+    };
+    const int count = sizeof(seq) / sizeof(seq[0]);
+    midi_encoder enc;
+    uint8_t out[3];
+    uint32_t total = 0;
+
+    midi_encoder_init(&enc, true);
+    reset(false);
+    for (int i = 0; i < count; i++) {
+        const uint32_t len = midi_encode(&enc, seq[i], out);
+        NN_CHECK(len >= 1 && len <= 3);
+        push(out, (int)len);
+        total += len;
+    }
+
+    // Running status saves the status of 3 messages
+    NN_CHECK_EQ(total, 3 + 2 + 1 + 2 + 3 + 2 + 1 + 3 + 3 + 1 + 3);
+    NN_CHECK_EQ(msg_count, count);
+    for (int i = 0; i < count && i < MAX_MSGS; i++) {
+        NN_CHECK_EQ(msgs[i], seq[i]);
+    }
+
+    // Invalid messages
+    NN_CHECK_EQ(midi_encode(&enc, 0x40, out), 0);
+    NN_CHECK_EQ(midi_encode(&enc, 0xF0, out), 0);
+    NN_CHECK_EQ(midi_encode(&enc, 0xFD, out), 0);
+}
+
+int main(void) {
+    test_running_status();
+    test_real_time();
+    test_sysex();
+    test_system_common();
+    test_encoder();
+
+    return nn_test_result("midi_utils");
+}
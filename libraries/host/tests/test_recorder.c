@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include "nn_test.h"
+#include "hardware/flash.h"
+#include "noise_nugget.h"
+#include "noise_nugget_host.h"
+#include "sample_stream.h"
+#include "store.h"
+#include "recorder.h"
+
+#define RATE 48000
+#define RENDER_FRAMES 64
+#define INPUT_FRAMES (RATE / 4)
+#define INPUT_PATH "test_recorder_input.raw"
+
+#define AREA_OFFSET (NN_STORE_FLASH_OFFSET + NN_STORE_SIZE)
+#define AREA_SIZE (64 * 1024)
+
+static uint32_t render_buf[RENDER_FRAMES];
+static uint32_t cb_frames;
+static uint32_t cb_transfer;
+
+static void audio_out_cb(uint32_t **buffer, uint32_t *stereo_point_count) {
+    // The audio counters can be read from the callbacks, as on the device
+    cb_frames = nn_audio_frame_count();
+    cb_transfer = nn_audio_min_transfer_frames();
+
+    *buffer = render_buf;
+    *stereo_point_count = RENDER_FRAMES;
+}
+
+// Input: a ramp on the left channel, its complement on the right channel
+static bool write_input(void) {
+    FILE *f = fopen(INPUT_PATH, "wb");
+
+    if (f == NULL) {
+        return false;
+    }
+    for (uint32_t i = 0; i < INPUT_FRAMES; i++) {
+        const uint8_t frame[4] = {i & 0xFF, (i >> 8) & 0xFF,
+                                  ~i & 0xFF, (~i >> 8) & 0xFF};
+        fwrite(frame, 1, 4, f);
+    }
+    return fclose(f) == 0;
+}
+
+static void test_area(void) {
+    const uint32_t sector = FLASH_SECTOR_SIZE;
+
+    // Not aligned, empty, or out of the flash
+    NN_CHECK(!nn_rec_prepare(AREA_OFFSET + 256, AREA_SIZE, NN_REC_LEFT));
+    NN_CHECK(!nn_rec_prepare(AREA_OFFSET, AREA_SIZE + 256, NN_REC_LEFT));
+    NN_CHECK(!nn_rec_prepare(AREA_OFFSET, 0, NN_REC_LEFT));
+    NN_CHECK(!nn_rec_prepare(PICO_FLASH_SIZE_BYTES - sector, 2 * sector,
+                             NN_REC_LEFT));
+    NN_CHECK(!nn_rec_prepare(AREA_OFFSET, AREA_SIZE, 3));
+
+    // Overlapping the store
+    NN_CHECK(!nn_rec_prepare(NN_STORE_FLASH_OFFSET, sector, NN_REC_LEFT));
+    NN_CHECK(!nn_rec_prepare(NN_STORE_FLASH_OFFSET - sector, 2 * sector,
+                             NN_REC_LEFT));
+    NN_CHECK(!nn_rec_prepare(AREA_OFFSET - sector, 2 * sector, NN_REC_LEFT));
+    NN_CHECK(!nn_rec_prepare(NN_STORE_FLASH_OFFSET - sector,
+                             NN_STORE_SIZE + 2 * sector, NN_REC_LEFT));
+
+    // Just before and just after the store
+    NN_CHECK(nn_rec_prepare(NN_STORE_FLASH_OFFSET - AREA_SIZE, AREA_SIZE,
+                            NN_REC_LEFT));
+    NN_CHECK(nn_rec_prepare(AREA_OFFSET, AREA_SIZE, NN_REC_LEFT));
+}
+
+static void test_window(void) {
+    nn_rec_stats stats;
+
+    NN_CHECK(nn_rec_prepare(AREA_OFFSET, AREA_SIZE, NN_REC_STEREO));
+    nn_rec_get_stats(&stats);
+
+    // One write per render block, not per recorder input block
+    NN_CHECK_EQ(nn_audio_min_transfer_frames(), RENDER_FRAMES);
+    NN_CHECK(stats.pages_per_write > 0);
+    NN_CHECK(stats.pages_per_write <= NN_REC_MAX_PAGES);
+    NN_CHECK(stats.page_us * stats.pages_per_write <=
+             (uint64_t)RENDER_FRAMES * 1000000 * NN_REC_FLASH_SHARE / 100 / RATE);
+    NN_CHECK_EQ(stats.capacity_bps,
+                (uint64_t)stats.pages_per_write * FLASH_PAGE_SIZE * RATE /
+                RENDER_FRAMES);
+    NN_CHECK_EQ(stats.required_bps, RATE * 4);
+}
+
+static void test_record(void) {
+    static const uint32_t streamed[1024];
+    const uint32_t blocks = 16;
+    nn_rec_stats stats;
+
+    // The flash emulation aborts if the streamer is not paused
+    NN_CHECK(nn_stream_init());
+    const int voice = nn_stream_play(streamed, sizeof(streamed));
+    NN_CHECK(voice >= 0);
+
+    NN_CHECK(nn_rec_prepare(AREA_OFFSET, AREA_SIZE, NN_REC_LEFT));
+    NN_CHECK(nn_rec_start());
+
+    for (uint32_t f = 0; f < blocks * NN_REC_BLOCK_FRAMES; f += RENDER_FRAMES) {
+        NN_CHECK(nn_host_audio_run(RENDER_FRAMES));
+        NN_CHECK(nn_rec_poll(0));
+    }
+    nn_rec_stop();
+    for (int n = 0; n < 1000 && nn_rec_poll(0); n++) {
+        NN_CHECK(nn_host_audio_run(RENDER_FRAMES));
+    }
+    NN_CHECK(!nn_rec_poll(0));
+    NN_CHECK(nn_stream_playing(voice));
+    nn_stream_stop(voice);
+
+    nn_rec_get_stats(&stats);
+    NN_CHECK(!stats.overrun);
+    NN_CHECK_EQ(stats.headroom_misses, 0);
+
+    // Whole blocks, 2 bytes per frame, without any hole
+    const uint32_t len = nn_rec_length();
+    const uint8_t *flash = pico_host_flash_memory() + AREA_OFFSET;
+
+    NN_CHECK(len >= (blocks - 1) * NN_REC_BLOCK_FRAMES * 2);
+    NN_CHECK_EQ(len % (NN_REC_BLOCK_FRAMES * 2), 0);
+
+    const uint16_t first = flash[0] | (flash[1] << 8);
+    uint32_t errors = 0;
+    for (uint32_t i = 0; i < len / 2; i++) {
+        const uint16_t sample = flash[2 * i] | (flash[2 * i + 1] << 8);
+        errors += sample != (uint16_t)(first + i);
+    }
+    NN_CHECK_EQ(errors, 0);
+    NN_CHECK(flash[len] == 0xFF);
+}
+
+int main(void) {
+    nn_host_audio_config config;
+
+    NN_CHECK(write_input());
+    nn_host_audio_config_init(&config);
+    config.input_path = INPUT_PATH;
+    config.realtime = false;
+    config.log_gaps = false;
+    nn_host_audio_configure(&config);
+
+    // No audio
+    NN_CHECK_EQ(nn_audio_min_transfer_frames(), 0);
+    NN_CHECK(!nn_rec_prepare(AREA_OFFSET, AREA_SIZE, NN_REC_LEFT));
+
+    NN_CHECK(nn_audio_init(RATE, audio_out_cb, nn_rec_audio_in_cb));
+
+    test_area();
+    test_window();
+    test_record();
+    NN_CHECK(cb_frames > 0);
+    NN_CHECK_EQ(cb_transfer, RENDER_FRAMES);
+
+    nn_host_audio_close();
+    remove(INPUT_PATH);
+    return nn_test_result("recorder");
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Decodes the assets compiled from data/tone.wav by samples_compiler.py and
+// compares them with the reference PCM of the WAV file. Regenerate them
+// with:
+//
+//   samples_compiler.py --format adpcm --block 128 --prefix smp_adpcm_
+//                       data/tone_adpcm data/tone.wav
+//   samples_compiler.py --format mulaw --prefix smp_mulaw_
+//                       data/tone_mulaw data/tone.wav
+//   samples_compiler.py --format s8 --prefix smp_s8_
+//                       data/tone_s8 data/tone.wav
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nn_test.h"
+#include "sample_decoder.h"
+#include "data/tone_adpcm.h"
+#include "data/tone_mulaw.h"
+#include "data/tone_s8.h"
+
+using fixdsp::sample::Decoder;
+using fixdsp::sample::SampleData;
+
+#define TONE_MAX_SAMPLES 4096
+
+static int16_t ref[TONE_MAX_SAMPLES];
+static uint32_t ref_len = 0;
+
+static uint32_t read_le32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// 16-bit mono PCM WAV only, like the ones samples_compiler.py takes
+static bool load_wav(const char *path) {
+    static uint8_t file[44 + TONE_MAX_SAMPLES * 2];
+    FILE *f = fopen(path, "rb");
+
+    if (f == NULL) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return false;
+    }
+    const size_t size = fread(file, 1, sizeof(file), f);
+    fclose(f);
+
+    if (size < 12 || memcmp(file, "RIFF", 4) || memcmp(&file[8], "WAVE", 4)) {
+        return false;
+    }
+    size_t pos = 12;
+    while (pos + 8 <= size) {
+        const uint32_t len = read_le32(&file[pos + 4]);
+
+        if (memcmp(&file[pos], "data", 4) == 0) {
+            ref_len = (pos + 8 + len <= size ? len : size - pos - 8) / 2;
+            for (uint32_t i = 0; i < ref_len; i++) {
+                const uint8_t *s = &file[pos + 8 + i * 2];
+                ref[i] = (int16_t)(s[0] | (s[1] << 8));
+            }
+            return true;
+        }
+        pos += 8 + len + (len & 1);
+    }
+    return false;
+}
+
+static void decode_all(const SampleData &data, int16_t *out) {
+    Decoder decoder;
+
+    decoder.setData(data);
+    NN_CHECK_EQ(decoder.decode(out, ref_len), ref_len);
+    NN_CHECK(decoder.done());
+
+    // Silence after the end
+    int16_t tail[8] = {1, 1, 1, 1, 1, 1, 1, 1};
+    NN_CHECK_EQ(decoder.decode(tail, 8), 0);
+    for (int i = 0; i < 8; i++) {
+        NN_CHECK_EQ(tail[i], 0);
+    }
+}
+
+// Seeking anywhere then decoding gives the same samples as decoding from
+// the start, through render() and odd sized reads.
+static void check_seek(const SampleData &data, const int16_t *all) {
+    static const uint32_t positions[] = {
+        0, 1, 37, 64, 127, 128, 128 + 61, 512 + 100, 999, 1000, 2000, 5
+    };
+    static int16_t out[TONE_MAX_SAMPLES];
+    Decoder decoder;
+
+    decoder.setData(data);
+    for (uint32_t p : positions) {
+        const uint32_t start = p < ref_len ? p : ref_len;
+
+        decoder.seek(p);
+        NN_CHECK_EQ(decoder.position(), start);
+
+        fixdsp::MonoBuffer buffer;
+        const uint32_t first = decoder.render(buffer);
+        const uint32_t len = buffer.getBufferLength();
+        NN_CHECK_EQ(first, ref_len - start < len ? ref_len - start : len);
+        memcpy(out, buffer.getWritePointer(0), first * sizeof(int16_t));
+
+        uint32_t n = first;
+        while (!decoder.done()) {
+            n += decoder.decode(&out[n], 13);
+        }
+        NN_CHECK_EQ(start + n, ref_len);
+        NN_CHECK(memcmp(out, &all[start], n * sizeof(int16_t)) == 0);
+    }
+}
+
+static void test_s8(void) {
+    static int16_t out[TONE_MAX_SAMPLES];
+    const SampleData &data = fixdsp::samples::smp_s8_tone;
+
+    NN_CHECK_EQ(data.format, fixdsp::sample::FORMAT_S8);
+    NN_CHECK_EQ(data.length, ref_len);
+
+    // Exact: the low byte is dropped
+    decode_all(data, out);
+    for (uint32_t i = 0; i < ref_len; i++) {
+        NN_CHECK_EQ(out[i], (int16_t)(ref[i] & ~0xFF));
+    }
+    check_seek(data, out);
+}
+
+static void test_mu_law(void) {
+    static int16_t out[TONE_MAX_SAMPLES];
+    const SampleData &data = fixdsp::samples::smp_mulaw_tone;
+
+    NN_CHECK_EQ(data.format, fixdsp::sample::FORMAT_MU_LAW);
+    NN_CHECK_EQ(data.length, ref_len);
+
+    // Logarithmic quantization: the error follows the amplitude, and full
+    // scale clips at 32124
+    decode_all(data, out);
+    for (uint32_t i = 0; i < ref_len; i++) {
+        const int32_t err = abs(out[i] - ref[i]);
+        const int32_t max = abs(ref[i]) > 32124 ? abs(ref[i]) - 32124 + 512
+                                                : abs(ref[i]) / 32 + 8;
+        if (err > max) {
+            fprintf(stderr, "mu-law sample %u: %d != %d\n", i, out[i], ref[i]);
+            NN_CHECK(err <= max);
+        }
+    }
+    check_seek(data, out);
+}
+
+static void test_adpcm(void) {
+    static int16_t out[TONE_MAX_SAMPLES];
+    const SampleData &data = fixdsp::samples::smp_adpcm_tone;
+
+    NN_CHECK_EQ(data.format, fixdsp::sample::FORMAT_IMA_ADPCM);
+    NN_CHECK_EQ(data.length, ref_len);
+    NN_CHECK_EQ(data.block_bytes, 4 + data.block_samples / 2);
+
+    decode_all(data, out);
+
+    // The encoder runs its own model of the decoder: each block header is
+    // the state where the previous block ended.
+    for (uint32_t b = 1; b * data.block_samples < ref_len; b++) {
+        const uint8_t *header = &data.data[b * data.block_bytes];
+        const int16_t predictor = (int16_t)(header[0] | (header[1] << 8));
+
+        NN_CHECK_EQ(predictor, out[b * data.block_samples - 1]);
+        NN_CHECK(header[2] <= 88);
+        NN_CHECK_EQ(header[3], 0);
+    }
+
+    // Tone part, once the step size has adapted from the first header (one
+    // period): 30 dB of SNR at least
+    double signal = 0.0;
+    double noise = 0.0;
+    for (uint32_t i = 50; i < 700; i++) {
+        const double err = (double)out[i] - ref[i];
+        signal += (double)ref[i] * ref[i];
+        noise += err * err;
+    }
+    const double snr = 10.0 * log10(signal / (noise + 1.0));
+    if (snr < 30.0) {
+        fprintf(stderr, "ADPCM SNR %.1f dB\n", snr);
+    }
+    NN_CHECK(snr >= 30.0);
+
+    check_seek(data, out);
+}
+
+int main(void) {
+    NN_CHECK(load_wav(NN_TEST_DATA_DIR "/tone.wav"));
+    NN_CHECK(ref_len > 512);
+
+    if (ref_len > 0) {
+        test_s8();
+        test_mu_law();
+        test_adpcm();
+    }
+
+    return nn_test_result("sample_decoder");
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "nn_test.h"
+#include "sample_stream.h"
+#include "sample_stream_dma_host.h"
+
+#define SAMPLE_LEN 3001 // Not a multiple of the chunk or of a word
+
+static uint32_t sample_words[(SAMPLE_LEN + 3) / 4];
+static const uint8_t *sample = (const uint8_t *)sample_words;
+static uint8_t out[SAMPLE_LEN];
+
+static uint32_t run_dma(void) {
+    uint32_t count = 0;
+
+    while (nn_host_stream_dma_run()) {
+        count++;
+    }
+    return count;
+}
+
+static nn_stream_stats stats_delta(const nn_stream_stats *before) {
+    nn_stream_stats now;
+
+    nn_stream_get_stats(&now);
+    now.hit_bytes -= before->hit_bytes;
+    now.starved_bytes -= before->starved_bytes;
+    now.starvations -= before->starvations;
+    now.fetches -= before->fetches;
+    return now;
+}
+
+static void test_read_ahead(void) {
+    nn_stream_stats before;
+    nn_stream_stats delta;
+
+    nn_stream_get_stats(&before);
+    const int voice = nn_stream_play(sample, SAMPLE_LEN);
+    NN_CHECK(voice >= 0);
+    NN_CHECK(nn_host_stream_reading());
+
+    // The ring fills up to its window
+    NN_CHECK_EQ(run_dma(), NN_STREAM_CHUNKS);
+    NN_CHECK(!nn_host_stream_reading());
+
+    NN_CHECK_EQ(nn_stream_read(voice, out, 1000), 1000);
+    delta = stats_delta(&before);
+    NN_CHECK_EQ(delta.hit_bytes, 1000);
+    NN_CHECK_EQ(delta.starved_bytes, 0);
+
+    // The read frees the slots before its chunk
+    NN_CHECK(nn_host_stream_reading());
+    NN_CHECK_EQ(run_dma(), 1000 / NN_STREAM_CHUNK);
+
+    // With the DMA keeping up, nothing is read directly
+    uint32_t pos = 1000;
+    while (nn_stream_playing(voice)) {
+        pos += nn_stream_read(voice, &out[pos], 100);
+        run_dma();
+    }
+    NN_CHECK_EQ(pos, SAMPLE_LEN);
+    NN_CHECK(memcmp(out, sample, SAMPLE_LEN) == 0);
+    NN_CHECK_EQ(nn_stream_read(voice, out, 100), 0);
+
+    delta = stats_delta(&before);
+    NN_CHECK_EQ(delta.hit_bytes, SAMPLE_LEN);
+    NN_CHECK_EQ(delta.starvations, 0);
+    NN_CHECK_EQ(delta.fetches,
+                (SAMPLE_LEN + NN_STREAM_CHUNK - 1) / NN_STREAM_CHUNK);
+}
+
+static void test_starvation(void) {
+    nn_stream_stats before;
+    nn_stream_stats delta;
+
+    nn_stream_get_stats(&before);
+    const int voice = nn_stream_play(sample, SAMPLE_LEN);
+    NN_CHECK(voice >= 0);
+
+    // Ahead of the DMA: read directly, the read-ahead restarts at the
+    // cursor and the chunk in progress is dropped
+    NN_CHECK_EQ(nn_stream_read(voice, out, 300), 300);
+    delta = stats_delta(&before);
+    NN_CHECK_EQ(delta.starved_bytes, 300);
+    NN_CHECK_EQ(delta.starvations, 1);
+
+    NN_CHECK(run_dma() > 0);
+    NN_CHECK_EQ(nn_stream_read(voice, &out[300], 700), 700);
+    NN_CHECK(memcmp(out, sample, 1000) == 0);
+    delta = stats_delta(&before);
+    NN_CHECK_EQ(delta.hit_bytes, 700);
+    NN_CHECK_EQ(delta.starvations, 1);
+
+    // Partly in the ring
+    NN_CHECK_EQ(nn_stream_read(voice, &out[1000], 1500), 1500);
+    NN_CHECK(memcmp(out, sample, 2500) == 0);
+    delta = stats_delta(&before);
+    NN_CHECK(delta.hit_bytes > 700);
+    NN_CHECK(delta.starved_bytes > 300);
+    NN_CHECK_EQ(delta.starvations, 2);
+
+    run_dma();
+    NN_CHECK_EQ(nn_stream_read(voice, &out[2500], 1000), SAMPLE_LEN - 2500);
+    NN_CHECK(memcmp(out, sample, SAMPLE_LEN) == 0);
+    NN_CHECK(!nn_stream_playing(voice));
+}
+
+static void test_priority(void) {
+    nn_stream_stats before;
+
+    const int a = nn_stream_play(sample, SAMPLE_LEN);
+    NN_CHECK(nn_host_stream_dma_run());
+    NN_CHECK(nn_host_stream_dma_run());
+
+    // A has two chunks ahead and its third in progress: B goes next
+    const int b = nn_stream_play(sample, SAMPLE_LEN);
+    NN_CHECK(a >= 0 && b >= 0 && a != b);
+    NN_CHECK(nn_host_stream_dma_run());
+    NN_CHECK(nn_host_stream_dma_run());
+
+    nn_stream_get_stats(&before);
+    NN_CHECK_EQ(nn_stream_read(b, out, NN_STREAM_CHUNK), NN_STREAM_CHUNK);
+    NN_CHECK_EQ(stats_delta(&before).starved_bytes, 0);
+    NN_CHECK(memcmp(out, sample, NN_STREAM_CHUNK) == 0);
+
+    nn_stream_stop(a);
+    nn_stream_stop(b);
+    run_dma();
+}
+
+static void test_pause(void) {
+    const int voice = nn_stream_play(sample, SAMPLE_LEN);
+    NN_CHECK(nn_host_stream_reading());
+
+    // The chunk in progress ends, no other one starts
+    nn_stream_pause();
+    NN_CHECK(!nn_host_stream_reading());
+    NN_CHECK(!nn_host_stream_dma_run());
+
+    // Nested
+    nn_stream_pause();
+    nn_stream_resume();
+    NN_CHECK(!nn_host_stream_reading());
+
+    // The voice keeps playing meanwhile
+    NN_CHECK_EQ(nn_stream_read(voice, out, 600), 600);
+    NN_CHECK(memcmp(out, sample, 600) == 0);
+
+    nn_stream_resume();
+    NN_CHECK(nn_host_stream_reading());
+
+    nn_stream_stop(voice);
+    run_dma();
+}
+
+static void test_stop(void) {
+    nn_stream_stats before;
+
+    const int a = nn_stream_play(sample, SAMPLE_LEN);
+    NN_CHECK(nn_host_stream_reading());
+
+    // The DMA still writes in the ring of A: B gets another voice
+    nn_stream_stop(a);
+    NN_CHECK(!nn_stream_playing(a));
+    const int b = nn_stream_play(&sample[1024], SAMPLE_LEN - 1024);
+    NN_CHECK(b >= 0 && b != a);
+
+    // The chunk of A is dropped, the next one is for B
+    NN_CHECK(nn_host_stream_dma_run());
+    NN_CHECK(nn_host_stream_dma_run());
+
+    nn_stream_get_stats(&before);
+    NN_CHECK_EQ(nn_stream_read(b, out, NN_STREAM_CHUNK), NN_STREAM_CHUNK);
+    NN_CHECK_EQ(stats_delta(&before).starved_bytes, 0);
+    NN_CHECK(memcmp(out, &sample[1024], NN_STREAM_CHUNK) == 0);
+
+    // Alignment and voice count
+    NN_CHECK_EQ(nn_stream_play(&sample[1], 16), -1);
+    nn_stream_stop(b);
+    run_dma();
+    for (int i = 0; i < NN_STREAM_VOICES; i++) {
+        NN_CHECK(nn_stream_play(sample, SAMPLE_LEN) >= 0);
+    }
+    NN_CHECK_EQ(nn_stream_play(sample, SAMPLE_LEN), -1);
+    for (int i = 0; i < NN_STREAM_VOICES; i++) {
+        nn_stream_stop(i);
+    }
+    run_dma();
+}
+
+int main(void) {
+    for (uint32_t i = 0; i < sizeof(sample_words); i++) {
+        ((uint8_t *)sample_words)[i] = (uint8_t)(i * 7 + (i >> 8));
+    }
+
+    // Nothing before the init
+    NN_CHECK_EQ(nn_stream_play(sample, SAMPLE_LEN), -1);
+    NN_CHECK(nn_stream_init());
+
+    test_read_ahead();
+    test_starvation();
+    test_priority();
+    test_pause();
+    test_stop();
+
+    return nn_test_result("sample_stream");
+}
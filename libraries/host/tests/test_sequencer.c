@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdlib.h>
+#include "nn_test.h"
+#include "midi_clock.h"
+#include "sequencer.h"
+
+#define RATE 48000
+#define BLOCK 64
+
+// 120 BPM: 1000 frames per tick, 6000 per 16th note step
+#define TICK_FRAMES 1000
+#define STEP_FRAMES 6000
+
+#define MAX_LOG 1024
+
+typedef struct logged_event {
+    uint32_t frame; // Absolute frame of the event
+    nn_seq_event ev;
+} logged_event;
+
+static midi_clock clk;
+static nn_seq seq;
+static nn_seq_pattern patterns[2];
+
+static logged_event event_log[MAX_LOG];
+static uint32_t log_count;
+static uint32_t frame;
+
+static void reset(void) {
+    midi_clock_init(&clk, RATE);
+    midi_clock_set_master(&clk, true);
+    midi_clock_set_bpm(&clk, 12000, 0);
+    nn_seq_pattern_clear(&patterns[0]);
+    nn_seq_pattern_clear(&patterns[1]);
+    nn_seq_init(&seq, &clk, patterns, 2);
+    log_count = 0;
+    frame = 0;
+}
+
+// Renders up to frame end in blocks, checks the order of the events in each
+// block and logs them
+static void render_until(uint32_t end, uint32_t max_events) {
+    nn_seq_event events[64];
+
+    while (frame < end) {
+        const uint32_t n = nn_seq_render(&seq, frame, BLOCK, events,
+                                         max_events);
+        NN_CHECK(n <= max_events);
+
+        for (uint32_t i = 0; i < n; i++) {
+            NN_CHECK(events[i].offset < BLOCK);
+            if (i > 0) {
+                NN_CHECK(events[i].offset >= events[i - 1].offset);
+            }
+            if (log_count < MAX_LOG) {
+                event_log[log_count].frame = frame + events[i].offset;
+                event_log[log_count].ev = events[i];
+                log_count++;
+            }
+        }
+        frame += BLOCK;
+    }
+}
+
+static uint32_t count_kind(uint8_t kind) {
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < log_count; i++) {
+        count += event_log[i].ev.kind == kind;
+    }
+    return count;
+}
+
+// Frame of the n-th event of a kind, UINT32_MAX if there is none
+static uint32_t nth_frame(uint8_t kind, uint32_t n) {
+    for (uint32_t i = 0; i < log_count; i++) {
+        if (event_log[i].ev.kind == kind && n-- == 0) {
+            return event_log[i].frame;
+        }
+    }
+    return UINT32_MAX;
+}
+
+static bool near(uint32_t a, uint32_t b) {
+    return abs((int32_t)(a - b)) <= 1;
+}
+
+static void test_offsets(void) {
+    reset();
+    for (uint32_t s = 0; s < NN_SEQ_MAX_STEPS; s++) {
+        patterns[0].steps[s] = NN_SEQ_STEP(60 + s, 100, 3, 15);
+    }
+    patterns[0].channel = 2;
+
+    midi_clock_start(&clk, 0);
+    render_until(NN_SEQ_MAX_STEPS * STEP_FRAMES - BLOCK, NN_SEQ_MIN_EVENTS);
+
+    // One note per step, on the frame of the step, released 3 ticks later
+    NN_CHECK_EQ(count_kind(NN_SEQ_NOTE_ON), NN_SEQ_MAX_STEPS);
+    NN_CHECK_EQ(count_kind(NN_SEQ_NOTE_OFF), NN_SEQ_MAX_STEPS);
+    for (uint32_t s = 0; s < NN_SEQ_MAX_STEPS; s++) {
+        const logged_event *on = &event_log[2 * s];
+        const logged_event *off = &event_log[2 * s + 1];
+
+        NN_CHECK_EQ(on->ev.kind, NN_SEQ_NOTE_ON);
+        NN_CHECK(near(on->frame, s * STEP_FRAMES));
+        NN_CHECK_EQ(on->ev.a, 60 + s);
+        NN_CHECK_EQ(on->ev.b, 100);
+        NN_CHECK_EQ(on->ev.channel, 2);
+
+        NN_CHECK_EQ(off->ev.kind, NN_SEQ_NOTE_OFF);
+        NN_CHECK(near(off->frame, s * STEP_FRAMES + 3 * TICK_FRAMES));
+        NN_CHECK_EQ(off->ev.a, 60 + s);
+    }
+    NN_CHECK_EQ(nn_seq_current_step(&seq), NN_SEQ_MAX_STEPS - 1);
+
+    // Stop: nothing is left playing
+    midi_clock_stop(&clk, frame);
+    render_until(frame + BLOCK, NN_SEQ_MIN_EVENTS);
+    NN_CHECK_EQ(count_kind(NN_SEQ_NOTE_OFF), NN_SEQ_MAX_STEPS);
+}
+
+static void test_swing(void) {
+    reset();
+    for (uint32_t s = 0; s < NN_SEQ_MAX_STEPS; s++) {
+        patterns[0].steps[s] = NN_SEQ_STEP(60, 100, 1, 15);
+    }
+
+    // Odd steps at 75% of the pair: half a step late
+    patterns[0].swing = 75;
+    midi_clock_start(&clk, 0);
+    render_until(4 * STEP_FRAMES, NN_SEQ_MIN_EVENTS);
+
+    NN_CHECK(near(nth_frame(NN_SEQ_NOTE_ON, 0), 0));
+    NN_CHECK(near(nth_frame(NN_SEQ_NOTE_ON, 1),
+                  STEP_FRAMES + STEP_FRAMES / 2));
+    NN_CHECK(near(nth_frame(NN_SEQ_NOTE_ON, 2), 2 * STEP_FRAMES));
+    NN_CHECK(near(nth_frame(NN_SEQ_NOTE_ON, 3),
+                  3 * STEP_FRAMES + STEP_FRAMES / 2));
+
+    // Out of range swing is clamped
+    reset();
+    for (uint32_t s = 0; s < NN_SEQ_MAX_STEPS; s++) {
+        patterns[0].steps[s] = NN_SEQ_STEP(60, 100, 1, 15);
+    }
+    patterns[0].swing = 90;
+    midi_clock_start(&clk, 0);
+    render_until(2 * STEP_FRAMES, NN_SEQ_MIN_EVENTS);
+    NN_CHECK(near(nth_frame(NN_SEQ_NOTE_ON, 1),
+                  STEP_FRAMES + STEP_FRAMES / 2));
+}
+
+static void test_locks(void) {
+    reset();
+    patterns[0].steps[0] = NN_SEQ_STEP(60, 100, 2, 15);
+    patterns[0].steps[1] = NN_SEQ_STEP(62, 100, 2, 15);
+    patterns[0].steps[2] = NN_SEQ_STEP(64, 100, 2, 15);
+    NN_CHECK(nn_seq_set_lock(&patterns[0], 0, 3, 10));
+    NN_CHECK(nn_seq_set_lock(&patterns[0], 1, 3, 20));
+    NN_CHECK(nn_seq_set_lock(&patterns[0], 1, 4, 30));
+    NN_CHECK(!nn_seq_set_lock(&patterns[0], 1, NN_SEQ_MAX_PARAMS, 0));
+
+    midi_clock_start(&clk, 0);
+    render_until(3 * STEP_FRAMES + BLOCK, NN_SEQ_MIN_EVENTS);
+
+    // Step 0: lock, note on
+    NN_CHECK_EQ(event_log[0].ev.kind, NN_SEQ_PARAM);
+    NN_CHECK_EQ(event_log[0].ev.a, 3);
+    NN_CHECK_EQ(event_log[0].ev.b, 10);
+    NN_CHECK_EQ(event_log[1].ev.kind, NN_SEQ_NOTE_ON);
+    NN_CHECK_EQ(event_log[2].ev.kind, NN_SEQ_NOTE_OFF);
+
+    // Step 1: parameter 3 stays locked, with its new value
+    NN_CHECK_EQ(event_log[3].ev.kind, NN_SEQ_PARAM);
+    NN_CHECK_EQ(event_log[3].ev.b, 20);
+    NN_CHECK_EQ(event_log[4].ev.kind, NN_SEQ_PARAM);
+    NN_CHECK_EQ(event_log[4].ev.a, 4);
+    NN_CHECK_EQ(event_log[5].ev.kind, NN_SEQ_NOTE_ON);
+    NN_CHECK(near(event_log[5].frame, STEP_FRAMES));
+    NN_CHECK_EQ(event_log[6].ev.kind, NN_SEQ_NOTE_OFF);
+
+    // Step 2: both restored at the trig, before the note
+    NN_CHECK_EQ(event_log[7].ev.kind, NN_SEQ_PARAM_END);
+    NN_CHECK_EQ(event_log[8].ev.kind, NN_SEQ_PARAM_END);
+    NN_CHECK_EQ(event_log[7].ev.a + event_log[8].ev.a, 3 + 4);
+    NN_CHECK(near(event_log[7].frame, 2 * STEP_FRAMES));
+    NN_CHECK_EQ(event_log[9].ev.kind, NN_SEQ_NOTE_ON);
+    NN_CHECK_EQ(log_count, 11);
+}
+
+static void test_capacity(void) {
+    // Too small for the events of a step: nothing is returned
+    reset();
+    for (uint32_t s = 0; s < NN_SEQ_MAX_STEPS; s++) {
+        patterns[0].steps[s] = NN_SEQ_STEP(60, 100, 1, 15);
+    }
+    NN_CHECK(nn_seq_set_lock(&patterns[0], 0, 1, 10));
+    NN_CHECK(nn_seq_set_lock(&patterns[0], 8, 2, 10));
+    midi_clock_start(&clk, 0);
+    render_until(RATE, 2);
+    NN_CHECK_EQ(log_count, 0);
+
+    // Only the locks of the step and the lock ends count: a step without
+    // locks after a fully locked one fits after a note off
+    reset();
+    for (uint32_t s = 0; s < NN_SEQ_MAX_STEPS; s++) {
+        patterns[0].steps[s] = NN_SEQ_STEP(60 + s, 100, 6, 15);
+    }
+    for (uint32_t p = 0; p < NN_SEQ_MAX_LOCKS; p++) {
+        NN_CHECK(nn_seq_set_lock(&patterns[0], 0, p, 1));
+    }
+    midi_clock_start(&clk, 0);
+    render_until(NN_SEQ_MAX_STEPS * STEP_FRAMES - BLOCK, NN_SEQ_MIN_EVENTS);
+    NN_CHECK_EQ(count_kind(NN_SEQ_NOTE_ON), NN_SEQ_MAX_STEPS);
+    for (uint32_t s = 0; s < NN_SEQ_MAX_STEPS; s++) {
+        NN_CHECK(near(nth_frame(NN_SEQ_NOTE_ON, s), s * STEP_FRAMES));
+    }
+    NN_CHECK_EQ(count_kind(NN_SEQ_PARAM_END), NN_SEQ_MAX_LOCKS);
+
+    // A full step after a note off does not fit in the same block: it comes
+    // at the start of the next block, and the next steps are not dropped.
+    // Pattern 0 locks the parameters 0 to 15, pattern 1 the 16 others.
+    reset();
+    patterns[0].length = 1;
+    patterns[1].length = 1;
+    patterns[0].steps[0] = NN_SEQ_STEP(60, 100, 6, 15);
+    patterns[1].steps[0] = NN_SEQ_STEP(61, 100, 6, 15);
+    for (uint32_t p = 0; p < NN_SEQ_MAX_LOCKS; p++) {
+        NN_CHECK(nn_seq_set_lock(&patterns[0], 0, p, 1));
+        NN_CHECK(nn_seq_set_lock(&patterns[1], 0, NN_SEQ_MAX_LOCKS + p, 1));
+    }
+    midi_clock_start(&clk, 0);
+
+    // The next pattern is chosen when the step before it is played
+    render_until(BLOCK, NN_SEQ_MIN_EVENTS);
+    nn_seq_queue_pattern(&seq, 1);
+    render_until(5 * STEP_FRAMES - BLOCK, NN_SEQ_MIN_EVENTS);
+
+    NN_CHECK_EQ(count_kind(NN_SEQ_NOTE_ON), 5);
+    NN_CHECK(near(nth_frame(NN_SEQ_NOTE_ON, 1), STEP_FRAMES));
+    NN_CHECK(near(nth_frame(NN_SEQ_NOTE_OFF, 1), 2 * STEP_FRAMES));
+    NN_CHECK_EQ(nth_frame(NN_SEQ_NOTE_ON, 2) % BLOCK, 0);
+    NN_CHECK(nth_frame(NN_SEQ_NOTE_ON, 2) > 2 * STEP_FRAMES);
+    NN_CHECK(nth_frame(NN_SEQ_NOTE_ON, 2) <= 2 * STEP_FRAMES + BLOCK);
+    NN_CHECK(near(nth_frame(NN_SEQ_NOTE_ON, 3), 3 * STEP_FRAMES));
+    NN_CHECK(near(nth_frame(NN_SEQ_NOTE_ON, 4), 4 * STEP_FRAMES));
+    NN_CHECK_EQ(count_kind(NN_SEQ_PARAM), 5 * NN_SEQ_MAX_LOCKS);
+    NN_CHECK_EQ(count_kind(NN_SEQ_PARAM_END), NN_SEQ_MAX_LOCKS);
+}
+
+int main(void) {
+    test_offsets();
+    test_swing();
+    test_locks();
+    test_capacity();
+
+    return nn_test_result("sequencer");
+}
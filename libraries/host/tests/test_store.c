@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "nn_test.h"
+#include "hardware/flash.h"
+#include "noise_nugget.h"
+#include "noise_nugget_host.h"
+#include "sample_stream.h"
+#include "store.h"
+
+#define SECTOR_CNT (NN_STORE_SIZE / FLASH_SECTOR_SIZE)
+
+// Record header (key, length, CRC), see store.c
+#define RECORD_HEADER 8
+#define RECORD_SIZE(len) ((RECORD_HEADER + (len) + 3) & ~3u)
+
+static uint8_t value[NN_STORE_MAX_VALUE];
+static uint8_t loaded[NN_STORE_MAX_VALUE];
+
+static uint8_t *store_flash(void) {
+    return pico_host_flash_memory() + NN_STORE_FLASH_OFFSET;
+}
+
+// Offset in the store of the record of a key
+static uint32_t record_offset(uint32_t key) {
+    const uint8_t *data = nn_store_get(key, NULL);
+    return data == NULL ? 0 : (uint32_t)(data - store_flash()) - RECORD_HEADER;
+}
+
+static void wipe(void) {
+    flash_range_erase(NN_STORE_FLASH_OFFSET, NN_STORE_SIZE);
+    NN_CHECK(nn_store_init());
+}
+
+static void fill(uint32_t key, uint32_t gen, uint32_t len) {
+    for (uint32_t i = 0; i < len; i++) {
+        value[i] = (uint8_t)(key * 31 + gen * 7 + i);
+    }
+}
+
+static bool check_value(uint32_t key, uint32_t gen, uint32_t len) {
+    fill(key, gen, len);
+    memset(loaded, 0, sizeof(loaded));
+    return nn_store_load(key, loaded, sizeof(loaded)) == (int32_t)len &&
+        memcmp(loaded, value, len) == 0;
+}
+
+static bool is_erased(uint32_t off, uint32_t len) {
+    const uint8_t *p = store_flash() + off;
+
+    for (uint32_t i = 0; i < len; i++) {
+        if (p[i] != 0xFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void test_save_load(void) {
+    nn_store_stats stats;
+
+    wipe();
+    NN_CHECK_EQ(nn_store_load(0, loaded, sizeof(loaded)), -1);
+    NN_CHECK(nn_store_get(0, NULL) == NULL);
+
+    fill(0, 0, 100);
+    NN_CHECK(nn_store_save(0, value, 100));
+    fill(1, 0, NN_STORE_MAX_VALUE);
+    NN_CHECK(nn_store_save(1, value, NN_STORE_MAX_VALUE));
+    NN_CHECK(nn_store_save(2, value, 0));
+    NN_CHECK(check_value(0, 0, 100));
+    NN_CHECK(check_value(1, 0, NN_STORE_MAX_VALUE));
+    NN_CHECK_EQ(nn_store_load(2, loaded, sizeof(loaded)), 0);
+
+    // Short buffer: the size of the value, only max_len bytes copied
+    memset(loaded, 0, sizeof(loaded));
+    NN_CHECK_EQ(nn_store_load(0, loaded, 10), 100);
+    fill(0, 0, 100);
+    NN_CHECK(memcmp(loaded, value, 10) == 0);
+    NN_CHECK_EQ(loaded[10], 0);
+
+    // New version
+    fill(0, 1, 50);
+    NN_CHECK(nn_store_save(0, value, 50));
+    NN_CHECK(check_value(0, 1, 50));
+
+    // Invalid key and size
+    NN_CHECK(!nn_store_save(NN_STORE_MAX_KEYS, value, 10));
+    NN_CHECK(!nn_store_save(3, value, NN_STORE_MAX_VALUE + 1));
+    NN_CHECK(!nn_store_delete(NN_STORE_MAX_KEYS));
+
+    // Delete, and delete of a key without value
+    NN_CHECK(nn_store_delete(1));
+    NN_CHECK_EQ(nn_store_load(1, loaded, sizeof(loaded)), -1);
+    NN_CHECK(nn_store_delete(1));
+    NN_CHECK(nn_store_delete(3));
+
+    nn_store_get_stats(&stats);
+    NN_CHECK_EQ(stats.keys, 2);
+    NN_CHECK_EQ(stats.live_bytes, RECORD_SIZE(50) + RECORD_SIZE(0));
+    NN_CHECK_EQ(stats.erases, 0);
+    NN_CHECK(stats.programs > 0);
+
+    // The index is rebuilt from the flash
+    NN_CHECK(nn_store_init());
+    NN_CHECK(check_value(0, 1, 50));
+    NN_CHECK_EQ(nn_store_load(1, loaded, sizeof(loaded)), -1);
+    NN_CHECK_EQ(nn_store_load(2, loaded, sizeof(loaded)), 0);
+    NN_CHECK_EQ(nn_store_load(3, loaded, sizeof(loaded)), -1);
+
+    nn_store_stats after;
+    nn_store_get_stats(&after);
+    NN_CHECK_EQ(after.keys, stats.keys);
+    NN_CHECK_EQ(after.live_bytes, stats.live_bytes);
+    NN_CHECK_EQ(after.log_bytes, stats.log_bytes);
+    NN_CHECK_EQ(after.free_bytes, stats.free_bytes);
+
+    // Writing continues after the last record
+    fill(4, 0, 20);
+    NN_CHECK(nn_store_save(4, value, 20));
+    NN_CHECK(record_offset(4) > record_offset(0));
+    NN_CHECK(record_offset(4) > record_offset(2));
+}
+
+static void test_truncated_record(void) {
+    wipe();
+    fill(0, 0, 100);
+    NN_CHECK(nn_store_save(0, value, 100));
+    fill(1, 0, 200);
+    NN_CHECK(nn_store_save(1, value, 200));
+
+    // Power loss while programming the record of key 2: the header and part
+    // of the data are written, the CRC does not match.
+    const uint32_t bad = record_offset(1) + RECORD_SIZE(200);
+    const uint32_t written = RECORD_HEADER + 64;
+    const uint32_t page = bad & ~(FLASH_PAGE_SIZE - 1);
+    uint8_t buf[2 * FLASH_PAGE_SIZE];
+    const uint8_t header[RECORD_HEADER] = {2, 0, 100, 0, 0x78, 0x56, 0x34, 0x12};
+
+    memset(buf, 0xFF, sizeof(buf));
+    memcpy(buf + bad - page, header, RECORD_HEADER);
+    memset(buf + bad - page + RECORD_HEADER, 0x00, written - RECORD_HEADER);
+    flash_range_program(NN_STORE_FLASH_OFFSET + page, buf, sizeof(buf));
+
+    // Ignored on init, the valid records before it are kept
+    NN_CHECK(nn_store_init());
+    NN_CHECK(check_value(0, 0, 100));
+    NN_CHECK(check_value(1, 0, 200));
+    NN_CHECK_EQ(nn_store_load(2, loaded, sizeof(loaded)), -1);
+
+    // Nothing is written after it in its sector, the log continues in the
+    // next one
+    const uint32_t sector = bad / FLASH_SECTOR_SIZE;
+    const uint32_t sector_end = (sector + 1) * FLASH_SECTOR_SIZE;
+
+    fill(3, 0, 100);
+    NN_CHECK(nn_store_save(3, value, 100));
+    NN_CHECK(nn_store_delete(0));
+    NN_CHECK(record_offset(3) / FLASH_SECTOR_SIZE != sector);
+    NN_CHECK(is_erased(bad + written, sector_end - (bad + written)));
+
+    NN_CHECK(nn_store_init());
+    NN_CHECK_EQ(nn_store_load(0, loaded, sizeof(loaded)), -1);
+    NN_CHECK(check_value(1, 0, 200));
+    NN_CHECK(check_value(3, 0, 100));
+    NN_CHECK(is_erased(bad + written, sector_end - (bad + written)));
+
+    // Compaction moves the valid records out of it and erases it
+    while (record_offset(1) / FLASH_SECTOR_SIZE == sector) {
+        fill(4, 0, NN_STORE_MAX_VALUE);
+        if (!nn_store_save(4, value, NN_STORE_MAX_VALUE)) {
+            NN_CHECK(nn_store_compact());
+            if (!nn_store_save(4, value, NN_STORE_MAX_VALUE)) {
+                NN_CHECK(false);
+                break;
+            }
+        }
+    }
+    NN_CHECK(check_value(1, 0, 200));
+    NN_CHECK(check_value(3, 0, 100));
+    NN_CHECK(is_erased(sector * FLASH_SECTOR_SIZE, FLASH_SECTOR_SIZE));
+}
+
+#define WRAP_KEYS 8
+#define WRAP_LEN 500
+
+static void test_wrap(void) {
+    uint32_t gen[WRAP_KEYS] = {0};
+    uint32_t compactions = 0;
+    nn_store_stats stats;
+
+    wipe();
+    for (uint32_t k = 0; k < WRAP_KEYS; k++) {
+        fill(k, 0, WRAP_LEN);
+        NN_CHECK(nn_store_save(k, value, WRAP_LEN));
+    }
+
+    // Overwrite the keys until the log went around the region three times
+    for (uint32_t n = 0; compactions < 1000; n++) {
+        const uint32_t k = n % WRAP_KEYS;
+
+        nn_store_get_stats(&stats);
+        if (stats.erases >= 3 * SECTOR_CNT) {
+            break;
+        }
+
+        fill(k, gen[k] + 1, WRAP_LEN);
+        if (!nn_store_save(k, value, WRAP_LEN)) {
+            // Only when the erased sectors are used up
+            NN_CHECK(stats.free_bytes < RECORD_SIZE(WRAP_LEN));
+
+            NN_CHECK(nn_store_compact());
+            compactions++;
+
+            nn_store_get_stats(&stats);
+            NN_CHECK(stats.erased_sectors >= SECTOR_CNT / 2);
+            for (uint32_t j = 0; j < WRAP_KEYS; j++) {
+                NN_CHECK(check_value(j, gen[j], WRAP_LEN));
+            }
+
+            fill(k, gen[k] + 1, WRAP_LEN);
+            NN_CHECK(nn_store_save(k, value, WRAP_LEN));
+        }
+        gen[k]++;
+    }
+
+    nn_store_get_stats(&stats);
+    NN_CHECK(stats.erases >= 3 * SECTOR_CNT);
+    NN_CHECK(compactions >= 6);
+    NN_CHECK_EQ(stats.keys, WRAP_KEYS);
+    NN_CHECK_EQ(stats.live_bytes, WRAP_KEYS * RECORD_SIZE(WRAP_LEN));
+
+    // After a wrap, the index is rebuilt in the sequence order
+    NN_CHECK(nn_store_init());
+    for (uint32_t k = 0; k < WRAP_KEYS; k++) {
+        NN_CHECK(check_value(k, gen[k], WRAP_LEN));
+    }
+}
+
+#define FULL_LEN 1000
+
+static void test_full(void) {
+    nn_store_stats stats;
+    uint32_t count = 0;
+
+    wipe();
+    for (uint32_t k = 0; k < NN_STORE_MAX_KEYS; k++) {
+        fill(k, 0, FULL_LEN);
+        if (!nn_store_save(k, value, FULL_LEN)) {
+            break;
+        }
+        count++;
+    }
+
+    // Full before the last key: every sector but the reserve is used
+    NN_CHECK(count < NN_STORE_MAX_KEYS);
+    NN_CHECK(count >= (SECTOR_CNT - 2) * ((FLASH_SECTOR_SIZE - 8) /
+                                          RECORD_SIZE(FULL_LEN)));
+    nn_store_get_stats(&stats);
+    NN_CHECK(stats.free_bytes < RECORD_SIZE(FULL_LEN));
+
+    // Only live data: compacting does not give space back, nothing is lost
+    NN_CHECK(nn_store_compact());
+    fill(count, 0, FULL_LEN);
+    NN_CHECK(!nn_store_save(count, value, FULL_LEN));
+    for (uint32_t k = 0; k < count; k++) {
+        NN_CHECK(check_value(k, 0, FULL_LEN));
+    }
+
+    // Deleting is still possible, and gives the space back. The deletion
+    // records use some of it until their sector is compacted.
+    for (uint32_t k = 0; k < count; k += 2) {
+        NN_CHECK(nn_store_delete(k));
+    }
+    NN_CHECK(nn_store_compact());
+    for (uint32_t k = 0; k < count; k += 4) {
+        fill(k, 1, FULL_LEN);
+        NN_CHECK(nn_store_save(k, value, FULL_LEN));
+    }
+
+    NN_CHECK(nn_store_init());
+    for (uint32_t k = 0; k < count; k++) {
+        if (k % 4 == 0) {
+            NN_CHECK(check_value(k, 1, FULL_LEN));
+        } else if (k % 2 == 0) {
+            NN_CHECK_EQ(nn_store_load(k, loaded, sizeof(loaded)), -1);
+        } else {
+            NN_CHECK(check_value(k, 0, FULL_LEN));
+        }
+    }
+}
+
+// The flash emulation aborts if the streamer is not paused
+static void test_streaming(void) {
+    static const uint32_t sample[256] = {1, 2, 3};
+    uint32_t out[256];
+
+    // A sector that is neither used nor erased, nn_store_init() erases it
+    uint8_t page[FLASH_PAGE_SIZE];
+    memset(page, 0, sizeof(page));
+    wipe();
+    flash_range_program(NN_STORE_FLASH_OFFSET + FLASH_SECTOR_SIZE, page,
+                        sizeof(page));
+
+    NN_CHECK(nn_stream_init());
+    const int voice = nn_stream_play(sample, sizeof(sample));
+    NN_CHECK(voice >= 0);
+
+    nn_store_stats stats;
+    NN_CHECK(nn_store_init());
+    nn_store_get_stats(&stats);
+    NN_CHECK_EQ(stats.erases, 1);
+
+    fill(0, 0, 300);
+    NN_CHECK(nn_store_save(0, value, 300));
+    NN_CHECK(check_value(0, 0, 300));
+
+    NN_CHECK(nn_stream_playing(voice));
+    NN_CHECK_EQ(nn_stream_read(voice, out, sizeof(out)), sizeof(sample));
+    NN_CHECK(memcmp(out, sample, sizeof(sample)) == 0);
+}
+
+#define RATE 48000
+
+static uint32_t render_buf[64];
+static uint32_t render_frames;
+
+static void audio_out_cb(uint32_t **buffer, uint32_t *stereo_point_count) {
+    *buffer = render_buf;
+    *stereo_point_count = render_frames;
+}
+
+static void test_headroom(void) {
+    nn_host_audio_config config;
+    nn_store_stats before;
+    nn_store_stats after;
+
+    wipe();
+    nn_host_audio_config_init(&config);
+    config.realtime = false;
+    config.log_gaps = false;
+    nn_host_audio_configure(&config);
+
+    // 32 frames at 48 kHz: shorter than a page program, nothing is written
+    render_frames = 32;
+    NN_CHECK(nn_audio_init(RATE, audio_out_cb, NULL));
+    NN_CHECK(nn_host_audio_run(render_frames));
+    NN_CHECK((uint64_t)render_frames * 1000000 < NN_STORE_PROGRAM_US * RATE);
+
+    nn_store_get_stats(&before);
+    fill(1, 0, 100);
+    NN_CHECK(!nn_store_save(1, value, 100));
+    NN_CHECK(nn_store_get(1, NULL) == NULL);
+    nn_store_get_stats(&after);
+    NN_CHECK_EQ(after.programs, before.programs);
+    NN_CHECK_EQ(after.free_bytes, before.free_bytes);
+    NN_CHECK_EQ(after.headroom_misses, before.headroom_misses + 1);
+
+    // 64 frames leave the time for it
+    render_frames = 64;
+    NN_CHECK(nn_host_audio_run(2 * render_frames));
+    NN_CHECK(nn_store_save(1, value, 100));
+    NN_CHECK(check_value(1, 0, 100));
+    nn_store_get_stats(&after);
+    NN_CHECK_EQ(after.headroom_misses, before.headroom_misses + 1);
+
+    nn_host_audio_close();
+}
+
+int main(void) {
+    test_save_load();
+    test_truncated_record();
+    test_wrap();
+    test_full();
+    test_streaming();
+    test_headroom();
+
+    return nn_test_result("store");
+}
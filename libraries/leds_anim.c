@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <math.h>
+#include <string.h>
+#include "pico/sync.h"
+#include "pgb1.h"
+#include "leds_anim.h"
+
+typedef struct led_state {
+    LedColor from;        // Color at the start of the fade
+    LedColor to;          // Target color
+    uint16_t fade_frames; // Duration of the fade, 0 when not fading
+    uint16_t fade_pos;
+    uint16_t on_frames;   // Blink on duration, 0 when not blinking
+    uint16_t off_frames;
+    uint16_t blink_pos;
+} led_state;
+
+static led_state g_leds[PGB1_LEDS_COUNT];
+static LedColor g_prev_out[PGB1_LEDS_COUNT];
+static bool g_first_frame = true;
+
+static uint32_t g_fps = LEDS_ANIM_DEFAULT_FPS;
+static float g_gamma = 1.0f;
+static uint8_t g_brightness = 255;
+
+// Gamma and brightness correction of each channel value. Identity by
+// default, so that the colors of pgb1.h are sent unchanged.
+static uint8_t g_lut[256];
+static bool g_lut_ready = false;
+
+// The animation timer interrupt composes frames while the application
+// changes targets.
+static critical_section_t g_lock;
+static bool g_lock_ready = false;
+
+static void lock(void) {
+    if (!g_lock_ready) {
+        critical_section_init(&g_lock);
+        g_lock_ready = true;
+    }
+    critical_section_enter_blocking(&g_lock);
+}
+
+static void unlock(void) {
+    critical_section_exit(&g_lock);
+}
+
+static void build_lut(uint8_t lut[256], float gamma, uint8_t brightness) {
+    for (int v = 0; v < 256; v++) {
+        const float linear = powf(v / 255.0f, gamma);
+
+        lut[v] = (uint8_t)(linear * brightness + 0.5f);
+    }
+}
+
+// The LUT is computed outside of the lock, powf() is slow on the M0+
+static void update_lut(void) {
+    uint8_t lut[256];
+
+    build_lut(lut, g_gamma, g_brightness);
+
+    lock();
+    memcpy(g_lut, lut, sizeof(g_lut));
+    g_lut_ready = true;
+    unlock();
+}
+
+static uint16_t ms_to_frames(uint32_t ms) {
+    if (ms == 0) {
+        return 0;
+    }
+
+    const uint32_t frames = (ms * g_fps + 500) / 1000;
+
+    if (frames == 0) {
+        return 1;
+    }
+    return frames > UINT16_MAX ? UINT16_MAX : (uint16_t)frames;
+}
+
+static uint8_t lerp(uint8_t a, uint8_t b, uint16_t pos, uint16_t len) {
+    return (uint8_t)(a + ((int32_t)b - a) * pos / len);
+}
+
+static LedColor current_color(const led_state *led) {
+    if (led->fade_pos >= led->fade_frames) {
+        return led->to;
+    }
+
+    return (LedColor){lerp(led->from.r, led->to.r, led->fade_pos, led->fade_frames),
+                      lerp(led->from.g, led->to.g, led->fade_pos, led->fade_frames),
+                      lerp(led->from.b, led->to.b, led->fade_pos, led->fade_frames)};
+}
+
+void leds_anim_set_fps(uint32_t fps) {
+    lock();
+    g_fps = fps ? fps : LEDS_ANIM_DEFAULT_FPS;
+    unlock();
+}
+
+bool leds_anim_compose(LedColor out[PGB1_LEDS_COUNT]) {
+    bool changed = g_first_frame;
+
+    lock();
+
+    if (!g_lut_ready) {
+        for (int v = 0; v < 256; v++) {
+            g_lut[v] = (uint8_t)v;
+        }
+        g_lut_ready = true;
+    }
+
+    for (int id = 0; id < PGB1_LEDS_COUNT; id++) {
+        led_state *led = &g_leds[id];
+        LedColor c = current_color(led);
+
+        if (led->fade_pos < led->fade_frames) {
+            led->fade_pos++;
+        }
+
+        if (led->on_frames != 0) {
+            if (led->blink_pos >= led->on_frames) {
+                c = (LedColor){0, 0, 0};
+            }
+            if (++led->blink_pos >= led->on_frames + led->off_frames) {
+                led->blink_pos = 0;
+            }
+        }
+
+        out[id] = (LedColor){g_lut[c.r], g_lut[c.g], g_lut[c.b]};
+
+        if (memcmp(&out[id], &g_prev_out[id], sizeof(LedColor)) != 0) {
+            g_prev_out[id] = out[id];
+            changed = true;
+        }
+    }
+
+    g_first_frame = false;
+
+    unlock();
+
+    return changed;
+}
+
+void leds_clear(void) {
+    lock();
+    memset(g_leds, 0, sizeof(g_leds));
+    unlock();
+}
+
+void leds_set_target(int id, LedColor rgb, uint32_t fade_ms) {
+    if (id < 0 || id >= PGB1_LEDS_COUNT) {
+        return;
+    }
+
+    lock();
+    led_state *led = &g_leds[id];
+    led->from = current_color(led);
+    led->to = rgb;
+    led->fade_frames = ms_to_frames(fade_ms);
+    led->fade_pos = 0;
+    unlock();
+}
+
+void leds_set_rgb(int id, uint8_t r, uint8_t g, uint8_t b) {
+    leds_set_target(id, (LedColor){r, g, b}, 0);
+}
+
+void leds_set_color(int id, LedColor rgb) {
+    leds_set_target(id, rgb, 0);
+}
+
+void leds_set_blink(int id, uint32_t on_ms, uint32_t off_ms) {
+    if (id < 0 || id >= PGB1_LEDS_COUNT) {
+        return;
+    }
+
+    lock();
+    led_state *led = &g_leds[id];
+    if (on_ms == 0 || off_ms == 0) {
+        led->on_frames = 0;
+        led->off_frames = 0;
+    } else {
+        led->on_frames = ms_to_frames(on_ms);
+        led->off_frames = ms_to_frames(off_ms);
+    }
+    led->blink_pos = 0;
+    unlock();
+}
+
+void leds_set_brightness(uint8_t brightness) {
+    g_brightness = brightness;
+    update_lut();
+}
+
+void leds_set_gamma(float gamma) {
+    if (gamma <= 0.0f) {
+        return;
+    }
+
+    g_gamma = gamma;
+    update_lut();
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file leds_anim.h
+ * @brief PGB-1 LED animation state shared by the LED functions of pgb1.h
+ * (leds_anim.c) and the LED drivers (pgb1.c on the device, pgb1_host.c on
+ * the host).
+ *
+ * The drivers call leds_anim_compose() once per frame, from the animation
+ * timer or from leds_update(), and send the result to the LEDs.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "pgb1.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LEDS_ANIM_DEFAULT_FPS 60
+
+/**
+ * @brief Set the frame rate used to convert fade and blink times to frames.
+ */
+void leds_anim_set_fps(uint32_t fps);
+
+/**
+ * @brief Advance the animations by one frame and compute the LED colors,
+ * after fade, blink, gamma and brightness.
+ *
+ * @param out Output colors
+ *
+ * @return Returns false if the colors are the same as the previous frame.
+ */
+bool leds_anim_compose(LedColor out[PGB1_LEDS_COUNT]);
+
+#ifdef __cplusplus
+}
+#endif
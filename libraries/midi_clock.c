@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stddef.h>
+#include "midi_clock.h"
+
+#define TICK ((uint64_t)1 << 32) // One tick in Q32.32 positions
+
+// Maximum ticks sent by one update, after a stall the late ticks are dropped
+#define MAX_TICKS_PER_UPDATE MIDI_CLOCK_PPQN
+
+// Frames per tick (Q16.16) to ticks per frame (Q32)
+static uint64_t speed_of(uint32_t period) {
+    // Rounded up, so that ticks are not late by one frame
+    return (((uint64_t)1 << 48) + period - 1) / period;
+}
+
+// 60 s / 24 ticks, with the tempo x 100: 250 * rate / bpm_x100
+static uint32_t period_of_bpm(uint32_t rate, uint32_t bpm_x100) {
+    return (uint32_t)(((uint64_t)rate * 250u * 65536u) / bpm_x100);
+}
+
+// Position without the running limit, called with the lock taken
+static uint64_t position_unlimited(const midi_clock *clk, uint32_t frame) {
+    const int32_t delta = (int32_t)(frame - clk->base_frame);
+
+    if (!clk->running || clk->waiting) {
+        return clk->base_pos;
+    }
+
+    if (delta >= 0) {
+        return clk->base_pos + (uint64_t)delta * clk->speed;
+    }
+
+    const uint64_t back = (uint64_t)(-(int64_t)delta) * clk->speed;
+    return back > clk->base_pos ? 0 : clk->base_pos - back;
+}
+
+static uint64_t position(const midi_clock *clk, uint32_t frame) {
+    const uint64_t pos = position_unlimited(clk, frame);
+    return pos > clk->limit ? clk->limit : pos;
+}
+
+static void rebase(midi_clock *clk, uint32_t frame) {
+    clk->base_pos = position(clk, frame);
+    clk->base_frame = frame;
+}
+
+static void reset_song(midi_clock *clk, uint32_t frame) {
+    clk->running = false;
+    clk->waiting = false;
+    clk->ticks = -1;
+    clk->base_pos = 0;
+    clk->base_frame = frame;
+    clk->limit = UINT64_MAX;
+}
+
+void midi_clock_init(midi_clock *clk, uint32_t sample_rate) {
+    critical_section_init(&clk->lock);
+
+    clk->sample_rate = sample_rate;
+    clk->master = false;
+    clk->master_bpm = MIDI_CLOCK_DEFAULT_BPM;
+    clk->send = NULL;
+    clk->period = period_of_bpm(sample_rate, MIDI_CLOCK_DEFAULT_BPM);
+    clk->speed = speed_of(clk->period);
+    clk->intervals = 0;
+    clk->rejected = 0;
+    clk->has_last_tick = false;
+    clk->last_tick_frame = 0;
+    clk->jitter_max = 0;
+    reset_song(clk, 0);
+}
+
+void midi_clock_set_output(midi_clock *clk, midi_clock_send_t send) {
+    critical_section_enter_blocking(&clk->lock);
+    clk->send = send;
+    critical_section_exit(&clk->lock);
+}
+
+void midi_clock_set_master(midi_clock *clk, bool master) {
+    critical_section_enter_blocking(&clk->lock);
+    clk->master = master;
+    reset_song(clk, clk->base_frame);
+    clk->has_last_tick = false;
+    clk->intervals = 0;
+    clk->rejected = 0;
+    if (master) {
+        clk->period = period_of_bpm(clk->sample_rate, clk->master_bpm);
+        clk->speed = speed_of(clk->period);
+    }
+    critical_section_exit(&clk->lock);
+}
+
+void midi_clock_set_bpm(midi_clock *clk, uint32_t bpm_x100, uint32_t frame) {
+    if (bpm_x100 == 0) {
+        return;
+    }
+
+    critical_section_enter_blocking(&clk->lock);
+    clk->master_bpm = bpm_x100;
+    if (clk->master) {
+        rebase(clk, frame);
+        clk->period = period_of_bpm(clk->sample_rate, bpm_x100);
+        clk->speed = speed_of(clk->period);
+    }
+    critical_section_exit(&clk->lock);
+}
+
+// Tempo tracking, called with the lock taken
+static void measure_interval(midi_clock *clk, uint32_t frame) {
+    if (!clk->has_last_tick) {
+        clk->has_last_tick = true;
+        clk->last_tick_frame = frame;
+        return;
+    }
+
+    const uint32_t interval = frame - clk->last_tick_frame;
+    clk->last_tick_frame = frame;
+
+    if (interval == 0 || interval > 0xFFFF) {
+        // Dropout, not a tempo
+        return;
+    }
+
+    const uint32_t measured = interval << 16;
+
+    if (clk->intervals == 0) {
+        clk->period = measured;
+        clk->intervals = 1;
+    } else if (measured > clk->period / 2 && measured < clk->period * 2) {
+        // Average of the intervals until the filter is full, so that a
+        // single jittery first interval does not hold the tempo for long
+        if (clk->intervals < (1u << MIDI_CLOCK_PERIOD_SHIFT)) {
+            clk->intervals++;
+        }
+        const int32_t diff = (int32_t)(measured - clk->period);
+        clk->period += diff / (int32_t)clk->intervals;
+        clk->rejected = 0;
+    } else if (++clk->rejected >= MIDI_CLOCK_RELOCK_TICKS) {
+        // The tempo really changed
+        clk->period = measured;
+        clk->intervals = 1;
+        clk->rejected = 0;
+    }
+}
+
+// Phase locking on a received tick, called with the lock taken
+static void lock_tick(midi_clock *clk, uint32_t frame) {
+    const uint64_t base_speed = speed_of(clk->period);
+
+    clk->ticks++;
+    const uint64_t target = (uint64_t)clk->ticks * TICK;
+    const uint64_t unlimited = position_unlimited(clk, frame);
+    const uint64_t current = unlimited > clk->limit ? clk->limit : unlimited;
+    const int64_t err = (int64_t)(target - current);
+    const uint64_t abs_err = err < 0 ? (uint64_t)-err : (uint64_t)err;
+
+    if (clk->waiting || abs_err > 2 * TICK) {
+        // First tick of the song, or lost: restart from the tick
+        clk->waiting = false;
+        clk->base_pos = target;
+        clk->speed = base_speed;
+    } else {
+        const uint32_t jitter = (uint32_t)(((abs_err >> 16) * clk->period) >> 32);
+
+        if (jitter > clk->jitter_max) {
+            clk->jitter_max = jitter;
+        }
+
+        // Reach target + N ticks in N periods
+        const int64_t num = err + (int64_t)(MIDI_CLOCK_CORRECTION_TICKS * TICK);
+        uint64_t speed = base_speed / 4;
+
+        if (num > 0) {
+            speed = ((uint64_t)num << 16) /
+                ((uint64_t)MIDI_CLOCK_CORRECTION_TICKS * clk->period);
+        }
+        if (speed < base_speed / 4) {
+            speed = base_speed / 4;
+        } else if (speed > base_speed * 4) {
+            speed = base_speed * 4;
+        }
+
+        // Continuous position, even when it was waiting at the limit
+        clk->base_pos = current;
+        clk->speed = speed;
+    }
+
+    clk->base_frame = frame;
+    // Do not run ahead of the master by more than one tick
+    clk->limit = target + TICK;
+}
+
+bool midi_clock_event(midi_clock *clk, const midi_event *ev) {
+    const uint8_t status = ev->msg & 0xFF;
+
+    if (status != 0xF8 && status != 0xFA && status != 0xFB &&
+        status != 0xFC && status != 0xF2) {
+        return false;
+    }
+
+    critical_section_enter_blocking(&clk->lock);
+
+    if (clk->master) {
+        // We are the master, ignore the input clock
+        critical_section_exit(&clk->lock);
+        return true;
+    }
+
+    switch (status) {
+    case 0xF8: // Timing tick
+        measure_interval(clk, ev->frame);
+        if (clk->running) {
+            lock_tick(clk, ev->frame);
+        }
+        break;
+
+    case 0xFA: // Start
+        reset_song(clk, ev->frame);
+        clk->jitter_max = 0;
+        clk->running = true;
+        clk->waiting = true;
+        clk->limit = 0;
+        break;
+
+    case 0xFB: // Continue
+        if (!clk->running) {
+            clk->base_frame = ev->frame;
+            clk->running = true;
+            clk->waiting = true;
+            clk->limit = (uint64_t)(clk->ticks + 1) * TICK;
+        }
+        break;
+
+    case 0xFC: // Stop
+        if (clk->running) {
+            rebase(clk, ev->frame);
+            clk->running = false;
+            clk->waiting = false;
+        }
+        break;
+
+    case 0xF2: // Song position, in 16th notes (6 ticks)
+        if (!clk->running) {
+            const uint32_t beats = ((ev->msg >> 8) & 0x7F) |
+                (((ev->msg >> 16) & 0x7F) << 7);
+
+            clk->ticks = (int64_t)beats * 6 - 1;
+            clk->base_pos = (uint64_t)beats * 6 * TICK;
+            clk->base_frame = ev->frame;
+            // The limit of the previous ticks does not apply anymore
+            clk->limit = clk->base_pos;
+        }
+        break;
+    }
+
+    critical_section_exit(&clk->lock);
+    return true;
+}
+
+// Sends a message outside of the lock
+static void send(midi_clock_send_t cb, uint32_t msg) {
+    if (cb != NULL) {
+        cb(msg);
+    }
+}
+
+void midi_clock_start(midi_clock *clk, uint32_t frame) {
+    critical_section_enter_blocking(&clk->lock);
+    if (!clk->master) {
+        critical_section_exit(&clk->lock);
+        return;
+    }
+    reset_song(clk, frame);
+    clk->running = true;
+    const midi_clock_send_t cb = clk->send;
+    critical_section_exit(&clk->lock);
+
+    send(cb, 0xFA);
+}
+
+void midi_clock_stop(midi_clock *clk, uint32_t frame) {
+    critical_section_enter_blocking(&clk->lock);
+    if (!clk->master || !clk->running) {
+        critical_section_exit(&clk->lock);
+        return;
+    }
+    rebase(clk, frame);
+    clk->running = false;
+    const midi_clock_send_t cb = clk->send;
+    critical_section_exit(&clk->lock);
+
+    send(cb, 0xFC);
+}
+
+void midi_clock_continue(midi_clock *clk, uint32_t frame) {
+    critical_section_enter_blocking(&clk->lock);
+    if (!clk->master || clk->running) {
+        critical_section_exit(&clk->lock);
+        return;
+    }
+    clk->base_frame = frame;
+    clk->running = true;
+    const midi_clock_send_t cb = clk->send;
+    critical_section_exit(&clk->lock);
+
+    send(cb, 0xFB);
+}
+
+uint32_t midi_clock_update(midi_clock *clk, uint32_t frame) {
+    uint32_t count = 0;
+
+    critical_section_enter_blocking(&clk->lock);
+    if (!clk->master || !clk->running) {
+        critical_section_exit(&clk->lock);
+        return 0;
+    }
+
+    // Keep the base close to the current frame
+    rebase(clk, frame);
+
+    const int64_t due = (int64_t)(clk->base_pos / TICK);
+    if (due - clk->ticks > MAX_TICKS_PER_UPDATE) {
+        clk->ticks = due - MAX_TICKS_PER_UPDATE;
+    }
+    if (due > clk->ticks) {
+        count = (uint32_t)(due - clk->ticks);
+        clk->ticks = due;
+    }
+    const midi_clock_send_t cb = clk->send;
+    critical_section_exit(&clk->lock);
+
+    for (uint32_t i = 0; i < count; i++) {
+        send(cb, 0xF8);
+    }
+    return count;
+}
+
+bool midi_clock_running(midi_clock *clk) {
+    return clk->running;
+}
+
+uint64_t midi_clock_position(midi_clock *clk, uint32_t frame) {
+    critical_section_enter_blocking(&clk->lock);
+    const uint64_t pos = position(clk, frame);
+    critical_section_exit(&clk->lock);
+    return pos;
+}
+
+uint32_t midi_clock_phase(midi_clock *clk, uint32_t frame,
+                          uint32_t ticks_per_cycle) {
+    if (ticks_per_cycle == 0) {
+        return 0;
+    }
+
+    const uint64_t pos = midi_clock_position(clk, frame);
+    return (uint32_t)((pos % ((uint64_t)ticks_per_cycle * TICK)) /
+                      ticks_per_cycle);
+}
+
+uint32_t midi_clock_steps(midi_clock *clk, uint64_t *cursor, uint32_t frame,
+                          uint32_t len, uint32_t ticks_per_step,
+                          midi_clock_step *steps, uint32_t max_steps) {
+    uint32_t count = 0;
+
+    if (ticks_per_step == 0 || len == 0) {
+        return 0;
+    }
+
+    critical_section_enter_blocking(&clk->lock);
+    const uint64_t start = position(clk, frame);
+    const uint64_t end = position(clk, frame + len);
+    critical_section_exit(&clk->lock);
+
+    uint64_t from = *cursor;
+    if (from + TICK < start || from > start + TICK) {
+        // Position jump
+        from = start;
+    }
+
+    if (end <= from) {
+        // Stopped, or waiting for the follower correction
+        *cursor = from;
+        return 0;
+    }
+
+    const uint64_t step_len = (uint64_t)ticks_per_step * TICK;
+    uint64_t step = (from + step_len - 1) / step_len;
+
+    while (count < max_steps) {
+        const uint64_t boundary = step * step_len;
+
+        if (boundary >= end) {
+            break;
+        }
+        steps[count].offset = (uint32_t)(((boundary - from) * len) /
+                                         (end - from));
+        steps[count].step = (uint32_t)step;
+        count++;
+        step++;
+    }
+
+    // Steps beyond max_steps are reported by the next call
+    *cursor = count == max_steps && step * step_len < end
+        ? step * step_len : end;
+    return count;
+}
+
+uint32_t midi_clock_period(midi_clock *clk) {
+    return clk->period;
+}
+
+uint32_t midi_clock_bpm(midi_clock *clk) {
+    return (uint32_t)(((uint64_t)clk->sample_rate * 250u * 65536u) /
+                      clk->period);
+}
+
+uint32_t midi_clock_jitter_max(midi_clock *clk) {
+    return clk->jitter_max;
+}
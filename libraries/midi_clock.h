@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file midi_clock.h
+ * @brief MIDI clock follower and generator on the audio sample clock.
+ *
+ * The clock position is a number of MIDI clock ticks (24 per quarter note)
+ * with a 32-bit fractional part, as a function of the audio frame counter
+ * (nn_audio_frame_count()). It advances linearly between ticks, so that
+ * sequencer steps, tempo synced LFOs and delays are sample accurate.
+ *
+ * As a follower, incoming ticks are timestamped with the frame of their
+ * reception (midi_event) and drive a phase-locked loop:
+ *
+ * - The tick period is the average of the intervals between ticks (one-pole
+ *   filter), intervals far from the average are rejected as jitter or
+ *   dropouts until they persist (tempo jump).
+ * - At each tick, the phase error between the received tick and the position
+ *   is corrected over the next MIDI_CLOCK_CORRECTION_TICKS ticks by adjusting
+ *   the speed, so the position is continuous and never goes backward.
+ * - The position does not run more than one tick ahead of the last received
+ *   tick, it waits when the master stops sending.
+ *
+ * As a master, the position follows the tempo set with midi_clock_set_bpm()
+ * and the ticks, start, stop and continue messages are sent through the
+ * output callback.
+ *
+ * All functions can be called from any core or interrupt (e.g. events from a
+ * MIDI task and positions from the audio callback).
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/sync.h"
+#include "midi_utils.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MIDI_CLOCK_PPQN 24 ///< Ticks per quarter note.
+
+/**
+ * @brief Tempo in BPM x 100 before the first received ticks, and of the
+ * master mode by default.
+ */
+#ifndef MIDI_CLOCK_DEFAULT_BPM
+#define MIDI_CLOCK_DEFAULT_BPM 12000
+#endif
+
+/**
+ * @brief Period filter: each interval contributes 1/2^MIDI_CLOCK_PERIOD_SHIFT,
+ * the first 2^MIDI_CLOCK_PERIOD_SHIFT intervals are averaged.
+ */
+#ifndef MIDI_CLOCK_PERIOD_SHIFT
+#define MIDI_CLOCK_PERIOD_SHIFT 3
+#endif
+
+/**
+ * @brief Number of ticks over which a phase error is corrected.
+ */
+#ifndef MIDI_CLOCK_CORRECTION_TICKS
+#define MIDI_CLOCK_CORRECTION_TICKS 4
+#endif
+
+/**
+ * @brief Number of consecutive out of range intervals taken as a tempo jump.
+ */
+#ifndef MIDI_CLOCK_RELOCK_TICKS
+#define MIDI_CLOCK_RELOCK_TICKS 3
+#endif
+
+/**
+ * @typedef midi_clock_send_t
+ * @brief Type definition for the output callback (e.g. midi_send()).
+ *
+ * @param msg The MIDI message to send.
+ * @return true if the message is sent, false otherwise.
+ */
+typedef bool (*midi_clock_send_t)(uint32_t msg);
+
+/**
+ * @struct midi_clock_step
+ * @brief Step boundary inside an audio block.
+ */
+typedef struct midi_clock_step {
+    uint32_t offset; ///< Frame offset in the block.
+    uint32_t step;   ///< Step number since the song start.
+} midi_clock_step;
+
+/**
+ * @struct midi_clock
+ * @brief MIDI clock state.
+ */
+typedef struct midi_clock {
+    uint32_t sample_rate;
+    bool master;
+    bool running;
+    bool waiting;       ///< Running, waiting for the first tick (follower).
+    uint32_t master_bpm;
+    midi_clock_send_t send;
+
+    // Position: base_pos + (frame - base_frame) * speed, in ticks Q32.32
+    uint32_t base_frame;
+    uint64_t base_pos;
+    uint64_t speed;     ///< Ticks per frame, Q32.
+    uint64_t limit;     ///< Maximum position while running.
+
+    uint32_t period;    ///< Average frames per tick, Q16.16.
+    uint32_t intervals; ///< Intervals averaged since the first tick or the
+                        ///< last tempo jump, up to 2^MIDI_CLOCK_PERIOD_SHIFT.
+    uint32_t rejected;  ///< Consecutive out of range intervals.
+    bool has_last_tick;
+    uint32_t last_tick_frame;
+    int64_t ticks;      ///< Last received (follower) or sent (master) tick,
+                        ///< -1 before the first tick of the song.
+    uint32_t jitter_max; ///< Largest phase error since the start, frames.
+
+    critical_section_t lock;
+} midi_clock;
+
+/**
+ * @brief Initializes a clock, follower and stopped
+ *
+ * @param clk Clock state
+ * @param sample_rate Audio sample rate, e.g. nn_audio_clock_plan()->actual_rate
+ */
+void midi_clock_init(midi_clock *clk, uint32_t sample_rate);
+
+/**
+ * @brief Sets the output callback used in master mode
+ *
+ * @param clk Clock state
+ * @param send Callback, or NULL to not send anything
+ */
+void midi_clock_set_output(midi_clock *clk, midi_clock_send_t send);
+
+/**
+ * @brief Selects master or follower mode, the clock is stopped
+ *
+ * @param clk Clock state
+ * @param master true to generate the clock, false to follow MIDI input
+ */
+void midi_clock_set_master(midi_clock *clk, bool master);
+
+/**
+ * @brief Sets the master tempo
+ *
+ * @param clk Clock state
+ * @param bpm_x100 Tempo in BPM x 100 (e.g. 12000 for 120 BPM)
+ * @param frame Current audio frame, the tempo changes from this frame
+ */
+void midi_clock_set_bpm(midi_clock *clk, uint32_t bpm_x100, uint32_t frame);
+
+/**
+ * @brief Processes a MIDI input event (follower)
+ *
+ * @details Handles clock, start, stop, continue and song position messages,
+ * other messages are ignored. Events must be given in reception order.
+ *
+ * @param clk Clock state
+ * @param ev Event, with the frame of its reception
+ *
+ * @return true if the message is a clock message, false otherwise.
+ */
+bool midi_clock_event(midi_clock *clk, const midi_event *ev);
+
+/**
+ * @brief Starts the song from the beginning (master)
+ *
+ * @param clk Clock state
+ * @param frame Audio frame of the first tick
+ */
+void midi_clock_start(midi_clock *clk, uint32_t frame);
+
+/**
+ * @brief Stops the song (master)
+ *
+ * @param clk Clock state
+ * @param frame Current audio frame
+ */
+void midi_clock_stop(midi_clock *clk, uint32_t frame);
+
+/**
+ * @brief Continues the song from the position where it stopped (master)
+ *
+ * @param clk Clock state
+ * @param frame Current audio frame
+ */
+void midi_clock_continue(midi_clock *clk, uint32_t frame);
+
+/**
+ * @brief Sends the ticks due at a given frame (master)
+ *
+ * @details Call it regularly, e.g. from a 1 kHz task: the jitter of the
+ * outgoing ticks is the calling period.
+ *
+ * @param clk Clock state
+ * @param frame Current audio frame
+ *
+ * @return Number of ticks sent.
+ */
+uint32_t midi_clock_update(midi_clock *clk, uint32_t frame);
+
+/**
+ * @brief Gets the running state
+ *
+ * @param clk Clock state
+ *
+ * @return true between start/continue and stop.
+ */
+bool midi_clock_running(midi_clock *clk);
+
+/**
+ * @brief Gets the position at a given frame
+ *
+ * @param clk Clock state
+ * @param frame Audio frame
+ *
+ * @return Position in ticks, Q32.32.
+ */
+uint64_t midi_clock_position(midi_clock *clk, uint32_t frame);
+
+/**
+ * @brief Gets the phase of a tempo synced cycle (e.g. LFO)
+ *
+ * @param clk Clock state
+ * @param frame Audio frame
+ * @param ticks_per_cycle Cycle length in ticks (e.g. 96 for one bar)
+ *
+ * @return Phase, a full cycle is 2^32.
+ */
+uint32_t midi_clock_phase(midi_clock *clk, uint32_t frame,
+                          uint32_t ticks_per_cycle);
+
+/**
+ * @brief Gets the step boundaries inside an audio block
+ *
+ * @details The cursor keeps the position at the end of the previous block so
+ * that each step is reported once, even when the follower corrects its
+ * phase. Initialize it to 0. After a position jump (song position, start
+ * from another position) the cursor is moved without reporting the skipped
+ * steps.
+ *
+ * @param clk Clock state
+ * @param cursor Position of the caller, updated
+ * @param frame Audio frame of the start of the block
+ * @param len Block length in frames
+ * @param ticks_per_step Step length in ticks (e.g. 6 for 16th notes)
+ * @param steps Output array
+ * @param max_steps Size of the output array
+ *
+ * @return Number of steps in the block.
+ */
+uint32_t midi_clock_steps(midi_clock *clk, uint64_t *cursor, uint32_t frame,
+                          uint32_t len, uint32_t ticks_per_step,
+                          midi_clock_step *steps, uint32_t max_steps);
+
+/**
+ * @brief Gets the tick period, e.g. for tempo synced delays
+ *
+ * @param clk Clock state
+ *
+ * @return Frames per tick, Q16.16.
+ */
+uint32_t midi_clock_period(midi_clock *clk);
+
+/**
+ * @brief Gets the tempo
+ *
+ * @param clk Clock state
+ *
+ * @return Tempo in BPM x 100.
+ */
+uint32_t midi_clock_bpm(midi_clock *clk);
+
+/**
+ * @brief Gets the largest phase error of the follower since the start
+ *
+ * @param clk Clock state
+ *
+ * @details With an input jitter of +/-J frames, it stays close to 2J: an
+ * early tick after a late one.
+ *
+ * @return Largest difference between a received tick and the position, in
+ * frames.
+ */
+uint32_t midi_clock_jitter_max(midi_clock *clk);
+
+#ifdef __cplusplus
+}
+#endif
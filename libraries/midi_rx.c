@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/uart.h"
+#include "noise_nugget.h"
+#include "midi_rx.h"
+
+static void midi_rx_start(midi_rx *rx) {
+    rx->read_count = 0;
+    dma_channel_set_write_addr(rx->dma_chan, rx->ring, false);
+    dma_channel_set_trans_count(rx->dma_chan, 0xFFFFFFFF, true);
+}
+
+bool midi_rx_init(midi_rx *rx, uart_inst_t *uart) {
+    rx->uart = uart;
+    rx->overruns = 0;
+    rx->last_poll_us = time_us_32();
+    midi_decoder_init(&rx->decoder);
+
+    rx->dma_chan = dma_claim_unused_channel(false);
+    if (rx->dma_chan < 0) {
+        return false;
+    }
+
+    dma_channel_config c = dma_channel_get_default_config(rx->dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, MIDI_RX_RING_BITS);
+    channel_config_set_dreq(&c, uart_get_dreq(uart, false));
+    dma_channel_set_config(rx->dma_chan, &c, false);
+    dma_channel_set_read_addr(rx->dma_chan, &uart_get_hw(uart)->dr, false);
+
+    midi_rx_start(rx);
+    return true;
+}
+
+uint32_t midi_rx_poll(midi_rx *rx, midi_event *events, uint32_t max_events) {
+    uint32_t count = 0;
+
+    if (rx->dma_chan < 0) {
+        return 0;
+    }
+
+    const uint32_t now = time_us_32();
+    const uint32_t frame_now = nn_audio_frame_count();
+    const uint32_t rate = nn_audio_clock_plan()->actual_rate;
+    const uint32_t written =
+        0xFFFFFFFF - dma_channel_hw_addr(rx->dma_chan)->transfer_count;
+
+    // Bytes of this batch were received after the previous poll
+    const uint32_t max_age = now - rx->last_poll_us;
+
+    if (written - rx->read_count > MIDI_RX_RING_LEN) {
+        // The oldest bytes are overwritten
+        rx->overruns += written - rx->read_count - MIDI_RX_RING_LEN;
+        rx->read_count = written - MIDI_RX_RING_LEN;
+    }
+
+    while (rx->read_count != written && count < max_events) {
+        const uint8_t byte = rx->ring[rx->read_count % MIDI_RX_RING_LEN];
+        const uint32_t msg = midi_decoder_push(&rx->decoder, byte);
+
+        if (msg != 0) {
+            uint32_t age = (written - 1 - rx->read_count) * MIDI_BYTE_US;
+
+            if (age > max_age) {
+                age = max_age;
+            }
+
+            events[count].msg = msg;
+            events[count].time_us = now - age;
+            events[count].frame =
+                frame_now - (uint32_t)(((uint64_t)age * rate) / 1000000u);
+            count++;
+        }
+        rx->read_count++;
+    }
+
+    if (rx->read_count == written) {
+        rx->last_poll_us = now;
+
+        if (!dma_channel_is_busy(rx->dma_chan)) {
+            // End of the (2^32 bytes) transfer
+            midi_rx_start(rx);
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file midi_rx.h
+ * @brief MIDI input through a UART RX DMA ring, with batched decoding.
+ *
+ * A DMA channel copies every received byte from the UART into a ring buffer,
+ * there is no interrupt per byte or per FIFO fill. The bytes are decoded
+ * when the application calls midi_rx_poll(), e.g. from a low priority task
+ * or once per audio block, so MIDI decoding never preempts the audio
+ * interrupts.
+ *
+ * The DMA drains the UART FIFO as soon as a byte is received, so the UART
+ * receive timeout interrupt cannot be used to detect the end of a burst:
+ * the reception time of each byte is estimated from its position in the ring
+ * (bytes are 320 us apart at 31250 baud) and the time of the previous poll.
+ * The estimate is within the polling period.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "hardware/uart.h"
+#include "midi_utils.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Size of the ring buffer, 82 ms of continuous MIDI input.
+ */
+#define MIDI_RX_RING_LEN 256
+#define MIDI_RX_RING_BITS 8 // log2(MIDI_RX_RING_LEN)
+
+/**
+ * @struct midi_rx
+ * @brief MIDI input state, one per UART.
+ */
+typedef struct midi_rx {
+    /** Written by the DMA, aligned on its size for the address wrapping. */
+    uint8_t ring[MIDI_RX_RING_LEN] __attribute__((aligned(MIDI_RX_RING_LEN)));
+    uart_inst_t *uart;
+    int dma_chan;
+    uint32_t read_count;   ///< Bytes decoded since the start of the transfer.
+    uint32_t last_poll_us; ///< Time of the previous poll.
+    uint32_t overruns;     ///< Bytes lost because polls were too far apart.
+    midi_decoder decoder;
+} midi_rx;
+
+/**
+ * @brief Starts receiving MIDI input by DMA
+ *
+ * @param rx MIDI input state, must stay valid (static)
+ * @param uart The UART, already initialized (uart_init() also enables its DMA
+ *        requests)
+ *
+ * @return true on success, false otherwise (no DMA channel available).
+ */
+bool midi_rx_init(midi_rx *rx, uart_inst_t *uart);
+
+/**
+ * @brief Decodes the bytes received since the previous call
+ *
+ * @details Stops after max_events messages, the remaining bytes are decoded
+ * by the next call. Call it at least every 80 ms.
+ *
+ * @param rx MIDI input state
+ * @param events Output array of decoded messages
+ * @param max_events Size of the output array
+ *
+ * @return Number of decoded messages.
+ */
+uint32_t midi_rx_poll(midi_rx *rx, midi_event *events, uint32_t max_events);
+
+#ifdef __cplusplus
+}
+#endif
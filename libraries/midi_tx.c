@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stddef.h>
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/uart.h"
+#include "midi_tx.h"
+
+// The DMA completion interrupt shares DMA_IRQ_1 with the audio input and the
+// PGB-1 screen
+#define MIDI_TX_DMA_IRQ DMA_IRQ_1
+
+#define MIDI_TX_MAX_OUTPUTS 2 // One per UART
+
+static midi_tx *outputs[MIDI_TX_MAX_OUTPUTS];
+static int output_cnt = 0;
+
+// Called with the lock taken and no transfer in progress
+static void start_next(midi_tx *tx) {
+    const uint8_t *src;
+    uint32_t len;
+
+    if (tx->rt_head != tx->rt_tail) {
+        tx->rt_byte = tx->rt[tx->rt_tail % MIDI_TX_RT_LEN];
+        tx->rt_tail++;
+        tx->chunk_len = 0;
+        src = &tx->rt_byte;
+        len = 1;
+    } else if (tx->head != tx->tail) {
+        const uint32_t pos = tx->tail % MIDI_TX_RING_LEN;
+
+        len = tx->head - tx->tail;
+        if (len > MIDI_TX_RING_LEN - pos) {
+            len = MIDI_TX_RING_LEN - pos;
+        }
+        if (len > MIDI_TX_CHUNK) {
+            len = MIDI_TX_CHUNK;
+        }
+        tx->chunk_len = len;
+        src = &tx->ring[pos];
+    } else {
+        tx->busy = false;
+        return;
+    }
+
+    tx->busy = true;
+    dma_channel_transfer_from_buffer_now(tx->dma_chan, src, len);
+}
+
+static void dma_tx_handler(void) {
+    for (int i = 0; i < output_cnt; i++) {
+        midi_tx *tx = outputs[i];
+
+        if (dma_hw->ints1 & (1u << tx->dma_chan)) {
+            // Clear the interrupt request.
+            dma_hw->ints1 = 1u << tx->dma_chan;
+
+            critical_section_enter_blocking(&tx->lock);
+            tx->tail += tx->chunk_len;
+            tx->chunk_len = 0;
+            start_next(tx);
+            critical_section_exit(&tx->lock);
+        }
+    }
+}
+
+bool midi_tx_init(midi_tx *tx, uart_inst_t *uart) {
+    tx->uart = uart;
+    tx->head = tx->tail = 0;
+    tx->rt_head = tx->rt_tail = 0;
+    tx->chunk_len = 0;
+    tx->busy = false;
+    tx->stats = (midi_tx_stats){0};
+    midi_encoder_init(&tx->encoder, true);
+
+    if (output_cnt == MIDI_TX_MAX_OUTPUTS) {
+        tx->dma_chan = -1;
+        return false;
+    }
+
+    tx->dma_chan = dma_claim_unused_channel(false);
+    if (tx->dma_chan < 0) {
+        return false;
+    }
+    critical_section_init(&tx->lock);
+
+    // At most one byte waiting in the UART, so that real time messages are
+    // not queued behind a full FIFO
+    uart_set_fifo_enabled(uart, false);
+
+    dma_channel_config c = dma_channel_get_default_config(tx->dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, uart_get_dreq(uart, true));
+    dma_channel_set_config(tx->dma_chan, &c, false);
+    dma_channel_set_write_addr(tx->dma_chan, &uart_get_hw(uart)->dr, false);
+
+    if (output_cnt == 0) {
+        irq_add_shared_handler(MIDI_TX_DMA_IRQ, dma_tx_handler,
+                               PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    }
+    outputs[output_cnt++] = tx;
+
+    dma_channel_set_irq1_enabled(tx->dma_chan, true);
+    irq_set_enabled(MIDI_TX_DMA_IRQ, true);
+    return true;
+}
+
+void midi_tx_set_running_status(midi_tx *tx, bool enable) {
+    if (tx->dma_chan < 0) {
+        return;
+    }
+
+    critical_section_enter_blocking(&tx->lock);
+    midi_encoder_init(&tx->encoder, enable);
+    critical_section_exit(&tx->lock);
+}
+
+bool midi_tx_send(midi_tx *tx, uint32_t msg) {
+    uint8_t bytes[3];
+    bool queued = false;
+
+    if (tx->dma_chan < 0) {
+        return false;
+    }
+
+    critical_section_enter_blocking(&tx->lock);
+
+    if ((msg & 0xFF) >= 0xF8) {
+        // Real time message, sent before the other queued bytes
+        if (tx->rt_head - tx->rt_tail < MIDI_TX_RT_LEN &&
+            midi_encode(&tx->encoder, msg, bytes) == 1) {
+            tx->rt[tx->rt_head % MIDI_TX_RT_LEN] = bytes[0];
+            tx->rt_head++;
+            queued = true;
+        }
+    } else {
+        // Encode a copy, the running status is only updated if the message
+        // is queued
+        midi_encoder enc = tx->encoder;
+        const uint32_t len = midi_encode(&enc, msg, bytes);
+
+        if (len != 0 && MIDI_TX_RING_LEN - (tx->head - tx->tail) >= len) {
+            for (uint32_t i = 0; i < len; i++) {
+                tx->ring[(tx->head + i) % MIDI_TX_RING_LEN] = bytes[i];
+            }
+            tx->head += len;
+            tx->encoder = enc;
+            queued = true;
+        }
+    }
+
+    if (queued) {
+        const uint32_t depth =
+            (tx->head - tx->tail) + (tx->rt_head - tx->rt_tail);
+
+        tx->stats.sent++;
+        if (depth > tx->stats.max_depth) {
+            tx->stats.max_depth = depth;
+        }
+
+        if (!tx->busy) {
+            start_next(tx);
+        }
+    } else {
+        tx->stats.drops++;
+    }
+
+    critical_section_exit(&tx->lock);
+    return queued;
+}
+
+void midi_tx_get_stats(midi_tx *tx, midi_tx_stats *stats) {
+    if (tx->dma_chan < 0) {
+        *stats = tx->stats;
+        return;
+    }
+
+    critical_section_enter_blocking(&tx->lock);
+    *stats = tx->stats;
+    stats->depth = (tx->head - tx->tail) + (tx->rt_head - tx->rt_tail);
+    critical_section_exit(&tx->lock);
+}
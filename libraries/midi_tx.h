@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file midi_tx.h
+ * @brief MIDI output through a software queue fed to the UART by DMA.
+ *
+ * Messages are encoded (with running status) into a byte ring when they are
+ * queued, a DMA channel then copies the bytes to the UART in chunks of at
+ * most MIDI_TX_CHUNK bytes, and the DMA interrupt starts the next chunk.
+ * Sending never waits for the UART.
+ *
+ * Real time messages (clock, start, stop, ...) have their own queue and are
+ * sent before the next chunk, even between the bytes of another message
+ * (which the MIDI specification allows). The UART FIFO is disabled so that
+ * at most one byte is waiting in the UART: a real time message is delayed by
+ * at most MIDI_TX_CHUNK + 1 bytes (about 1.3 ms).
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "hardware/uart.h"
+#include "pico/sync.h"
+#include "midi_utils.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Size of the queue in bytes, 82 ms of continuous MIDI output.
+ */
+#ifndef MIDI_TX_RING_LEN
+#define MIDI_TX_RING_LEN 256
+#endif
+
+/**
+ * @brief Size of the real time messages queue.
+ */
+#ifndef MIDI_TX_RT_LEN
+#define MIDI_TX_RT_LEN 8
+#endif
+
+/**
+ * @brief Maximum number of bytes per DMA transfer, a real time message waits
+ * for at most one transfer.
+ */
+#ifndef MIDI_TX_CHUNK
+#define MIDI_TX_CHUNK 3
+#endif
+
+/**
+ * @struct midi_tx
+ * @brief MIDI output state, one per UART.
+ */
+typedef struct midi_tx {
+    uint8_t ring[MIDI_TX_RING_LEN];
+    uint32_t head; ///< Bytes queued since the init.
+    uint32_t tail; ///< Bytes sent since the init.
+
+    uint8_t rt[MIDI_TX_RT_LEN];
+    uint32_t rt_head;
+    uint32_t rt_tail;
+    uint8_t rt_byte; ///< Real time message being sent.
+
+    uint32_t chunk_len; ///< Bytes of the ring in the current DMA transfer.
+    bool busy;          ///< A DMA transfer is in progress.
+
+    midi_encoder encoder;
+    midi_tx_stats stats;
+    uart_inst_t *uart;
+    int dma_chan;
+    critical_section_t lock;
+} midi_tx;
+
+/**
+ * @brief Starts the MIDI output
+ *
+ * @details Disables the FIFO of the UART, claims a DMA channel and installs a
+ * shared handler on DMA_IRQ_1.
+ *
+ * @param tx MIDI output state, must stay valid (static)
+ * @param uart The UART, already initialized (uart_init() also enables its DMA
+ *        requests)
+ *
+ * @return true on success, false otherwise (no DMA channel available, too
+ * many outputs).
+ */
+bool midi_tx_init(midi_tx *tx, uart_inst_t *uart);
+
+/**
+ * @brief Enables or disables running status (enabled by default)
+ *
+ * @param tx MIDI output state
+ * @param enable Omit repeated status bytes of channel messages
+ */
+void midi_tx_set_running_status(midi_tx *tx, bool enable);
+
+/**
+ * @brief Queues a message
+ *
+ * @details Can be called from any core or interrupt.
+ *
+ * @param tx MIDI output state
+ * @param msg Message, in the format returned by midi_decoder_push()
+ *
+ * @return true if the message is queued, false if it is invalid or dropped
+ * because the queue is full.
+ */
+bool midi_tx_send(midi_tx *tx, uint32_t msg);
+
+/**
+ * @brief Gets the output statistics
+ *
+ * @param tx MIDI output state
+ * @param stats Output statistics
+ */
+void midi_tx_get_stats(midi_tx *tx, midi_tx_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
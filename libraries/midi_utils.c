@@ -4,116 +4,251 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <stddef.h>
 #include "midi_utils.h"
 
-void midi_decoder_init(midi_decoder *dec) {
+static void reset_message(midi_decoder *dec) {
     dec->expect_data = false;
     dec->msg = 0;
     dec->count = 0;
     dec->index = 0;
 }
 
-uint32_t midi_decoder_push(midi_decoder *dec, uint8_t byte) {
-    const bool is_status = (byte & 0b10000000) != 0;
+static void start_message(midi_decoder *dec, uint8_t status, int size) {
+    dec->msg = status;
+    dec->count = size - 1;
+    dec->index = 1;
+    dec->expect_data = true;
+}
 
-    if (dec->expect_data) {
-        if (is_status || dec->count == 0) {
-            /* There is an issue with the current message, ignore it */
-            dec->expect_data = false;
+/* Size in bytes (including status) of a channel message */
+static int channel_message_size(uint8_t status) {
+    switch ((status >> 4) & 0b1111) {
+    case Patch_Change:
+    case Channel_Pressure:
+        return 2;
+    default:
+        return 3;
+    }
+}
+
+static void sysex_flush(midi_decoder *dec, uint32_t flags) {
+    if (dec->sysex_first) {
+        flags |= MIDI_SYSEX_START;
+        dec->sysex_first = false;
+    }
+    dec->sysex_cb(dec->sysex_user, dec->sysex_buf, dec->sysex_len, flags);
+    dec->sysex_len = 0;
+}
 
-            /* Fallback to status byte processing below */
-        } else {
-            /* Save incoming data byte*/
-            dec->msg = dec->msg | (byte << (8 * dec->index));
-            dec->count -= 1;
-            dec->index += 1;
+void midi_decoder_init(midi_decoder *dec) {
+    reset_message(dec);
+    dec->running_status = 0;
+
+    dec->in_sysex = false;
+    dec->sysex_first = false;
+    dec->sysex_buf = NULL;
+    dec->sysex_size = 0;
+    dec->sysex_len = 0;
+    dec->sysex_cb = NULL;
+    dec->sysex_user = NULL;
+}
 
-            /* Check if we have a complete message */
-            if (dec->count == 0) {
-                const uint32_t msg = dec->msg;
-                midi_decoder_init(dec);
+void midi_decoder_set_sysex(midi_decoder *dec, uint8_t *buffer, uint32_t size,
+                            midi_sysex_cb_t cb, void *user) {
+    dec->in_sysex = false;
+    dec->sysex_len = 0;
 
-                return msg;
-            }
+    if (buffer == NULL || size == 0) {
+        cb = NULL;
+    }
+    dec->sysex_buf = buffer;
+    dec->sysex_size = size;
+    dec->sysex_cb = cb;
+    dec->sysex_user = user;
+}
 
+uint32_t midi_decoder_push(midi_decoder *dec, uint8_t byte) {
+    const bool is_status = (byte & 0b10000000) != 0;
+
+    if (byte >= 0xF8) {
+        /* Real time messages can be anywhere, even between the bytes of
+           another message, and do not change the decoder state. */
+        switch (byte & 0b1111) {
+        case Timming_Tick:
+        case Start_Song:
+        case Continue_Song:
+        case Stop_Song:
+        case Active_Sensing:
+        case Reset:
+            return byte;
+        default:
+            /* Undefined (0xF9, 0xFD) */
             return 0;
         }
     }
 
-    if (is_status) {
-        const uint8_t cmd = (byte >> 4) & 0b1111;
-        const uint8_t sub = (byte >> 0) & 0b1111;
+    if (!is_status) {
+        if (dec->in_sysex) {
+            if (dec->sysex_len == dec->sysex_size) {
+                sysex_flush(dec, 0);
+            }
+            dec->sysex_buf[dec->sysex_len++] = byte;
+            return 0;
+        }
+
+        if (!dec->expect_data) {
+            if (dec->running_status == 0) {
+                /* Data byte without status, ignore it */
+                return 0;
+            }
 
-        switch (cmd) {
+            /* Running status: new message with the previous status byte */
+            start_message(dec, dec->running_status,
+                          channel_message_size(dec->running_status));
+        }
 
-        case Note_Off:
-        case Note_On:
-        case Aftertouch:
-        case Continous_Controller:
-                dec->msg = byte;
-                dec->count = 3 - 1;
-                dec->index = 1;
-                dec->expect_data = true;
+        /* Save incoming data byte*/
+        dec->msg = dec->msg | (byte << (8 * dec->index));
+        dec->count -= 1;
+        dec->index += 1;
+
+        /* Check if we have a complete message */
+        if (dec->count == 0) {
+            const uint32_t msg = dec->msg;
+            reset_message(dec);
+
+            return msg;
+        }
+
+        return 0;
+    }
+
+    /* Any status byte ends the SysEx in progress and the incomplete
+       message, if any. */
+    if (dec->in_sysex) {
+        dec->in_sysex = false;
+        sysex_flush(dec, byte == 0xF7 ? MIDI_SYSEX_END : MIDI_SYSEX_ABORTED);
+    }
+    reset_message(dec);
+
+    const uint8_t cmd = (byte >> 4) & 0b1111;
+    const uint8_t sub = (byte >> 0) & 0b1111;
+
+    switch (cmd) {
+
+    case Note_Off:
+    case Note_On:
+    case Aftertouch:
+    case Continous_Controller:
+    case Patch_Change:
+    case Channel_Pressure:
+    case Pitch_Bend:
+        dec->running_status = byte;
+        start_message(dec, byte, channel_message_size(byte));
+        break;
+
+    case Sys:
+        /* System common messages cancel the running status */
+        dec->running_status = 0;
+
+        switch (sub) {
+
+        case Exclusive:
+            if (dec->sysex_cb != NULL) {
+                dec->in_sysex = true;
+                dec->sysex_first = true;
+                dec->sysex_len = 0;
+            }
             break;
 
-        case Patch_Change:
-        case Channel_Pressure:
-        case Pitch_Bend:
-                dec->msg = byte;
-                dec->count = 2 - 1;
-                dec->index = 1;
-                dec->expect_data = true;
+        case End_Exclusive:
+            /* Handled above */
             break;
 
-        case Sys:
-            switch (sub) {
-
-            case Exclusive:
-            case End_Exclusive:
-                /* Ignore SysEx start and stop, we do not support those
-                   messages */
-                break;
-
-            case Song_Position:
-                dec->msg = byte;
-                dec->count = 3 - 1;
-                dec->index = 1;
-                dec->expect_data = true;
-                break;
-
-            case Song_Select:
-            case Bus_Select:
-                dec->msg = byte;
-                dec->count = 2 - 1;
-                dec->index = 1;
-                dec->expect_data = true;
-                break;
-
-            case Tune_Request:
-            case Timming_Tick:
-            case Start_Song:
-            case Continue_Song:
-            case Stop_Song:
-            case Active_Sensing:
-            case Reset:
-                dec->msg = 0;
-                dec->count = 0;
-                dec->index = 0;
-                dec->expect_data = false;
-                return byte;
-                break;
-
-            default:
-                /* Unknown/unsupported sys message */
-                break;
-            }
+        case Song_Position:
+            start_message(dec, byte, 3);
             break;
 
-        default:
-            /* Unknown/unsupported message */
+        case Song_Select:
+        case Bus_Select:
+            start_message(dec, byte, 2);
             break;
 
+        case Tune_Request:
+            return byte;
+
+        default:
+            /* Unknown/unsupported sys message */
+            break;
         }
+        break;
+
+    default:
+        /* Unknown/unsupported message */
+        break;
+
     }
     return 0;
 }
+
+void midi_encoder_init(midi_encoder *enc, bool running_status) {
+    enc->use_running_status = running_status;
+    enc->running_status = 0;
+}
+
+uint32_t midi_encode(midi_encoder *enc, uint32_t msg, uint8_t out[3]) {
+    const uint8_t status = msg & 0xFF;
+    const uint8_t data1 = (msg >> 8) & 0x7F;
+    const uint8_t data2 = (msg >> 16) & 0x7F;
+    int size;
+
+    if ((status & 0b10000000) == 0) {
+        return 0;
+    }
+
+    if (status >= 0xF8) {
+        if (status == 0xF9 || status == 0xFD) {
+            /* Undefined */
+            return 0;
+        }
+        out[0] = status;
+        return 1;
+    }
+
+    if (((status >> 4) & 0b1111) != Sys) {
+        size = channel_message_size(status);
+
+        if (enc->use_running_status && status == enc->running_status) {
+            out[0] = data1;
+            out[1] = data2;
+            return size - 1;
+        }
+        enc->running_status = status;
+    } else {
+        switch (status & 0b1111) {
+        case Song_Position:
+            size = 3;
+            break;
+        case 0x1: /* MIDI time code quarter frame */
+        case Song_Select:
+        case Bus_Select:
+            size = 2;
+            break;
+        case Tune_Request:
+            size = 1;
+            break;
+        default:
+            /* SysEx or undefined */
+            return 0;
+        }
+
+        /* System common messages cancel the running status */
+        enc->running_status = 0;
+    }
+
+    out[0] = status;
+    out[1] = data1;
+    out[2] = data2;
+    return size;
+}
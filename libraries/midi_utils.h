@@ -6,7 +6,7 @@
 
 /**
  * @file midi_utils.h
- * @brief MIDI messages decoder.
+ * @brief MIDI messages decoder and encoder.
  */
 
 #pragma once
@@ -43,20 +43,91 @@ typedef enum midi_sys_cmd {
     Reset          = 0xF
 } midi_sys_cmd;
 
+/*! \brief Flags of a SysEx chunk */
+#define MIDI_SYSEX_START   0x1 /*!< First chunk of the message */
+#define MIDI_SYSEX_END     0x2 /*!< Last chunk, the message ended with 0xF7 */
+#define MIDI_SYSEX_ABORTED 0x4 /*!< Last chunk, the message was interrupted
+                                    by a status byte */
+
+/*! \brief SysEx chunk callback
+ *
+ * Called from midi_decoder_push() when the SysEx buffer is full or at the
+ * end of the message. The data is in the buffer given to
+ * midi_decoder_set_sysex(), it is overwritten by the next chunk.
+ *
+ * \param user User pointer given to midi_decoder_set_sysex()
+ * \param data SysEx data bytes, without the 0xF0 and 0xF7 bytes
+ * \param len Number of data bytes (can be 0 for the last chunk)
+ * \param flags MIDI_SYSEX_* flags
+ */
+typedef void (*midi_sysex_cb_t)(void *user, const uint8_t *data, uint32_t len,
+                                uint32_t flags);
+
+#define MIDI_BYTE_US 320 /*!< Duration of a byte (10 bits) at 31250 baud */
+
+/*! \brief Decoded MIDI message with its reception time */
+typedef struct midi_event {
+    uint32_t msg;     /*!< Message, as returned by midi_decoder_push() */
+    uint32_t frame;   /*!< Audio sample clock at the last byte of the message,
+                           see nn_audio_frame_count() */
+    uint32_t time_us; /*!< time_us_32() at the last byte of the message */
+} midi_event;
+
+/*! \brief MIDI output statistics */
+typedef struct midi_tx_stats {
+    uint32_t depth;     /*!< Bytes in the output queue */
+    uint32_t max_depth; /*!< Highest depth since the init */
+    uint32_t sent;      /*!< Messages queued */
+    uint32_t drops;     /*!< Messages dropped because the queue was full */
+} midi_tx_stats;
+
 typedef struct midi_decoder {
     bool expect_data;
     int count;
     uint32_t msg;
     int index;
+
+    uint8_t running_status; /* Channel status byte, 0 when none */
+
+    bool in_sysex;
+    bool sysex_first;
+    uint8_t *sysex_buf;
+    uint32_t sysex_size;
+    uint32_t sysex_len;
+    midi_sysex_cb_t sysex_cb;
+    void *sysex_user;
 } midi_decoder;
 
 /*! \brief Init/reset a MIDI decoder
+ *
+ * Also disables SysEx streaming.
  *
  * \param dec MIDI decoder instance
  */
 void midi_decoder_init(midi_decoder *dec);
 
+/*! \brief Enable SysEx streaming
+ *
+ * SysEx data bytes are written directly in the buffer, the callback is called
+ * each time the buffer is full and at the end of the message, so messages of
+ * any size are received with a fixed size buffer. Without a callback SysEx
+ * messages are ignored.
+ *
+ * \param dec MIDI decoder instance
+ * \param buffer Buffer for the SysEx data bytes
+ * \param size Size of the buffer in bytes
+ * \param cb SysEx chunk callback, NULL to disable SysEx streaming
+ * \param user User pointer given to the callback
+ */
+void midi_decoder_set_sysex(midi_decoder *dec, uint8_t *buffer, uint32_t size,
+                            midi_sysex_cb_t cb, void *user);
+
 /*! \brief Process and incoming byte of MIDI input
+ *
+ * Channel messages using running status (data bytes without a new status
+ * byte) are decoded with the previous status byte. Real time messages
+ * (0xF8-0xFF) are returned immediately, even in the middle of another
+ * message or of a SysEx.
  *
  * \param dec MIDI decoder instance
  * \param byte incoming byte of MIDI input
@@ -64,6 +135,33 @@ void midi_decoder_init(midi_decoder *dec);
  */
 uint32_t midi_decoder_push(midi_decoder *dec, uint8_t byte);
 
+typedef struct midi_encoder {
+    bool use_running_status;
+    uint8_t running_status; /* Last channel status byte sent, 0 when none */
+} midi_encoder;
+
+/*! \brief Init/reset a MIDI encoder
+ *
+ * \param enc MIDI encoder instance
+ * \param running_status Omit the status byte of channel messages when it is
+ *        the same as the previous one
+ */
+void midi_encoder_init(midi_encoder *enc, bool running_status);
+
+/*! \brief Encode a MIDI message
+ *
+ * The bytes must be transmitted in the order of the calls, the running status
+ * depends on the previously encoded message. Real time messages can be
+ * transmitted anywhere, they do not change the running status. SysEx
+ * messages are not supported.
+ *
+ * \param enc MIDI encoder instance
+ * \param msg message, in the format returned by midi_decoder_push()
+ * \param out output bytes
+ * \return number of bytes written in out, 0 for an invalid message
+ */
+uint32_t midi_encode(midi_encoder *enc, uint32_t msg, uint8_t out[3]);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
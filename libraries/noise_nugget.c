@@ -4,16 +4,22 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <string.h>
 #include "pico/stdlib.h"
 #include "hardware/clocks.h"
 #include "hardware/gpio.h"
 #include "hardware/i2c.h"
 #include "hardware/pio.h"
 #include "hardware/dma.h"
+#include "hardware/flash.h"
 #include "hardware/irq.h"
 #include "hardware/pwm.h"
+#include "hardware/sync.h"
+#include "hardware/vreg.h"
 #include "duplex_i2s.pio.h"
 #include "noise_nugget.h"
+#include "clock_planner.h"
+#include "dac_eq.h"
 #include "aic3105_reg_def.h"
 #define I2S_PIO pio1
 #define I2S_SM 0
@@ -25,11 +31,14 @@
 #define I2S_BCLK_PIN 3
 
 #define AIC3105_ADDR 0x18
+#define AIC3105_RESET_TIMEOUT_US 10000
 #define TCA6408_ADDR 0x20
 
 #define I2C_PORT i2c1
+#define I2C_IRQ I2C1_IRQ
 #define I2C_SDA_PIN 6
 #define I2C_SCL_PIN 7
+#define I2C_BAUDRATE (400 * 1000) // Fast-mode, supported by AIC3105 and TCA6408
 
 #define IO_EXP_SPK_Enable_L_Mask  0b00000001
 #define IO_EXP_SPK_Enable_R_Mask  0b00000010
@@ -54,12 +63,26 @@ static int i2s_out_dma_chan = -1; // init with invalid DMA channel id
 static int i2s_in_dma_chan = -1; // init with invalid DMA channel id
 
 #define DUMMY_AUDIO_BUFFER_SIZE 256
-const uint32_t zeroes_audio_buffer[DUMMY_AUDIO_BUFFER_SIZE] = {0x0};
+// In RAM, not const: the output DMA plays it on gaps, and it must not read
+// the flash during the store and recorder operations
+static uint32_t zeroes_audio_buffer[DUMMY_AUDIO_BUFFER_SIZE] = {0x0};
 static uint32_t dev_null_audio_buffer[DUMMY_AUDIO_BUFFER_SIZE] = {0x0};
 
 static audio_cb_t user_audio_input_callback = NULL;
 static audio_cb_t user_audio_output_callback = NULL;
 
+static nn_clock_plan g_clock_plan = {0};
+static uint32_t g_sample_rate = 0;
+
+// Audio sample clock: frames of the completed output transfers, plus the
+// length of the transfer in progress. g_frame_seq is odd while they are
+// updated (see nn_audio_frame_count()).
+static volatile uint32_t g_frames_done = 0;
+static volatile uint32_t g_out_transfer_len = 0;
+static volatile uint32_t g_frame_seq = 0;
+
+static volatile uint32_t g_in_transfer_len = 0;
+
 static void dma_out_handler() {
     uint32_t *buffer = NULL;
     uint32_t point_count = 0;
@@ -78,18 +101,71 @@ static void dma_out_handler() {
         point_count = DUMMY_AUDIO_BUFFER_SIZE;
     }
 
+    g_frame_seq++;
+    g_frames_done += g_out_transfer_len;
+    g_out_transfer_len = point_count;
     dma_channel_transfer_from_buffer_now(i2s_out_dma_chan,
                                          buffer,
                                          point_count);
+    g_frame_seq++;
 }
 
-static void dma_in_handler() {
+uint32_t nn_audio_frame_count(void) {
+    uint32_t seq, done, len, remaining;
+
+    if (i2s_out_dma_chan < 0) {
+        return 0;
+    }
+
+    // Retry if the DMA handler ran in the middle (other core, or higher
+    // priority interrupt)
+    do {
+        seq = g_frame_seq;
+        done = g_frames_done;
+        len = g_out_transfer_len;
+        remaining = dma_channel_hw_addr(i2s_out_dma_chan)->transfer_count;
+    } while ((seq & 1) || seq != g_frame_seq);
+
+    return done + len - remaining;
+}
+
+bool nn_audio_wait_headroom(uint32_t us, uint32_t timeout_us) {
+    const uint32_t start = time_us_32();
+
+    if (i2s_out_dma_chan < 0 || g_clock_plan.actual_rate == 0) {
+        return true;
+    }
+
+    const uint32_t frames =
+        (uint32_t)(((uint64_t)us * g_clock_plan.actual_rate + 999999) / 1000000);
+
+    while (dma_channel_hw_addr(i2s_out_dma_chan)->transfer_count < frames ||
+           (i2s_in_dma_chan >= 0 &&
+            dma_channel_hw_addr(i2s_in_dma_chan)->transfer_count < frames))
+    {
+        if (time_us_32() - start > timeout_us) {
+            return false;
+        }
+        tight_loop_contents();
+    }
+    return true;
+}
+
+uint32_t nn_audio_min_transfer_frames(void) {
+    if (i2s_out_dma_chan < 0) {
+        return 0;
+    }
+
+    const uint32_t out = g_out_transfer_len;
+    const uint32_t in = g_in_transfer_len;
+
+    return i2s_in_dma_chan >= 0 && in < out ? in : out;
+}
+
+static void dma_in_start_next() {
     uint32_t *buffer = NULL;
     uint32_t point_count = 0;
 
-    // Clear the interrupt request.
-    dma_hw->ints1 = 1u << i2s_in_dma_chan;
-
     // Call user callback, if any
     if (user_audio_input_callback != NULL) {
         user_audio_input_callback (&buffer, &point_count);
@@ -101,11 +177,22 @@ static void dma_in_handler() {
         point_count = DUMMY_AUDIO_BUFFER_SIZE;
     }
 
+    g_in_transfer_len = point_count;
     dma_channel_transfer_to_buffer_now(i2s_in_dma_chan,
                                        buffer,
                                        point_count);
 }
 
+// DMA_IRQ_1 is shared with other peripherals (e.g. PGB-1 screen)
+static void dma_in_handler() {
+    if (dma_hw->ints1 & (1u << i2s_in_dma_chan)) {
+        // Clear the interrupt request.
+        dma_hw->ints1 = 1u << i2s_in_dma_chan;
+
+        dma_in_start_next();
+    }
+}
+
 static void setup_audio_pin(int pin, bool out) {
     gpio_init(pin);
     gpio_set_dir(pin, out ? GPIO_OUT : GPIO_IN);
@@ -114,6 +201,40 @@ static void setup_audio_pin(int pin, bool out) {
     gpio_set_function(pin, I2S_PIN_FUNC);
 }
 
+static bool apply_clock_plan(int sample_rate) {
+    nn_clock_constraints constraints;
+
+    nn_clock_constraints_init(&constraints, NN_SYS_CLOCK_PLAN_MAX_KHZ * 1000);
+    constraints.max_error_ppm = NN_SAMPLE_RATE_MAX_ERROR_PPM;
+
+    if (NN_SYS_CLOCK_MAX_KHZ == 0 ||
+        !nn_clock_plan_for_rate(sample_rate, &constraints, &g_clock_plan))
+    {
+        // Keep the current system clock, the PIO divider may be fractional
+        return nn_clock_plan_fixed(sample_rate, clock_get_hz(clk_sys),
+                                   &g_clock_plan);
+    }
+
+    if (g_clock_plan.sys_hz > 133 * MHZ) {
+        // Above the nominal 133MHz, use the 1.15V the RP2040 is certified at
+        vreg_set_voltage(VREG_VOLTAGE_1_15);
+        sleep_ms(1);
+    }
+
+    set_sys_clock_pll(g_clock_plan.vco_hz,
+                      g_clock_plan.post_div1,
+                      g_clock_plan.post_div2);
+
+    // set_sys_clock_pll() ties clk_peri to clk_sys, move it to the fixed 48MHz
+    // USB PLL so that UART/SPI/I2C baud rates do not depend on the plan.
+    clock_configure(clk_peri,
+                    0,
+                    CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB,
+                    48 * MHZ,
+                    48 * MHZ);
+    return true;
+}
+
 static bool init_i2s(int sample_rate) {
 
     // PIO I2S Pins
@@ -125,7 +246,6 @@ static bool init_i2s(int sample_rate) {
 
     const int sample_bits = 16;
     const int channels = 2;
-    const int cycles_per_sample = 4;
 
     // PIO I2S Program
 
@@ -152,8 +272,11 @@ static bool init_i2s(int sample_rate) {
 
     pio_sm_exec(I2S_PIO, I2S_SM, pio_encode_jmp(offset + audio_i2s_offset_entry_point));
 
-    const int pio_frequency = sample_rate * sample_bits * channels * cycles_per_sample;
-    sm_config_set_clkdiv(&c, (float)clock_get_hz(clk_sys) / (float)pio_frequency);
+    // The planner divider is computed for NN_I2S_PIO_CYCLES_PER_FRAME
+    // (16 bits * 2 channels * 4 PIO cycles per bit) PIO cycles per frame.
+    sm_config_set_clkdiv_int_frac(&c,
+                                  g_clock_plan.pio_div_int,
+                                  g_clock_plan.pio_div_frac);
     pio_sm_set_config(I2S_PIO, I2S_SM, &c);
     pio_sm_set_enabled(I2S_PIO, I2S_SM, true);
 
@@ -188,14 +311,18 @@ static bool init_i2s(int sample_rate) {
 
     dma_channel_set_irq1_enabled(i2s_in_dma_chan, true);
 
-    irq_set_exclusive_handler(DMA_IRQ_1, dma_in_handler);
-    dma_in_handler();
+    irq_add_shared_handler(DMA_IRQ_1, dma_in_handler,
+                           PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    dma_in_start_next();
     dma_irqn_set_channel_enabled (DMA_IRQ_1, i2s_in_dma_chan, true);
     irq_set_enabled(DMA_IRQ_1, true);
 
     return true;
 }
 
+static bool aic3105_wait_idle(void);
+static void aic3105_i2c_handler(void);
+
 bool nn_i2c_init(void){
     if (g_i2c_init) {
         return true;
@@ -209,7 +336,11 @@ bool nn_i2c_init(void){
     gpio_pull_up(I2C_SDA_PIN);
     gpio_set_function(I2C_SDA_PIN, GPIO_FUNC_I2C);
 
-    i2c_init(I2C_PORT, 100 * 1000);
+    i2c_init(I2C_PORT, I2C_BAUDRATE);
+
+    i2c_get_hw(I2C_PORT)->intr_mask = 0;
+    irq_set_exclusive_handler(I2C_IRQ, aic3105_i2c_handler);
+    irq_set_enabled(I2C_IRQ, true);
 
     g_i2c_init = true;
     return true;
@@ -218,6 +349,9 @@ bool nn_i2c_init(void){
 static bool tca6408_write_register(uint8_t reg, uint8_t value){
     uint8_t buf[2] = {reg, value};
 
+    // Blocking SDK transfers cannot share the bus with the codec engine
+    aic3105_wait_idle();
+
     const int result = i2c_write_blocking(I2C_PORT, TCA6408_ADDR, buf, 2, false);
     return result == 2;
 }
@@ -294,7 +428,8 @@ static bool enable_codec(void) {
     return io_exp_set_out(new_state);
 }
 
-static uint8_t g_aic3105_reg_local_copy[] =
+// Register values after a soft reset
+static const uint8_t g_aic3105_reg_reset_values[] =
 {0b00000000, // 0
  0b00000000, // 1
  0b00000000, // 2
@@ -413,17 +548,234 @@ typedef struct clock_cfg {
     uint8_t p;
 } clock_cfg;
 
-static bool aic3105_write_reg (uint8_t reg, uint8_t value) {
+#define AIC3105_REG_COUNT sizeof(g_aic3105_reg_reset_values)
+#define AIC3105_MAX_RUN 32
+
+/*
+ * Codec register transaction layer
+ *
+ * g_aic3105_reg_local_copy holds the value each register should have. Writes
+ * only update the local copy and mark the register dirty (writes that do not
+ * change the value are dropped). The I2C interrupt handler then sends every
+ * run of adjacent dirty registers as a single transfer, using the AIC3105
+ * register address auto-increment. Calling code never waits on the bus,
+ * unless it asks to with aic3105_sync().
+ *
+ * A register written again while it is being sent is marked dirty again, so
+ * the last value always wins.
+ */
+static uint8_t g_aic3105_reg_local_copy[AIC3105_REG_COUNT];
+static uint32_t g_aic3105_dirty[(AIC3105_REG_COUNT + 31) / 32];
+static bool g_aic3105_cache_valid = false;
+
+static volatile bool g_aic3105_busy = false;
+static bool g_aic3105_hold = false; // Page 1 selected, do not start transfers
+static volatile bool g_aic3105_error = false;
+
+// Run currently being sent by the interrupt handler
+static uint8_t g_run_first;
+static uint8_t g_run_len;
+static uint8_t g_run_sent; // Bytes pushed in the TX FIFO, register address included
+static uint8_t g_run_data[AIC3105_MAX_RUN];
+
+static void aic3105_reset_cache(void) {
+    memcpy(g_aic3105_reg_local_copy, g_aic3105_reg_reset_values,
+           AIC3105_REG_COUNT);
+    memset(g_aic3105_dirty, 0, sizeof(g_aic3105_dirty));
+    g_aic3105_cache_valid = true;
+}
+
+static inline bool is_dirty(uint8_t reg) {
+    return (g_aic3105_dirty[reg / 32] & (1u << (reg % 32))) != 0;
+}
+
+static inline void set_dirty(uint8_t reg, bool dirty) {
+    if (dirty) {
+        g_aic3105_dirty[reg / 32] |= 1u << (reg % 32);
+    } else {
+        g_aic3105_dirty[reg / 32] &= ~(1u << (reg % 32));
+    }
+}
+
+// Must be called with interrupts disabled, or from the I2C handler
+static bool start_next_run(void) {
+    i2c_hw_t *hw = i2c_get_hw(I2C_PORT);
+    int first = -1;
+
+    for (int reg = 0; reg < AIC3105_REG_COUNT; reg++) {
+        if (is_dirty(reg)) {
+            first = reg;
+            break;
+        }
+    }
+
+    if (first < 0) {
+        hw->intr_mask = 0;
+        g_aic3105_busy = false;
+        return false;
+    }
+
+    // Snapshot the run, later writes will mark registers dirty again
+    g_run_first = first;
+    g_run_len = 0;
+    g_run_sent = 0;
+    while (first + g_run_len < AIC3105_REG_COUNT &&
+           g_run_len < AIC3105_MAX_RUN &&
+           is_dirty(first + g_run_len))
+    {
+        const uint8_t reg = first + g_run_len;
+        g_run_data[g_run_len] = g_aic3105_reg_local_copy[reg];
+        set_dirty(reg, false);
+        g_run_len++;
+    }
+
+    if (!g_aic3105_busy) {
+        // The target address can only be changed while the block is disabled
+        hw->enable = 0;
+        hw->tar = AIC3105_ADDR;
+        hw->enable = 1;
+        g_aic3105_busy = true;
+    }
+
+    (void)hw->clr_tx_abrt;
+    (void)hw->clr_stop_det;
+    hw->intr_mask = I2C_IC_INTR_MASK_M_TX_EMPTY_BITS |
+        I2C_IC_INTR_MASK_M_TX_ABRT_BITS |
+        I2C_IC_INTR_MASK_M_STOP_DET_BITS;
+    return true;
+}
+
+static void fill_tx_fifo(void) {
+    i2c_hw_t *hw = i2c_get_hw(I2C_PORT);
+    const uint8_t total = g_run_len + 1;
+
+    while (g_run_sent < total && i2c_get_write_available(I2C_PORT) > 0) {
+        uint32_t cmd;
+
+        if (g_run_sent == 0) {
+            cmd = g_run_first;
+        } else {
+            cmd = g_run_data[g_run_sent - 1];
+        }
+
+        if (g_run_sent == total - 1) {
+            cmd |= I2C_IC_DATA_CMD_STOP_BITS;
+        }
+
+        hw->data_cmd = cmd;
+        g_run_sent++;
+    }
+
+    if (g_run_sent == total) {
+        // Everything is queued, now wait for the STOP condition
+        hw->intr_mask = I2C_IC_INTR_MASK_M_TX_ABRT_BITS |
+            I2C_IC_INTR_MASK_M_STOP_DET_BITS;
+    }
+}
+
+static void aic3105_i2c_handler(void) {
+    i2c_hw_t *hw = i2c_get_hw(I2C_PORT);
+    const uint32_t status = hw->intr_stat;
+
+    if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+        (void)hw->clr_tx_abrt;
+        (void)hw->clr_stop_det;
+
+        // Put the run back in the dirty set and stop, the next write (or
+        // aic3105_sync) will retry.
+        for (int i = 0; i < g_run_len; i++) {
+            set_dirty(g_run_first + i, true);
+        }
+        g_aic3105_error = true;
+        hw->intr_mask = 0;
+        g_aic3105_busy = false;
+        return;
+    }
+
+    if (status & I2C_IC_INTR_STAT_R_STOP_DET_BITS) {
+        (void)hw->clr_stop_det;
+        if (g_run_sent == g_run_len + 1) {
+            if (start_next_run()) {
+                fill_tx_fifo();
+            }
+            return;
+        }
+    }
+
+    if (status & I2C_IC_INTR_STAT_R_TX_EMPTY_BITS) {
+        fill_tx_fifo();
+    }
+}
+
+// Start sending dirty registers, if not already in progress
+static void aic3105_kick(void) {
+    const uint32_t irq_state = save_and_disable_interrupts();
+
+    if (!g_aic3105_busy && !g_aic3105_hold && start_next_run()) {
+        fill_tx_fifo();
+    }
+
+    restore_interrupts(irq_state);
+}
+
+// Wait for the end of the current transfers, without starting new ones
+static bool aic3105_wait_idle(void) {
+    while (g_aic3105_busy) {
+        tight_loop_contents();
+    }
+
+    const bool success = !g_aic3105_error;
+    g_aic3105_error = false;
+    return success;
+}
+
+// Send all dirty registers and wait for completion
+static bool aic3105_sync(void) {
+    bool success = true;
+
+    for (int retry = 0; retry < 3; retry++) {
+        aic3105_kick();
+        success = aic3105_wait_idle();
+        if (success) {
+            break;
+        }
+    }
+    return success;
+}
+
+// Write a register immediately, bypassing the transaction layer (used for
+// the page select and self-clearing reset registers).
+static bool aic3105_write_reg_now(uint8_t reg, uint8_t value) {
     uint8_t buf[2] = {reg, value};
 
+    aic3105_wait_idle();
+
     const int result = i2c_write_blocking(I2C_PORT, AIC3105_ADDR, buf, 2, false);
+    return result == 2;
+}
 
-    if (result == 2) {
-        g_aic3105_reg_local_copy[reg] = value;
-        return true;
-    } else {
+static bool aic3105_write_reg (uint8_t reg, uint8_t value) {
+    if (reg >= AIC3105_REG_COUNT) {
         return false;
     }
+
+    const uint32_t irq_state = save_and_disable_interrupts();
+
+    if (!g_aic3105_cache_valid) {
+        aic3105_reset_cache();
+    }
+
+    if (g_aic3105_reg_local_copy[reg] != value) {
+        g_aic3105_reg_local_copy[reg] = value;
+        set_dirty(reg, true);
+    }
+
+    restore_interrupts(irq_state);
+
+    // Report (once) the failure of a previous asynchronous transfer
+    const bool success = !g_aic3105_error;
+    g_aic3105_error = false;
+    return success;
 }
 
 static bool aic3105_write_bit(uint8_t reg, uint8_t pos, uint8_t value) {
@@ -610,13 +962,16 @@ static bool init_aic3105(int sample_rate){
     nn_i2c_init();
     enable_codec();
 
-    sleep_ms(10);
-
-      //  Select Page 0
-      success = aic3105_write_bit(AIC3X_PAGE_SELECT, 0, 0);
+      //  Select Page 0. The codec does not acknowledge its address until it
+      //  is out of reset, poll instead of waiting a fixed delay.
+      const absolute_time_t timeout = make_timeout_time_us(AIC3105_RESET_TIMEOUT_US);
+      do {
+          success = aic3105_write_reg_now(AIC3X_PAGE_SELECT, 0);
+      } while (!success && !time_reached(timeout));
 
       //  Soft reset
-      success = success && aic3105_write_bit(AIC3X_RESET, 7, 1);
+      success = success && aic3105_write_reg_now(AIC3X_RESET, 1 << 7);
+      aic3105_reset_cache();
 
       //  Let's start with clock configuration.
 
@@ -645,6 +1000,9 @@ static bool init_aic3105(int sample_rate){
       //  signal. So if there's no MCLK, BCLK should be used here as well
       success = success && aic3105_write_multi(AIC3X_CLKGEN_CTRL_REG, 6, 7, 0);
 
+      //  PLL must be programmed before it is enabled
+      success = success && aic3105_sync();
+
       //  Enable PLL
       success = success && aic3105_write_bit(AIC3X_PLL_PROGA_REG, 7, 1);
 
@@ -716,10 +1074,15 @@ static bool init_aic3105(int sample_rate){
       //  HPRCOM configured as independent single-ended output
       success = success && aic3105_write_multi(HPRCOM_CFG, 5, 3, 1);
 
+      //  Power up everything before unmuting the outputs
+      success = success && aic3105_sync();
+
       //  Unmute outputs
       success = success && unmute(HP_L_OUT);
       success = success && unmute(HP_R_OUT);
 
+      success = success && aic3105_sync();
+
     return success;
 }
 
@@ -750,6 +1113,7 @@ bool nn_enable_line_out (bool left, bool right) {
         success = success && mute(LINE_OUT_R);
     }
 
+    aic3105_kick();
     return success;
 }
 
@@ -792,11 +1156,17 @@ bool nn_set_adc_volume (float left, float right) {
     } else {
         success = success && aic3105_write_reg(RADC_VOL, PGA_VOLUME (right));
     }
+
+    aic3105_kick();
     return success;
 }
 
 bool nn_set_hp_volume(float left, float right) {
-    return set_volume(DAC_L1, HP_L_OUT, left) && set_volume(DAC_R1, HP_R_OUT, right);
+    bool success = set_volume(DAC_L1, HP_L_OUT, left);
+    success = success && set_volume(DAC_R1, HP_R_OUT, right);
+
+    aic3105_kick();
+    return success;
 }
 
 bool nn_set_line_out_volume(float L2L, float L2R, float R2L, float R2R) {
@@ -806,6 +1176,8 @@ bool nn_set_line_out_volume(float L2L, float L2R, float R2L, float R2R) {
     success = success && set_volume(DAC_R1, LINE_OUT_L, R2L);
     success = success && set_volume(DAC_R1, LINE_OUT_R, R2R);
 
+    aic3105_kick();
+
     return success;
 }
 
@@ -850,11 +1222,75 @@ bool nn_set_line_in_boost(uint8_t line, uint8_t L2L, uint8_t L2R, uint8_t R2L, u
         success = false;
         break;
     }
+
+    aic3105_kick();
     return success;
 }
 
 bool nn_enable_mic_bias(void) {
-    return aic3105_write_multi(MICBIAS_CTRL, 7, 6, 0b10);
+    const bool success = aic3105_write_multi(MICBIAS_CTRL, 7, 6, 0b10);
+
+    aic3105_kick();
+    return success;
+}
+
+bool nn_codec_sync(void) {
+    return aic3105_sync();
+}
+
+static bool upload_eq_coefs(uint8_t first_reg, const nn_dac_eq_coefs *coefs) {
+    uint8_t buf[1 + 20];
+
+    buf[0] = first_reg;
+    nn_dac_eq_to_regs(coefs, &buf[1]);
+
+    const int result = i2c_write_blocking(I2C_PORT, AIC3105_ADDR, buf,
+                                          sizeof(buf), false);
+    return result == sizeof(buf);
+}
+
+bool nn_set_dac_eq(const nn_eq_band *left, const nn_eq_band *right) {
+    nn_dac_eq_coefs left_coefs, right_coefs;
+    bool success = true;
+
+    if (g_sample_rate == 0) {
+        return false;
+    }
+
+    if (left != NULL && !nn_dac_eq_compute(left, g_sample_rate, &left_coefs)) {
+        return false;
+    }
+
+    if (right != NULL && !nn_dac_eq_compute(right, g_sample_rate, &right_coefs)) {
+        return false;
+    }
+
+    //  Page 1 registers are not part of the local copy, keep the transaction
+    //  engine out of the way while page 1 is selected.
+    success = aic3105_sync();
+    g_aic3105_hold = true;
+
+    success = success && aic3105_write_reg_now(AIC3X_PAGE_SELECT, 1);
+
+    if (left != NULL) {
+        success = success && upload_eq_coefs(AIC3X_P1_LEFT_EFFECTS_N0_MSB,
+                                             &left_coefs);
+    }
+    if (right != NULL) {
+        success = success && upload_eq_coefs(AIC3X_P1_RIGHT_EFFECTS_N0_MSB,
+                                             &right_coefs);
+    }
+
+    //  Always go back to page 0
+    success = aic3105_write_reg_now(AIC3X_PAGE_SELECT, 0) && success;
+    g_aic3105_hold = false;
+
+    //  Left/Right DAC digital effects filter enable
+    success = success && aic3105_write_bit(AIC3X_CODEC_DFILT_CTRL, 3, left != NULL);
+    success = success && aic3105_write_bit(AIC3X_CODEC_DFILT_CTRL, 1, right != NULL);
+
+    success = success && aic3105_sync();
+    return success;
 }
 
 bool nn_audio_init(int sample_rate,
@@ -865,10 +1301,31 @@ bool nn_audio_init(int sample_rate,
 
     user_audio_input_callback = input_callback;
     user_audio_output_callback = output_callback;
+    g_sample_rate = sample_rate;
+
+    if (!apply_clock_plan(sample_rate)) {
+        return false;
+    }
+    nn_boot_mark("clock plan");
 
     success &= init_i2s(sample_rate);
+    nn_boot_mark("I2S");
+
     success &= nn_i2c_init();
     success &= init_aic3105(sample_rate);
+    nn_boot_mark("codec");
 
     return success;
 }
+
+const nn_clock_plan *nn_audio_clock_plan(void) {
+    return &g_clock_plan;
+}
+
+// End of the program image, from the linker script
+extern char __flash_binary_end;
+
+uint32_t nn_flash_program_end(void) {
+    const uint32_t end = (uintptr_t)&__flash_binary_end - XIP_BASE;
+    return (end + FLASH_SECTOR_SIZE - 1) & ~(FLASH_SECTOR_SIZE - 1);
+}
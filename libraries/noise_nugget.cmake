@@ -7,8 +7,23 @@ pico_generate_pio_header(noise_nugget ${CMAKE_CURRENT_LIST_DIR}/duplex_i2s.pio)
 
 target_sources(noise_nugget INTERFACE
   ${CMAKE_CURRENT_LIST_DIR}/noise_nugget.c
+  ${CMAKE_CURRENT_LIST_DIR}/boot_timeline.c
   ${CMAKE_CURRENT_LIST_DIR}/pgb1.c
+  ${CMAKE_CURRENT_LIST_DIR}/screen_gfx.c
+  ${CMAKE_CURRENT_LIST_DIR}/leds_anim.c
   ${CMAKE_CURRENT_LIST_DIR}/midi_utils.c
+  ${CMAKE_CURRENT_LIST_DIR}/midi_rx.c
+  ${CMAKE_CURRENT_LIST_DIR}/midi_tx.c
+  ${CMAKE_CURRENT_LIST_DIR}/midi_clock.c
+  ${CMAKE_CURRENT_LIST_DIR}/sequencer.c
+  ${CMAKE_CURRENT_LIST_DIR}/store.c
+  ${CMAKE_CURRENT_LIST_DIR}/recorder.c
+  ${CMAKE_CURRENT_LIST_DIR}/sample_stream.c
+  ${CMAKE_CURRENT_LIST_DIR}/sample_stream_dma.c
+  ${CMAKE_CURRENT_LIST_DIR}/clock_planner.c
+  ${CMAKE_CURRENT_LIST_DIR}/dac_eq.c
+  ${CMAKE_CURRENT_LIST_DIR}/scheduler.c
+  ${CMAKE_CURRENT_LIST_DIR}/pots.c
 )
 
 set(NOISE_NUGGET_LINKER_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/noise_nugget_memmap.ld)
@@ -17,7 +32,8 @@ target_include_directories(noise_nugget INTERFACE ${CMAKE_CURRENT_LIST_DIR})
 
 target_link_libraries(noise_nugget INTERFACE pico_stdlib hardware_pio
   hardware_spi hardware_pwm hardware_dma hardware_irq hardware_i2c
-  hardware_interp hardware_uart)
+  hardware_interp hardware_uart hardware_vreg hardware_adc
+  hardware_flash pico_flash)
 
 function(noise_nugget_executable NAME SOURCES)
   add_executable(
@@ -16,11 +16,67 @@
 #pragma once
 #include <stdint.h>
 #include <stdbool.h>
+#include "clock_planner.h"
+#include "dac_eq.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Highest system clock (in kHz) nn_audio_init() is allowed to select.
+ *
+ * @details nn_audio_init() retunes the system PLL so that the I2S PIO clock
+ * divider is an integer (no jitter) for the requested sample rate, overclocking
+ * up to this limit. Define it to 0 in your cmake file to keep the current
+ * system clock:
+ *
+ * target_compile_definitions(my_target_project PUBLIC NN_SYS_CLOCK_MAX_KHZ=0)
+ *
+ * The default, 200MHz, is the highest clock the RP2040 is certified for (the
+ * core voltage is raised to 1.15V above 133MHz) and gives an integer divider
+ * at 8000, 16000, 44100 and 48000Hz. Higher limits are an opt-in overclock:
+ * the flash SPI clock (clk_sys / PICO_FLASH_SPI_CLKDIV) must stay within
+ * NN_FLASH_SPI_MAX_KHZ, so also raise the flash divider:
+ *
+ * target_compile_definitions(my_target_project PUBLIC
+ *                            NN_SYS_CLOCK_MAX_KHZ=250000
+ *                            PICO_FLASH_SPI_CLKDIV=4)
+ */
+#ifndef NN_SYS_CLOCK_MAX_KHZ
+#define NN_SYS_CLOCK_MAX_KHZ 200000
+#endif
+
+/**
+ * @brief Highest flash SPI clock (in kHz) allowed by the clock plan.
+ *
+ * @details The plan never selects a system clock above
+ * NN_FLASH_SPI_MAX_KHZ * PICO_FLASH_SPI_CLKDIV, whatever NN_SYS_CLOCK_MAX_KHZ.
+ */
+#ifndef NN_FLASH_SPI_MAX_KHZ
+#define NN_FLASH_SPI_MAX_KHZ 100000
+#endif
+
+#ifndef PICO_FLASH_SPI_CLKDIV
+// Default of the boot stage 2
+#define PICO_FLASH_SPI_CLKDIV 2
+#endif
+
+/**
+ * @brief System clock limit (in kHz) actually given to the clock planner.
+ */
+#define NN_SYS_CLOCK_PLAN_MAX_KHZ                                       \
+    (NN_SYS_CLOCK_MAX_KHZ < NN_FLASH_SPI_MAX_KHZ * PICO_FLASH_SPI_CLKDIV  \
+     ? NN_SYS_CLOCK_MAX_KHZ                                             \
+     : NN_FLASH_SPI_MAX_KHZ * PICO_FLASH_SPI_CLKDIV)
+
+/**
+ * @brief Maximum accepted sample rate error (in ppm) for the clock plan.
+ */
+#ifndef NN_SAMPLE_RATE_MAX_ERROR_PPM
+#define NN_SAMPLE_RATE_MAX_ERROR_PPM 100
+#endif
+
 /**
  * @typedef audio_cb_t
  * @brief Defines a callback type for audio processing.
@@ -59,6 +115,16 @@ typedef void (*audio_cb_t)(uint32_t **buffer, uint32_t *stereo_point_count);
  * @param input_callback The callback function to be invoked when an audio input
  *                        buffer is required.
  *
+ * @note The codec control functions below (volume, routing, ...) only update a
+ *       local copy of the codec registers and return immediately, the changes
+ *       are sent in the background over I2C. Use nn_codec_sync() to wait for
+ *       them.
+ *
+ * @note This function may change the system clock (see NN_SYS_CLOCK_MAX_KHZ).
+ *       clk_peri is then moved to a fixed 48MHz, so call it before
+ *       initializing any peripheral whose timing depends on clk_sys or clk_peri
+ *       (PIO, UART, SPI, ...).
+ *
  * @return Returns true if the audio system was successfully initialized, false
  *         otherwise.
  */
@@ -150,6 +216,122 @@ bool nn_set_line_in_boost(uint8_t line, uint8_t L2L, uint8_t L2R, uint8_t R2L, u
  */
 bool nn_enable_mic_bias(void);
 
+/**
+ * @brief Set the DAC equalizer
+ *
+ * @details The EQ runs in the codec digital effects filters (two biquads per
+ * channel) and therefore costs no CPU time. Each channel takes an array of
+ * NN_DAC_EQ_BANDS bands, see nn_dac_eq_compute() for the conversion. The EQ
+ * gain never exceeds 0 dB: boosting bands lower the overall level instead of
+ * clipping, use nn_dac_eq_compute() to get that headroom and compensate with
+ * the output volume if needed.
+ *
+ * This function waits for the transfer to complete. It must be called after
+ * nn_audio_init().
+ *
+ * @param left Left channel bands, or NULL to disable the left EQ
+ * @param right Right channel bands, or NULL to disable the right EQ
+ *
+ * @return Returns true on success, false otherwise.
+ */
+bool nn_set_dac_eq(const nn_eq_band *left, const nn_eq_band *right);
+
+/**
+ * @brief Wait until all pending codec register changes are sent
+ *
+ * @details Codec control functions return without waiting for the I2C bus,
+ * adjacent registers are then sent in a single transfer and registers
+ * written several times are only sent with their latest value. Must not be
+ * called with interrupts disabled.
+ *
+ * @return Returns true if all pending changes were sent successfully, false
+ *         otherwise.
+ */
+bool nn_codec_sync(void);
+
+/**
+ * @brief Record the end of a boot phase in the boot timeline
+ *
+ * @details Timestamps are taken from the microsecond timer (time since power
+ * up). The SDK marks its own phases (clock plan, I2S, codec, screen, core1
+ * ready...), applications can add theirs. Only call from core 0, up to 16
+ * marks are recorded.
+ *
+ * @param phase Name of the phase, must be a static string.
+ */
+void nn_boot_mark(const char *phase);
+
+/**
+ * @brief Print the boot timeline on stdio
+ *
+ * @details Prints each recorded phase with its timestamp and duration since
+ * the previous mark.
+ */
+void nn_boot_print_timeline(void);
+
+/**
+ * @brief Get the audio sample clock
+ *
+ * @details Number of stereo frames sent to the codec since nn_audio_init(),
+ * including the frames of the transfer in progress (within the I2S FIFO
+ * depth). It wraps around after 2^32 frames (about 27 hours at 44.1kHz).
+ * Use it to timestamp events relative to the audio stream. Can be called
+ * from any core or interrupt handler.
+ *
+ * @return Frame count, 0 before nn_audio_init() is called.
+ */
+uint32_t nn_audio_frame_count(void);
+
+/**
+ * @brief Wait until the audio transfers in progress have some time left
+ *
+ * @details Returns as soon as the remaining frames of the current output and
+ * input transfers last at least us microseconds, i.e. the next audio
+ * interrupts are not due before that time. Use it to place a short operation
+ * that blocks the interrupts (e.g. a flash page program) so that it does not
+ * delay the audio: a late output interrupt plays a glitch, a late input
+ * interrupt loses samples. Returns immediately when the audio is not running.
+ *
+ * @param us Required time before the next audio interrupt
+ * @param timeout_us Maximum wait time
+ *
+ * @return true when the time is available, false on timeout (e.g. audio
+ * transfers shorter than us, or input and output transfers out of phase).
+ */
+bool nn_audio_wait_headroom(uint32_t us, uint32_t timeout_us);
+
+/**
+ * @brief Get the length of the shortest audio transfer in progress
+ *
+ * @details Output or input, whichever is shorter: the time between two audio
+ * interrupts can be that short, operations placed with
+ * nn_audio_wait_headroom() must fit in it.
+ *
+ * @return Frames, 0 when the audio is not running.
+ */
+uint32_t nn_audio_min_transfer_frames(void);
+
+/**
+ * @brief Get the system clock plan selected by nn_audio_init()
+ *
+ * @details The plan reports the system clock, the I2S PIO divider, the sample
+ * rate actually produced and the CPU cycles available per stereo frame on
+ * each core (the headroom for audio rendering).
+ *
+ * @return Pointer to the current plan, zeroed before nn_audio_init() is called.
+ */
+const nn_clock_plan *nn_audio_clock_plan(void);
+
+/**
+ * @brief Get the end of the program in flash
+ *
+ * @details Flash below this offset holds the code and constant data of the
+ * running program, it must not be erased or programmed.
+ *
+ * @return Offset from the start of the flash, rounded up to the 4kB sector.
+ */
+uint32_t nn_flash_program_end(void);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "nugget_midi_synth.h"
 #include "pico/multicore.h"
 #include "pico/platform.h"
+#include "hardware/sync.h"
 
 static render_audio_callback g_render_cb = NULL;
 static note_on_callback g_note_on_cb = NULL;
@@ -13,6 +14,9 @@ static cc_callback g_cc_cb = NULL;
 static uint32_t audio_buffer_tmp[NN_MS_BUFFER_COUNT][NN_MS_BUFFER_LEN] = {0};
 static int playing_buffer_id = -1;
 
+// Set by core1 once it is ready to receive messages
+static volatile bool g_core1_ready = false;
+
 /*
  * FIFO message format for buffers
  *
@@ -75,6 +79,9 @@ static void audio_out_cb(uint32_t **buffer, uint32_t *stereo_point_count) {
 static void core1_main (void) {
     multicore_fifo_drain();
 
+    g_core1_ready = true;
+    __sev();
+
     while (1) {
 
         const uint32_t data = multicore_fifo_pop_blocking();
@@ -154,17 +161,21 @@ bool nn_ms_start (uint32_t sample_rate,
     g_note_off_cb = note_off_cb;
     g_cc_cb = cc_cb;
 
+    g_core1_ready = false;
     multicore_fifo_drain();
-    sleep_ms(200);
     multicore_reset_core1();
-    sleep_ms(200);
     multicore_launch_core1(core1_main);
+    nn_boot_mark("core1 launched");
 
+    /* Audio and codec setup run while core1 initializes */
     if (!nn_audio_init(sample_rate, audio_out_cb, NULL)) {
         return false;
     }
 
-    sleep_ms(200);
+    while (!g_core1_ready) {
+        __wfe();
+    }
+    nn_boot_mark("core1 ready");
 
     /* Send buffers to core1 */
     for (int i = 0; i < NN_MS_BUFFER_COUNT; i++) {
@@ -12,9 +12,16 @@
 #include "hardware/dma.h"
 #include "hardware/irq.h"
 #include "hardware/spi.h"
+#include "hardware/sync.h"
+#include "pico/sync.h"
 #include "ws2812.pio.h"
 #include "pgb1.h"
 #include "midi_utils.h"
+#include "midi_rx.h"
+#include "midi_tx.h"
+#include "noise_nugget.h"
+#include "screen_gfx.h"
+#include "leds_anim.h"
 
 #define LED_PIO_SM 0
 #define LED_PIO pio0
@@ -23,14 +30,115 @@
 
 #define KEY_COLUMN_CNT 5
 #define KEY_ROW_CNT 6
+#define KEY_CNT (KEY_COLUMN_CNT * KEY_ROW_CNT)
+
+// The matrix is scanned from a timer interrupt, one column per tick: the rows
+// of the column raised on the previous tick are read, then the next column is
+// raised. Every key is sampled each KEY_COLUMN_CNT * KEYBOARD_TICK_US.
+#ifndef KEYBOARD_TICK_US
+#define KEYBOARD_TICK_US 200
+#endif
+
+// After an accepted change, further changes of the same key are ignored for
+// this duration (contact bounce). Changes are accepted as soon as they are
+// seen, the debounce doesn't delay the events.
+#ifndef KEYBOARD_DEBOUNCE_US
+#define KEYBOARD_DEBOUNCE_US 5000
+#endif
+
+// Must be a power of 2
+#ifndef KEYBOARD_EVENT_QUEUE_LEN
+#define KEYBOARD_EVENT_QUEUE_LEN 32
+#endif
 
 const int key_column[KEY_COLUMN_CNT] = {21, 22, 26, 23, 29};
 const int key_row[KEY_ROW_CNT] = {20, 18, 19, 24, 25, 27};
 
 static uint32_t _keyboard_state = 0;
-static uint32_t _keyboard_prev_state = 0;
+static uint32_t _keyboard_falling = 0;
+static uint32_t _keyboard_raising = 0;
+
+// Written by the timer interrupt
+static volatile uint32_t _keyboard_debounced = 0;
+static volatile uint32_t _keyboard_down_acc = 0; // Pressed since last scan
+static volatile uint32_t _keyboard_up_acc = 0;   // Released since last scan
+static uint32_t _key_change_us[KEY_CNT] = {0};
+static int _keyboard_column = 0;
+static repeating_timer_t _keyboard_timer;
+static critical_section_t _keyboard_lock;
+static bool _keyboard_ready = false;
+
+// Single producer (timer interrupt), single consumer ring of events
+static keyboard_event _keyboard_events[KEYBOARD_EVENT_QUEUE_LEN];
+static volatile uint32_t _keyboard_events_head = 0;
+static volatile uint32_t _keyboard_events_tail = 0;
+
+static inline uint32_t key_bit(int column, int row) {
+    // Same bit order as the key codes of pgb1.h
+    return 1u << (KEY_CNT - 1 - (column * KEY_ROW_CNT + row));
+}
+
+static void keyboard_push_event(uint32_t key, bool pressed,
+                                uint32_t frame, uint32_t time_us) {
+    const uint32_t head = _keyboard_events_head;
+
+    if (head - _keyboard_events_tail >= KEYBOARD_EVENT_QUEUE_LEN) {
+        // Queue full, the application doesn't read events
+        return;
+    }
+
+    keyboard_event *ev = &_keyboard_events[head % KEYBOARD_EVENT_QUEUE_LEN];
+    ev->key = key;
+    ev->pressed = pressed;
+    ev->frame = frame;
+    ev->time_us = time_us;
+
+    __dmb();
+    _keyboard_events_head = head + 1;
+}
+
+static bool keyboard_timer_cb(repeating_timer_t *rt) {
+    const int i = _keyboard_column;
+    const uint32_t now = time_us_32();
+    const uint32_t frame = nn_audio_frame_count();
+
+    critical_section_enter_blocking(&_keyboard_lock);
+
+    for (int j = 0; j < KEY_ROW_CNT; j++) {
+        const uint32_t bit = key_bit(i, j);
+        const int index = i * KEY_ROW_CNT + j;
+        const bool down = gpio_get(key_row[j]);
+
+        if (down == ((_keyboard_debounced & bit) != 0) ||
+            now - _key_change_us[index] < KEYBOARD_DEBOUNCE_US) {
+            continue;
+        }
+
+        _key_change_us[index] = now;
+        if (down) {
+            _keyboard_debounced |= bit;
+            _keyboard_down_acc |= bit;
+        } else {
+            _keyboard_debounced &= ~bit;
+            _keyboard_up_acc |= bit;
+        }
+        keyboard_push_event(bit, down, frame, now);
+    }
+
+    critical_section_exit(&_keyboard_lock);
+
+    gpio_put(key_column[i], false);
+    _keyboard_column = (i + 1) % KEY_COLUMN_CNT;
+    gpio_put(key_column[_keyboard_column], true);
+
+    return true;
+}
 
 void keyboard_init(void) {
+    if (_keyboard_ready) {
+        return;
+    }
+
     for (int i = 0; i < KEY_COLUMN_CNT; i++) {
         const int pin = key_column[i];
 
@@ -46,30 +154,48 @@ void keyboard_init(void) {
         gpio_set_dir(pin, GPIO_IN);
         gpio_pull_down(pin);
     }
-}
 
-void keyboard_scan(void) {
-    uint32_t new_state = 0;
-    for (int i = 0; i < KEY_COLUMN_CNT; i++) {
-        const int col = key_column[i];
+    critical_section_init(&_keyboard_lock);
 
-        gpio_put(col, true);
+    // Rows of the first column are read on the first tick
+    _keyboard_column = 0;
+    gpio_put(key_column[0], true);
 
-        busy_wait_at_least_cycles(100);
+    // Negative delay: fixed rate, regardless of the callback duration
+    _keyboard_ready = add_repeating_timer_us(-KEYBOARD_TICK_US,
+                                             keyboard_timer_cb,
+                                             NULL,
+                                             &_keyboard_timer);
+}
 
-        for (int j = 0; j < KEY_ROW_CNT; j++) {
-            const int row = key_row[j];
-            new_state <<= 1;
-            if (gpio_get (row)) {
-                new_state |= 1;
-            }
-        }
+void keyboard_scan(void) {
+    critical_section_enter_blocking(&_keyboard_lock);
+    const uint32_t state = _keyboard_debounced;
+    const uint32_t down = _keyboard_down_acc;
+    const uint32_t up = _keyboard_up_acc;
+    _keyboard_down_acc = 0;
+    _keyboard_up_acc = 0;
+    critical_section_exit(&_keyboard_lock);
+
+    // Keys pressed and released between two scans are reported by both
+    // falling() and raising().
+    _keyboard_state = state;
+    _keyboard_falling = down;
+    _keyboard_raising = up;
+}
+
+bool keyboard_get_event(keyboard_event *ev) {
+    const uint32_t tail = _keyboard_events_tail;
 
-        gpio_put(col, false);
+    if (tail == _keyboard_events_head) {
+        return false;
     }
 
-    _keyboard_prev_state = _keyboard_state;
-    _keyboard_state = new_state;
+    __dmb();
+    *ev = _keyboard_events[tail % KEYBOARD_EVENT_QUEUE_LEN];
+    __dmb();
+    _keyboard_events_tail = tail + 1;
+    return true;
 }
 
 bool pressed(uint32_t key) {
@@ -77,18 +203,27 @@ bool pressed(uint32_t key) {
 }
 
 bool falling(uint32_t key){
-    uint32_t all_falling_keys = _keyboard_state & (~_keyboard_prev_state);
-    return (all_falling_keys & key) != 0;
+    return (_keyboard_falling & key) != 0;
 }
 
 bool raising(uint32_t key){
-    uint32_t all_raising_keys = (~_keyboard_state) & _keyboard_prev_state;
-    return (all_raising_keys & key) != 0;
+    return (_keyboard_raising & key) != 0;
 }
 
 int leds_dma_chan = -1; // init with invalid DMA channel id
 uint32_t leds_framebuffer[PGB1_LEDS_COUNT] = {0};
 
+static repeating_timer_t leds_timer;
+static volatile bool leds_animating = false;
+
+static void leds_pack_frame(const LedColor colors[PGB1_LEDS_COUNT]) {
+    for (int id = 0; id < PGB1_LEDS_COUNT; id++) {
+        leds_framebuffer[id] = ((uint32_t) (colors[id].r) << 16) |
+            ((uint32_t) (colors[id].g) << 24) |
+            ((uint32_t) (colors[id].b) << 8);
+    }
+}
+
 void leds_init(void) {
     uint offset = pio_add_program(LED_PIO, &ws2812_program);
     ws2812_program_init(LED_PIO, LED_PIO_SM, offset, WS2812_PIN, 800000, IS_RGBW);
@@ -104,11 +239,20 @@ void leds_init(void) {
 }
 
 bool leds_update(void) {
+    LedColor colors[PGB1_LEDS_COUNT];
+
+    if (leds_animating) {
+        // Frames are sent by the animation timer
+        return true;
+    }
+
     if (leds_dma_chan < 0 || dma_channel_is_busy(leds_dma_chan)) {
         // Previous DMA transfer still in progress
         return false;
     }
 
+    leds_anim_compose(colors);
+    leds_pack_frame(colors);
     dma_channel_transfer_from_buffer_now(leds_dma_chan,
                                          leds_framebuffer,
                                          PGB1_LEDS_COUNT);
@@ -116,20 +260,45 @@ bool leds_update(void) {
 
 }
 
-void leds_clear(void) {
-    memset(leds_framebuffer, 0, sizeof(leds_framebuffer));
+static bool leds_timer_cb(repeating_timer_t *rt) {
+    LedColor colors[PGB1_LEDS_COUNT];
+
+    if (dma_channel_is_busy(leds_dma_chan)) {
+        // Frame rate too high for the chain, skip this frame
+        return true;
+    }
+
+    // Unchanged frames are not sent, static LEDs cost only the composition
+    if (leds_anim_compose(colors)) {
+        leds_pack_frame(colors);
+        dma_channel_transfer_from_buffer_now(leds_dma_chan,
+                                             leds_framebuffer,
+                                             PGB1_LEDS_COUNT);
+    }
+    return true;
 }
 
-void leds_set_rgb(int id, uint8_t r, uint8_t g, uint8_t b) {
-    if (id >= 0 && id < PGB1_LEDS_COUNT) {
-        leds_framebuffer[id] = ((uint32_t) (r) << 16) |
-            ((uint32_t) (g) << 24) |
-            ((uint32_t) (b) << 8);
+bool leds_animation_start(uint32_t fps) {
+    if (leds_dma_chan < 0 || fps == 0 || fps > LEDS_MAX_FPS) {
+        return false;
     }
+
+    leds_animation_stop();
+    leds_anim_set_fps(fps);
+
+    // Negative delay: fixed rate, regardless of the callback duration
+    leds_animating = add_repeating_timer_us(-(int64_t)(1000000 / fps),
+                                            leds_timer_cb,
+                                            NULL,
+                                            &leds_timer);
+    return leds_animating;
 }
 
-void leds_set_color(int id, LedColor rgb) {
-    leds_set_rgb(id, rgb.r, rgb.g, rgb.b);
+void leds_animation_stop(void) {
+    if (leds_animating) {
+        cancel_repeating_timer(&leds_timer);
+        leds_animating = false;
+    }
 }
 
 // register definitions
@@ -152,18 +321,49 @@ void leds_set_color(int id, LedColor rgb) {
 #define SET_VCOM_DESEL      0xDB
 #define SET_CHARGE_PUMP     0x8D
 
-#define WIDTH 128
-#define HEIGHT 64
-
 #define SCREEN_SPI spi1
 #define N_RESET_PIN 13
 #define DC_PIN      12
 #define SCK_PIN     10
 #define MOSI_PIN    11
-#define SCREEN_FRAMEBUFFER_SIZE (WIDTH * HEIGHT) / 8
-
+#define SCREEN_RESET_PULSE_US 10 // SSD1306 requires at least 3us
+
+// SSD1306 serial clock cycle time is 100ns min, i.e. 10MHz max. spi_init()
+// selects the closest rate below: 8MHz from the 48MHz clk_peri set by
+// nn_audio_init(), 7.8MHz from a 125MHz clk_peri. A full frame then takes
+// about 1ms instead of 8ms at the previous 1MHz.
+#define SCREEN_SPI_BAUDRATE (8 * 1000 * 1000)
+
+// The screen DMA completion interrupt shares DMA_IRQ_1 with the audio input,
+// MIDI and streaming handlers. Only the screen channel interrupt is masked,
+// and the handler only writes a few registers.
+#define SCREEN_DMA_IRQ DMA_IRQ_1
+
+// The TX channel feeds the SPI, the RX channel drains the received bytes.
+// The RX channel completes once the last byte is shifted out, the D/C pin can
+// then be switched right away instead of waiting for the SPI in the handler.
 static int screen_dma_chan = -1; // init with invalid DMA channel id
-static uint8_t screen_framebuffer[SCREEN_FRAMEBUFFER_SIZE] = {0};
+static int screen_rx_dma_chan = -1;
+static uint8_t screen_rx_dummy;
+
+// Dirty windows are packed in one of two transmit buffers: one is sent by the
+// DMA while the next update is latched in the other. The framebuffer can be
+// modified at any time.
+typedef struct screen_window {
+    int x0, x1, page0, page1;
+} screen_window;
+
+#define SCREEN_WINDOW_CMDS_LEN 6
+
+static uint8_t screen_tx_buffer[2][SCREEN_FRAMEBUFFER_SIZE];
+static uint8_t screen_tx_cmds[2][SCREEN_WINDOW_CMDS_LEN];
+static int screen_tx_len[2];
+static screen_window screen_tx_window[2];
+static int screen_tx_active = 0;        // Buffer sent by the DMA
+static bool screen_tx_pending = false;  // Other buffer waiting to be sent
+static bool screen_tx_cmds_phase = false; // Window commands being sent
+static volatile bool screen_busy = false;
+static screen_update_cb_t screen_update_cb = NULL;
 
 static uint8_t init_cmds[] =
 {SET_DISP, // off
@@ -173,7 +373,7 @@ static uint8_t init_cmds[] =
  SET_DISP_START_LINE,
  SET_SEG_REMAP | 0x01, // column addr 127 mapped to SEG0
  SET_MUX_RATIO,
- HEIGHT- 1,
+ SCREEN_HEIGHT - 1,
  SET_COM_OUT_DIR | 0x08, // scan from COM[N] to COM0
  SET_DISP_OFFSET,
  0x00,
@@ -204,6 +404,60 @@ static void screen_write_cmd(uint8_t cmd) {
     spi_write_blocking(SCREEN_SPI, &cmd, 1);
 }
 
+static void screen_start_dma(const uint8_t *src, int len) {
+    dma_channel_set_read_addr(screen_dma_chan, src, false);
+    dma_channel_set_trans_count(screen_dma_chan, len, false);
+    dma_channel_set_trans_count(screen_rx_dma_chan, len, false);
+    dma_start_channel_mask((1u << screen_rx_dma_chan) |
+                           (1u << screen_dma_chan));
+}
+
+// Start sending buffer id, called with the SPI idle. The window commands are
+// sent first, the data from the completion interrupt.
+static void screen_start_transfer(int id) {
+    const screen_window *w = &screen_tx_window[id];
+    uint8_t *cmds = screen_tx_cmds[id];
+
+    // Restrict the display RAM write window to the dirty region
+    cmds[0] = SET_COL_ADDR;
+    cmds[1] = w->x0;
+    cmds[2] = w->x1;
+    cmds[3] = SET_PAGE_ADDR;
+    cmds[4] = w->page0;
+    cmds[5] = w->page1;
+
+    screen_tx_active = id;
+    screen_tx_cmds_phase = true;
+    screen_busy = true;
+
+    gpio_put(DC_PIN, false);
+    screen_start_dma(cmds, SCREEN_WINDOW_CMDS_LEN);
+}
+
+static void screen_dma_handler(void) {
+    if (!(dma_hw->ints1 & (1u << screen_rx_dma_chan))) {
+        return;
+    }
+
+    // Clear the interrupt request.
+    dma_hw->ints1 = 1u << screen_rx_dma_chan;
+
+    if (screen_tx_cmds_phase) {
+        screen_tx_cmds_phase = false;
+        gpio_put(DC_PIN, true);
+        screen_start_dma(screen_tx_buffer[screen_tx_active],
+                         screen_tx_len[screen_tx_active]);
+    } else if (screen_tx_pending) {
+        screen_tx_pending = false;
+        screen_start_transfer(1 - screen_tx_active);
+    } else {
+        screen_busy = false;
+        if (screen_update_cb != NULL) {
+            screen_update_cb();
+        }
+    }
+}
+
 void screen_init(void) {
     gpio_init(N_RESET_PIN);
     gpio_set_dir(N_RESET_PIN, GPIO_OUT);
@@ -225,19 +479,19 @@ void screen_init(void) {
     gpio_pull_up(DC_PIN);
     gpio_put(DC_PIN, false);
 
-    spi_init(SCREEN_SPI, 1000000);
+    spi_init(SCREEN_SPI, SCREEN_SPI_BAUDRATE);
 
     gpio_put(N_RESET_PIN, true);
-    sleep_ms(1);
+    sleep_us(SCREEN_RESET_PULSE_US);
     gpio_put(N_RESET_PIN, false);
-    sleep_ms(10);
+    sleep_us(SCREEN_RESET_PULSE_US);
     gpio_put(N_RESET_PIN, true);
 
     screen_write_cmd(SET_DISP | 0x01);
 
-    for (int i = 0; i < sizeof(init_cmds) / sizeof(*init_cmds); i++){
-        screen_write_cmd(init_cmds[i]);
-    }
+    // All init commands in a single SPI transfer
+    gpio_put(DC_PIN, false);
+    spi_write_blocking(SCREEN_SPI, init_cmds, sizeof(init_cmds));
 
     screen_dma_chan = dma_claim_unused_channel(true);
     dma_channel_config c = dma_channel_get_default_config(screen_dma_chan);
@@ -246,98 +500,88 @@ void screen_init(void) {
     dma_channel_set_config(screen_dma_chan, &c, false);
     dma_channel_set_write_addr(screen_dma_chan, &spi_get_hw(SCREEN_SPI)->dr,
                                false);
+
+    screen_rx_dma_chan = dma_claim_unused_channel(true);
+    c = dma_channel_get_default_config(screen_rx_dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, spi_get_dreq(SCREEN_SPI, false));
+    dma_channel_configure(screen_rx_dma_chan, &c,
+                          &screen_rx_dummy,
+                          &spi_get_hw(SCREEN_SPI)->dr,
+                          0,
+                          false);
+
+    // spi_write_blocking() leaves the RX FIFO empty, the RX channel then
+    // stays in step with the TX channel
+    dma_channel_set_irq1_enabled(screen_rx_dma_chan, true);
+    irq_add_shared_handler(SCREEN_DMA_IRQ, screen_dma_handler,
+                           PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(SCREEN_DMA_IRQ, true);
+
     screen_clear();
-}
+    screen_mark_all_dirty();
 
-void screen_clear(void) {
-    memset(screen_framebuffer, 0, sizeof(screen_framebuffer));
+    nn_boot_mark("screen");
 }
 
 bool screen_update(void) {
-    if (screen_dma_chan < 0 || dma_channel_is_busy(screen_dma_chan)) {
-        // Previous DMA transfer still in progress
-        return false;
-    }
+    screen_window w;
 
-    gpio_put(DC_PIN, true);
-    dma_channel_transfer_from_buffer_now(screen_dma_chan,
-                                         screen_framebuffer,
-                                         SCREEN_FRAMEBUFFER_SIZE);
-    return true;
-}
-
-void screen_set_pixel(int x, int y, bool set) {
-    if (x >= 0 && x < WIDTH && y >= 0 && y < HEIGHT) {
-        int index = x + (y / 8) * WIDTH;
-        uint8_t *byte = &screen_framebuffer[index];
-        if (set) {
-            *byte |= 1 << (y % 8);
-        } else {
-            *byte &= ~(1 << (y % 8));
-        }
+    if (screen_dma_chan < 0) {
+        return false;
     }
-}
 
-void screen_draw_line(int x0, int y0, int x1, int y1, bool set) {
-    int dx =  abs (x1 - x0), sx = x0 < x1 ? 1 : -1;
-    int dy = -abs (y1 - y0), sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy, e2; /* error value e_xy */
-
-    for (;;){  /* loop */
-        screen_set_pixel (x0, y0, set);
-        if (x0 == x1 && y0 == y1) break;
-        e2 = 2 * err;
-        if (e2 >= dy) { err += dy; x0 += sx; } /* e_xy+e_x > 0 */
-        if (e2 <= dx) { err += dx; y0 += sy; } /* e_xy+e_y < 0 */
+    if (!screen_take_dirty_window(&w.x0, &w.x1, &w.page0, &w.page1)) {
+        // Nothing changed
+        return true;
     }
-}
 
-const uint8_t font5x7[] =
-{187, 214, 205, 231, 125, 253, 255, 255, 255, 141, 59, 130, 11, 38, 136, 241, 255, 251, 123, 140, 17, 70, 12, 64, 116,
- 113, 56, 239, 92, 132, 17, 70, 224, 156, 115, 14, 196, 30, 247, 207, 223, 255, 247, 239, 247, 251, 246, 252, 255, 255,
- 255, 255, 255, 255, 255, 255, 207, 157, 255, 174, 53, 176, 118, 239, 222, 251, 255, 127, 93, 118, 119, 250, 254, 156, 203,
- 121, 255, 237, 156, 115, 206, 122, 239, 220, 190, 214, 19, 231, 156, 115, 110, 59, 231, 156, 123, 189, 223, 250, 251, 247,
- 255, 253, 245, 253, 255, 125, 255, 255, 255, 255, 127, 255, 255, 255, 255, 125, 223, 191, 43, 208, 183, 222, 125, 213, 254,
- 255, 111, 179, 223, 174, 208, 95, 231, 114, 238, 224, 190, 231, 156, 119, 222, 123, 183, 175, 246, 138, 57, 231, 156, 223,
- 206, 185, 90, 111, 223, 215, 253, 29, 101, 76, 113, 7, 153, 111, 219, 84, 70, 24, 74, 136, 206, 57, 230, 64, 223,
- 183, 239, 95, 227, 222, 127, 223, 8, 62, 248, 91, 237, 123, 237, 131, 59, 134, 255, 253, 127, 183, 1, 232, 29, 132,
- 2, 236, 203, 189, 82, 14, 58, 24, 183, 115, 106, 239, 221, 247, 253, 255, 63, 230, 141, 139, 142, 237, 91, 183, 98,
- 206, 185, 236, 183, 115, 110, 182, 235, 247, 83, 251, 131, 213, 171, 223, 87, 237, 252, 255, 102, 123, 63, 240, 220, 118,
- 47, 231, 14, 238, 86, 206, 121, 231, 189, 115, 251, 106, 239, 140, 243, 74, 191, 237, 156, 170, 187, 247, 125, 255, 255,
- 193, 121, 7, 118, 112, 251, 230, 173, 156, 131, 161, 199, 237, 156, 218, 115, 247, 125, 239, 255, 21, 58, 246, 239, 222,
- 123, 255, 220, 221, 238, 238, 58, 183, 221, 205, 123, 255, 253, 149, 115, 206, 122, 239, 220, 182, 214, 59, 231, 188, 181,
- 110, 187, 74, 220, 246, 253, 222, 255, 191, 115, 206, 249, 253, 220, 182, 117, 43, 231, 252, 235, 111, 153, 170, 242, 238,
- 125, 223, 191, 127, 221, 79, 250, 215, 255, 239, 63, 247, 24, 65, 188, 49, 238, 152, 127, 191, 191, 239, 232, 96, 196,
- 192, 7, 23, 179, 3, 206, 69, 159, 92, 220, 113, 59, 183, 65, 188, 241, 131, 31, 98, 12, 113, 71, 23, 115, 139,
- 202, 69, 255, 58, 188, 105, 87, 195, 193, 220, 249, 251};
-
-static uint8_t get_bit(const uint8_t *bitmap, int bit_index) {
-    int byte_index = bit_index / 8;
-    int bit_position = bit_index % 8;
-
-    return (bitmap[byte_index] >> bit_position) & 0x01;
-}
+    // Hold off the screen completion only, not the other DMA_IRQ_1 handlers.
+    // A completion during the copy stays pending until unmasked.
+    dma_channel_set_irq1_enabled(screen_rx_dma_chan, false);
 
-void screen_printc(int x, int y, char c) {
-    const int index = c - '!';
+    const int id = screen_busy ? 1 - screen_tx_active : screen_tx_active;
 
-    if (index < 0 || index > 93) {
-        return;
+    if (screen_tx_pending) {
+        // Not sent yet, merge with the new region
+        const screen_window *prev = &screen_tx_window[id];
+        w.x0 = MIN(w.x0, prev->x0);
+        w.x1 = MAX(w.x1, prev->x1);
+        w.page0 = MIN(w.page0, prev->page0);
+        w.page1 = MAX(w.page1, prev->page1);
     }
 
-    for (int dy = 0; dy < 7; dy++) {
-        for (int dx = 0; dx < 5; dx++) {
-            const int bit_index = index * 5 + dx + dy * 470;
-            screen_set_pixel(x + dx, y + dy, get_bit(font5x7, bit_index) == 0);
-        }
+    const int width = w.x1 - w.x0 + 1;
+    int len = 0;
+
+    for (int page = w.page0; page <= w.page1; page++) {
+        memcpy(&screen_tx_buffer[id][len],
+               &screen_framebuffer[page * SCREEN_WIDTH + w.x0],
+               width);
+        len += width;
+    }
+    screen_tx_window[id] = w;
+    screen_tx_len[id] = len;
+
+    if (screen_busy) {
+        // Sent from the completion interrupt
+        screen_tx_pending = true;
+    } else {
+        screen_start_transfer(id);
     }
+
+    dma_channel_set_irq1_enabled(screen_rx_dma_chan, true);
+    return true;
 }
 
-void screen_print(int x, int y, const char *str) {
-    int dx = 0;
-    for (const char *c = str; *c != 0; c++, dx += 6) {
-        screen_printc(x + dx, y, *c);
-    }
+bool screen_update_in_progress(void) {
+    return screen_busy;
+}
+
+void screen_set_update_callback(screen_update_cb_t cb) {
+    screen_update_cb = cb;
 }
 
 #define MIDI_UART uart1
@@ -347,17 +591,11 @@ void screen_print(int x, int y, const char *str) {
 #define MIDI_GPIO_FUNC GPIO_FUNC_UART
 static midi_in_cb_t midi_in_user_cb = NULL;
 
-static midi_decoder pgb1_midi_decoder;
-
-static void on_uart_rx() {
-    while (uart_is_readable(MIDI_UART)) {
-        uint8_t ch = uart_getc(MIDI_UART);
-        uint32_t msg = midi_decoder_push(&pgb1_midi_decoder, ch);
-        if (msg != 0 && midi_in_user_cb != NULL) {
-            midi_in_user_cb(msg);
-        }
-    }
-}
+static midi_rx pgb1_midi_rx;
+static midi_tx pgb1_midi_tx;
+static bool pgb1_midi_ready = false;
+static bool pgb1_midi_out_ready = false;
+static bool pgb1_midi_thru = false;
 
 void midi_init(midi_in_cb_t cb) {
 
@@ -365,12 +603,65 @@ void midi_init(midi_in_cb_t cb) {
     gpio_set_function(MIDI_IN_PIN, MIDI_GPIO_FUNC);
     gpio_set_function(MIDI_OUT_PIN, MIDI_GPIO_FUNC);
     uart_set_format(MIDI_UART, 8, 1, UART_PARITY_NONE);
-    uart_set_fifo_enabled(MIDI_UART, true);
 
-    irq_set_exclusive_handler(MIDI_IRQ, on_uart_rx);
-    irq_set_enabled(MIDI_IRQ, true);
-    uart_set_irq_enables(MIDI_UART, true, false);
-
-    midi_decoder_init(&pgb1_midi_decoder);
+    // No RX interrupt, bytes are received by DMA and decoded in midi_poll().
+    // The output disables the UART FIFO, the RX DMA reads each byte as soon
+    // as it is received.
     midi_in_user_cb = cb;
+    pgb1_midi_ready = midi_rx_init(&pgb1_midi_rx, MIDI_UART);
+    pgb1_midi_out_ready = midi_tx_init(&pgb1_midi_tx, MIDI_UART);
+}
+
+bool midi_send(uint32_t msg) {
+    if (!pgb1_midi_out_ready) {
+        return false;
+    }
+    return midi_tx_send(&pgb1_midi_tx, msg);
+}
+
+void midi_set_thru(bool enable) {
+    pgb1_midi_thru = enable;
+}
+
+void midi_get_tx_stats(midi_tx_stats *stats) {
+    if (!pgb1_midi_out_ready) {
+        *stats = (midi_tx_stats){0};
+        return;
+    }
+    midi_tx_get_stats(&pgb1_midi_tx, stats);
+}
+
+uint32_t midi_poll(midi_event *events, uint32_t max_events) {
+    midi_event batch[16];
+    uint32_t total = 0;
+
+    if (!pgb1_midi_ready) {
+        return 0;
+    }
+
+    while (events == NULL || total < max_events) {
+        midi_event *out = events != NULL ? &events[total] : batch;
+        const uint32_t max = events != NULL ? max_events - total : 16;
+        const uint32_t count = midi_rx_poll(&pgb1_midi_rx, out, max);
+
+        if (pgb1_midi_thru) {
+            // Merged with the local output at message boundaries
+            for (uint32_t i = 0; i < count; i++) {
+                midi_send(out[i].msg);
+            }
+        }
+
+        if (midi_in_user_cb != NULL) {
+            for (uint32_t i = 0; i < count; i++) {
+                midi_in_user_cb(out[i].msg);
+            }
+        }
+
+        total += count;
+        if (count < max) {
+            // All received bytes are decoded
+            break;
+        }
+    }
+    return total;
 }
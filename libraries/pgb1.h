@@ -13,6 +13,7 @@
 
 #pragma once
 #include "pico/stdlib.h"
+#include "midi_utils.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -53,14 +54,47 @@ extern "C" {
 
 /**
  * @brief Initializes the keyboard interface.
+ *
+ * The key matrix is then scanned in the background from a timer interrupt
+ * (every key is sampled each millisecond) with per-key debouncing. Key
+ * presses and releases are reported by keyboard_get_event() and summarized
+ * by keyboard_scan().
  */
 void keyboard_init(void);
 
 /**
- * @brief Scans the keyboard state and updates internal key state tracking.
+ * @brief Takes a snapshot of the keyboard state for pressed(), falling() and
+ * raising().
+ *
+ * falling() and raising() report the presses and releases since the previous
+ * call, so short key presses between two calls are not lost.
  */
 void keyboard_scan(void);
 
+/**
+ * @struct keyboard_event
+ * @brief Key press or release.
+ */
+typedef struct keyboard_event {
+    uint32_t key;     ///< Key code (one of the K_* values).
+    bool pressed;     ///< true when the key is pressed, false when released.
+    uint32_t frame;   ///< Audio sample clock at the event, see
+                      ///< nn_audio_frame_count().
+    uint32_t time_us; ///< time_us_32() at the event.
+} keyboard_event;
+
+/**
+ * @brief Gets the next key event from the event queue.
+ *
+ * @details Events are queued by the scan interrupt, independently from
+ * keyboard_scan(). The queue holds 32 events by default, new events are dropped when it
+ * is full. Events must be read from a single core.
+ *
+ * @param ev Output event
+ * @return true if an event was available, false otherwise.
+ */
+bool keyboard_get_event(keyboard_event *ev);
+
 /**
  * @brief Checks if a key is currently pressed.
  * @param key Key code to check.
@@ -97,10 +131,37 @@ void leds_clear(void);
 
 /**
  * @brief Updates the LED states to the device.
+ *
+ * Fades and blinks (see leds_set_target() and leds_set_blink()) advance by
+ * one frame on each call. When the animation engine runs (see
+ * leds_animation_start()), frames are sent automatically and this function
+ * does nothing.
+ *
  * @return true if the update was successful, false otherwise.
  */
 bool leds_update(void);
 
+#define LEDS_MAX_FPS 400 ///< Maximum LED animation frame rate.
+
+/**
+ * @brief Starts the LED animation engine.
+ *
+ * A timer interrupt composes a frame at a fixed rate (fades, blinks, gamma
+ * and brightness) and sends it to the LEDs by DMA when it changed. The
+ * application only sets targets and patterns, there is no need to call
+ * leds_update().
+ *
+ * @param fps Frame rate, from 1 to LEDS_MAX_FPS.
+ * @return true on success, false otherwise (LEDs not initialized, invalid
+ *         frame rate, no timer available).
+ */
+bool leds_animation_start(uint32_t fps);
+
+/**
+ * @brief Stops the LED animation engine, LEDs keep their current color.
+ */
+void leds_animation_stop(void);
+
 /**
  * @struct LedColor
  * @brief Represents an RGB color value.
@@ -143,6 +204,49 @@ void leds_set_rgb(int id, uint8_t r, uint8_t g, uint8_t b);
  */
 void leds_set_color(int id, LedColor rgb);
 
+/**
+ * @brief Sets the color an LED fades to.
+ *
+ * The fade starts from the current color of the LED (possibly in the middle
+ * of another fade) and is linear over fade_ms.
+ *
+ * @param id The LED index to set, from 0 to PGB1_LEDS_COUNT - 1.
+ * @param rgb Target color.
+ * @param fade_ms Duration of the fade in milliseconds, 0 to change the color
+ *        at the next frame.
+ */
+void leds_set_target(int id, LedColor rgb, uint32_t fade_ms);
+
+/**
+ * @brief Makes an LED blink.
+ *
+ * The LED alternates between its color (including fades) for on_ms and off
+ * for off_ms, starting with on at the next frame.
+ *
+ * @param id The LED index to set, from 0 to PGB1_LEDS_COUNT - 1.
+ * @param on_ms Duration of the on phase in milliseconds.
+ * @param off_ms Duration of the off phase in milliseconds, 0 (or on_ms 0)
+ *        to stop blinking.
+ */
+void leds_set_blink(int id, uint32_t on_ms, uint32_t off_ms);
+
+/**
+ * @brief Sets the global LED brightness, applied after the gamma correction.
+ * @param brightness From 0 (off) to 255 (default, colors unchanged).
+ */
+void leds_set_brightness(uint8_t brightness);
+
+/**
+ * @brief Sets the gamma correction of the LED colors.
+ *
+ * The default is 1.0 (no correction) so that the predefined colors above are
+ * sent unchanged. Use about 2.2 for perceptually even fades with colors
+ * using the full 0-255 range.
+ *
+ * @param gamma Gamma exponent, greater than 0.
+ */
+void leds_set_gamma(float gamma);
+
 /**
  * @brief Initializes the OLED screen.
  */
@@ -155,10 +259,42 @@ void screen_clear(void);
 
 /**
  * @brief Updates the screen with the current graphics buffer.
- * @return true if the update is successful, false otherwise.
+ *
+ * Only the region modified since the previous update (bounding box of the
+ * modified columns and pages) is sent to the screen, in the background.
+ *
+ * The region is copied in a transmit buffer, drawing of the next frame can
+ * start right away. If the previous update is still in progress, the new one
+ * is queued and sent as soon as the previous completes (successive queued
+ * updates are merged).
+ *
+ * @return true if the update is successful, false otherwise (screen not
+ *         initialized).
  */
 bool screen_update(void);
 
+/**
+ * @brief Checks if a screen update is being sent.
+ * @return true if a screen update is in progress or queued, false otherwise.
+ */
+bool screen_update_in_progress(void);
+
+/**
+ * @typedef screen_update_cb_t
+ * @brief Type definition for the screen update completion callback.
+ */
+typedef void (*screen_update_cb_t)(void);
+
+/**
+ * @brief Sets a callback called when all the screen updates are sent.
+ *
+ * @details The callback is called from the DMA interrupt handler, it must
+ * return quickly (e.g. set a flag or send an event).
+ *
+ * @param cb Function pointer to the callback, or NULL to disable it.
+ */
+void screen_set_update_callback(screen_update_cb_t cb);
+
 /**
  * @brief Sets or clears a pixel on the screen.
  * @param x The x-coordinate of the pixel.
@@ -179,6 +315,49 @@ void screen_set_pixel(int x, int y, bool set);
  */
 void screen_draw_line(int x0, int y0, int x1, int y1, bool set);
 
+/**
+ * @brief Fills a rectangle on the screen.
+ * @param x The x-coordinate of the top-left corner.
+ * @param y The y-coordinate of the top-left corner.
+ * @param w Width of the rectangle in pixels.
+ * @param h Height of the rectangle in pixels.
+ * @param set true to set the pixels, false to clear them.
+ */
+void screen_fill_rect(int x, int y, int w, int h, bool set);
+
+/**
+ * @brief Draws an horizontal line on the screen.
+ * @param x The x-coordinate of the left end.
+ * @param y The y-coordinate of the line.
+ * @param w Length of the line in pixels.
+ * @param set true to set the pixels, false to clear them.
+ */
+void screen_draw_hline(int x, int y, int w, bool set);
+
+/**
+ * @brief Draws a vertical line on the screen.
+ * @param x The x-coordinate of the line.
+ * @param y The y-coordinate of the top end.
+ * @param h Length of the line in pixels.
+ * @param set true to set the pixels, false to clear them.
+ */
+void screen_draw_vline(int x, int y, int h, bool set);
+
+/**
+ * @brief Copies a bitmap on the screen.
+ *
+ * The bitmap uses the screen memory layout: rows of 8 pixels high pages,
+ * each page is w bytes, one byte per column with the least significant bit on
+ * top. Pixels of the w * h area are set or cleared according to the bitmap.
+ *
+ * @param x The x-coordinate of the top-left corner.
+ * @param y The y-coordinate of the top-left corner (any alignment).
+ * @param w Width of the bitmap in pixels.
+ * @param h Height of the bitmap in pixels.
+ * @param bitmap ((h + 7) / 8) * w bytes of bitmap data.
+ */
+void screen_blit_bitmap(int x, int y, int w, int h, const uint8_t *bitmap);
+
 /**
  * @brief Prints a single character at a specified position on the screen.
  * @param x The x-coordinate for the character.
@@ -205,11 +384,62 @@ typedef void (*midi_in_cb_t)(uint32_t msg);
 
 /**
  * @brief Initializes the MIDI interface with a callback for incoming messages.
+ *
+ * Incoming bytes are received by DMA in the background and decoded by
+ * midi_poll(), the callback is called from midi_poll().
+ *
  * @param cb Function pointer to the callback that handles incoming MIDI
- *         messages.
+ *         messages, or NULL.
  */
 void midi_init(midi_in_cb_t cb);
 
+/**
+ * @brief Decodes the MIDI input received since the previous call.
+ *
+ * Call it regularly, at least every 80 ms, e.g. from a scheduler task or once
+ * per audio block. Each decoded message is passed to the callback given to
+ * midi_init() and, if events is not NULL, stored in events.
+ *
+ * @param events Output array of timestamped messages, or NULL to decode all
+ *        the pending input.
+ * @param max_events Size of the events array, decoding stops when it is full
+ *        and continues at the next call.
+ * @return Number of decoded messages.
+ */
+uint32_t midi_poll(midi_event *events, uint32_t max_events);
+
+/**
+ * @brief Sends a MIDI message.
+ *
+ * The message is queued and sent in the background, the function does not
+ * wait for the UART. Channel messages use running status, real time messages
+ * (clock, start, stop, ...) are sent before the other queued messages. Can be
+ * called from any core or interrupt.
+ *
+ * @param msg The message, in the format of the input callback (status byte in
+ *        the low byte, then the data bytes). SysEx is not supported.
+ * @return true if the message is queued, false if it is invalid or dropped
+ *         because the output queue is full.
+ */
+bool midi_send(uint32_t msg);
+
+/**
+ * @brief Enables or disables MIDI thru.
+ *
+ * When enabled, midi_poll() forwards the decoded input messages to the output,
+ * merged with the messages from midi_send(). SysEx is not forwarded.
+ *
+ * @param enable true to forward the input.
+ */
+void midi_set_thru(bool enable);
+
+/**
+ * @brief Gets the MIDI output queue statistics.
+ *
+ * @param stats Output statistics.
+ */
+void midi_get_tx_stats(midi_tx_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "pico/stdlib.h"
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "pots.h"
+
+// Must be a power of 2, the ring buffer is aligned on its size for the DMA
+// address wrapping.
+#define POTS_RING_LEN 256
+#define POTS_RING_BITS 9 // log2(POTS_RING_LEN * sizeof(uint16_t))
+
+#define POTS_EVENT_QUEUE_LEN 16 // Must be a power of 2
+
+#define POTS_STEP 32 // 12-bit ADC units per 7-bit value
+
+static uint16_t g_ring[POTS_RING_LEN]
+    __attribute__((aligned(POTS_RING_LEN * sizeof(uint16_t))));
+static uint32_t g_read_count = 0; // Samples since the start of the transfer
+
+static int g_dma_chan = -1;
+
+// Round robin order of the sampled inputs
+static uint8_t g_channels[NN_POTS_MAX_CHANNELS];
+static int g_channel_cnt = 0;
+
+static int32_t g_filter[NN_POTS_MAX_CHANNELS];  // 12-bit value << 8
+static uint8_t g_value[NN_POTS_MAX_CHANNELS];
+static bool g_valid[NN_POTS_MAX_CHANNELS];
+
+static nn_pot_event g_events[POTS_EVENT_QUEUE_LEN];
+static uint32_t g_events_head = 0;
+static uint32_t g_events_tail = 0;
+
+static void pots_start(void) {
+    adc_run(false);
+    adc_fifo_drain();
+
+    // Sample n of the transfer is then from g_channels[n % g_channel_cnt]
+    adc_select_input(g_channels[0]);
+    g_read_count = 0;
+
+    dma_channel_set_write_addr(g_dma_chan, g_ring, false);
+    dma_channel_set_trans_count(g_dma_chan, 0xFFFFFFFF, true);
+
+    adc_run(true);
+}
+
+bool nn_pots_init(uint32_t channel_mask) {
+    if (g_dma_chan >= 0 || channel_mask == 0 ||
+        (channel_mask >> NN_POTS_MAX_CHANNELS) != 0) {
+        return false;
+    }
+
+    adc_init();
+
+    g_channel_cnt = 0;
+    for (int ch = 0; ch < NN_POTS_MAX_CHANNELS; ch++) {
+        if (channel_mask & (1u << ch)) {
+            adc_gpio_init(26 + ch);
+            g_channels[g_channel_cnt++] = ch;
+        }
+    }
+
+    adc_set_round_robin(channel_mask);
+    // FIFO with DREQ on each sample, no error bit, 12-bit samples
+    adc_fifo_setup(true, true, 1, false, false);
+
+    // One conversion every (1 + div) ADC clock cycles, for all the channels
+    const float div = (float)clock_get_hz(clk_adc) /
+        (NN_POTS_SAMPLE_RATE * g_channel_cnt) - 1.0f;
+    adc_set_clkdiv(div);
+
+    g_dma_chan = dma_claim_unused_channel(false);
+    if (g_dma_chan < 0) {
+        return false;
+    }
+
+    dma_channel_config c = dma_channel_get_default_config(g_dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, POTS_RING_BITS);
+    channel_config_set_dreq(&c, DREQ_ADC);
+    dma_channel_set_config(g_dma_chan, &c, false);
+    dma_channel_set_read_addr(g_dma_chan, &adc_hw->fifo, false);
+
+    pots_start();
+    return true;
+}
+
+static void push_event(uint8_t channel, uint8_t value) {
+    if (g_events_head - g_events_tail >= POTS_EVENT_QUEUE_LEN) {
+        // Queue full, the snapshot is still up to date
+        return;
+    }
+
+    g_events[g_events_head % POTS_EVENT_QUEUE_LEN] =
+        (nn_pot_event){channel, value};
+    g_events_head++;
+}
+
+static bool process_sample(uint8_t ch, uint16_t sample) {
+    const int32_t x = (int32_t)(sample & 0xFFF) << 8;
+
+    if (!g_valid[ch]) {
+        g_filter[ch] = x;
+    } else {
+        g_filter[ch] += (x - g_filter[ch]) >> NN_POTS_IIR_SHIFT;
+    }
+
+    const bool first = !g_valid[ch];
+    const int32_t filtered = g_filter[ch] >> 8;
+    const int32_t value = g_value[ch];
+
+    g_valid[ch] = true;
+
+    // Change only when the filtered value is clearly out of the current
+    // step, noise around a boundary doesn't toggle the value.
+    if (first ||
+        filtered >= (value + 1) * POTS_STEP + NN_POTS_HYSTERESIS ||
+        filtered < value * POTS_STEP - NN_POTS_HYSTERESIS)
+    {
+        g_value[ch] = (uint8_t)(filtered / POTS_STEP);
+        push_event(ch, g_value[ch]);
+        return true;
+    }
+    return false;
+}
+
+bool nn_pots_poll(void) {
+    bool changed = false;
+
+    if (g_dma_chan < 0) {
+        return false;
+    }
+
+    const uint32_t written = 0xFFFFFFFF - dma_channel_hw_addr(g_dma_chan)->transfer_count;
+
+    if (written - g_read_count > POTS_RING_LEN) {
+        // Not polled often enough, the oldest samples are overwritten
+        g_read_count = written - POTS_RING_LEN;
+    }
+
+    while (g_read_count != written) {
+        const uint8_t ch = g_channels[g_read_count % g_channel_cnt];
+
+        changed |= process_sample(ch, g_ring[g_read_count % POTS_RING_LEN]);
+        g_read_count++;
+    }
+
+    if (!dma_channel_is_busy(g_dma_chan)) {
+        // End of the (2^32 samples) transfer, restart to keep the channel
+        // order in sync.
+        pots_start();
+    }
+
+    return changed;
+}
+
+bool nn_pots_get_event(nn_pot_event *ev) {
+    if (g_events_tail == g_events_head) {
+        return false;
+    }
+
+    *ev = g_events[g_events_tail % POTS_EVENT_QUEUE_LEN];
+    g_events_tail++;
+    return true;
+}
+
+uint8_t nn_pots_value(int channel) {
+    if (channel < 0 || channel >= NN_POTS_MAX_CHANNELS) {
+        return 0;
+    }
+    return g_value[channel];
+}
+
+uint16_t nn_pots_raw(int channel) {
+    if (channel < 0 || channel >= NN_POTS_MAX_CHANNELS) {
+        return 0;
+    }
+    return (uint16_t)(g_filter[channel] >> 8);
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pots.h
+ * @brief Potentiometer inputs on the RP2040 ADC.
+ *
+ * The ADC runs free in round-robin mode over the selected inputs and a DMA
+ * channel writes the samples into a ring, without CPU involvement.
+ * nn_pots_poll() consumes the new samples: each channel is smoothed with a
+ * one-pole IIR filter, then converted to a 7-bit value (0-127, like a MIDI
+ * CC) with hysteresis, so that noise around a step boundary does not produce
+ * changes. Only changes are published, as events and in a value snapshot.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NN_POTS_MAX_CHANNELS 4 ///< ADC inputs 0 to 3 (GPIO 26 to 29).
+
+/**
+ * @brief Sample rate of each channel in Hz.
+ */
+#ifndef NN_POTS_SAMPLE_RATE
+#define NN_POTS_SAMPLE_RATE 1000
+#endif
+
+/**
+ * @brief IIR smoothing: each new sample contributes 1/2^NN_POTS_IIR_SHIFT.
+ */
+#ifndef NN_POTS_IIR_SHIFT
+#define NN_POTS_IIR_SHIFT 3
+#endif
+
+/**
+ * @brief Hysteresis, in 12-bit ADC units, beyond a step boundary before the
+ * value changes.
+ */
+#ifndef NN_POTS_HYSTERESIS
+#define NN_POTS_HYSTERESIS 12
+#endif
+
+/**
+ * @struct nn_pot_event
+ * @brief Change of a potentiometer value.
+ */
+typedef struct nn_pot_event {
+    uint8_t channel; ///< ADC input, from 0 to NN_POTS_MAX_CHANNELS - 1.
+    uint8_t value;   ///< New value, from 0 to 127.
+} nn_pot_event;
+
+/**
+ * @brief Starts sampling the potentiometers
+ *
+ * @details Initializes the GPIOs of the selected inputs, the ADC and a DMA
+ * channel. Other GPIOs are not touched.
+ *
+ * @param channel_mask Bit n set to sample ADC input n (0 to 3)
+ *
+ * @return true on success, false otherwise (invalid mask, already started).
+ */
+bool nn_pots_init(uint32_t channel_mask);
+
+/**
+ * @brief Processes the samples received since the previous call
+ *
+ * @details Call it regularly (e.g. from a 200 Hz task), the ring holds at
+ * least 64 ms of samples.
+ *
+ * @return true if at least one value changed, false otherwise.
+ */
+bool nn_pots_poll(void);
+
+/**
+ * @brief Gets the next value change
+ *
+ * @param ev Output event
+ *
+ * @return true if an event was available, false otherwise.
+ */
+bool nn_pots_get_event(nn_pot_event *ev);
+
+/**
+ * @brief Gets the current value of a potentiometer
+ *
+ * @param channel ADC input, from 0 to NN_POTS_MAX_CHANNELS - 1
+ *
+ * @return Value from 0 to 127, 0 for channels that are not sampled.
+ */
+uint8_t nn_pots_value(int channel);
+
+/**
+ * @brief Gets the filtered value of a potentiometer at full resolution
+ *
+ * @param channel ADC input, from 0 to NN_POTS_MAX_CHANNELS - 1
+ *
+ * @return Value from 0 to 4095, 0 for channels that are not sampled.
+ */
+uint16_t nn_pots_raw(int channel);
+
+#ifdef __cplusplus
+}
+#endif
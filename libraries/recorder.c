@@ -0,0 +1,401 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/sync.h"
+#include "pico/flash.h"
+#include "hardware/flash.h"
+#include "noise_nugget.h"
+#include "sample_stream.h"
+#include "store.h"
+#include "recorder.h"
+
+#if NN_REC_BLOCK_FRAMES % 128 != 0
+#error "NN_REC_BLOCK_FRAMES must be a multiple of 128 (one mono page)"
+#endif
+
+#define FLASH_TIMEOUT_MS 100
+#define ERASE_CHUNK (64 * 1024) // Erase block of the flash chip
+
+// Pages programmed by nn_rec_prepare() to measure the page program time
+#define CALIBRATION_PAGES 16
+
+typedef enum rec_state {
+    REC_IDLE,
+    REC_PREPARED,
+    REC_RECORDING,
+    REC_DONE,
+} rec_state;
+
+typedef struct flash_op {
+    uint32_t flash_offs;
+    const uint8_t *data;
+    uint32_t len;
+} flash_op;
+
+static uint32_t g_ring[NN_REC_RING_BLOCKS][NN_REC_BLOCK_FRAMES];
+
+// Pages to program, in RAM
+static uint8_t g_stage[NN_REC_MAX_PAGES * FLASH_PAGE_SIZE]
+    __attribute__((aligned(4)));
+
+static critical_section_t g_lock;
+static bool g_lock_init = false;
+
+// Shared with the input interrupt
+static volatile bool g_capture = false;  // Give ring blocks to the DMA
+static volatile bool g_filling = false;  // The DMA is writing a ring block
+static volatile bool g_overrun = false;
+static volatile uint32_t g_filled = 0;   // Blocks filled by the DMA
+static volatile uint32_t g_read = 0;     // Blocks written to flash
+static uint32_t g_max_blocks = 0;        // Blocks that fit in the area
+static uint32_t g_ring_max = 0;
+
+static rec_state g_state = REC_IDLE;
+static nn_rec_channels g_channels;
+static uint32_t g_flash_offset;
+static uint32_t g_size;
+static uint32_t g_read_page;            // Pages of block g_read written
+static uint32_t g_pages_per_block;
+static uint32_t g_page_us;
+static uint32_t g_window_frames;        // Shortest audio transfer
+static uint32_t g_pages_per_write;
+static uint32_t g_rate;
+static uint32_t g_bytes;
+static uint32_t g_headroom_misses;
+static uint64_t g_start_us;
+static uint64_t g_end_us;
+
+/********************/
+/* Flash operations */
+/********************/
+
+// Run with the flash unavailable for execution, must stay in RAM
+static void __no_inline_not_in_flash_func(do_program)(void *param) {
+    const flash_op *op = param;
+    flash_range_program(op->flash_offs, op->data, op->len);
+}
+
+static void __no_inline_not_in_flash_func(do_erase)(void *param) {
+    const flash_op *op = param;
+    flash_range_erase(op->flash_offs, op->len);
+}
+
+static bool erase_range(uint32_t offset, uint32_t size) {
+    while (size > 0) {
+        const uint32_t len = size < ERASE_CHUNK ? size : ERASE_CHUNK;
+        flash_op op = {offset, NULL, len};
+
+        nn_stream_pause();
+        const int ret = flash_safe_execute(do_erase, &op, FLASH_TIMEOUT_MS);
+        nn_stream_resume();
+
+        if (ret != PICO_OK) {
+            return false;
+        }
+        offset += len;
+        size -= len;
+    }
+    return true;
+}
+
+// Programs pages of g_stage, returns the time per page or 0 on failure
+static uint32_t program_stage(uint32_t offset, uint32_t pages) {
+    flash_op op = {g_flash_offset + offset, g_stage, pages * FLASH_PAGE_SIZE};
+
+    nn_stream_pause();
+    const uint32_t start = time_us_32();
+    const int ret = flash_safe_execute(do_program, &op, FLASH_TIMEOUT_MS);
+    const uint32_t elapsed = time_us_32() - start;
+    nn_stream_resume();
+
+    if (ret != PICO_OK) {
+        return 0;
+    }
+    const uint32_t us = (elapsed + pages - 1) / pages;
+
+    return us > 0 ? us : 1;
+}
+
+// A write must fit between two audio interrupts: the output transfers are
+// usually much shorter than the recorder input blocks.
+static void update_pages_per_write(void) {
+    uint32_t frames = nn_audio_min_transfer_frames();
+
+    if (frames == 0 || frames > NN_REC_BLOCK_FRAMES) {
+        frames = NN_REC_BLOCK_FRAMES;
+    }
+    g_window_frames = frames;
+
+    const uint64_t window_us = (uint64_t)frames * 1000000u *
+        NN_REC_FLASH_SHARE / 100 / g_rate;
+    const uint64_t pages = window_us / g_page_us;
+
+    g_pages_per_write = pages < NN_REC_MAX_PAGES ? pages : NN_REC_MAX_PAGES;
+}
+
+// The area must not hold the program or overlap the store
+static bool valid_area(uint32_t offset, uint32_t size) {
+    return size > 0 &&
+        offset % FLASH_SECTOR_SIZE == 0 &&
+        size % FLASH_SECTOR_SIZE == 0 &&
+        offset >= nn_flash_program_end() &&
+        offset <= PICO_FLASH_SIZE_BYTES &&
+        size <= PICO_FLASH_SIZE_BYTES - offset &&
+        (offset >= NN_STORE_FLASH_OFFSET + NN_STORE_SIZE ||
+         offset + size <= NN_STORE_FLASH_OFFSET);
+}
+
+static uint32_t frame_bytes(void) {
+    return g_channels == NN_REC_STEREO ? 4 : 2;
+}
+
+/*************/
+/* SRAM ring */
+/*************/
+
+void nn_rec_audio_in_cb(uint32_t **buffer, uint32_t *stereo_point_count) {
+    critical_section_enter_blocking(&g_lock);
+
+    // The block given at the previous call is complete
+    if (g_filling) {
+        g_filled++;
+        g_filling = false;
+    }
+
+    if (g_capture) {
+        const uint32_t used = g_filled - g_read;
+
+        if (g_filled >= g_max_blocks) {
+            g_capture = false;
+        } else if (used >= NN_REC_RING_BLOCKS) {
+            // A recording never has holes, it ends here
+            g_overrun = true;
+            g_capture = false;
+        } else {
+            *buffer = g_ring[g_filled % NN_REC_RING_BLOCKS];
+            *stereo_point_count = NN_REC_BLOCK_FRAMES;
+            g_filling = true;
+            if (used + 1 > g_ring_max) {
+                g_ring_max = used + 1;
+            }
+        }
+    }
+
+    critical_section_exit(&g_lock);
+}
+
+// Converts the next pages of the ring to the flash format
+static void stage_pages(uint32_t pages) {
+    const uint32_t frames = FLASH_PAGE_SIZE / frame_bytes();
+    uint32_t block = g_read;
+    uint32_t page = g_read_page;
+
+    for (uint32_t p = 0; p < pages; p++) {
+        const uint32_t *src =
+            &g_ring[block % NN_REC_RING_BLOCKS][page * frames];
+        uint8_t *dst = &g_stage[p * FLASH_PAGE_SIZE];
+
+        if (g_channels == NN_REC_STEREO) {
+            memcpy(dst, src, FLASH_PAGE_SIZE);
+        } else {
+            const int shift = g_channels == NN_REC_LEFT ? 16 : 0;
+
+            for (uint32_t i = 0; i < frames; i++) {
+                const uint32_t sample = src[i] >> shift;
+                dst[2 * i] = sample & 0xFF;
+                dst[2 * i + 1] = (sample >> 8) & 0xFF;
+            }
+        }
+
+        if (++page == g_pages_per_block) {
+            page = 0;
+            block++;
+        }
+    }
+}
+
+/*******/
+/* API */
+/*******/
+
+bool nn_rec_prepare(uint32_t flash_offset, uint32_t size,
+                    nn_rec_channels channels) {
+    const nn_clock_plan *plan = nn_audio_clock_plan();
+
+    if (!g_lock_init) {
+        critical_section_init(&g_lock);
+        g_lock_init = true;
+    }
+
+    if (g_state == REC_RECORDING || plan->actual_rate == 0 ||
+        channels > NN_REC_RIGHT || !valid_area(flash_offset, size))
+    {
+        return false;
+    }
+
+    g_state = REC_IDLE;
+    g_flash_offset = flash_offset;
+    g_size = size;
+    g_channels = channels;
+    g_rate = plan->actual_rate;
+    g_pages_per_block = NN_REC_BLOCK_FRAMES * frame_bytes() / FLASH_PAGE_SIZE;
+    g_bytes = 0;
+
+    if (!erase_range(flash_offset, size)) {
+        return false;
+    }
+
+    // All the bits programmed, the slowest case
+    memset(g_stage, 0, FLASH_PAGE_SIZE);
+    g_page_us = 0;
+    for (uint32_t p = 0; p < CALIBRATION_PAGES; p++) {
+        const uint32_t us = program_stage(p * FLASH_PAGE_SIZE, 1);
+
+        if (us == 0) {
+            return false;
+        }
+        if (us > g_page_us) {
+            g_page_us = us;
+        }
+    }
+    if (!erase_range(flash_offset, FLASH_SECTOR_SIZE)) {
+        return false;
+    }
+
+    update_pages_per_write();
+    g_state = REC_PREPARED;
+    return true;
+}
+
+bool nn_rec_start(void) {
+    nn_rec_stats stats;
+
+    if (g_state == REC_PREPARED) {
+        // The audio transfers may have changed since nn_rec_prepare()
+        update_pages_per_write();
+    }
+    nn_rec_get_stats(&stats);
+    if (g_state != REC_PREPARED || stats.capacity_bps < stats.required_bps) {
+        return false;
+    }
+
+    g_read_page = 0;
+    g_bytes = 0;
+    g_headroom_misses = 0;
+    g_start_us = time_us_64();
+
+    critical_section_enter_blocking(&g_lock);
+    g_filled = 0;
+    g_read = 0;
+    g_ring_max = 0;
+    g_overrun = false;
+    g_max_blocks = g_size / (g_pages_per_block * FLASH_PAGE_SIZE);
+    g_capture = true;
+    critical_section_exit(&g_lock);
+
+    g_state = REC_RECORDING;
+    return true;
+}
+
+void nn_rec_stop(void) {
+    critical_section_enter_blocking(&g_lock);
+    g_capture = false;
+    critical_section_exit(&g_lock);
+}
+
+bool nn_rec_poll(uint32_t timeout_us) {
+    if (g_state != REC_RECORDING) {
+        return false;
+    }
+
+    critical_section_enter_blocking(&g_lock);
+    const bool active = g_capture || g_filling;
+    const uint32_t filled = g_filled;
+    critical_section_exit(&g_lock);
+
+    const uint32_t ready = (filled - g_read) * g_pages_per_block - g_read_page;
+    if (ready == 0) {
+        if (!active) {
+            g_state = REC_DONE;
+            g_end_us = time_us_64();
+            return false;
+        }
+        return true;
+    }
+
+    // At least one page, even when the window is too short (the throughput
+    // check of nn_rec_start() failed)
+    uint32_t pages = g_pages_per_write > 0 ? g_pages_per_write : 1;
+    if (pages > ready) {
+        pages = ready;
+    }
+    stage_pages(pages);
+
+    // Before waiting for the headroom, the chunk in progress may take some
+    // (program_stage() pauses again, the calls are nested)
+    nn_stream_pause();
+    if (!nn_audio_wait_headroom(pages * g_page_us, timeout_us)) {
+        nn_stream_resume();
+        g_headroom_misses++;
+        return true;
+    }
+
+    const uint32_t us = program_stage(g_bytes, pages);
+    nn_stream_resume();
+    if (us == 0) {
+        // Unknown state of the flash, the recording ends before
+        nn_rec_stop();
+        g_state = REC_DONE;
+        g_end_us = time_us_64();
+        return false;
+    }
+    if (us > g_page_us) {
+        // Keep the next writes within the window
+        g_page_us = us;
+        update_pages_per_write();
+    }
+
+    g_bytes += pages * FLASH_PAGE_SIZE;
+    g_read_page += pages;
+    while (g_read_page >= g_pages_per_block) {
+        g_read_page -= g_pages_per_block;
+        g_read++;
+    }
+    return true;
+}
+
+uint32_t nn_rec_length(void) {
+    return g_bytes;
+}
+
+void nn_rec_get_stats(nn_rec_stats *stats) {
+    memset(stats, 0, sizeof(*stats));
+    if (g_state == REC_IDLE) {
+        return;
+    }
+
+    stats->required_bps = g_rate * frame_bytes();
+    stats->capacity_bps = (uint32_t)((uint64_t)g_pages_per_write *
+        FLASH_PAGE_SIZE * g_rate / g_window_frames);
+    stats->page_us = g_page_us;
+    stats->pages_per_write = g_pages_per_write;
+    stats->bytes = g_bytes;
+    stats->ring_max = g_ring_max;
+    stats->headroom_misses = g_headroom_misses;
+    stats->overrun = g_overrun;
+
+    if (g_state != REC_PREPARED) {
+        const uint64_t end = g_state == REC_DONE ? g_end_us : time_us_64();
+
+        if (end > g_start_us) {
+            stats->sustained_bps =
+                (uint32_t)((uint64_t)g_bytes * 1000000u / (end - g_start_us));
+        }
+    }
+}
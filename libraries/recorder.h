@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file recorder.h
+ * @brief Records the audio input (line in or microphone) to flash.
+ *
+ * The input DMA writes directly into an SRAM ring of blocks
+ * (nn_rec_audio_in_cb() is the input callback of nn_audio_init()). The
+ * application calls nn_rec_poll() between two render blocks, it writes the
+ * filled pages of the ring to flash in small chunks.
+ *
+ * Programming flash stalls the execution from flash on both cores, with the
+ * interrupts disabled (flash_safe_execute(), the other core must have called
+ * flash_safe_execute_core_init() if it is running). Each chunk is sized from
+ * the measured page program time to fit in the shortest running audio
+ * transfer (nn_audio_min_transfer_frames(), usually the output render
+ * block), and started just after the audio interrupts
+ * (nn_audio_wait_headroom()), so it ends before the next ones. The code
+ * running during the write is in RAM.
+ *
+ * Like the store (store.h), the flash operations pause the sample streamer
+ * (nn_stream_pause()).
+ *
+ * Erasing cannot fit between two audio interrupts: the whole recording area
+ * is erased in advance by nn_rec_prepare(), which also measures the write
+ * throughput. nn_rec_start() refuses to start when it cannot keep up with
+ * the input.
+ *
+ * Flash format: stereo recordings are in the I2S frame format (left sample
+ * in the high half-word, see audio_cb_t), so that they can be played back
+ * directly; mono recordings are 16-bit samples. Both are little-endian.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Frames per input transfer.
+ */
+#ifndef NN_REC_BLOCK_FRAMES
+#define NN_REC_BLOCK_FRAMES 256
+#endif
+
+/**
+ * @brief Blocks in the SRAM ring (4 bytes per frame), the latency the
+ * recorder can absorb when nn_rec_poll() is late.
+ */
+#ifndef NN_REC_RING_BLOCKS
+#define NN_REC_RING_BLOCKS 32
+#endif
+
+/**
+ * @brief Maximum pages (256 bytes) programmed by a flash operation.
+ */
+#ifndef NN_REC_MAX_PAGES
+#define NN_REC_MAX_PAGES 8
+#endif
+
+/**
+ * @brief Maximum share of the shortest audio transfer period (in percent)
+ * spent with the flash stalled, the rest is left for the audio rendering.
+ */
+#ifndef NN_REC_FLASH_SHARE
+#define NN_REC_FLASH_SHARE 50
+#endif
+
+/**
+ * @brief Recorded channels.
+ */
+typedef enum nn_rec_channels {
+    NN_REC_STEREO, ///< 4 bytes per frame
+    NN_REC_LEFT,   ///< 2 bytes per frame
+    NN_REC_RIGHT,  ///< 2 bytes per frame
+} nn_rec_channels;
+
+/**
+ * @struct nn_rec_stats
+ * @brief Recorder statistics, throughputs in bytes per second.
+ */
+typedef struct nn_rec_stats {
+    uint32_t required_bps;   ///< Throughput of the input.
+    uint32_t capacity_bps;   ///< Write throughput with one write per
+                             ///< shortest audio transfer.
+    uint32_t sustained_bps;  ///< Write throughput reached since the start.
+    uint32_t page_us;        ///< Longest page program.
+    uint32_t pages_per_write;///< Pages programmed by a flash operation.
+    uint32_t bytes;          ///< Bytes written to flash.
+    uint32_t ring_max;       ///< Highest ring usage, in blocks.
+    uint32_t headroom_misses;///< nn_rec_poll() calls that timed out.
+    bool overrun;            ///< The recording stopped on a full ring.
+} nn_rec_stats;
+
+/**
+ * @brief Input callback of the recorder, to pass to nn_audio_init()
+ */
+void nn_rec_audio_in_cb(uint32_t **buffer, uint32_t *stereo_point_count);
+
+/**
+ * @brief Prepares a recording area
+ *
+ * @details Erases the area and measures the page program time. Stalls for
+ * hundreds of milliseconds (about 1s per 64kB erase block in the worst
+ * case), the audio output glitches. The audio must be initialized.
+ *
+ * @param flash_offset Offset of the area in flash, sector aligned (4kB), after
+ * the program (nn_flash_program_end())
+ * @param size Size of the area, multiple of the sector size
+ * @param channels Recorded channels
+ *
+ * @return true on success, false otherwise (invalid area, area overlapping
+ * the program or the store of store.h, recording in progress, audio not
+ * initialized).
+ */
+bool nn_rec_prepare(uint32_t flash_offset, uint32_t size,
+                    nn_rec_channels channels);
+
+/**
+ * @brief Starts recording at the next input block
+ *
+ * @return true on success, false otherwise (not prepared, or the measured
+ * write throughput is lower than the input throughput).
+ */
+bool nn_rec_start(void);
+
+/**
+ * @brief Stops recording
+ *
+ * @details The block being received is the last one, nn_rec_poll() writes
+ * the rest of the ring.
+ */
+void nn_rec_stop(void);
+
+/**
+ * @brief Writes the recorded data to flash
+ *
+ * @details Call it between two render blocks. Writes at most one chunk, after
+ * waiting for the audio interrupts to leave enough time: capacity_bps
+ * assumes a call per shortest audio transfer (each render block), and at
+ * least one call per input block (NN_REC_BLOCK_FRAMES frames) is needed.
+ *
+ * @param timeout_us Maximum wait for the audio interrupts
+ *
+ * @return true while recording or writing, false when the recording is
+ * complete (stopped, area full, or overrun).
+ */
+bool nn_rec_poll(uint32_t timeout_us);
+
+/**
+ * @brief Gets the size of the recording
+ *
+ * @return Bytes written to flash, from the start of the area.
+ */
+uint32_t nn_rec_length(void);
+
+/**
+ * @brief Gets the recorder statistics
+ *
+ * @param stats Output statistics
+ */
+void nn_rec_get_stats(nn_rec_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "pico/sync.h"
+#include "sample_stream.h"
+#include "sample_stream_dma.h"
+
+#if NN_STREAM_CHUNK % 4 != 0
+#error "NN_STREAM_CHUNK must be a multiple of 4"
+#endif
+
+/*
+ * Positions are in bytes from the start of the sample. The ring holds the
+ * chunks from the one of read_pos, chunk n is in slot n % NN_STREAM_CHUNKS:
+ *
+ *   read_pos <= ready_pos <= fetch_pos <= (read_pos chunk + CHUNKS) * CHUNK
+ *
+ * except after a starvation, where ready_pos and fetch_pos may be behind
+ * read_pos until the next chunk lands.
+ */
+typedef struct stream_voice {
+    uint8_t ring[NN_STREAM_CHUNKS][NN_STREAM_CHUNK];
+    const uint8_t *src;  // Sample, through the uncached alias for flash
+    uint32_t length;
+    uint32_t read_pos;   // Bytes read by nn_stream_read()
+    uint32_t ready_pos;  // End of the data in the ring
+    uint32_t fetch_pos;  // End of the data requested from the DMA
+    uint32_t gen;        // Changes when the ring content is dropped
+    bool active;
+} stream_voice;
+
+static stream_voice g_voices[NN_STREAM_VOICES] __attribute__((aligned(4)));
+static critical_section_t g_lock;
+static bool g_init = false;
+
+// Transfer in progress
+static int g_busy_voice = -1;
+static uint32_t g_busy_gen;
+static uint32_t g_busy_end;
+
+// Nested nn_stream_pause() calls, no transfer is started while non zero
+static uint32_t g_paused = 0;
+
+static nn_stream_stats g_stats;
+
+// Called with the lock taken and no transfer in progress
+static void start_next(void) {
+    stream_voice *best = NULL;
+    uint32_t best_ahead = UINT32_MAX;
+
+    if (g_paused > 0) {
+        g_busy_voice = -1;
+        return;
+    }
+
+    // The voice with the least data ahead of its cursor first
+    for (int i = 0; i < NN_STREAM_VOICES; i++) {
+        stream_voice *v = &g_voices[i];
+        const uint32_t window =
+            (v->read_pos / NN_STREAM_CHUNK + NN_STREAM_CHUNKS) * NN_STREAM_CHUNK;
+
+        if (!v->active || v->fetch_pos >= v->length || v->fetch_pos >= window) {
+            continue;
+        }
+
+        const uint32_t ahead =
+            v->fetch_pos > v->read_pos ? v->fetch_pos - v->read_pos : 0;
+        if (ahead < best_ahead) {
+            best = v;
+            best_ahead = ahead;
+        }
+    }
+
+    if (best == NULL) {
+        g_busy_voice = -1;
+        return;
+    }
+
+    uint32_t len = best->length - best->fetch_pos;
+    if (len > NN_STREAM_CHUNK) {
+        len = NN_STREAM_CHUNK;
+    }
+    const uint32_t slot = (best->fetch_pos / NN_STREAM_CHUNK) % NN_STREAM_CHUNKS;
+
+    g_busy_voice = best - g_voices;
+    g_busy_gen = best->gen;
+    g_busy_end = best->fetch_pos + len;
+
+    // Whole words: the last chunk may read up to 3 bytes after the sample
+    nn_stream_dma_start(best->src + best->fetch_pos, best->ring[slot],
+                        (len + 3) / 4);
+
+    best->fetch_pos += len;
+    g_stats.fetches++;
+}
+
+// DMA completion interrupt
+void nn_stream_dma_done(void) {
+    critical_section_enter_blocking(&g_lock);
+    stream_voice *v = &g_voices[g_busy_voice];
+    if (v->gen == g_busy_gen) {
+        v->ready_pos = g_busy_end;
+    }
+    start_next();
+    critical_section_exit(&g_lock);
+}
+
+bool nn_stream_init(void) {
+    if (g_init) {
+        return true;
+    }
+
+    if (!nn_stream_dma_init()) {
+        return false;
+    }
+    critical_section_init(&g_lock);
+    memset(&g_stats, 0, sizeof(g_stats));
+    g_init = true;
+    return true;
+}
+
+int nn_stream_play(const void *data, uint32_t length) {
+    int voice = -1;
+    uint32_t playing = 0;
+
+    if (!g_init || ((uintptr_t)data & 3) != 0) {
+        return -1;
+    }
+
+    critical_section_enter_blocking(&g_lock);
+
+    for (int i = 0; i < NN_STREAM_VOICES; i++) {
+        // The DMA may still write in the ring of a voice that just stopped
+        if (voice < 0 && !g_voices[i].active && i != g_busy_voice) {
+            stream_voice *v = &g_voices[i];
+
+            v->src = nn_stream_dma_source(data);
+            v->length = length;
+            v->read_pos = v->ready_pos = v->fetch_pos = 0;
+            v->gen++;
+            v->active = length > 0;
+            voice = i;
+        }
+        playing += g_voices[i].active;
+    }
+
+    if (playing > g_stats.voices_max) {
+        g_stats.voices_max = playing;
+    }
+    if (g_busy_voice < 0) {
+        start_next();
+    }
+
+    critical_section_exit(&g_lock);
+    return voice;
+}
+
+void nn_stream_stop(int voice) {
+    if (voice < 0 || voice >= NN_STREAM_VOICES) {
+        return;
+    }
+
+    critical_section_enter_blocking(&g_lock);
+    g_voices[voice].active = false;
+    g_voices[voice].gen++;
+    critical_section_exit(&g_lock);
+}
+
+bool nn_stream_playing(int voice) {
+    return voice >= 0 && voice < NN_STREAM_VOICES && g_voices[voice].active;
+}
+
+uint32_t nn_stream_read(int voice, void *dst, uint32_t len) {
+    uint8_t *out = dst;
+
+    if (voice < 0 || voice >= NN_STREAM_VOICES) {
+        return 0;
+    }
+    stream_voice *v = &g_voices[voice];
+
+    critical_section_enter_blocking(&g_lock);
+    const bool active = v->active;
+    const uint32_t pos = v->read_pos;
+    const uint32_t ready = v->ready_pos;
+    critical_section_exit(&g_lock);
+
+    if (!active) {
+        return 0;
+    }
+    if (len > v->length - pos) {
+        len = v->length - pos;
+    }
+
+    // The slots up to the chunk of pos + len are not refilled until read_pos
+    // moves, copy them without the lock
+    uint32_t hit = ready > pos ? ready - pos : 0;
+    if (hit > len) {
+        hit = len;
+    }
+    for (uint32_t n = 0; n < hit;) {
+        const uint32_t p = pos + n;
+        const uint32_t off = p % NN_STREAM_CHUNK;
+        uint32_t k = NN_STREAM_CHUNK - off;
+
+        if (k > hit - n) {
+            k = hit - n;
+        }
+        memcpy(&out[n], &v->ring[(p / NN_STREAM_CHUNK) % NN_STREAM_CHUNKS][off], k);
+        n += k;
+    }
+
+    const uint32_t starved = len - hit;
+    if (starved > 0) {
+        memcpy(&out[hit], v->src + pos + hit, starved);
+    }
+
+    critical_section_enter_blocking(&g_lock);
+    v->read_pos = pos + len;
+    g_stats.hit_bytes += hit;
+    g_stats.starved_bytes += starved;
+
+    if (starved > 0) {
+        g_stats.starvations++;
+        if (v->fetch_pos <= v->read_pos) {
+            // Restart the read-ahead at the cursor, the chunks before it are
+            // not needed anymore
+            v->gen++;
+            v->ready_pos = v->fetch_pos =
+                v->read_pos / NN_STREAM_CHUNK * NN_STREAM_CHUNK;
+        }
+    }
+    if (v->read_pos == v->length) {
+        v->active = false;
+        v->gen++;
+    }
+    if (g_busy_voice < 0) {
+        start_next();
+    }
+    critical_section_exit(&g_lock);
+
+    return len;
+}
+
+void nn_stream_pause(void) {
+    if (!g_init) {
+        return;
+    }
+
+    critical_section_enter_blocking(&g_lock);
+    g_paused++;
+    critical_section_exit(&g_lock);
+
+    // The completion interrupt does not start another chunk, it can run
+    // later (e.g. after the flash operation)
+    nn_stream_dma_wait();
+}
+
+void nn_stream_resume(void) {
+    if (!g_init) {
+        return;
+    }
+
+    critical_section_enter_blocking(&g_lock);
+    if (g_paused > 0) {
+        g_paused--;
+    }
+    if (g_paused == 0 && g_busy_voice < 0) {
+        start_next();
+    }
+    critical_section_exit(&g_lock);
+}
+
+void nn_stream_get_stats(nn_stream_stats *stats) {
+    if (!g_init) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+
+    critical_section_enter_blocking(&g_lock);
+    *stats = g_stats;
+    critical_section_exit(&g_lock);
+}
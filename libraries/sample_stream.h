@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file sample_stream.h
+ * @brief Streams samples from flash through per-voice read-ahead rings.
+ *
+ * Reading long samples from the cached XIP window evicts the render code
+ * from the 16kB XIP cache. Instead, each playing voice has a small SRAM ring
+ * that a DMA channel fills ahead of the play cursor, in chunks of
+ * NN_STREAM_CHUNK bytes, through the flash alias that neither uses nor
+ * allocates cache lines (XIP_NOCACHE_NOALLOC_BASE). The DMA serves the
+ * voice with the least data ahead first, and each completion starts the
+ * next chunk.
+ *
+ * The render path reads the voices with nn_stream_read(). Data that is not
+ * in the ring yet (starvation, e.g. just after nn_stream_play()) is read
+ * directly through the same uncached alias, so the output never has holes,
+ * and counted in the statistics.
+ *
+ * The DMA keeps running when the flash is programmed or erased, and reading
+ * the flash at that time returns garbage or stalls the bus. Every flash
+ * operation must be placed between nn_stream_pause() and nn_stream_resume(),
+ * the store (store.h) and the recorder (recorder.h) do it.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Voices playing at the same time.
+ */
+#ifndef NN_STREAM_VOICES
+#define NN_STREAM_VOICES 8
+#endif
+
+/**
+ * @brief Bytes per DMA transfer, a multiple of 4.
+ */
+#ifndef NN_STREAM_CHUNK
+#define NN_STREAM_CHUNK 256
+#endif
+
+/**
+ * @brief Chunks in the ring of a voice: 1kB, 93ms of 8-bit samples at
+ * 11kHz, 23ms at 44.1kHz.
+ */
+#ifndef NN_STREAM_CHUNKS
+#define NN_STREAM_CHUNKS 4
+#endif
+
+/**
+ * @struct nn_stream_stats
+ * @brief Streamer statistics, since nn_stream_init().
+ */
+typedef struct nn_stream_stats {
+    uint32_t hit_bytes;     ///< Bytes read from the rings.
+    uint32_t starved_bytes; ///< Bytes read directly from flash.
+    uint32_t starvations;   ///< nn_stream_read() calls with starved bytes.
+    uint32_t fetches;       ///< Chunks copied by the DMA.
+    uint32_t voices_max;    ///< Highest number of voices playing.
+} nn_stream_stats;
+
+/**
+ * @brief Initializes the streamer
+ *
+ * @details Claims a DMA channel, its interrupt is shared on DMA_IRQ_1.
+ *
+ * @return true on success, false otherwise.
+ */
+bool nn_stream_init(void);
+
+/**
+ * @brief Starts streaming a sample
+ *
+ * @param data Sample data, 4-byte aligned, in flash (or RAM)
+ * @param length Size in bytes
+ *
+ * @return Voice number, -1 if no voice is free or the sample is not
+ * aligned.
+ */
+int nn_stream_play(const void *data, uint32_t length);
+
+/**
+ * @brief Stops a voice, it becomes free
+ *
+ * @param voice Voice number
+ */
+void nn_stream_stop(int voice);
+
+/**
+ * @brief Checks if a voice still has data to read
+ *
+ * @param voice Voice number
+ */
+bool nn_stream_playing(int voice);
+
+/**
+ * @brief Reads the next bytes of a voice
+ *
+ * @details The voice becomes free after its last byte is read.
+ *
+ * @param voice Voice number
+ * @param dst Output buffer
+ * @param len Number of bytes
+ *
+ * @return Number of bytes read, less than len at the end of the sample.
+ */
+uint32_t nn_stream_read(int voice, void *dst, uint32_t len);
+
+/**
+ * @brief Stops reading the flash, before a flash operation
+ *
+ * @details Waits for the chunk in progress (a few microseconds) and starts
+ * no other one until nn_stream_resume(). The voices keep playing, reading
+ * the flash directly when their ring is empty: the execution from flash is
+ * stalled during the operation anyway. Calls can be nested. Does nothing
+ * before nn_stream_init().
+ */
+void nn_stream_pause(void);
+
+/**
+ * @brief Reads the flash again, after a flash operation
+ *
+ * @details Restarts the read-ahead when the calls to nn_stream_pause() are
+ * all matched.
+ */
+void nn_stream_resume(void);
+
+/**
+ * @brief Gets the streamer statistics
+ *
+ * @param stats Output statistics
+ */
+void nn_stream_get_stats(nn_stream_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
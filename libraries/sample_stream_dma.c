@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/address_mapped.h"
+#include "sample_stream_dma.h"
+
+// The DMA completion interrupt shares DMA_IRQ_1 with the audio input, the
+// MIDI output and the PGB-1 screen
+#define STREAM_DMA_IRQ DMA_IRQ_1
+
+static int g_dma_chan = -1;
+
+static void dma_stream_handler(void) {
+    if (dma_hw->ints1 & (1u << g_dma_chan)) {
+        // Clear the interrupt request.
+        dma_hw->ints1 = 1u << g_dma_chan;
+        nn_stream_dma_done();
+    }
+}
+
+bool nn_stream_dma_init(void) {
+    g_dma_chan = dma_claim_unused_channel(false);
+    if (g_dma_chan < 0) {
+        return false;
+    }
+
+    // Unpaced memory to memory transfers
+    dma_channel_config c = dma_channel_get_default_config(g_dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, true);
+    dma_channel_set_config(g_dma_chan, &c, false);
+
+    irq_add_shared_handler(STREAM_DMA_IRQ, dma_stream_handler,
+                           PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    dma_channel_set_irq1_enabled(g_dma_chan, true);
+    irq_set_enabled(STREAM_DMA_IRQ, true);
+    return true;
+}
+
+const uint8_t *nn_stream_dma_source(const void *data) {
+    const uintptr_t addr = (uintptr_t)data;
+
+    if (addr >= XIP_BASE && addr < XIP_BASE + PICO_FLASH_SIZE_BYTES) {
+        return (const uint8_t *)(addr - XIP_BASE + XIP_NOCACHE_NOALLOC_BASE);
+    }
+    return data;
+}
+
+void nn_stream_dma_start(const void *src, void *dst, uint32_t words) {
+    dma_channel_set_read_addr(g_dma_chan, src, false);
+    dma_channel_set_write_addr(g_dma_chan, dst, false);
+    dma_channel_set_trans_count(g_dma_chan, words, true);
+}
+
+void nn_stream_dma_wait(void) {
+    dma_channel_wait_for_finish_blocking(g_dma_chan);
+}
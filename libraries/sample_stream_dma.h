@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file sample_stream_dma.h
+ * @brief DMA of the sample streamer (internal).
+ *
+ * sample_stream.c schedules the chunks, the transfers go through these
+ * functions: sample_stream_dma.c on the device, a fake DMA driven by the
+ * tests on the host (host/sample_stream_dma_host.c).
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Claims the channel and installs the completion interrupt
+ *
+ * @return true on success, false otherwise.
+ */
+bool nn_stream_dma_init(void);
+
+/**
+ * @brief Address to read a sample from, for the DMA and the starved reads
+ *
+ * @param data Sample data
+ *
+ * @return The address of data in the flash alias that bypasses the XIP
+ * cache, data itself if it is not in flash.
+ */
+const uint8_t *nn_stream_dma_source(const void *data);
+
+/**
+ * @brief Starts a transfer, nn_stream_dma_done() is called when it ends
+ *
+ * @details Called with the streamer lock taken and no transfer in progress.
+ *
+ * @param src Source, 4-byte aligned
+ * @param dst Destination, 4-byte aligned
+ * @param words Number of 32-bit words
+ */
+void nn_stream_dma_start(const void *src, void *dst, uint32_t words);
+
+/**
+ * @brief Waits for the end of the transfer in progress, if any
+ *
+ * @details nn_stream_dma_done() may be called later.
+ */
+void nn_stream_dma_wait(void);
+
+/**
+ * @brief Completion of a transfer, implemented by sample_stream.c
+ */
+void nn_stream_dma_done(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "scheduler.h"
+
+typedef struct nn_sched_task {
+    nn_sched_task_fn fn;
+    void *arg;
+    uint64_t next_release_us;
+    nn_sched_task_stats stats;
+} nn_sched_task;
+
+static nn_sched_task g_tasks[NN_SCHED_MAX_TASKS];
+static int g_task_count = 0;
+
+static nn_sched_yield_cb_t g_yield_cb = NULL;
+static nn_sched_overrun_cb_t g_overrun_cb = NULL;
+
+static bool g_started = false;
+static uint64_t g_start_us = 0;
+static nn_sched_stats g_stats = {0};
+
+int nn_sched_add_task(const char *name, nn_sched_task_fn fn, void *arg,
+                      uint32_t period_us, uint32_t budget_us) {
+    if (g_task_count >= NN_SCHED_MAX_TASKS || fn == NULL || period_us == 0) {
+        return -1;
+    }
+
+    nn_sched_task *t = &g_tasks[g_task_count];
+
+    t->fn = fn;
+    t->arg = arg;
+    // Tasks added before the start are released when the scheduler starts
+    t->next_release_us = g_started ? time_us_64() : 0;
+    t->stats = (nn_sched_task_stats){0};
+    t->stats.name = name;
+    t->stats.period_us = period_us;
+    t->stats.budget_us = budget_us;
+
+    return g_task_count++;
+}
+
+void nn_sched_set_yield_callback(nn_sched_yield_cb_t cb) {
+    g_yield_cb = cb;
+}
+
+void nn_sched_set_overrun_callback(nn_sched_overrun_cb_t cb) {
+    g_overrun_cb = cb;
+}
+
+static void yield(void) {
+    if (g_yield_cb == NULL) {
+        return;
+    }
+
+    const uint64_t start = time_us_64();
+    while (g_yield_cb()) {
+        continue;
+    }
+    g_stats.yield_us += time_us_64() - start;
+}
+
+static void run_task(int id, uint64_t now) {
+    nn_sched_task *t = &g_tasks[id];
+    const uint32_t period = t->stats.period_us;
+    const uint32_t latency = (uint32_t)(now - t->next_release_us);
+
+    if (latency > t->stats.max_latency_us) {
+        t->stats.max_latency_us = latency;
+    }
+
+    t->fn(t->arg);
+
+    const uint64_t end = time_us_64();
+    const uint32_t run_us = (uint32_t)(end - now);
+
+    t->stats.runs++;
+    t->stats.total_run_us += run_us;
+    g_stats.task_us += run_us;
+    if (run_us > t->stats.max_run_us) {
+        t->stats.max_run_us = run_us;
+    }
+
+    // Next release on the original grid. A release that is due runs late,
+    // releases late by a period or more are skipped rather than run back to
+    // back.
+    t->next_release_us += period;
+    if (end >= t->next_release_us + period) {
+        const uint64_t missed = (end - t->next_release_us) / period;
+
+        t->stats.skipped += (uint32_t)missed;
+        t->next_release_us += missed * period;
+    }
+
+    if (t->stats.budget_us != 0 && run_us > t->stats.budget_us) {
+        t->stats.overruns++;
+        if (g_overrun_cb != NULL) {
+            g_overrun_cb(id, run_us);
+        }
+    }
+}
+
+bool nn_sched_run_once(void) {
+    if (!g_started) {
+        g_started = true;
+        g_start_us = time_us_64();
+        for (int i = 0; i < g_task_count; i++) {
+            g_tasks[i].next_release_us = g_start_us;
+        }
+    }
+
+    // Audio first
+    yield();
+
+    if (g_task_count == 0) {
+        return false;
+    }
+
+    const uint64_t now = time_us_64();
+    int next = 0;
+
+    for (int i = 1; i < g_task_count; i++) {
+        if (g_tasks[i].next_release_us < g_tasks[next].next_release_us) {
+            next = i;
+        }
+    }
+
+    if (g_tasks[next].next_release_us <= now) {
+        run_task(next, now);
+        return true;
+    }
+
+    // Sleep until the next release, or any event (interrupt, other core)
+    best_effort_wfe_or_timeout(from_us_since_boot(g_tasks[next].next_release_us));
+    g_stats.idle_us += time_us_64() - now;
+    return false;
+}
+
+void nn_sched_run(void) {
+    while (true) {
+        nn_sched_run_once();
+    }
+}
+
+bool nn_sched_get_task_stats(int task, nn_sched_task_stats *stats) {
+    if (task < 0 || task >= g_task_count) {
+        return false;
+    }
+
+    *stats = g_tasks[task].stats;
+    return true;
+}
+
+void nn_sched_get_stats(nn_sched_stats *stats) {
+    *stats = g_stats;
+    stats->elapsed_us = g_started ? time_us_64() - g_start_us : 0;
+}
+
+void nn_sched_print_stats(void) {
+    nn_sched_stats s;
+
+    nn_sched_get_stats(&s);
+
+    const uint64_t elapsed = s.elapsed_us ? s.elapsed_us : 1;
+
+    printf("Scheduler: %llu ms, tasks %u%%, yield %u%%, idle %u%%\n",
+           (unsigned long long)(s.elapsed_us / 1000),
+           (unsigned)(s.task_us * 100 / elapsed),
+           (unsigned)(s.yield_us * 100 / elapsed),
+           (unsigned)(s.idle_us * 100 / elapsed));
+
+    for (int i = 0; i < g_task_count; i++) {
+        const nn_sched_task_stats *t = &g_tasks[i].stats;
+
+        printf("  %-10s %6lu us: %8lu runs, avg %5lu us, max %5lu us, "
+               "%lu overruns, %lu skipped, max latency %lu us\n",
+               t->name ? t->name : "?",
+               (unsigned long)t->period_us,
+               (unsigned long)t->runs,
+               (unsigned long)(t->runs ? t->total_run_us / t->runs : 0),
+               (unsigned long)t->max_run_us,
+               (unsigned long)t->overruns,
+               (unsigned long)t->skipped,
+               (unsigned long)t->max_latency_us);
+    }
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file scheduler.h
+ * @brief Cooperative periodic task scheduler for the application core.
+ *
+ * Tasks (keyboard, LEDs, screen, control inputs, ...) are registered with a
+ * period and a time budget, then nn_sched_run() calls each of them at its
+ * release times: task k runs at start + n * period, independently of the
+ * duration of the other tasks, so the schedule does not drift with load.
+ *
+ * Tasks run to completion in the calling thread (not in interrupt context).
+ * When several tasks are due, the one with the earliest release runs first.
+ * Between two tasks and while idle, the optional yield callback is called so
+ * that audio rendered on the same core always takes precedence over the
+ * periodic work.
+ *
+ * Between releases the core sleeps (WFE) until the next release, woken by a
+ * hardware alarm, so that idle time is measurable and does not waste power.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum number of tasks.
+ */
+#ifndef NN_SCHED_MAX_TASKS
+#define NN_SCHED_MAX_TASKS 8
+#endif
+
+/**
+ * @typedef nn_sched_task_fn
+ * @brief Type definition for task functions.
+ *
+ * @param arg The argument given to nn_sched_add_task().
+ */
+typedef void (*nn_sched_task_fn)(void *arg);
+
+/**
+ * @typedef nn_sched_yield_cb_t
+ * @brief Type definition for the yield callback.
+ *
+ * @return true if the callback did some work (e.g. rendered an audio buffer)
+ *         and wants to be called again before the next task, false otherwise.
+ */
+typedef bool (*nn_sched_yield_cb_t)(void);
+
+/**
+ * @typedef nn_sched_overrun_cb_t
+ * @brief Type definition for the overrun callback.
+ *
+ * @param task The task id.
+ * @param run_us Duration of the run that exceeded the task budget.
+ */
+typedef void (*nn_sched_overrun_cb_t)(int task, uint32_t run_us);
+
+/**
+ * @struct nn_sched_task_stats
+ * @brief Run time statistics of a task.
+ */
+typedef struct nn_sched_task_stats {
+    const char *name;       ///< Name given to nn_sched_add_task().
+    uint32_t period_us;     ///< Release period.
+    uint32_t budget_us;     ///< Maximum expected run time.
+    uint32_t runs;          ///< Number of runs.
+    uint32_t overruns;      ///< Runs longer than the budget.
+    uint32_t skipped;       ///< Releases skipped because the task was late by
+                            ///< a period or more.
+    uint32_t max_run_us;    ///< Longest run.
+    uint64_t total_run_us;  ///< Sum of the run times.
+    uint32_t max_latency_us; ///< Longest delay between release and start.
+} nn_sched_task_stats;
+
+/**
+ * @struct nn_sched_stats
+ * @brief Core time statistics of the scheduler.
+ */
+typedef struct nn_sched_stats {
+    uint64_t elapsed_us; ///< Time since nn_sched_run() started.
+    uint64_t task_us;    ///< Time spent in tasks.
+    uint64_t yield_us;   ///< Time spent in the yield callback.
+    uint64_t idle_us;    ///< Time spent waiting for the next release.
+} nn_sched_stats;
+
+/**
+ * @brief Registers a periodic task
+ *
+ * @details Must be called before nn_sched_run() (or from a task). The first
+ * release of the task is when it is added, or when the scheduler starts.
+ *
+ * @param name Name of the task, for the statistics (not copied)
+ * @param fn Task function
+ * @param arg Argument given to the task function
+ * @param period_us Release period in microseconds (e.g. 1000 for 1 kHz)
+ * @param budget_us Maximum expected run time, longer runs are reported as
+ *                  overruns (0 for no budget)
+ *
+ * @return Task id, or -1 on error (no more task slot, invalid period).
+ */
+int nn_sched_add_task(const char *name, nn_sched_task_fn fn, void *arg,
+                      uint32_t period_us, uint32_t budget_us);
+
+/**
+ * @brief Sets the callback called between tasks and while idle
+ *
+ * @details Use it when audio is rendered on the same core as the tasks: the
+ * callback renders pending audio buffers before any task starts. A task
+ * itself is never interrupted.
+ *
+ * @param cb Function pointer to the callback, or NULL to disable it.
+ */
+void nn_sched_set_yield_callback(nn_sched_yield_cb_t cb);
+
+/**
+ * @brief Sets the callback called after a task exceeds its budget
+ *
+ * @param cb Function pointer to the callback, or NULL to disable it.
+ */
+void nn_sched_set_overrun_callback(nn_sched_overrun_cb_t cb);
+
+/**
+ * @brief Runs the due tasks, or waits for the next release
+ *
+ * @details For applications with their own main loop. At most one task is
+ * run per call.
+ *
+ * @return true if a task was run, false otherwise.
+ */
+bool nn_sched_run_once(void);
+
+/**
+ * @brief Runs the tasks forever
+ */
+void nn_sched_run(void);
+
+/**
+ * @brief Gets the statistics of a task
+ *
+ * @param task The task id
+ * @param stats Output statistics
+ *
+ * @return true on success, false if the task id is invalid.
+ */
+bool nn_sched_get_task_stats(int task, nn_sched_task_stats *stats);
+
+/**
+ * @brief Gets the core time statistics
+ *
+ * @param stats Output statistics
+ */
+void nn_sched_get_stats(nn_sched_stats *stats);
+
+/**
+ * @brief Prints the core load and the statistics of each task with printf
+ */
+void nn_sched_print_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "pgb1.h"
+#include "screen_gfx.h"
+
+uint8_t screen_framebuffer[SCREEN_FRAMEBUFFER_SIZE] = {0};
+
+// Start with the whole screen dirty: display RAM content is unknown
+uint8_t screen_dirty_x0[SCREEN_PAGES] = {0, 0, 0, 0, 0, 0, 0, 0};
+uint8_t screen_dirty_x1[SCREEN_PAGES] = {127, 127, 127, 127, 127, 127, 127, 127};
+
+void screen_mark_all_dirty(void) {
+    for (int page = 0; page < SCREEN_PAGES; page++) {
+        screen_dirty_x0[page] = 0;
+        screen_dirty_x1[page] = SCREEN_WIDTH - 1;
+    }
+}
+
+bool screen_take_dirty_window(int *x0, int *x1, int *page0, int *page1) {
+    bool dirty = false;
+
+    *x0 = SCREEN_WIDTH;
+    *x1 = -1;
+    *page0 = SCREEN_PAGES;
+    *page1 = -1;
+
+    for (int page = 0; page < SCREEN_PAGES; page++) {
+        if (screen_dirty_x0[page] <= screen_dirty_x1[page]) {
+            if (screen_dirty_x0[page] < *x0) {
+                *x0 = screen_dirty_x0[page];
+            }
+            if (screen_dirty_x1[page] > *x1) {
+                *x1 = screen_dirty_x1[page];
+            }
+            if (page < *page0) {
+                *page0 = page;
+            }
+            *page1 = page;
+            dirty = true;
+
+            screen_dirty_x0[page] = SCREEN_WIDTH - 1;
+            screen_dirty_x1[page] = 0;
+        }
+    }
+
+    return dirty;
+}
+
+void screen_clear(void) {
+    // Only the non-blank columns of each page become dirty
+    for (int page = 0; page < SCREEN_PAGES; page++) {
+        uint8_t *line = &screen_framebuffer[page * SCREEN_WIDTH];
+        int first = 0;
+        int last = SCREEN_WIDTH - 1;
+
+        while (first <= last && line[first] == 0) {
+            first++;
+        }
+        while (last >= first && line[last] == 0) {
+            last--;
+        }
+
+        if (first <= last) {
+            screen_mark_dirty(first, last, page);
+            memset(&line[first], 0, last - first + 1);
+        }
+    }
+}
+
+void screen_set_pixel(int x, int y, bool set) {
+    if (x >= 0 && x < SCREEN_WIDTH && y >= 0 && y < SCREEN_HEIGHT) {
+        int index = x + (y / 8) * SCREEN_WIDTH;
+        uint8_t *byte = &screen_framebuffer[index];
+        const uint8_t prev = *byte;
+        if (set) {
+            *byte |= 1 << (y % 8);
+        } else {
+            *byte &= ~(1 << (y % 8));
+        }
+        if (*byte != prev) {
+            screen_mark_dirty(x, x, y / 8);
+        }
+    }
+}
+
+void screen_draw_line(int x0, int y0, int x1, int y1, bool set) {
+    int dx =  abs (x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs (y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy, e2; /* error value e_xy */
+
+    for (;;){  /* loop */
+        screen_set_pixel (x0, y0, set);
+        if (x0 == x1 && y0 == y1) break;
+        e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; } /* e_xy+e_x > 0 */
+        if (e2 <= dx) { err += dx; y0 += sy; } /* e_xy+e_y < 0 */
+    }
+}
+
+const uint8_t font5x7[] =
+{187, 214, 205, 231, 125, 253, 255, 255, 255, 141, 59, 130, 11, 38, 136, 241, 255, 251, 123, 140, 17, 70, 12, 64, 116,
+ 113, 56, 239, 92, 132, 17, 70, 224, 156, 115, 14, 196, 30, 247, 207, 223, 255, 247, 239, 247, 251, 246, 252, 255, 255,
+ 255, 255, 255, 255, 255, 255, 207, 157, 255, 174, 53, 176, 118, 239, 222, 251, 255, 127, 93, 118, 119, 250, 254, 156, 203,
+ 121, 255, 237, 156, 115, 206, 122, 239, 220, 190, 214, 19, 231, 156, 115, 110, 59, 231, 156, 123, 189, 223, 250, 251, 247,
+ 255, 253, 245, 253, 255, 125, 255, 255, 255, 255, 127, 255, 255, 255, 255, 125, 223, 191, 43, 208, 183, 222, 125, 213, 254,
+ 255, 111, 179, 223, 174, 208, 95, 231, 114, 238, 224, 190, 231, 156, 119, 222, 123, 183, 175, 246, 138, 57, 231, 156, 223,
+ 206, 185, 90, 111, 223, 215, 253, 29, 101, 76, 113, 7, 153, 111, 219, 84, 70, 24, 74, 136, 206, 57, 230, 64, 223,
+ 183, 239, 95, 227, 222, 127, 223, 8, 62, 248, 91, 237, 123, 237, 131, 59, 134, 255, 253, 127, 183, 1, 232, 29, 132,
+ 2, 236, 203, 189, 82, 14, 58, 24, 183, 115, 106, 239, 221, 247, 253, 255, 63, 230, 141, 139, 142, 237, 91, 183, 98,
+ 206, 185, 236, 183, 115, 110, 182, 235, 247, 83, 251, 131, 213, 171, 223, 87, 237, 252, 255, 102, 123, 63, 240, 220, 118,
+ 47, 231, 14, 238, 86, 206, 121, 231, 189, 115, 251, 106, 239, 140, 243, 74, 191, 237, 156, 170, 187, 247, 125, 255, 255,
+ 193, 121, 7, 118, 112, 251, 230, 173, 156, 131, 161, 199, 237, 156, 218, 115, 247, 125, 239, 255, 21, 58, 246, 239, 222,
+ 123, 255, 220, 221, 238, 238, 58, 183, 221, 205, 123, 255, 253, 149, 115, 206, 122, 239, 220, 182, 214, 59, 231, 188, 181,
+ 110, 187, 74, 220, 246, 253, 222, 255, 191, 115, 206, 249, 253, 220, 182, 117, 43, 231, 252, 235, 111, 153, 170, 242, 238,
+ 125, 223, 191, 127, 221, 79, 250, 215, 255, 239, 63, 247, 24, 65, 188, 49, 238, 152, 127, 191, 191, 239, 232, 96, 196,
+ 192, 7, 23, 179, 3, 206, 69, 159, 92, 220, 113, 59, 183, 65, 188, 241, 131, 31, 98, 12, 113, 71, 23, 115, 139,
+ 202, 69, 255, 58, 188, 105, 87, 195, 193, 220, 249, 251};
+
+#define FONT_GLYPH_COUNT 94
+#define FONT_GLYPH_WIDTH 5
+#define FONT_GLYPH_HEIGHT 7
+#define FONT_STRIDE (FONT_GLYPH_COUNT * FONT_GLYPH_WIDTH) // Bits per font row
+
+// Glyphs rotated in the framebuffer format: one byte per column, LSB on top
+static uint8_t glyph_cache[FONT_GLYPH_COUNT][FONT_GLYPH_WIDTH];
+static bool glyph_cache_ready = false;
+
+static uint8_t get_bit(const uint8_t *bitmap, int bit_index) {
+    int byte_index = bit_index / 8;
+    int bit_position = bit_index % 8;
+
+    return (bitmap[byte_index] >> bit_position) & 0x01;
+}
+
+static void build_glyph_cache(void) {
+    for (int index = 0; index < FONT_GLYPH_COUNT; index++) {
+        for (int dx = 0; dx < FONT_GLYPH_WIDTH; dx++) {
+            uint8_t column = 0;
+
+            for (int dy = 0; dy < FONT_GLYPH_HEIGHT; dy++) {
+                const int bit_index = index * FONT_GLYPH_WIDTH + dx + dy * FONT_STRIDE;
+                if (get_bit(font5x7, bit_index) == 0) {
+                    column |= 1 << dy;
+                }
+            }
+            glyph_cache[index][dx] = column;
+        }
+    }
+    glyph_cache_ready = true;
+}
+
+static inline int floor_div8(int v) {
+    return v >= 0 ? v / 8 : -((7 - v) / 8);
+}
+
+static inline void write_byte(int x, int page, uint8_t bits, uint8_t mask) {
+    uint8_t *byte = &screen_framebuffer[page * SCREEN_WIDTH + x];
+    const uint8_t value = (*byte & ~mask) | (bits & mask);
+
+    if (value != *byte) {
+        *byte = value;
+        screen_mark_dirty(x, x, page);
+    }
+}
+
+// Write the masked bits of an 8 pixels column starting at row y (LSB on top),
+// over one or two pages depending on the alignment of y.
+static void write_column(int x, int y, uint8_t bits, uint8_t mask) {
+    if (x < 0 || x >= SCREEN_WIDTH) {
+        return;
+    }
+
+    const int page = floor_div8(y);
+    const int shift = y - page * 8;
+    const uint16_t b = (uint16_t)bits << shift;
+    const uint16_t m = (uint16_t)mask << shift;
+
+    if (page >= 0 && page < SCREEN_PAGES && (m & 0xFF)) {
+        write_byte(x, page, b & 0xFF, m & 0xFF);
+    }
+    if (page + 1 >= 0 && page + 1 < SCREEN_PAGES && (m >> 8)) {
+        write_byte(x, page + 1, b >> 8, m >> 8);
+    }
+}
+
+void screen_printc(int x, int y, char c) {
+    const int index = c - '!';
+
+    if (index < 0 || index >= FONT_GLYPH_COUNT) {
+        return;
+    }
+
+    if (!glyph_cache_ready) {
+        build_glyph_cache();
+    }
+
+    const uint8_t mask = (1 << FONT_GLYPH_HEIGHT) - 1;
+
+    for (int dx = 0; dx < FONT_GLYPH_WIDTH; dx++) {
+        write_column(x + dx, y, glyph_cache[index][dx], mask);
+    }
+}
+
+void screen_print(int x, int y, const char *str) {
+    int dx = 0;
+    for (const char *c = str; *c != 0; c++, dx += 6) {
+        screen_printc(x + dx, y, *c);
+    }
+}
+
+void screen_fill_rect(int x, int y, int w, int h, bool set) {
+    // Clip to the screen
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (x + w > SCREEN_WIDTH) {
+        w = SCREEN_WIDTH - x;
+    }
+    if (y + h > SCREEN_HEIGHT) {
+        h = SCREEN_HEIGHT - y;
+    }
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+
+    const int y_end = y + h; // Exclusive
+
+    for (int page = y / 8; page * 8 < y_end; page++) {
+        const int top = page * 8 > y ? 0 : y - page * 8;
+        const int bot = (page + 1) * 8 < y_end ? 8 : y_end - page * 8;
+        const uint8_t mask = (uint8_t)((0xFF << top) & (0xFF >> (8 - bot)));
+        const uint8_t bits = set ? mask : 0;
+        uint8_t *line = &screen_framebuffer[page * SCREEN_WIDTH];
+        int first = -1, last = -1;
+
+        for (int col = x; col < x + w; col++) {
+            const uint8_t value = (line[col] & ~mask) | bits;
+
+            if (value != line[col]) {
+                line[col] = value;
+                if (first < 0) {
+                    first = col;
+                }
+                last = col;
+            }
+        }
+
+        if (first >= 0) {
+            screen_mark_dirty(first, last, page);
+        }
+    }
+}
+
+void screen_draw_hline(int x, int y, int w, bool set) {
+    screen_fill_rect(x, y, w, 1, set);
+}
+
+void screen_draw_vline(int x, int y, int h, bool set) {
+    screen_fill_rect(x, y, 1, h, set);
+}
+
+void screen_blit_bitmap(int x, int y, int w, int h, const uint8_t *bitmap) {
+    for (int row = 0; row < h; row += 8) {
+        const int rows = h - row < 8 ? h - row : 8;
+        const uint8_t mask = (uint8_t)(0xFF >> (8 - rows));
+        const uint8_t *src = &bitmap[(row / 8) * w];
+
+        for (int dx = 0; dx < w; dx++) {
+            write_column(x + dx, y + row, src[dx], mask);
+        }
+    }
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file screen_gfx.h
+ * @brief PGB-1 screen framebuffer shared by the drawing functions of pgb1.h
+ * (screen_gfx.c) and the screen drivers (pgb1.c on the device, pgb1_host.c
+ * on the host).
+ *
+ * The framebuffer uses the SSD1306 horizontal addressing layout: 8 pages of
+ * 128 bytes, each byte is a column of 8 pixels with the LSB on top.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SCREEN_WIDTH 128
+#define SCREEN_HEIGHT 64
+#define SCREEN_PAGES (SCREEN_HEIGHT / 8)
+#define SCREEN_FRAMEBUFFER_SIZE ((SCREEN_WIDTH * SCREEN_HEIGHT) / 8)
+
+extern uint8_t screen_framebuffer[SCREEN_FRAMEBUFFER_SIZE];
+
+// Dirty column range of each page, the page is clean when x0 > x1
+extern uint8_t screen_dirty_x0[SCREEN_PAGES];
+extern uint8_t screen_dirty_x1[SCREEN_PAGES];
+
+static inline void screen_mark_dirty(int x0, int x1, int page) {
+    if (x0 < screen_dirty_x0[page]) {
+        screen_dirty_x0[page] = (uint8_t)x0;
+    }
+    if (x1 > screen_dirty_x1[page]) {
+        screen_dirty_x1[page] = (uint8_t)x1;
+    }
+}
+
+/**
+ * @brief Mark the whole screen as dirty (e.g. unknown display RAM content).
+ */
+void screen_mark_all_dirty(void);
+
+/**
+ * @brief Get the bounding window of the dirty regions and mark them clean.
+ *
+ * @return Returns false if nothing changed since the previous call.
+ */
+bool screen_take_dirty_window(int *x0, int *x1, int *page0, int *page1);
+
+#ifdef __cplusplus
+}
+#endif
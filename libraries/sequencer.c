@@ -0,0 +1,406 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "sequencer.h"
+
+#define TICK ((uint64_t)1 << 32) // One tick in Q32.32 positions
+
+#define DEFAULT_TICKS_PER_STEP 6 // 16th notes
+
+static uint32_t next_random(nn_seq *seq) {
+    // xorshift32
+    uint32_t x = seq->random;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    seq->random = x;
+    return x;
+}
+
+static const nn_seq_pattern *current(const nn_seq *seq) {
+    return &seq->patterns[seq->pattern];
+}
+
+static uint32_t pattern_length(const nn_seq_pattern *pat) {
+    if (pat->length == 0 || pat->length > NN_SEQ_MAX_STEPS) {
+        return NN_SEQ_MAX_STEPS;
+    }
+    return pat->length;
+}
+
+void nn_seq_init(nn_seq *seq, midi_clock *clock,
+                 const nn_seq_pattern *patterns, uint32_t pattern_count) {
+    seq->clock = clock;
+    seq->ticks_per_step = DEFAULT_TICKS_PER_STEP;
+    seq->patterns = patterns;
+    seq->pattern_count = pattern_count;
+    seq->song = NULL;
+    seq->pattern = 0;
+    seq->next_pattern = -1;
+    seq->song_pos = 0;
+    seq->song_repeat = 0;
+    seq->pattern_start = 0;
+    seq->cursor = 0;
+    seq->block_end = 0;
+    seq->next_step = 0;
+    seq->step_index = 0;
+    seq->was_running = false;
+    seq->note_count = 0;
+    seq->locked = 0;
+    seq->locked_channel = 0;
+    seq->random = 0x2545F491;
+}
+
+void nn_seq_pattern_clear(nn_seq_pattern *pat) {
+    memset(pat, 0, sizeof(*pat));
+    pat->length = NN_SEQ_MAX_STEPS;
+    pat->swing = 50;
+}
+
+bool nn_seq_set_lock(nn_seq_pattern *pat, uint32_t step, uint32_t param,
+                     uint8_t value) {
+    if (step >= NN_SEQ_MAX_STEPS || param >= NN_SEQ_MAX_PARAMS) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < pat->lock_count; i++) {
+        if (pat->locks[i].step == step && pat->locks[i].param == param) {
+            pat->locks[i].value = value;
+            return true;
+        }
+    }
+
+    if (pat->lock_count == NN_SEQ_MAX_LOCKS) {
+        return false;
+    }
+
+    pat->locks[pat->lock_count] = (nn_seq_lock){step, param, value};
+    pat->lock_count++;
+    pat->steps[step] |= NN_SEQ_STEP_LOCKS;
+    return true;
+}
+
+void nn_seq_clear_locks(nn_seq_pattern *pat, uint32_t step) {
+    uint32_t count = 0;
+
+    if (step >= NN_SEQ_MAX_STEPS) {
+        return;
+    }
+
+    pat->steps[step] &= ~NN_SEQ_STEP_LOCKS;
+    for (uint32_t i = 0; i < pat->lock_count; i++) {
+        if (pat->locks[i].step != step) {
+            pat->locks[count++] = pat->locks[i];
+        }
+    }
+    pat->lock_count = count;
+}
+
+void nn_seq_set_step_length(nn_seq *seq, uint32_t ticks_per_step) {
+    if (ticks_per_step != 0) {
+        seq->ticks_per_step = ticks_per_step;
+    }
+}
+
+void nn_seq_queue_pattern(nn_seq *seq, uint32_t pattern) {
+    if (pattern < seq->pattern_count) {
+        seq->song = NULL;
+        seq->next_pattern = pattern;
+    }
+}
+
+void nn_seq_set_song(nn_seq *seq, const nn_seq_song *song) {
+    if (song != NULL && song->length == 0) {
+        song = NULL;
+    }
+    seq->song_pos = 0;
+    seq->song_repeat = 0;
+    seq->song = song;
+}
+
+uint32_t nn_seq_current_step(const nn_seq *seq) {
+    return seq->step_index;
+}
+
+static void select_song_entry(nn_seq *seq) {
+    const uint8_t pattern = seq->song->pattern[seq->song_pos];
+
+    if (pattern < seq->pattern_count) {
+        seq->pattern = pattern;
+    }
+}
+
+// Next pattern at the end of the current one
+static void advance_pattern(nn_seq *seq) {
+    if (seq->song != NULL) {
+        seq->song_repeat++;
+        if (seq->song_repeat >= seq->song->repeat[seq->song_pos]) {
+            seq->song_repeat = 0;
+            seq->song_pos = (seq->song_pos + 1) % seq->song->length;
+        }
+        select_song_entry(seq);
+    } else if (seq->next_pattern >= 0) {
+        seq->pattern = seq->next_pattern;
+        seq->next_pattern = -1;
+    }
+}
+
+// Restarts the step counting at a position, after a start or a jump
+static void locate(nn_seq *seq, uint64_t pos) {
+    const uint64_t step_len = (uint64_t)seq->ticks_per_step * TICK;
+
+    seq->next_step = (uint32_t)((pos + step_len - 1) / step_len);
+
+    if (seq->next_step == 0) {
+        // Song start
+        seq->pattern_start = 0;
+        if (seq->song != NULL) {
+            seq->song_pos = 0;
+            seq->song_repeat = 0;
+            select_song_entry(seq);
+        } else if (seq->next_pattern >= 0) {
+            seq->pattern = seq->next_pattern;
+            seq->next_pattern = -1;
+        }
+    } else {
+        const uint32_t len = pattern_length(current(seq));
+        seq->pattern_start = seq->next_step - seq->next_step % len;
+    }
+}
+
+// Pattern and position in the pattern of the next step
+static uint32_t prepare_step(nn_seq *seq) {
+    while (seq->next_step - seq->pattern_start >=
+           pattern_length(current(seq))) {
+        seq->pattern_start += pattern_length(current(seq));
+        advance_pattern(seq);
+    }
+    return seq->next_step - seq->pattern_start;
+}
+
+static uint64_t trig_position(const nn_seq *seq, uint32_t index) {
+    const uint64_t step_len = (uint64_t)seq->ticks_per_step * TICK;
+    uint64_t pos = (uint64_t)seq->next_step * step_len;
+
+    if (index % 2 == 1) {
+        uint32_t swing = current(seq)->swing;
+
+        if (swing < 50) {
+            swing = 50;
+        } else if (swing > 75) {
+            swing = 75;
+        }
+        // The odd step is at swing % of the pair of steps
+        pos += (step_len * (2 * swing - 100)) / 100;
+    }
+    return pos;
+}
+
+static uint16_t offset_of(uint64_t pos, uint64_t from, uint64_t end,
+                          uint32_t len) {
+    if (pos <= from) {
+        return 0;
+    }
+
+    // First frame at or after the position
+    const uint64_t offset = ((pos - from) * len + (end - from) - 1) /
+        (end - from);
+    return offset >= len ? len - 1 : (uint16_t)offset;
+}
+
+static void remove_note(nn_seq *seq, uint32_t i) {
+    seq->note_count--;
+    seq->notes[i] = seq->notes[seq->note_count];
+}
+
+static int earliest_note(const nn_seq *seq) {
+    int found = -1;
+
+    for (uint32_t i = 0; i < seq->note_count; i++) {
+        if (found < 0 || seq->notes[i].end < seq->notes[found].end) {
+            found = i;
+        }
+    }
+    return found;
+}
+
+// Stopped: releases the notes and parameter locks
+static uint32_t release_all(nn_seq *seq, nn_seq_event *events,
+                            uint32_t max_events) {
+    uint32_t count = 0;
+
+    while (seq->note_count > 0 && count < max_events) {
+        const uint32_t i = seq->note_count - 1;
+
+        events[count++] = (nn_seq_event){0, NN_SEQ_NOTE_OFF,
+                                         seq->notes[i].channel,
+                                         seq->notes[i].note, 0};
+        remove_note(seq, i);
+    }
+
+    for (uint32_t p = 0; p < NN_SEQ_MAX_PARAMS && count < max_events; p++) {
+        if (seq->locked & (1u << p)) {
+            events[count++] = (nn_seq_event){0, NN_SEQ_PARAM_END,
+                                             seq->locked_channel, p, 0};
+            seq->locked &= ~(1u << p);
+        }
+    }
+
+    if (seq->note_count == 0 && seq->locked == 0) {
+        seq->was_running = false;
+    }
+    return count;
+}
+
+uint32_t nn_seq_render(nn_seq *seq, uint32_t frame, uint32_t len,
+                       nn_seq_event *events, uint32_t max_events) {
+    uint32_t count = 0;
+
+    if (seq->pattern_count == 0 || len == 0 ||
+        max_events < NN_SEQ_MIN_EVENTS) {
+        return 0;
+    }
+
+    if (!midi_clock_running(seq->clock)) {
+        if (seq->was_running) {
+            return release_all(seq, events, max_events);
+        }
+        return 0;
+    }
+
+    const uint64_t start = midi_clock_position(seq->clock, frame);
+    const uint64_t end = midi_clock_position(seq->clock, frame + len);
+    const uint64_t prev_end = seq->block_end;
+    uint64_t from = seq->cursor;
+
+    // The cursor may be behind when events did not fit in the previous call,
+    // the jumps are detected on the block positions.
+    seq->block_end = end;
+    if (!seq->was_running || prev_end + TICK < start ||
+        prev_end > start + TICK) {
+        // Start or position jump
+        seq->was_running = true;
+        from = start;
+        locate(seq, from);
+    }
+
+    if (end <= from) {
+        // Waiting for the clock
+        seq->cursor = from;
+        return 0;
+    }
+
+    uint64_t done = end; // Position up to which everything is processed
+
+    while (true) {
+        const int off = earliest_note(seq);
+        const uint32_t index = prepare_step(seq);
+        const nn_seq_pattern *pat = current(seq);
+        const uint64_t trig = trig_position(seq, index);
+
+        if (off >= 0 && seq->notes[off].end < end &&
+            (seq->notes[off].end <= trig || trig >= end))
+        {
+            if (count == max_events) {
+                done = seq->notes[off].end;
+                break;
+            }
+            events[count++] = (nn_seq_event){
+                offset_of(seq->notes[off].end, start, end, len),
+                NN_SEQ_NOTE_OFF, seq->notes[off].channel,
+                seq->notes[off].note, 0};
+            remove_note(seq, off);
+            continue;
+        }
+
+        if (trig >= end) {
+            break;
+        }
+
+        const uint32_t step = pat->steps[index];
+        const uint16_t offset = offset_of(trig, start, end, len);
+        const bool play = (step & NN_SEQ_STEP_TRIG) &&
+            (next_random(seq) & 0xF) <= NN_SEQ_STEP_PROBA(step);
+
+        if (play) {
+            uint32_t locked = 0;
+            if (step & NN_SEQ_STEP_LOCKS) {
+                for (uint32_t i = 0; i < pat->lock_count; i++) {
+                    if (pat->locks[i].step == index) {
+                        locked |= 1u << pat->locks[i].param;
+                    }
+                }
+            }
+
+            // Worst case: the lock ends, the locks of the step, a note off
+            // for the retrigger or the voice steal, and the note on. At most
+            // NN_SEQ_MIN_EVENTS, so the step fits in an empty array.
+            uint32_t needed = 2;
+            for (uint32_t p = 0; p < NN_SEQ_MAX_PARAMS; p++) {
+                needed += ((seq->locked | locked) >> p) & 1;
+            }
+            if (max_events - count < needed) {
+                done = trig;
+                break;
+            }
+
+            // Restore the parameters locked by the previous trig only
+            for (uint32_t p = 0; p < NN_SEQ_MAX_PARAMS; p++) {
+                if ((seq->locked & ~locked) & (1u << p)) {
+                    events[count++] = (nn_seq_event){
+                        offset, NN_SEQ_PARAM_END, seq->locked_channel, p, 0};
+                }
+            }
+
+            for (uint32_t i = 0; i < pat->lock_count && locked != 0; i++) {
+                if (pat->locks[i].step == index) {
+                    events[count++] = (nn_seq_event){
+                        offset, NN_SEQ_PARAM, pat->channel,
+                        pat->locks[i].param, pat->locks[i].value};
+                }
+            }
+            seq->locked = locked;
+            seq->locked_channel = pat->channel;
+
+            const uint8_t note = NN_SEQ_STEP_NOTE(step);
+            int cut = -1;
+
+            for (uint32_t i = 0; i < seq->note_count; i++) {
+                if (seq->notes[i].note == note &&
+                    seq->notes[i].channel == pat->channel) {
+                    cut = i;
+                }
+            }
+            if (cut < 0 && seq->note_count == NN_SEQ_MAX_NOTES) {
+                cut = earliest_note(seq);
+            }
+            if (cut >= 0) {
+                events[count++] = (nn_seq_event){
+                    offset, NN_SEQ_NOTE_OFF, seq->notes[cut].channel,
+                    seq->notes[cut].note, 0};
+                remove_note(seq, cut);
+            }
+
+            events[count++] = (nn_seq_event){
+                offset, NN_SEQ_NOTE_ON, pat->channel, note,
+                NN_SEQ_STEP_VELOCITY(step)};
+
+            seq->notes[seq->note_count].end =
+                trig + NN_SEQ_STEP_LENGTH(step) * TICK;
+            seq->notes[seq->note_count].note = note;
+            seq->notes[seq->note_count].channel = pat->channel;
+            seq->note_count++;
+        }
+
+        seq->step_index = index;
+        seq->next_step++;
+    }
+
+    seq->cursor = done;
+    return count;
+}
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file sequencer.h
+ * @brief Step sequencer running in the audio render path.
+ *
+ * Patterns are up to NN_SEQ_MAX_STEPS steps, each packed in 32 bits (note,
+ * velocity, length, probability), with a small pool of parameter locks per
+ * pattern: a pattern is 116 bytes, so many of them fit in RAM. A song is a
+ * list of patterns with a repeat count.
+ *
+ * nn_seq_render() is called for each audio block with the frame of the
+ * block. It reads the position of a midi_clock (follower or master) and
+ * returns the note and parameter events of the block with their frame
+ * offset, so the timing only depends on the audio clock, not on the load of
+ * the UI. Swing delays the odd steps by a fraction of a step.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "midi_clock.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NN_SEQ_MAX_STEPS 16 ///< One step per key, K_1 to K_16.
+
+/**
+ * @brief Parameter locks per pattern.
+ */
+#ifndef NN_SEQ_MAX_LOCKS
+#define NN_SEQ_MAX_LOCKS 16
+#endif
+
+#define NN_SEQ_MAX_PARAMS 32 ///< Parameters that can be locked (0 to 31).
+
+/**
+ * @brief Smallest event array for nn_seq_render(): the events of one step
+ * (lock ends of the previous trig, locks, a note off and the note on) are
+ * returned together.
+ */
+#define NN_SEQ_MIN_EVENTS \
+    ((2 * NN_SEQ_MAX_LOCKS < NN_SEQ_MAX_PARAMS ? \
+      2 * NN_SEQ_MAX_LOCKS : NN_SEQ_MAX_PARAMS) + 2)
+
+/**
+ * @brief Entries in a song.
+ */
+#ifndef NN_SEQ_SONG_LEN
+#define NN_SEQ_SONG_LEN 64
+#endif
+
+/**
+ * @brief Notes playing at the same time, the oldest one is cut when a new
+ * note does not fit.
+ */
+#ifndef NN_SEQ_MAX_NOTES
+#define NN_SEQ_MAX_NOTES 8
+#endif
+
+/*
+ * Step format
+ *
+ * XXXX_XXKP_PPPL_LLLL_LVVV_VVVV_NNNN_NNNT
+ *                                       ^ Trig: the step plays
+ *                                      ^ Note (0-127)
+ *                             ^ Velocity (0-127)
+ *                     ^ Length in ticks - 1 (1 to 64 ticks, 6 per 16th note)
+ *             ^ Probability (n + 1) / 16
+ *        ^ Has parameter locks
+ */
+#define NN_SEQ_STEP_TRIG       (1u << 0)
+#define NN_SEQ_STEP_LOCKS      (1u << 25)
+
+#define NN_SEQ_STEP_NOTE(s)    (((s) >> 1) & 0x7F)
+#define NN_SEQ_STEP_VELOCITY(s) (((s) >> 8) & 0x7F)
+#define NN_SEQ_STEP_LENGTH(s)  ((((s) >> 15) & 0x3F) + 1)
+#define NN_SEQ_STEP_PROBA(s)   (((s) >> 21) & 0xF)
+
+/**
+ * @brief Builds a step that plays
+ *
+ * @param note MIDI note, 0 to 127
+ * @param vel Velocity, 0 to 127
+ * @param len Length in ticks, 1 to 64
+ * @param proba Probability (proba + 1) / 16, 15 to always play
+ */
+#define NN_SEQ_STEP(note, vel, len, proba)          \
+    (NN_SEQ_STEP_TRIG                              \
+     | (((uint32_t)(note) & 0x7F) << 1)            \
+     | (((uint32_t)(vel) & 0x7F) << 8)             \
+     | ((((uint32_t)(len) - 1) & 0x3F) << 15)      \
+     | (((uint32_t)(proba) & 0xF) << 21))
+
+/**
+ * @struct nn_seq_lock
+ * @brief Value of a parameter for one step.
+ */
+typedef struct nn_seq_lock {
+    uint8_t step;  ///< Step in the pattern.
+    uint8_t param; ///< Parameter, 0 to NN_SEQ_MAX_PARAMS - 1.
+    uint8_t value; ///< Value for this step.
+} nn_seq_lock;
+
+/**
+ * @struct nn_seq_pattern
+ * @brief A pattern.
+ */
+typedef struct nn_seq_pattern {
+    uint32_t steps[NN_SEQ_MAX_STEPS];
+    nn_seq_lock locks[NN_SEQ_MAX_LOCKS];
+    uint8_t lock_count;
+    uint8_t length;  ///< Number of steps, 1 to NN_SEQ_MAX_STEPS.
+    uint8_t swing;   ///< Position of the odd steps in a pair, 50 (straight)
+                     ///< to 75 percent.
+    uint8_t channel; ///< MIDI channel of the events.
+} nn_seq_pattern;
+
+/**
+ * @struct nn_seq_song
+ * @brief A list of patterns.
+ */
+typedef struct nn_seq_song {
+    uint8_t pattern[NN_SEQ_SONG_LEN]; ///< Pattern index.
+    uint8_t repeat[NN_SEQ_SONG_LEN];  ///< Number of times it plays, 1 or more.
+    uint8_t length;                   ///< Number of entries.
+} nn_seq_song;
+
+/**
+ * @brief Kinds of events.
+ */
+typedef enum nn_seq_event_kind {
+    NN_SEQ_NOTE_OFF,
+    NN_SEQ_NOTE_ON,
+    NN_SEQ_PARAM,     ///< Parameter lock of the step.
+    NN_SEQ_PARAM_END, ///< End of a parameter lock, restore the value.
+} nn_seq_event_kind;
+
+/**
+ * @struct nn_seq_event
+ * @brief Event at a frame of an audio block.
+ */
+typedef struct nn_seq_event {
+    uint16_t offset; ///< Frame offset in the block.
+    uint8_t kind;    ///< nn_seq_event_kind.
+    uint8_t channel; ///< MIDI channel of the pattern.
+    uint8_t a;       ///< Note or parameter.
+    uint8_t b;       ///< Velocity or parameter value.
+} nn_seq_event;
+
+/**
+ * @struct nn_seq
+ * @brief Sequencer state.
+ */
+typedef struct nn_seq {
+    midi_clock *clock;
+    uint32_t ticks_per_step;
+
+    const nn_seq_pattern *patterns;
+    uint32_t pattern_count;
+    const nn_seq_song *song; ///< NULL in pattern mode.
+
+    uint32_t pattern;       ///< Pattern playing.
+    int32_t next_pattern;   ///< Queued pattern, -1 for none.
+    uint32_t song_pos;      ///< Entry of the song playing.
+    uint32_t song_repeat;   ///< Repeats of the entry already played.
+    uint32_t pattern_start; ///< Step number of the start of the pattern.
+
+    uint64_t cursor;        ///< Position up to which the events are
+                            ///< returned.
+    uint64_t block_end;     ///< Position at the end of the previous block.
+    uint32_t next_step;     ///< Next step number to play.
+    uint32_t step_index;    ///< Last step played, in its pattern.
+    bool was_running;
+
+    struct {
+        uint64_t end;       ///< Note off position.
+        uint8_t note;
+        uint8_t channel;
+    } notes[NN_SEQ_MAX_NOTES];
+    uint32_t note_count;
+
+    uint32_t locked;        ///< Parameters locked by the previous step.
+    uint8_t locked_channel;
+    uint32_t random;
+} nn_seq;
+
+/**
+ * @brief Initializes a sequencer, in pattern mode on pattern 0
+ *
+ * @param seq Sequencer state
+ * @param clock Clock driving the sequencer
+ * @param patterns Pattern bank, can be modified while playing
+ * @param pattern_count Number of patterns in the bank
+ */
+void nn_seq_init(nn_seq *seq, midi_clock *clock,
+                 const nn_seq_pattern *patterns, uint32_t pattern_count);
+
+/**
+ * @brief Clears a pattern: no trig, 16 steps, straight, channel 0
+ *
+ * @param pat Pattern
+ */
+void nn_seq_pattern_clear(nn_seq_pattern *pat);
+
+/**
+ * @brief Sets or replaces a parameter lock
+ *
+ * @param pat Pattern
+ * @param step Step in the pattern
+ * @param param Parameter, 0 to NN_SEQ_MAX_PARAMS - 1
+ * @param value Value for this step
+ *
+ * @return true on success, false otherwise (invalid step or parameter, no
+ * free lock).
+ */
+bool nn_seq_set_lock(nn_seq_pattern *pat, uint32_t step, uint32_t param,
+                     uint8_t value);
+
+/**
+ * @brief Removes the parameter locks of a step
+ *
+ * @param pat Pattern
+ * @param step Step in the pattern
+ */
+void nn_seq_clear_locks(nn_seq_pattern *pat, uint32_t step);
+
+/**
+ * @brief Sets the step length (6 ticks, 16th notes, by default)
+ *
+ * @param seq Sequencer state
+ * @param ticks_per_step Ticks per step, 1 or more
+ */
+void nn_seq_set_step_length(nn_seq *seq, uint32_t ticks_per_step);
+
+/**
+ * @brief Queues a pattern, it plays when the current pattern ends
+ *
+ * @details Also leaves the song mode.
+ *
+ * @param seq Sequencer state
+ * @param pattern Index in the pattern bank
+ */
+void nn_seq_queue_pattern(nn_seq *seq, uint32_t pattern);
+
+/**
+ * @brief Plays a song, from its first entry at the next song start
+ *
+ * @param seq Sequencer state
+ * @param song Song, or NULL to go back to pattern mode
+ */
+void nn_seq_set_song(nn_seq *seq, const nn_seq_song *song);
+
+/**
+ * @brief Gets the step of the pattern playing
+ *
+ * @param seq Sequencer state
+ *
+ * @return Step in the pattern, e.g. for the step LEDs.
+ */
+uint32_t nn_seq_current_step(const nn_seq *seq);
+
+/**
+ * @brief Gets the events of an audio block
+ *
+ * @details Call it from the audio render path, once per block. Events are
+ * in order of offset. When the clock stops, notes are released at the start
+ * of the next block. Events that do not fit in the array are returned by the
+ * next call, at offset 0. The array holds at least NN_SEQ_MIN_EVENTS events.
+ *
+ * @param seq Sequencer state
+ * @param frame Audio frame of the start of the block
+ * @param len Block length in frames
+ * @param events Output array
+ * @param max_events Size of the output array, NN_SEQ_MIN_EVENTS or more
+ *
+ * @return Number of events, 0 if the array is too small.
+ */
+uint32_t nn_seq_render(nn_seq *seq, uint32_t frame, uint32_t len,
+                       nn_seq_event *events, uint32_t max_events);
+
+#ifdef __cplusplus
+}
+#endif
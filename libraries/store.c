@@ -0,0 +1,537 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/flash.h"
+#include "hardware/flash.h"
+#include "noise_nugget.h"
+#include "sample_stream.h"
+#include "store.h"
+
+#define SECTOR_CNT ((int)(NN_STORE_SIZE / FLASH_SECTOR_SIZE))
+
+#define SECTOR_MAGIC 0x564B4E4Eu // "NNKV"
+#define ERASED_WORD  0xFFFFFFFFu
+#define ERASED_HALF  0xFFFF
+#define DELETED_LEN  0xFFFE      // Record length of a deletion
+
+// Erased sectors kept for nn_store_compact(), saving cannot use them
+#define RESERVED_SECTORS 1
+
+#define FLASH_TIMEOUT_MS 100
+#define HEADROOM_TIMEOUT_US 10000
+#define HEADROOM_RETRIES 3
+
+/*
+ * Sector: sector header, then records until the first erased header.
+ * Record: record header, then the data padded to 4 bytes. The CRC covers the
+ * key, the length and the data.
+ */
+typedef struct sector_header {
+    uint32_t magic;
+    uint32_t seq; // Order of the sectors in the log
+} sector_header;
+
+typedef struct record_header {
+    uint16_t key;
+    uint16_t len;
+    uint32_t crc;
+} record_header;
+
+typedef enum sector_state {
+    SECTOR_ERASED,
+    SECTOR_USED,
+    SECTOR_DIRTY, // Not used and not erased
+} sector_state;
+
+// Offset in the store of the last record of each key, 0 for no value
+static uint32_t g_index[NN_STORE_MAX_KEYS];
+static uint8_t g_state[SECTOR_CNT];
+static int g_head = -1;      // Sector being written
+static int g_tail = -1;      // Oldest used sector
+static uint32_t g_head_off;  // Write offset in the head sector
+static uint32_t g_next_seq = 0;
+static bool g_ready = false;
+static bool g_compacting = false; // Audio glitches are accepted
+static nn_store_stats g_stats;
+
+// Page to program, in RAM
+static uint8_t g_page[FLASH_PAGE_SIZE] __attribute__((aligned(4)));
+
+typedef struct flash_op {
+    uint32_t flash_offs;
+    const uint8_t *data;
+} flash_op;
+
+static const uint8_t *flash_ptr(uint32_t off) {
+    return (const uint8_t *)(XIP_BASE + NN_STORE_FLASH_OFFSET + off);
+}
+
+static uint32_t record_size(uint32_t len) {
+    return (sizeof(record_header) + len + 3) & ~3u;
+}
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, uint32_t len) {
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static uint32_t record_crc(uint16_t key, uint16_t len, const uint8_t *data,
+                           uint32_t data_len) {
+    const uint8_t head[4] = {key & 0xFF, key >> 8, len & 0xFF, len >> 8};
+    return crc32_update(crc32_update(0, head, 4), data, data_len);
+}
+
+/*******************/
+/* Flash operations */
+/*******************/
+
+// Run with the flash unavailable for execution, must stay in RAM
+static void __no_inline_not_in_flash_func(do_program)(void *param) {
+    const flash_op *op = param;
+    flash_range_program(op->flash_offs, op->data, FLASH_PAGE_SIZE);
+}
+
+static void __no_inline_not_in_flash_func(do_erase)(void *param) {
+    const flash_op *op = param;
+    flash_range_erase(op->flash_offs, FLASH_SECTOR_SIZE);
+}
+
+// Whether the audio transfers are long enough for a page program
+static bool headroom_possible(void) {
+    const uint32_t frames = nn_audio_min_transfer_frames();
+    const uint32_t rate = nn_audio_clock_plan()->actual_rate;
+
+    return frames == 0 || rate == 0 ||
+        (uint64_t)frames * 1000000 >= (uint64_t)NN_STORE_PROGRAM_US * rate;
+}
+
+// Programs g_page, right after an audio output interrupt. Fails if there is
+// no room for it, except during a compaction.
+static bool program_page(uint32_t off) {
+    flash_op op = {NN_STORE_FLASH_OFFSET + off, g_page};
+
+    // Before waiting for the headroom, the chunk in progress may take some
+    nn_stream_pause();
+    bool headroom = false;
+    for (int i = 0; i < HEADROOM_RETRIES && !headroom; i++) {
+        headroom = nn_audio_wait_headroom(NN_STORE_PROGRAM_US,
+                                          HEADROOM_TIMEOUT_US);
+        g_stats.headroom_misses += !headroom;
+    }
+    if (!headroom && !g_compacting) {
+        nn_stream_resume();
+        return false;
+    }
+
+    const uint32_t start = time_us_32();
+    const int ret = flash_safe_execute(do_program, &op, FLASH_TIMEOUT_MS);
+    const uint32_t duration = time_us_32() - start;
+
+    nn_stream_resume();
+    if (ret != PICO_OK) {
+        return false;
+    }
+
+    g_stats.programs++;
+    if (duration > g_stats.max_program_us) {
+        g_stats.max_program_us = duration;
+    }
+    return true;
+}
+
+static bool erase_sector(int sector) {
+    flash_op op = {NN_STORE_FLASH_OFFSET + sector * FLASH_SECTOR_SIZE, NULL};
+
+    nn_stream_pause();
+    const int ret = flash_safe_execute(do_erase, &op, FLASH_TIMEOUT_MS);
+    nn_stream_resume();
+
+    if (ret != PICO_OK) {
+        return false;
+    }
+    g_stats.erases++;
+    g_state[sector] = SECTOR_ERASED;
+    return true;
+}
+
+// Programs a then b at off, page by page. The bytes around them in the pages
+// are left unchanged (0xFF does not clear any bit).
+static bool program_bytes(uint32_t off, const void *a, uint32_t a_len,
+                          const void *b, uint32_t b_len) {
+    const uint32_t total = a_len + b_len;
+    uint32_t done = 0;
+
+    while (done < total) {
+        const uint32_t pos = off + done;
+        const uint32_t page = pos & ~(FLASH_PAGE_SIZE - 1);
+        const uint32_t start = pos - page;
+        uint32_t n = FLASH_PAGE_SIZE - start;
+
+        if (n > total - done) {
+            n = total - done;
+        }
+
+        memset(g_page, 0xFF, FLASH_PAGE_SIZE);
+        for (uint32_t i = 0; i < n; i++) {
+            const uint32_t k = done + i;
+            g_page[start + i] = k < a_len
+                ? ((const uint8_t *)a)[k]
+                : ((const uint8_t *)b)[k - a_len];
+        }
+
+        if (!program_page(page)) {
+            return false;
+        }
+        done += n;
+    }
+    return true;
+}
+
+/*******/
+/* Log */
+/*******/
+
+static bool is_erased(uint32_t off, uint32_t len) {
+    const uint8_t *p = flash_ptr(off);
+
+    for (uint32_t i = 0; i < len; i++) {
+        if (p[i] != 0xFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint32_t erased_count(void) {
+    uint32_t count = 0;
+
+    for (int s = 0; s < SECTOR_CNT; s++) {
+        count += g_state[s] == SECTOR_ERASED;
+    }
+    return count;
+}
+
+typedef void (*record_fn)(uint32_t off, const record_header *h);
+
+// Calls fn for each valid record of a sector and sets end to the end of the
+// valid records. Returns false if the space after them is not erased.
+static bool scan_sector(int sector, record_fn fn, uint32_t *end) {
+    const uint32_t base = sector * FLASH_SECTOR_SIZE;
+    uint32_t off = sizeof(sector_header);
+
+    *end = off;
+    while (off + sizeof(record_header) <= FLASH_SECTOR_SIZE) {
+        const record_header *h = (const record_header *)flash_ptr(base + off);
+
+        if (h->key == ERASED_HALF && h->len == ERASED_HALF) {
+            // End of the log in this sector
+            return is_erased(base + off, FLASH_SECTOR_SIZE - off);
+        }
+
+        const uint32_t len = h->len == DELETED_LEN ? 0 : h->len;
+
+        if (h->key >= NN_STORE_MAX_KEYS || len > NN_STORE_MAX_VALUE ||
+            off + record_size(len) > FLASH_SECTOR_SIZE ||
+            h->crc != record_crc(h->key, h->len, (const uint8_t *)(h + 1), len))
+        {
+            // Interrupted write
+            return false;
+        }
+
+        if (fn != NULL) {
+            fn(base + off, h);
+        }
+        off += record_size(len);
+        *end = off;
+    }
+    return is_erased(base + off, FLASH_SECTOR_SIZE - off);
+}
+
+static void index_record(uint32_t off, const record_header *h) {
+    g_index[h->key] = h->len == DELETED_LEN ? 0 : off;
+}
+
+static bool open_sector(bool use_reserve) {
+    int next = 0;
+
+    if (g_head >= 0) {
+        next = (g_head + 1) % SECTOR_CNT;
+    } else {
+        while (next < SECTOR_CNT && g_state[next] != SECTOR_ERASED) {
+            next++;
+        }
+        if (next == SECTOR_CNT) {
+            return false;
+        }
+    }
+
+    if (g_state[next] != SECTOR_ERASED ||
+        (!use_reserve && erased_count() <= RESERVED_SECTORS)) {
+        return false;
+    }
+
+    const sector_header sh = {SECTOR_MAGIC, g_next_seq};
+    if (!program_bytes(next * FLASH_SECTOR_SIZE, &sh, sizeof(sh), NULL, 0)) {
+        g_state[next] = SECTOR_DIRTY;
+        return false;
+    }
+
+    g_state[next] = SECTOR_USED;
+    g_next_seq++;
+    g_head = next;
+    g_head_off = sizeof(sector_header);
+    if (g_tail < 0) {
+        g_tail = next;
+    }
+    return true;
+}
+
+// Appends a record, returns its offset or 0 on failure
+static uint32_t append(uint32_t key, uint16_t len, const uint8_t *data,
+                       bool use_reserve) {
+    const uint32_t data_len = len == DELETED_LEN ? 0 : len;
+    const uint32_t size = record_size(data_len);
+
+    if (g_head < 0 || g_head_off + size > FLASH_SECTOR_SIZE) {
+        if (!open_sector(use_reserve)) {
+            return 0;
+        }
+    }
+
+    const record_header h = {key, len, record_crc(key, len, data, data_len)};
+    const uint32_t off = g_head * FLASH_SECTOR_SIZE + g_head_off;
+
+    if (!program_bytes(off, &h, sizeof(h), data, data_len)) {
+        // Unknown state, do not write after it
+        g_head_off = FLASH_SECTOR_SIZE;
+        return 0;
+    }
+    g_head_off += size;
+    return off;
+}
+
+// Moves the last versions out of a sector
+static bool move_live_records(int sector) {
+    const uint32_t base = sector * FLASH_SECTOR_SIZE;
+    uint32_t end;
+    uint32_t off = sizeof(sector_header);
+
+    scan_sector(sector, NULL, &end);
+
+    while (off < end) {
+        const record_header *h = (const record_header *)flash_ptr(base + off);
+        const uint32_t len = h->len == DELETED_LEN ? 0 : h->len;
+
+        // Deletions are dropped, older versions are in this sector or before
+        if (g_index[h->key] == base + off) {
+            const uint32_t moved = append(h->key, h->len,
+                                          (const uint8_t *)(h + 1), true);
+            if (moved == 0) {
+                return false;
+            }
+            g_index[h->key] = moved;
+        }
+        off += record_size(len);
+    }
+    return true;
+}
+
+/*******/
+/* API */
+/*******/
+
+bool nn_store_init(void) {
+    uint32_t seq[SECTOR_CNT];
+    int order[SECTOR_CNT];
+    int used = 0;
+
+    memset(g_index, 0, sizeof(g_index));
+    memset(&g_stats, 0, sizeof(g_stats));
+    g_head = g_tail = -1;
+    g_next_seq = 0;
+
+    for (int s = 0; s < SECTOR_CNT; s++) {
+        const sector_header *sh =
+            (const sector_header *)flash_ptr(s * FLASH_SECTOR_SIZE);
+
+        if (sh->magic == SECTOR_MAGIC && sh->seq != ERASED_WORD) {
+            g_state[s] = SECTOR_USED;
+            seq[s] = sh->seq;
+
+            // Sorted by sequence number
+            int i = used++;
+            while (i > 0 && seq[order[i - 1]] > seq[s]) {
+                order[i] = order[i - 1];
+                i--;
+            }
+            order[i] = s;
+        } else if (is_erased(s * FLASH_SECTOR_SIZE, FLASH_SECTOR_SIZE)) {
+            g_state[s] = SECTOR_ERASED;
+        } else {
+            g_state[s] = SECTOR_DIRTY;
+        }
+    }
+
+    for (int i = 0; i < used; i++) {
+        if (!scan_sector(order[i], index_record, &g_head_off)) {
+            // Do not write after an interrupted write
+            g_head_off = FLASH_SECTOR_SIZE;
+        }
+    }
+    if (used > 0) {
+        g_tail = order[0];
+        g_head = order[used - 1];
+        g_next_seq = seq[g_head] + 1;
+    }
+    g_ready = true;
+
+    if (erased_count() < SECTOR_CNT / 4 || erased_count() + used < SECTOR_CNT) {
+        return nn_store_compact();
+    }
+    return true;
+}
+
+bool nn_store_save(uint32_t key, const void *data, uint32_t len) {
+    if (!g_ready || key >= NN_STORE_MAX_KEYS || len > NN_STORE_MAX_VALUE) {
+        return false;
+    }
+    if (!headroom_possible()) {
+        // Fail before writing anything, the record would be cut
+        g_stats.headroom_misses++;
+        return false;
+    }
+
+    const uint32_t off = append(key, len, data, false);
+    if (off == 0) {
+        return false;
+    }
+    g_index[key] = off;
+    return true;
+}
+
+bool nn_store_delete(uint32_t key) {
+    if (!g_ready || key >= NN_STORE_MAX_KEYS) {
+        return false;
+    }
+    if (g_index[key] == 0) {
+        return true;
+    }
+    if (!headroom_possible()) {
+        g_stats.headroom_misses++;
+        return false;
+    }
+
+    // A deletion can use the reserve, or a full store could not be freed
+    if (append(key, DELETED_LEN, NULL, true) == 0) {
+        return false;
+    }
+    g_index[key] = 0;
+    return true;
+}
+
+const void *nn_store_get(uint32_t key, uint32_t *len) {
+    if (!g_ready || key >= NN_STORE_MAX_KEYS || g_index[key] == 0) {
+        return NULL;
+    }
+
+    const record_header *h = (const record_header *)flash_ptr(g_index[key]);
+    if (len != NULL) {
+        *len = h->len;
+    }
+    return h + 1;
+}
+
+int32_t nn_store_load(uint32_t key, void *data, uint32_t max_len) {
+    uint32_t len;
+    const void *value = nn_store_get(key, &len);
+
+    if (value == NULL) {
+        return -1;
+    }
+    memcpy(data, value, len < max_len ? len : max_len);
+    return len;
+}
+
+static bool compact(void) {
+    for (int s = 0; s < SECTOR_CNT; s++) {
+        if (g_state[s] == SECTOR_DIRTY && !erase_sector(s)) {
+            return false;
+        }
+    }
+
+    // Each used sector is moved at most once
+    for (int n = SECTOR_CNT; n > 0; n--) {
+        if (g_tail < 0 || g_tail == g_head ||
+            erased_count() >= SECTOR_CNT / 2) {
+            break;
+        }
+
+        const int sector = g_tail;
+        if (!move_live_records(sector) || !erase_sector(sector)) {
+            return false;
+        }
+
+        do {
+            g_tail = (g_tail + 1) % SECTOR_CNT;
+        } while (g_state[g_tail] != SECTOR_USED);
+    }
+    return true;
+}
+
+bool nn_store_compact(void) {
+    if (!g_ready) {
+        return false;
+    }
+
+    g_compacting = true;
+    const bool ok = compact();
+    g_compacting = false;
+    return ok;
+}
+
+void nn_store_get_stats(nn_store_stats *stats) {
+    const uint32_t capacity = FLASH_SECTOR_SIZE - sizeof(sector_header);
+    uint32_t used = 0;
+
+    *stats = g_stats;
+    stats->keys = 0;
+    stats->live_bytes = 0;
+
+    for (int k = 0; k < NN_STORE_MAX_KEYS; k++) {
+        if (g_index[k] != 0) {
+            const record_header *h =
+                (const record_header *)flash_ptr(g_index[k]);
+            stats->keys++;
+            stats->live_bytes += record_size(h->len);
+        }
+    }
+
+    for (int s = 0; s < SECTOR_CNT; s++) {
+        used += g_state[s] == SECTOR_USED;
+    }
+
+    stats->erased_sectors = erased_count();
+    stats->log_bytes = 0;
+    stats->free_bytes = 0;
+    if (used > 0) {
+        stats->log_bytes = (used - 1) * capacity + g_head_off -
+            sizeof(sector_header);
+        stats->free_bytes = FLASH_SECTOR_SIZE - g_head_off;
+    }
+    if (stats->erased_sectors > RESERVED_SECTORS) {
+        stats->free_bytes +=
+            (stats->erased_sectors - RESERVED_SECTORS) * capacity;
+    }
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2024 Fabien Chouteau @ Wee Noise Makers
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file store.h
+ * @brief Wear-levelled key-value store in flash, for presets and patterns.
+ *
+ * The store is a log in a flash region after the program (the linker script
+ * limits the program to the first 12MB). Saving a value appends a record
+ * (key, length, CRC, data) at the end of the log, the previous version
+ * becomes garbage. Sectors are used in a circle, so the erases are spread
+ * over the whole region.
+ *
+ * A RAM index gives the flash address of the last version of each key:
+ * loading is a lookup and a copy from the memory mapped flash, or no copy at
+ * all with nn_store_get().
+ *
+ * Flash operations stall the execution from flash on both cores, with the
+ * interrupts disabled (flash_safe_execute(), the other core must have called
+ * flash_safe_execute_core_init() if it is running):
+ *
+ * - Saving only programs pages, one at a time (< 1 ms each), each one placed
+ *   just after an audio output interrupt (nn_audio_wait_headroom()) so that it
+ *   never delays the next one. The code running during the operation is in
+ *   RAM. Saving fails when the audio transfers are shorter than
+ *   NN_STORE_PROGRAM_US, or when the time is not found in a few attempts.
+ * - Erasing a sector takes tens of milliseconds and cannot fit between two
+ *   audio interrupts. Erases are only done by nn_store_init() and
+ *   nn_store_compact(), call them when an audio glitch is acceptable (boot,
+ *   muted output). Saving fails when the erased sectors are used up.
+ *
+ * The DMA of the sample streamer (sample_stream.h) must not read the flash
+ * during an operation: each one is placed between nn_stream_pause() and
+ * nn_stream_resume(). Other DMA reads of the flash (e.g. audio buffers in
+ * flash returned by the callbacks) must be stopped by the application. The
+ * silence that the audio output plays on gaps is in RAM.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Offset of the store in flash, the end of the program area.
+ */
+#ifndef NN_STORE_FLASH_OFFSET
+#define NN_STORE_FLASH_OFFSET (12 * 1024 * 1024)
+#endif
+
+/**
+ * @brief Size of the store in flash, a multiple of the 4kB sector size.
+ */
+#ifndef NN_STORE_SIZE
+#define NN_STORE_SIZE (256 * 1024)
+#endif
+
+/**
+ * @brief Number of keys, from 0 to NN_STORE_MAX_KEYS - 1.
+ */
+#ifndef NN_STORE_MAX_KEYS
+#define NN_STORE_MAX_KEYS 256
+#endif
+
+/**
+ * @brief Maximum size of a value in bytes.
+ */
+#ifndef NN_STORE_MAX_VALUE
+#define NN_STORE_MAX_VALUE 2048
+#endif
+
+/**
+ * @brief Time reserved for a page program, see nn_audio_wait_headroom().
+ */
+#ifndef NN_STORE_PROGRAM_US
+#define NN_STORE_PROGRAM_US 1000
+#endif
+
+/**
+ * @struct nn_store_stats
+ * @brief Store usage.
+ */
+typedef struct nn_store_stats {
+    uint32_t keys;           ///< Keys with a value.
+    uint32_t live_bytes;     ///< Size of the last version of each key.
+    uint32_t log_bytes;      ///< Size of the log, including garbage.
+    uint32_t free_bytes;     ///< Space available for saving.
+    uint32_t erased_sectors; ///< Sectors ready for writing.
+    uint32_t erases;         ///< Sector erases since the init.
+    uint32_t programs;       ///< Page programs since the init.
+    uint32_t max_program_us; ///< Longest page program.
+    uint32_t headroom_misses;///< Headroom waits that timed out, and saves or
+                             ///< deletes refused for short audio transfers.
+} nn_store_stats;
+
+/**
+ * @brief Loads the index and prepares the store
+ *
+ * @details Scans the flash region to build the index, erases the sectors
+ * that were not completely erased (power loss) and compacts the log when
+ * few erased sectors are left. Can stall for some time, call it at boot.
+ *
+ * @return true on success, false otherwise.
+ */
+bool nn_store_init(void);
+
+/**
+ * @brief Saves a value
+ *
+ * @param key Key, from 0 to NN_STORE_MAX_KEYS - 1
+ * @param data Value
+ * @param len Size of the value in bytes, up to NN_STORE_MAX_VALUE
+ *
+ * @return true on success, false otherwise (invalid key or size, no space
+ * left: call nn_store_compact(), no time between the audio interrupts: see
+ * headroom_misses in nn_store_get_stats()).
+ */
+bool nn_store_save(uint32_t key, const void *data, uint32_t len);
+
+/**
+ * @brief Deletes a value
+ *
+ * @param key Key, from 0 to NN_STORE_MAX_KEYS - 1
+ *
+ * @details Works on a full store, using the space kept for nn_store_compact(),
+ * which then gives the space of the deleted values back.
+ *
+ * @return true on success (including when there is no value), false
+ * otherwise.
+ */
+bool nn_store_delete(uint32_t key);
+
+/**
+ * @brief Gets a value in place
+ *
+ * @param key Key, from 0 to NN_STORE_MAX_KEYS - 1
+ * @param len Output size of the value, can be NULL
+ *
+ * @return Address of the value in the memory mapped flash, valid until the
+ * next nn_store_compact(), or NULL if the key has no value.
+ */
+const void *nn_store_get(uint32_t key, uint32_t *len);
+
+/**
+ * @brief Loads a value
+ *
+ * @param key Key, from 0 to NN_STORE_MAX_KEYS - 1
+ * @param data Output buffer
+ * @param max_len Size of the buffer
+ *
+ * @return Size of the value (only max_len bytes are copied if it is larger),
+ * -1 if the key has no value.
+ */
+int32_t nn_store_load(uint32_t key, void *data, uint32_t max_len);
+
+/**
+ * @brief Removes the garbage from the log
+ *
+ * @details Moves the last versions out of the oldest sectors and erases them
+ * until at least half of the sectors are erased, or all the garbage is
+ * removed. Stalls for tens of milliseconds per erased sector, the audio
+ * output glitches. The pages are programmed even when the audio leaves no
+ * time for them.
+ *
+ * @return true on success, false otherwise.
+ */
+bool nn_store_compact(void);
+
+/**
+ * @brief Gets the store usage
+ *
+ * @param stats Output statistics
+ */
+void nn_store_get_stats(nn_store_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif